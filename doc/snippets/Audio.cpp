@@ -29,10 +29,13 @@
 #define CORRADE_STATIC_PLUGIN
 
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/Manager.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 #include "Magnum/Audio/Context.h"
 #include "Magnum/Audio/Extensions.h"
+#include "Magnum/Math/Functions.h"
 
 using namespace Magnum;
 
@@ -61,6 +64,19 @@ CORRADE_PLUGIN_REGISTER(MyAudioImporter, MyNamespace::MyAudioImporter,
    avoid -Wmisssing-prototypes */
 void mainAudio();
 void mainAudio() {
+{
+PluginManager::Manager<Audio::AbstractImporter> manager;
+Containers::Pointer<Audio::AbstractImporter> importer = manager.loadAndInstantiate("AnyAudioImporter");
+/* [AbstractImporter-streaming] */
+importer->openFile("ambience.wav");
+for(std::size_t offset = 0; offset < importer->frameCount(); offset += 4096) {
+    Containers::Array<char> chunk = importer->frames(offset,
+        Math::min(std::size_t{4096}, importer->frameCount() - offset));
+    // queue the chunk for playback ...
+}
+/* [AbstractImporter-streaming] */
+}
+
 {
 /* [Context-isExtensionSupported] */
 if(Audio::Context::current().isExtensionSupported<Audio::Extensions::ALC::SOFTX::HRTF>()) {
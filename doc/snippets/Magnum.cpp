@@ -28,9 +28,13 @@
 
 #include "Magnum/Math/Color.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/Range.h"
 #include "Magnum/Image.h"
+#include "Magnum/ImageTransformation.h"
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/PixelFormatConversion.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/VertexFormat.h"
 #ifdef MAGNUM_TARGET_GL
 #include "Magnum/GL/AbstractShaderProgram.h"
@@ -394,4 +398,67 @@ PixelFormat rgbFormat = pixelFormat(
 static_cast<void>(rgbFormat);
 }
 
+{
+Containers::ArrayView<Vector3> positions;
+Matrix4 transformation;
+/* [ThreadPool-usage] */
+ThreadPool::global().parallelFor(positions.size(), 1024,
+    [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            positions[i] = transformation.transformPoint(positions[i]);
+    });
+/* [ThreadPool-usage] */
+}
+
+{
+Containers::ArrayView<const Vector3> positions;
+/* [ThreadPool-usage-thread] */
+ThreadPool& pool = ThreadPool::global();
+
+/* Per-thread bounds, merged at the end */
+Containers::Array<Range3D> bounds{DirectInit, pool.threadCount(),
+    Range3D{Vector3{Constants::inf()}, Vector3{-Constants::inf()}}};
+pool.parallelFor(positions.size(), 1024,
+    [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+        for(std::size_t i = begin; i != end; ++i)
+            bounds[thread] = Math::join(bounds[thread], positions[i]);
+    });
+/* [ThreadPool-usage-thread] */
+}
+
+{
+Containers::ArrayView<const Float> values;
+/* [ThreadPool-usage-reduce] */
+Double sum = ThreadPool::global().parallelReduce(values.size(), 4096, 0.0,
+    [&](std::size_t begin, std::size_t end) {
+        Double sum = 0.0;
+        for(std::size_t i = begin; i != end; ++i)
+            sum += values[i];
+        return sum;
+    },
+    [](Double a, Double b) { return a + b; });
+/* [ThreadPool-usage-reduce] */
+static_cast<void>(sum);
+}
+
+{
+/* [convertPixelFormat] */
+/* BGRA data, for example from a TGA file */
+ImageView2D bgra = DOXYGEN_ELLIPSIS(ImageView2D{PixelFormat::RGBA8Unorm, {}});
+
+/* Convert to RGB half-floats, dropping the alpha channel */
+Image2D rgb = convertPixelFormat(bgra, PixelFormat::RGB16F, {2, 1, 0, 3});
+/* [convertPixelFormat] */
+}
+
+{
+/* [yFlipInPlace] */
+/* Data from a file that stores rows top-down, while Magnum expects them
+   bottom-up */
+Image2D image = DOXYGEN_ELLIPSIS(Image2D{PixelFormat::RGBA8Unorm});
+
+yFlipInPlace(image);
+/* [yFlipInPlace] */
+}
+
 }
@@ -29,14 +29,17 @@
 #include <Corrade/Containers/BitArrayView.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/Triple.h>
 
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Transform.h"
+#include "Magnum/SceneTools/Combine.h"
 #include "Magnum/SceneTools/Filter.h"
 #include "Magnum/SceneTools/Hierarchy.h"
+#include "Magnum/SceneTools/LevelOfDetail.h"
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -103,6 +106,22 @@ for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
 
 Trade::MeshData concatenated = MeshTools::concatenate(flattenedMeshes);
 /* [absoluteFieldTransformations3D-mesh-concatenate] */
+} {
+Trade::SceneData scene = DOXYGEN_ELLIPSIS(Trade::SceneData{{}, 0, nullptr, {}});
+Containers::Array<Trade::MeshData> meshes = DOXYGEN_ELLIPSIS({});
+/* [absoluteFieldTransformations3D-mesh-concatenateTransformed3D] */
+Containers::Array<Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>>
+    meshesMaterials = scene.meshesMaterialsAsArray();
+Containers::Array<Matrix4> transformations =
+    SceneTools::absoluteFieldTransformations3D(scene, Trade::SceneField::Mesh);
+
+/* Use all available cores */
+Trade::MeshData concatenated = MeshTools::concatenateTransformed3D(meshes,
+    stridedArrayView(meshesMaterials)
+        .slice(&Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>::second)
+        .slice(&Containers::Pair<UnsignedInt, Int>::first),
+    transformations, 0);
+/* [absoluteFieldTransformations3D-mesh-concatenateTransformed3D] */
 }
 
 {
@@ -167,4 +186,52 @@ for(const Containers::Pair<UnsignedInt, Int>& parent:
 }
 /* [parentsBreadthFirst-transformations] */
 }
+
+{
+/* [selectLevelOfDetail-fields] */
+constexpr Trade::SceneField SceneFieldLodMesh = Trade::sceneFieldCustom(0);
+constexpr Trade::SceneField SceneFieldLodScreenSize = Trade::sceneFieldCustom(1);
+
+/* Object 3 has three levels, object 7 just two, and gets culled when it's
+   smaller than 5% of the viewport height */
+const struct Lod {
+    UnsignedInt object;
+    UnsignedInt mesh;
+    Float screenSize;
+} lods[]{
+    {3, 0, 0.5f},
+    {3, 1, 0.1f},
+    {3, 2, 0.0f},
+    {7, 4, 0.25f},
+    {7, 5, 0.05f},
+};
+Containers::StridedArrayView1D<const Lod> view = lods;
+
+Trade::SceneData scene = SceneTools::combineFields(
+    Trade::SceneMappingType::UnsignedInt, 8, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            view.slice(&Lod::object), view.slice(&Lod::mesh)},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            view.slice(&Lod::object), view.slice(&Lod::screenSize)},
+        DOXYGEN_ELLIPSIS()
+    });
+/* [selectLevelOfDetail-fields] */
+
+/* [selectLevelOfDetail] */
+Containers::Array<Matrix4> transformations =
+    SceneTools::absoluteFieldTransformations3D(scene, SceneFieldLodMesh);
+Containers::Array<UnsignedInt> meshes{NoInit, std::size_t(scene.mappingBound())};
+
+/* Every frame */
+Matrix4 camera = DOXYGEN_ELLIPSIS({});
+Matrix4 projection = DOXYGEN_ELLIPSIS({});
+SceneTools::selectLevelOfDetailInto(scene,
+    SceneFieldLodMesh, SceneFieldLodScreenSize, transformations,
+    camera, projection, meshes);
+for(UnsignedInt object = 0; object != meshes.size(); ++object) {
+    if(meshes[object] == ~UnsignedInt{}) continue;
+    DOXYGEN_ELLIPSIS()
+}
+/* [selectLevelOfDetail] */
+}
 }
@@ -39,6 +39,8 @@
 #include "Magnum/Math/Range.h"
 #include "Magnum/MeshTools/Transform.h"
 #include "Magnum/TextureTools/Atlas.h"
+#include "Magnum/TextureTools/Decompress.h"
+#include "Magnum/TextureTools/Resample.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -176,6 +178,36 @@ MeshTools::transformTextureCoordinates2DInPlace(mesh, matrix);
 /* [atlasTextureCoordinateTransformation-meshdata] */
 }
 
+{
+/* [generateMipmaps] */
+Image2D image = DOXYGEN_ELLIPSIS(Image2D{PixelFormat::RGBA8Srgb});
+
+/* Level 1 is half the size of the image, the last one is 1x1 */
+Containers::Array<Image2D> levels =
+    TextureTools::generateMipmaps(image, TextureTools::ResampleFilter::Kaiser);
+/* [generateMipmaps] */
+}
+
+{
+/* [resize] */
+Image2D image = DOXYGEN_ELLIPSIS(Image2D{PixelFormat::RGBA8Srgb});
+
+Image2D resized = TextureTools::resize(image, {512, 512},
+    TextureTools::ResampleFilter::Lanczos);
+/* [resize] */
+}
+
+{
+/* [decompress] */
+CompressedImageView2D image = DOXYGEN_ELLIPSIS(CompressedImageView2D{CompressedPixelFormat::Bc1RGBAUnorm, {}, nullptr});
+
+if(TextureTools::isDecompressionSupported(image.format())) {
+    Image2D decompressed = TextureTools::decompress(image);
+    DOXYGEN_ELLIPSIS(static_cast<void>(decompressed));
+}
+/* [decompress] */
+}
+
 {
 Matrix3 matrix;
 /* [atlasTextureCoordinateTransformation-materialdata] */
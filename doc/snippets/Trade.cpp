@@ -30,6 +30,7 @@
 
 #include <unordered_map>
 #include <Corrade/Containers/ArrayTuple.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
@@ -50,11 +51,15 @@
 #include "Magnum/MeshTools/Interleave.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Transform.h"
+#include "Magnum/Trade/AbstractAllocator.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
 #include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ArenaAllocator.h"
+#include "Magnum/Trade/AsyncImporter.h"
 #include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterCache.h"
 #include "Magnum/Trade/LightData.h"
 #include "Magnum/Trade/MaterialData.h"
 #include "Magnum/Trade/MeshData.h"
@@ -304,6 +309,94 @@ void doOpenData(Containers::Array<char>&& data, Trade::DataFlags dataFlags) over
 } importer;
 }
 
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+/* [AsyncImporter-usage] */
+Containers::Pointer<Trade::AbstractImporter> importer =
+    manager.loadAndInstantiate("AnySceneImporter");
+if(!importer || !importer->openFile("scene.gltf"))
+    Fatal{} << "Can't open scene.gltf with AnySceneImporter";
+
+Trade::AsyncImporter asyncImporter{Utility::move(importer)};
+
+/* The mesh closest to the camera is needed first */
+Trade::AsyncImporter::Ticket distant = asyncImporter.requestMesh(0);
+Trade::AsyncImporter::Ticket closest = asyncImporter.requestMesh(1, 0, 10);
+
+// render a frame or do other work meanwhile ...
+
+if(asyncImporter.status(closest) == Trade::AsyncImportStatus::Finished) {
+    Containers::Optional<Trade::MeshData> mesh = asyncImporter.takeMesh(closest);
+    // use the mesh ...
+}
+
+/* The distant mesh isn't needed anymore */
+asyncImporter.release(distant);
+/* [AsyncImporter-usage] */
+}
+
+{
+PluginManager::Manager<Trade::AbstractImporter> manager;
+/* [AsyncImporter-multiple] */
+Containers::Array<Containers::Pointer<Trade::AbstractImporter>> importers;
+for(std::size_t i = 0; i != 4; ++i) {
+    Containers::Pointer<Trade::AbstractImporter> importer =
+        manager.loadAndInstantiate("AnySceneImporter");
+    if(!importer || !importer->openFile("scene.gltf"))
+        Fatal{} << "Can't open scene.gltf with AnySceneImporter";
+    arrayAppend(importers, Utility::move(importer));
+}
+
+Trade::AsyncImporter asyncImporter{Utility::move(importers)};
+/* [AsyncImporter-multiple] */
+}
+
+{
+/* [ImporterCache-usage] */
+PluginManager::Manager<Trade::AbstractImporter> importerManager;
+PluginManager::Manager<Trade::AbstractSceneConverter> converterManager;
+Trade::ImporterCache cache{importerManager, converterManager, "cache/"};
+
+Containers::Pointer<Trade::AbstractImporter> importer =
+    cache.openFile(importerManager.loadAndInstantiate("AnySceneImporter"),
+        "scene.gltf");
+if(!importer)
+    Fatal{} << "Can't open scene.gltf";
+
+/* Served from cache/ on subsequent runs */
+Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+/* [ImporterCache-usage] */
+}
+
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [AbstractAllocator-usage] */
+Trade::ArenaAllocator arena;
+importer->setAllocator(&arena);
+
+/* Both the imported mesh and the processed copy end up in the arena */
+Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+Trade::MeshData deduplicated = MeshTools::removeDuplicates(*mesh);
+arena.relocate(deduplicated);
+/* [AbstractAllocator-usage] */
+}
+
+{
+Containers::Pointer<Trade::AbstractImporter> importer;
+/* [ArenaAllocator-usage] */
+Trade::ArenaAllocator arena;
+importer->setAllocator(&arena);
+
+for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+    Containers::Optional<Trade::MeshData> mesh = importer->mesh(i);
+    // upload the mesh to the GPU and discard it
+}
+
+/* All data are gone, reuse the memory for the next file */
+arena.reset();
+/* [ArenaAllocator-usage] */
+}
+
 {
 /* [AbstractSceneConverter-usage-mesh-file] */
 PluginManager::Manager<Trade::AbstractSceneConverter> manager;
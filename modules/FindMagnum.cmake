@@ -85,6 +85,8 @@
 #  WglContext                   - WGL context
 #  OpenGLTester                 - OpenGLTester class
 #  VulkanTester                 - VulkanTester class
+#  MagnumImporter               - Magnum binary blob importer plugin
+#  MagnumSceneConverter         - Magnum binary blob scene converter plugin
 #  ObjImporter                  - OBJ importer plugin
 #  TgaImageConverter            - TGA image converter plugin
 #  TgaImporter                  - TGA importer plugin
@@ -397,6 +399,15 @@ if(NOT TARGET Magnum::Magnum)
     # Dependent libraries
     set_property(TARGET Magnum::Magnum APPEND PROPERTY INTERFACE_LINK_LIBRARIES
          Corrade::Utility)
+
+    # Threads::Threads is a PRIVATE dependency of the library, needed by
+    # ThreadPool, which only matters when linking statically
+    if(MAGNUM_BUILD_STATIC)
+        set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+        find_package(Threads REQUIRED)
+        set_property(TARGET Magnum::Magnum APPEND PROPERTY
+            INTERFACE_LINK_LIBRARIES Threads::Threads)
+    endif()
 else()
     set(MAGNUM_LIBRARY Magnum::Magnum)
 endif()
@@ -413,8 +424,8 @@ set(_MAGNUM_LIBRARY_COMPONENTS_ALWAYS_STATIC
     OpenGLTester)
 set(_MAGNUM_PLUGIN_COMPONENTS
     AnyAudioImporter AnyImageConverter AnyImageImporter AnySceneConverter
-    AnySceneImporter ObjImporter TgaImageConverter TgaImporter
-    WavAudioImporter)
+    AnySceneImporter MagnumImporter MagnumSceneConverter ObjImporter
+    TgaImageConverter TgaImporter WavAudioImporter)
 set(_MAGNUM_EXECUTABLE_COMPONENTS
     imageconverter sceneconverter shaderconverter gl-info al-info)
 # Audio and Vk libs aren't enabled by default, and none of the Context,
@@ -1102,7 +1113,17 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for Shaders library
         # No special setup for Text library
         # No special setup for TextureTools library
-        # No special setup for Trade library
+
+        # Trade library
+        elseif(_component STREQUAL Trade)
+            # Threads::Threads is a PRIVATE dependency of the library, which
+            # only matters when linking statically
+            if(MAGNUM_BUILD_STATIC)
+                set(THREADS_PREFER_PTHREAD_FLAG TRUE)
+                find_package(Threads REQUIRED)
+                set_property(TARGET Magnum::${_component} APPEND PROPERTY
+                    INTERFACE_LINK_LIBRARIES Threads::Threads)
+            endif()
 
         # Vk library
         elseif(_component STREQUAL Vk)
@@ -1115,6 +1136,8 @@ foreach(_component ${Magnum_FIND_COMPONENTS})
         # No special setup for AnyImageConverter plugin
         # No special setup for AnyImageImporter plugin
         # No special setup for AnySceneImporter plugin
+        # No special setup for MagnumImporter plugin
+        # No special setup for MagnumSceneConverter plugin
         # No special setup for ObjImporter plugin
         # No special setup for TgaImageConverter plugin
         # No special setup for TgaImporter plugin
@@ -139,6 +139,36 @@ Containers::Array<char> AbstractImporter::data() {
     return out;
 }
 
+std::size_t AbstractImporter::frameCount() const {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::frameCount(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frameCount(): no file opened", {});
+    return doFrameCount();
+}
+
+std::size_t AbstractImporter::doFrameCount() const {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::frameCount(): feature advertised but not implemented", {});
+}
+
+Containers::Array<char> AbstractImporter::frames(const std::size_t offset, const std::size_t count) {
+    CORRADE_ASSERT(features() & ImporterFeature::Streaming,
+        "Audio::AbstractImporter::frames(): feature not supported", {});
+    CORRADE_ASSERT(isOpened(), "Audio::AbstractImporter::frames(): no file opened", {});
+    #ifndef CORRADE_NO_ASSERT
+    const std::size_t frameCount = doFrameCount();
+    #endif
+    CORRADE_ASSERT(offset <= frameCount && count <= frameCount - offset,
+        "Audio::AbstractImporter::frames(): range [" << Debug::nospace << offset << Debug::nospace << "," << offset + count << Debug::nospace << ") out of bounds for" << frameCount << "frames", {});
+
+    Containers::Array<char> out = doFrames(offset, count);
+    CORRADE_ASSERT(!out.deleter(), "Audio::AbstractImporter::frames(): implementation is not allowed to use a custom Array deleter", {});
+    return out;
+}
+
+Containers::Array<char> AbstractImporter::doFrames(std::size_t, std::size_t) {
+    CORRADE_ASSERT_UNREACHABLE("Audio::AbstractImporter::frames(): feature advertised but not implemented", {});
+}
+
 Debug& operator<<(Debug& debug, const ImporterFeature value) {
     const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
 
@@ -149,6 +179,7 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
         /* LCOV_EXCL_START */
         #define _c(v) case ImporterFeature::v: return debug << (packed ? "" : "::") << Debug::nospace << #v;
         _c(OpenData)
+        _c(Streaming)
         #undef _c
         /* LCOV_EXCL_STOP */
     }
@@ -158,7 +189,8 @@ Debug& operator<<(Debug& debug, const ImporterFeature value) {
 
 Debug& operator<<(Debug& debug, const ImporterFeatures value) {
     return Containers::enumSetDebugOutput(debug, value, debug.immediateFlags() >= Debug::Flag::Packed ? "{}" : "Audio::ImporterFeatures{}", {
-        ImporterFeature::OpenData});
+        ImporterFeature::OpenData,
+        ImporterFeature::Streaming});
 }
 
 }}
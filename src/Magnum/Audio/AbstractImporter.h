@@ -50,7 +50,14 @@ namespace Magnum { namespace Audio {
 */
 enum class ImporterFeature: UnsignedByte {
     /** Opening files from raw data using @ref AbstractImporter::openData() */
-    OpenData = 1 << 0
+    OpenData = 1 << 0,
+
+    /**
+     * Reading the data in chunks using @ref AbstractImporter::frameCount()
+     * and @ref AbstractImporter::frames()
+     * @m_since_latest
+     */
+    Streaming = 1 << 1
 };
 
 /**
@@ -85,11 +92,23 @@ around in order to have the returned data valid. Moreover, all returned
 deleters --- this is to avoid potential dangling function pointer calls when
 destructing such instances after the plugin module has been unloaded.
 
+@section Audio-AbstractImporter-streaming Streaming
+
+If the importer advertises @ref ImporterFeature::Streaming, the data can be
+read in chunks of a given frame count instead of all at once, which is useful
+for long tracks that would otherwise need a lot of memory. A frame is a single
+sample for each channel, the data returned from @ref frames() have the same
+layout as if the corresponding range was taken from @ref data():
+
+@snippet Audio.cpp AbstractImporter-streaming
+
 @section Audio-AbstractImporter-subclassing Subclassing
 
 Plugin implements function @ref doFeatures(), @ref doIsOpened(), one of or both
 @ref doOpenData() and @ref doOpenFile() functions, function @ref doClose() and
 data access functions @ref doFormat(), @ref doFrequency() and @ref doData().
+If @ref ImporterFeature::Streaming is supported, the plugin implements also
+@ref doFrameCount() and @ref doFrames().
 
 You don't need to do most of the redundant sanity checks, these things are
 checked by the implementation:
@@ -99,6 +118,9 @@ checked by the implementation:
     is any file opened.
 -   Function @ref doOpenData() is called only if @ref ImporterFeature::OpenData
     is supported.
+-   Functions @ref doFrameCount() and @ref doFrames() are called only if
+    @ref ImporterFeature::Streaming is supported. The range passed to
+    @ref doFrames() is checked to be in bounds.
 -   All `do*()` implementations working on opened file are called only if
     there is any file opened.
 
@@ -205,6 +227,28 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
         /** @brief Sample data */
         Containers::Array<char> data();
 
+        /**
+         * @brief Frame count
+         * @m_since_latest
+         *
+         * A frame is a single sample for each channel. Available only if
+         * @ref ImporterFeature::Streaming is supported.
+         * @see @ref features(), @ref frames()
+         */
+        std::size_t frameCount() const;
+
+        /**
+         * @brief Sample data for a range of frames
+         * @m_since_latest
+         *
+         * Returns @p count frames starting at frame @p offset, in the same
+         * layout as @ref data(). Available only if
+         * @ref ImporterFeature::Streaming is supported. Expects that
+         * @cpp offset + count @ce is not larger than @ref frameCount().
+         * @see @ref features()
+         */
+        Containers::Array<char> frames(std::size_t offset, std::size_t count);
+
         /* Since 1.8.17, the original short-hand group closing doesn't work
            anymore. FFS. */
         /**
@@ -241,6 +285,18 @@ class MAGNUM_AUDIO_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         /** @brief Implementation for @ref data() */
         virtual Containers::Array<char> doData() = 0;
+
+        /**
+         * @brief Implementation for @ref frameCount()
+         * @m_since_latest
+         */
+        virtual std::size_t doFrameCount() const;
+
+        /**
+         * @brief Implementation for @ref frames()
+         * @m_since_latest
+         */
+        virtual Containers::Array<char> doFrames(std::size_t offset, std::size_t count);
 };
 
 /**
@@ -261,7 +317,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_AUDIO_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Audio.AbstractImporter/0.1.1"
+"cz.mosra.magnum.Audio.AbstractImporter/0.1.2"
 /* [interface] */
 
 }}
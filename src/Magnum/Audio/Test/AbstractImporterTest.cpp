@@ -64,6 +64,13 @@ struct AbstractImporterTest: TestSuite::Tester {
     void dataNoFile();
     void dataCustomDeleter();
 
+    void frames();
+    void framesNotSupported();
+    void framesNotImplemented();
+    void framesNoFile();
+    void framesOutOfRange();
+    void framesCustomDeleter();
+
     void debugFeature();
     void debugFeaturePacked();
     void debugFeatures();
@@ -91,6 +98,13 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::dataNoFile,
               &AbstractImporterTest::dataCustomDeleter,
 
+              &AbstractImporterTest::frames,
+              &AbstractImporterTest::framesNotSupported,
+              &AbstractImporterTest::framesNotImplemented,
+              &AbstractImporterTest::framesNoFile,
+              &AbstractImporterTest::framesOutOfRange,
+              &AbstractImporterTest::framesCustomDeleter,
+
               &AbstractImporterTest::debugFeature,
               &AbstractImporterTest::debugFeaturePacked,
               &AbstractImporterTest::debugFeatures,
@@ -381,6 +395,153 @@ void AbstractImporterTest::dataCustomDeleter() {
     CORRADE_COMPARE(out, "Audio::AbstractImporter::data(): implementation is not allowed to use a custom Array deleter\n");
 }
 
+void AbstractImporterTest::frames() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doFrameCount() const override { return 5; }
+        Containers::Array<char> doFrames(std::size_t offset, std::size_t count) override {
+            return Containers::Array<char>{InPlaceInit, {char('0' + offset), char('0' + count)}};
+        }
+    } importer;
+
+    CORRADE_COMPARE(importer.frameCount(), 5);
+    CORRADE_COMPARE_AS(importer.frames(2, 3), (Containers::Array<char>{InPlaceInit, {'2', '3'}}), TestSuite::Compare::Container);
+    /* Empty range at the end is allowed */
+    CORRADE_COMPARE_AS(importer.frames(5, 0), (Containers::Array<char>{InPlaceInit, {'5', '0'}}), TestSuite::Compare::Container);
+}
+
+void AbstractImporterTest::framesNotSupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.frameCount();
+    importer.frames(0, 0);
+    CORRADE_COMPARE(out,
+        "Audio::AbstractImporter::frameCount(): feature not supported
+"
+        "Audio::AbstractImporter::frames(): feature not supported
+");
+}
+
+void AbstractImporterTest::framesNotImplemented() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.frameCount();
+    CORRADE_COMPARE(out, "Audio::AbstractImporter::frameCount(): feature advertised but not implemented
+");
+}
+
+void AbstractImporterTest::framesNoFile() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return false; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.frameCount();
+    importer.frames(0, 0);
+    CORRADE_COMPARE(out,
+        "Audio::AbstractImporter::frameCount(): no file opened
+"
+        "Audio::AbstractImporter::frames(): no file opened
+");
+}
+
+void AbstractImporterTest::framesOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doFrameCount() const override { return 5; }
+        Containers::Array<char> doFrames(std::size_t, std::size_t) override { return nullptr; }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.frames(3, 3);
+    importer.frames(6, 0);
+    CORRADE_COMPARE(out,
+        "Audio::AbstractImporter::frames(): range [3, 6) out of bounds for 5 frames
+"
+        "Audio::AbstractImporter::frames(): range [6, 6) out of bounds for 5 frames
+");
+}
+
+void AbstractImporterTest::framesCustomDeleter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return ImporterFeature::Streaming; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        BufferFormat doFormat() const override { return {}; }
+        UnsignedInt doFrequency() const override { return {}; }
+        Containers::Array<char> doData() override { return nullptr; }
+
+        std::size_t doFrameCount() const override { return 5; }
+        Containers::Array<char> doFrames(std::size_t, std::size_t) override {
+            return Containers::Array<char>{nullptr, 0, [](char*, std::size_t) {}};
+        }
+    } importer;
+
+    Containers::String out;
+    Error redirectError{&out};
+
+    importer.frames(0, 1);
+    CORRADE_COMPARE(out, "Audio::AbstractImporter::frames(): implementation is not allowed to use a custom Array deleter
+");
+}
+
 void AbstractImporterTest::debugFeature() {
     Containers::String out;
 
@@ -0,0 +1,253 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImageTransformation.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Implementation/imageUtilities.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+namespace Magnum {
+
+namespace {
+
+/* Pixels of common sizes are processed as whole values, allowing the
+   compiler to turn the copies and swaps into vector moves */
+template<std::size_t size> struct Pixel { char data[size]; };
+
+template<class T> void xFlipRowsInPlace(const Containers::StridedArrayView3D<char>& pixels) {
+    const std::size_t width = pixels.size()[1];
+    for(std::size_t y = 0, height = pixels.size()[0]; y != height; ++y) {
+        T* const row = reinterpret_cast<T*>(pixels[y].data());
+        std::reverse(row, row + width);
+    }
+}
+
+void xFlipInPlaceImplementation(const Containers::StridedArrayView3D<char>& pixels) {
+    switch(pixels.size()[2]) {
+        #define _c(size)                                                    \
+            case size: return xFlipRowsInPlace<Pixel<size>>(pixels);
+        _c(1)
+        _c(2)
+        _c(3)
+        _c(4)
+        _c(6)
+        _c(8)
+        _c(12)
+        _c(16)
+        #undef _c
+    }
+
+    /* Implementation-specific formats of unusual sizes */
+    const std::size_t width = pixels.size()[1];
+    const std::size_t pixelSize = pixels.size()[2];
+    for(std::size_t y = 0, height = pixels.size()[0]; y != height; ++y) {
+        char* const row = static_cast<char*>(pixels[y].data());
+        for(std::size_t x = 0; x != width/2; ++x)
+            std::swap_ranges(row + x*pixelSize, row + (x + 1)*pixelSize, row + (width - x - 1)*pixelSize);
+    }
+}
+
+void yFlipInPlaceImplementation(const Containers::StridedArrayView3D<char>& pixels) {
+    /* Pixels in a row of an image view are always contiguous, so whole rows
+       can be swapped */
+    const std::size_t rowSize = pixels.size()[1]*pixels.size()[2];
+    const std::size_t height = pixels.size()[0];
+    for(std::size_t y = 0; y != height/2; ++y) {
+        char* const a = static_cast<char*>(pixels[y].data());
+        char* const b = static_cast<char*>(pixels[height - y - 1].data());
+        std::swap_ranges(a, a + rowSize, b);
+    }
+}
+
+/* Copies pixels from a (transposed and flipped) source view to a destination
+   of the same size in square tiles, so neither the reads nor the writes
+   thrash the cache */
+template<class T> void copyTiled(const Containers::StridedArrayView3D<const char>& source, const Containers::StridedArrayView3D<char>& destination) {
+    constexpr std::size_t TileSize = 32;
+    const std::size_t height = destination.size()[0];
+    const std::size_t width = destination.size()[1];
+    const auto* const sourceData = static_cast<const char*>(source.data());
+    auto* const destinationData = static_cast<char*>(destination.data());
+    const std::ptrdiff_t sourceStrideY = source.stride()[0];
+    const std::ptrdiff_t sourceStrideX = source.stride()[1];
+    const std::ptrdiff_t destinationStrideY = destination.stride()[0];
+    const std::ptrdiff_t destinationStrideX = destination.stride()[1];
+
+    for(std::size_t tileY = 0; tileY < height; tileY += TileSize) {
+        const std::size_t endY = Math::min(tileY + TileSize, height);
+        for(std::size_t tileX = 0; tileX < width; tileX += TileSize) {
+            const std::size_t endX = Math::min(tileX + TileSize, width);
+            for(std::size_t y = tileY; y != endY; ++y) {
+                const char* const sourceRow = sourceData + std::ptrdiff_t(y)*sourceStrideY;
+                char* const destinationRow = destinationData + std::ptrdiff_t(y)*destinationStrideY;
+                for(std::size_t x = tileX; x != endX; ++x)
+                    *reinterpret_cast<T*>(destinationRow + std::ptrdiff_t(x)*destinationStrideX) = *reinterpret_cast<const T*>(sourceRow + std::ptrdiff_t(x)*sourceStrideX);
+            }
+        }
+    }
+}
+
+void copyTiledImplementation(const Containers::StridedArrayView3D<const char>& source, const Containers::StridedArrayView3D<char>& destination) {
+    switch(source.size()[2]) {
+        #define _c(size)                                                    \
+            case size: return copyTiled<Pixel<size>>(source, destination);
+        _c(1)
+        _c(2)
+        _c(3)
+        _c(4)
+        _c(6)
+        _c(8)
+        _c(12)
+        _c(16)
+        #undef _c
+    }
+
+    /* Implementation-specific formats of unusual sizes */
+    const std::size_t pixelSize = source.size()[2];
+    for(std::size_t y = 0, height = destination.size()[0]; y != height; ++y)
+        for(std::size_t x = 0, width = destination.size()[1]; x != width; ++x)
+            std::memcpy(destination[y][x].data(), source[y][x].data(), pixelSize);
+}
+
+/* Destination pixel (x, y) is source pixel (w - y - 1, x) */
+inline Containers::StridedArrayView3D<const char> rotatedClockwise(const Containers::StridedArrayView3D<const char>& pixels) {
+    return pixels.transposed<0, 1>().flipped<0>();
+}
+
+/* Destination pixel (x, y) is source pixel (y, h - x - 1) */
+inline Containers::StridedArrayView3D<const char> rotatedCounterClockwise(const Containers::StridedArrayView3D<const char>& pixels) {
+    return pixels.transposed<0, 1>().flipped<1>();
+}
+
+#ifndef CORRADE_NO_ASSERT
+template<UnsignedInt dimensions> bool checkRotation(const char* const function, const ImageView<dimensions, const char>& source, const ImageView<dimensions, char>& destination) {
+    CORRADE_ASSERT(source.format() == destination.format() && source.formatExtra() == destination.formatExtra(),
+        function << "expected destination format" << source.format() << "but got" << destination.format(), false);
+    CORRADE_ASSERT(source.pixelSize() == destination.pixelSize(),
+        function << "expected destination pixel size" << source.pixelSize() << "but got" << destination.pixelSize(), false);
+    VectorTypeFor<dimensions, Int> expectedSize = source.size();
+    std::swap(expectedSize[0], expectedSize[1]);
+    CORRADE_ASSERT(destination.size() == expectedSize,
+        function << "expected destination size" << Debug::packed << expectedSize << "but got" << Debug::packed << destination.size(), false);
+    return true;
+}
+#endif
+
+template<UnsignedInt dimensions> Image<dimensions> allocateRotated(const ImageView<dimensions, const char>& source, const ImageFlags<dimensions> flags) {
+    VectorTypeFor<dimensions, Int> size = source.size();
+    std::swap(size[0], size[1]);
+
+    return Implementation::allocateImage<dimensions>(source.format(), source.formatExtra(), source.pixelSize(), size, flags);
+}
+
+}
+
+void xFlipInPlace(const MutableImageView2D& image) {
+    xFlipInPlaceImplementation(image.pixels());
+}
+
+void xFlipInPlace(const MutableImageView3D& image) {
+    const Containers::StridedArrayView4D<char> pixels = image.pixels();
+    for(std::size_t z = 0, depth = pixels.size()[0]; z != depth; ++z)
+        xFlipInPlaceImplementation(pixels[z]);
+}
+
+void yFlipInPlace(const MutableImageView2D& image) {
+    yFlipInPlaceImplementation(image.pixels());
+}
+
+void yFlipInPlace(const MutableImageView3D& image) {
+    const Containers::StridedArrayView4D<char> pixels = image.pixels();
+    for(std::size_t z = 0, depth = pixels.size()[0]; z != depth; ++z)
+        yFlipInPlaceImplementation(pixels[z]);
+}
+
+void rotateClockwise(const ImageView2D& source, const MutableImageView2D& destination) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkRotation<2>("rotateClockwise():", source, destination)) return;
+    #endif
+    copyTiledImplementation(rotatedClockwise(source.pixels()), destination.pixels());
+}
+
+void rotateClockwise(const ImageView3D& source, const MutableImageView3D& destination) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkRotation<3>("rotateClockwise():", source, destination)) return;
+    #endif
+    const Containers::StridedArrayView4D<const char> sourcePixels = source.pixels();
+    const Containers::StridedArrayView4D<char> destinationPixels = destination.pixels();
+    for(std::size_t z = 0, depth = sourcePixels.size()[0]; z != depth; ++z)
+        copyTiledImplementation(rotatedClockwise(sourcePixels[z]), destinationPixels[z]);
+}
+
+Image2D rotateClockwise(const ImageView2D& source) {
+    Image2D out = allocateRotated(source, source.flags() & ~ImageFlag2D::Array);
+    rotateClockwise(source, out);
+    return out;
+}
+
+Image3D rotateClockwise(const ImageView3D& source) {
+    Image3D out = allocateRotated(source, source.flags());
+    rotateClockwise(source, out);
+    return out;
+}
+
+void rotateCounterClockwise(const ImageView2D& source, const MutableImageView2D& destination) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkRotation<2>("rotateCounterClockwise():", source, destination)) return;
+    #endif
+    copyTiledImplementation(rotatedCounterClockwise(source.pixels()), destination.pixels());
+}
+
+void rotateCounterClockwise(const ImageView3D& source, const MutableImageView3D& destination) {
+    #ifndef CORRADE_NO_ASSERT
+    if(!checkRotation<3>("rotateCounterClockwise():", source, destination)) return;
+    #endif
+    const Containers::StridedArrayView4D<const char> sourcePixels = source.pixels();
+    const Containers::StridedArrayView4D<char> destinationPixels = destination.pixels();
+    for(std::size_t z = 0, depth = sourcePixels.size()[0]; z != depth; ++z)
+        copyTiledImplementation(rotatedCounterClockwise(sourcePixels[z]), destinationPixels[z]);
+}
+
+Image2D rotateCounterClockwise(const ImageView2D& source) {
+    Image2D out = allocateRotated(source, source.flags() & ~ImageFlag2D::Array);
+    rotateCounterClockwise(source, out);
+    return out;
+}
+
+Image3D rotateCounterClockwise(const ImageView3D& source) {
+    Image3D out = allocateRotated(source, source.flags());
+    rotateCounterClockwise(source, out);
+    return out;
+}
+
+}
@@ -0,0 +1,170 @@
+#ifndef Magnum_ImageTransformation_h
+#define Magnum_ImageTransformation_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::xFlipInPlace(), @ref Magnum::yFlipInPlace(), @ref Magnum::rotateClockwise(), @ref Magnum::rotateCounterClockwise()
+ * @m_since_latest
+ */
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+
+namespace Magnum {
+
+/**
+@brief Flip a 2D image horizontally in-place
+@m_since_latest
+
+Reverses the order of pixels in each row. Works with any @ref PixelFormat
+including implementation-specific ones, as only the pixel size is needed, and
+with arbitrary @ref PixelStorage parameters. Pixels are swapped as whole
+values of the pixel size, allowing the compiler to vectorize the operation for
+common pixel sizes.
+@see @ref yFlipInPlace(), @ref ImageView::pixelSize()
+*/
+MAGNUM_EXPORT void xFlipInPlace(const MutableImageView2D& image);
+
+/**
+@brief Flip a 3D image horizontally in-place
+@m_since_latest
+
+Like @ref xFlipInPlace(const MutableImageView2D&) but flips each slice of a
+3D image.
+*/
+MAGNUM_EXPORT void xFlipInPlace(const MutableImageView3D& image);
+
+/**
+@brief Flip a 2D image vertically in-place
+@m_since_latest
+
+Reverses the order of rows. Works with any @ref PixelFormat including
+implementation-specific ones and with arbitrary @ref PixelStorage parameters.
+As pixels in a row are always contiguous, whole rows are swapped at once. For
+compressed images see @ref Math::yFlipBc1InPlace() and related functions
+instead.
+
+@snippet Magnum.cpp yFlipInPlace
+
+@see @ref xFlipInPlace()
+*/
+MAGNUM_EXPORT void yFlipInPlace(const MutableImageView2D& image);
+
+/**
+@brief Flip a 3D image vertically in-place
+@m_since_latest
+
+Like @ref yFlipInPlace(const MutableImageView2D&) but flips each slice of a
+3D image.
+*/
+MAGNUM_EXPORT void yFlipInPlace(const MutableImageView3D& image);
+
+/**
+@brief Rotate a 2D image clockwise
+@m_since_latest
+
+Writes @p source rotated by 90° clockwise to @p destination. Expects that
+both have the same format and pixel size and that the destination size is the
+source size with X and Y swapped. Both images can have arbitrary
+@ref PixelStorage parameters, the source and destination memory is expected to
+not overlap. The pixels are copied in square tiles to make both the reads and
+writes cache-friendly.
+@see @ref rotateCounterClockwise(), @ref Math::Vector2::flipped()
+*/
+MAGNUM_EXPORT void rotateClockwise(const ImageView2D& source, const MutableImageView2D& destination);
+
+/**
+@brief Rotate a 3D image clockwise
+@m_since_latest
+
+Like @ref rotateClockwise(const ImageView2D&, const MutableImageView2D&) but
+rotates each slice of a 3D image. The Z size is expected to be the same for
+both.
+*/
+MAGNUM_EXPORT void rotateClockwise(const ImageView3D& source, const MutableImageView3D& destination);
+
+/**
+@brief Rotate a 2D image clockwise to a newly allocated image
+@m_since_latest
+
+Allocates an image of the same format, with X and Y size swapped and with the
+default @ref PixelStorage and delegates to
+@ref rotateClockwise(const ImageView2D&, const MutableImageView2D&). As the Y
+dimension changes meaning, @ref ImageFlag2D::Array is not preserved.
+*/
+MAGNUM_EXPORT Image2D rotateClockwise(const ImageView2D& source);
+
+/**
+@brief Rotate a 3D image clockwise to a newly allocated image
+@m_since_latest
+
+Allocates an image of the same format and @ref ImageFlags3D, with X and Y size
+swapped and with the default @ref PixelStorage and delegates to
+@ref rotateClockwise(const ImageView3D&, const MutableImageView3D&).
+*/
+MAGNUM_EXPORT Image3D rotateClockwise(const ImageView3D& source);
+
+/**
+@brief Rotate a 2D image counterclockwise
+@m_since_latest
+
+Like @ref rotateClockwise(const ImageView2D&, const MutableImageView2D&) but
+rotates by 90° counterclockwise.
+*/
+MAGNUM_EXPORT void rotateCounterClockwise(const ImageView2D& source, const MutableImageView2D& destination);
+
+/**
+@brief Rotate a 3D image counterclockwise
+@m_since_latest
+
+Like @ref rotateClockwise(const ImageView3D&, const MutableImageView3D&) but
+rotates by 90° counterclockwise.
+*/
+MAGNUM_EXPORT void rotateCounterClockwise(const ImageView3D& source, const MutableImageView3D& destination);
+
+/**
+@brief Rotate a 2D image counterclockwise to a newly allocated image
+@m_since_latest
+
+Like @ref rotateClockwise(const ImageView2D&) but rotates by 90°
+counterclockwise.
+*/
+MAGNUM_EXPORT Image2D rotateCounterClockwise(const ImageView2D& source);
+
+/**
+@brief Rotate a 3D image counterclockwise to a newly allocated image
+@m_since_latest
+
+Like @ref rotateClockwise(const ImageView3D&) but rotates by 90°
+counterclockwise.
+*/
+MAGNUM_EXPORT Image3D rotateCounterClockwise(const ImageView3D& source);
+
+}
+
+#endif
@@ -0,0 +1,87 @@
+#ifndef Magnum_Implementation_imageUtilities_h
+#define Magnum_Implementation_imageUtilities_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cmath>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector3.h"
+
+/* Shared by convertPixelFormat(), flipImage*() / rotateImage*() and the
+   TextureTools::decompress(), resize() and generateMipmaps() utilities */
+
+namespace Magnum { namespace Implementation {
+
+/* Decodes an 8-bit sRGB channel value to a linear float. There's just 256
+   possible inputs so it's done through a lookup table that's filled on first
+   use. */
+inline Float srgbToLinear(const UnsignedByte value) {
+    static const struct Table {
+        explicit Table() {
+            for(std::size_t i = 0; i != 256; ++i) {
+                const Float srgb = i/255.0f;
+                data[i] = srgb <= 0.04045f ? srgb/12.92f :
+                    std::pow((srgb + 0.055f)/1.055f, 2.4f);
+            }
+        }
+
+        Float data[256];
+    } table;
+    return table.data[value];
+}
+
+/* Encodes a linear float to a sRGB float in the [0, 1] range, values outside
+   of the range get clamped */
+inline Float linearToSrgb(const Float value) {
+    const Float linear = Math::clamp(value, 0.0f, 1.0f);
+    return linear <= 0.0031308f ? linear*12.92f :
+        1.055f*std::pow(linear, 1.0f/2.4f) - 0.055f;
+}
+
+/* Row size in bytes with the default PixelStorage, i.e. aligned to four
+   bytes */
+inline std::size_t defaultPixelStorageRowSize(const std::size_t width, const std::size_t pixelSize) {
+    return (width*pixelSize + 3)/4*4;
+}
+
+/* Allocates an uninitialized image with the default PixelStorage */
+template<UnsignedInt dimensions> Image<dimensions> allocateImage(const PixelFormat format, const UnsignedInt formatExtra, const UnsignedInt pixelSize, const VectorTypeFor<dimensions, Int>& size, const ImageFlags<dimensions> flags) {
+    const Vector3i paddedSize = Vector3i::pad(size, 1);
+    return Image<dimensions>{PixelStorage{}, format, formatExtra, pixelSize, size, Containers::Array<char>{NoInit, defaultPixelStorageRowSize(paddedSize.x(), pixelSize)*paddedSize.y()*paddedSize.z()}, flags};
+}
+
+/* Overload for a generic format, with the pixel size implicit */
+template<UnsignedInt dimensions> Image<dimensions> allocateImage(const PixelFormat format, const VectorTypeFor<dimensions, Int>& size, const ImageFlags<dimensions> flags) {
+    return allocateImage<dimensions>(format, 0, pixelFormatSize(format), size, flags);
+}
+
+}}
+
+#endif
@@ -1377,6 +1377,7 @@ enum class SamplerFilter: UnsignedInt;
 enum class SamplerMipmap: UnsignedInt;
 enum class SamplerWrapping: UnsignedInt;
 
+class ThreadPool;
 class Timeline;
 #endif
 
@@ -26,11 +26,16 @@
 
 #include "Concatenate.h"
 
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Utility/Algorithms.h>
 
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/GenerateIndices.h"
 #include "Magnum/MeshTools/Implementation/remapAttributeData.h"
+#include "Magnum/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools {
 
@@ -210,4 +215,276 @@ Trade::MeshData concatenate(const Containers::Iterable<const Trade::MeshData>& m
     return Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenate():");
 }
 
+namespace {
+
+/* Whether given attribute gets transformed by concatenateTransformed3D(),
+   same as what transform3D() does with default arguments */
+bool isTransformedAttribute(const Trade::MeshAttribute name, const UnsignedInt id, const Int morphTargetId) {
+    return id == 0 && morphTargetId == -1 &&
+        (name == Trade::MeshAttribute::Position ||
+         name == Trade::MeshAttribute::Tangent ||
+         name == Trade::MeshAttribute::Bitangent ||
+         name == Trade::MeshAttribute::Normal);
+}
+
+}
+
+Trade::MeshData concatenateTransformed3D(const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::StridedArrayView1D<const UnsignedInt>& meshIds, const Containers::StridedArrayView1D<const Matrix4>& transformations, const UnsignedInt threadCount, const InterleaveFlags flags) {
+    CORRADE_ASSERT(meshIds.size() == transformations.size(),
+        "MeshTools::concatenateTransformed3D(): expected the same count of mesh IDs and transformations but got" << meshIds.size() << "and" << transformations.size(),
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    CORRADE_ASSERT(!meshIds.isEmpty(),
+        "MeshTools::concatenateTransformed3D(): expected at least one instance",
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != meshIds.size(); ++i)
+        CORRADE_ASSERT(meshIds[i] < meshes.size(),
+            "MeshTools::concatenateTransformed3D(): mesh ID" << meshIds[i] << "at index" << i << "out of range for" << meshes.size() << "meshes",
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+    #endif
+
+    /* The output attribute layout is taken from the mesh referenced by the
+       first instance */
+    const Trade::MeshData& first = meshes[meshIds[0]];
+    CORRADE_ASSERT(
+        first.primitive() != MeshPrimitive::LineStrip &&
+        first.primitive() != MeshPrimitive::LineLoop &&
+        first.primitive() != MeshPrimitive::TriangleStrip &&
+        first.primitive() != MeshPrimitive::TriangleFan,
+        "MeshTools::concatenateTransformed3D():" << first.primitive() << "is not supported, turn it into a plain indexed mesh first",
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+    CORRADE_ASSERT(first.findAttributeId(Trade::MeshAttribute::Position),
+        "MeshTools::concatenateTransformed3D(): the first instance mesh has no positions",
+        (Trade::MeshData{MeshPrimitive::Points, 0}));
+
+    /* Copy the original attributes to a mutable array, expanding the
+       transformed attributes to floats if they're not already. Not using
+       Utility::copy() for the same reason as in transform3D(). */
+    Containers::Array<Trade::MeshAttributeData> attributes{ValueInit, first.attributeCount()};
+    bool formatsChanged = false;
+    for(UnsignedInt i = 0; i != first.attributeCount(); ++i) {
+        const VertexFormat format = first.attributeFormat(i);
+        CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+            "MeshTools::concatenateTransformed3D(): attribute" << i << "of the first instance mesh has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        attributes[i] = first.attributeData(i);
+
+        const Trade::MeshAttribute name = first.attributeName(i);
+        if(!isTransformedAttribute(name, first.attributeId(i), first.attributeMorphTargetId(i)))
+            continue;
+
+        CORRADE_ASSERT(name != Trade::MeshAttribute::Position || vertexFormatComponentCount(format) == 3,
+            "MeshTools::concatenateTransformed3D(): expected 3D positions but got" << format,
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        const VertexFormat desiredFormat =
+            vertexFormatComponentCount(format) == 4 ?
+                VertexFormat::Vector4 : VertexFormat::Vector3;
+        if(format != desiredFormat) {
+            attributes[i] = Trade::MeshAttributeData{name, desiredFormat, nullptr};
+            formatsChanged = true;
+        }
+    }
+
+    /* Calculate the output layout. If no formats were changed, make a
+       non-owning copy of the attribute data as in concatenate() to preserve
+       the interleaved layout, otherwise pack the attributes tightly in the
+       original order. */
+    Containers::Array<Trade::MeshAttributeData> attributeData;
+    if(!formatsChanged)
+        attributeData = Implementation::interleavedLayout(Trade::MeshData{first.primitive(),
+            {}, first.vertexData(),
+            Trade::meshAttributeDataNonOwningArray(first.attributeData())}, {}, flags);
+    else
+        attributeData = Implementation::interleavedLayout(Trade::MeshData{first.primitive(), 0}, attributes, flags);
+
+    /* Validate all meshes referenced by the instances, each just once. This
+       is done upfront so the (possibly parallel) processing below doesn't
+       need to check anything. */
+    #ifndef CORRADE_NO_ASSERT
+    Containers::BitArray validated{ValueInit, meshes.size()};
+    for(std::size_t i = 0; i != meshIds.size(); ++i) {
+        const UnsignedInt meshId = meshIds[i];
+        if(validated[meshId])
+            continue;
+        validated.set(meshId);
+
+        const Trade::MeshData& mesh = meshes[meshId];
+        CORRADE_ASSERT(mesh.primitive() == first.primitive(),
+            "MeshTools::concatenateTransformed3D(): expected" << first.primitive() << "but got" << mesh.primitive() << "in mesh" << meshId,
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+        CORRADE_ASSERT(!mesh.isIndexed() || !isMeshIndexTypeImplementationSpecific(mesh.indexType()),
+            "MeshTools::concatenateTransformed3D(): mesh" << meshId << "has an implementation-specific index type" << Debug::hex << meshIndexTypeUnwrap(mesh.indexType()),
+            (Trade::MeshData{MeshPrimitive::Points, 0}));
+
+        for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
+            const Trade::MeshAttribute name = mesh.attributeName(src);
+            const UnsignedInt id = mesh.attributeId(src);
+            const Int morphTargetId = mesh.attributeMorphTargetId(src);
+            const Containers::Optional<UnsignedInt> dst = first.findAttributeId(name, id, morphTargetId);
+            if(!dst)
+                continue;
+
+            /* Transformed attributes get unpacked, so they only need to have
+               a matching component count */
+            const VertexFormat format = mesh.attributeFormat(src);
+            if(isTransformedAttribute(name, id, morphTargetId)) {
+                CORRADE_ASSERT(!isVertexFormatImplementationSpecific(format),
+                    "MeshTools::concatenateTransformed3D(): mesh" << meshId << "attribute" << src << "has an implementation-specific format" << Debug::hex << vertexFormatUnwrap(format),
+                    (Trade::MeshData{MeshPrimitive::Points, 0}));
+                CORRADE_ASSERT(vertexFormatComponentCount(format) == vertexFormatComponentCount(attributeData[*dst].format()),
+                    "MeshTools::concatenateTransformed3D(): expected" << vertexFormatComponentCount(attributeData[*dst].format()) << "components for attribute" << dst << "(" << Debug::nospace << name << Debug::nospace << ") but got" << format << "in mesh" << meshId << "attribute" << src,
+                    (Trade::MeshData{MeshPrimitive::Points, 0}));
+                continue;
+            }
+
+            CORRADE_ASSERT(attributeData[*dst].format() == format,
+                "MeshTools::concatenateTransformed3D(): expected" << attributeData[*dst].format() << "for attribute" << dst << "(" << Debug::nospace << name << Debug::nospace << ") but got" << format << "in mesh" << meshId << "attribute" << src,
+                (Trade::MeshData{MeshPrimitive::Points, 0}));
+            CORRADE_ASSERT(!attributeData[*dst].arraySize() == !mesh.attributeArraySize(src),
+                "MeshTools::concatenateTransformed3D(): attribute" << dst << "(" << Debug::nospace << name << Debug::nospace << ")" << (attributeData[*dst].arraySize() ? "is" : "isn't") << "an array but attribute" << src << "in mesh" << meshId << (mesh.attributeArraySize(src) ? "is" : "isn't"),
+                (Trade::MeshData{MeshPrimitive::Points, 0}));
+            CORRADE_ASSERT(attributeData[*dst].arraySize() >= mesh.attributeArraySize(src),
+                "MeshTools::concatenateTransformed3D(): expected array size" << attributeData[*dst].arraySize() << "or less for attribute" << dst << "(" << Debug::nospace << name << Debug::nospace << ") but got" << mesh.attributeArraySize(src) << "in mesh" << meshId << "attribute" << src,
+                (Trade::MeshData{MeshPrimitive::Points, 0}));
+        }
+    }
+    #endif
+
+    /* Calculate index and vertex offsets of all instances upfront, with the
+       same logic as in concatenateIndexVertexCount(). The extra item at the
+       end contains the total counts. */
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> offsets{NoInit, meshIds.size() + 1};
+    bool indexed = false;
+    for(std::size_t i = 0; i != meshIds.size(); ++i) {
+        if(meshes[meshIds[i]].isIndexed()) {
+            indexed = true;
+            break;
+        }
+    }
+    {
+        UnsignedInt indexOffset = 0;
+        UnsignedInt vertexOffset = 0;
+        for(std::size_t i = 0; i != meshIds.size(); ++i) {
+            const Trade::MeshData& mesh = meshes[meshIds[i]];
+            offsets[i] = {indexOffset, vertexOffset};
+            if(indexed)
+                indexOffset += mesh.isIndexed() ? mesh.indexCount() : mesh.vertexCount();
+            vertexOffset += mesh.vertexCount();
+        }
+        offsets.back() = {indexOffset, vertexOffset};
+    }
+    const UnsignedInt indexCount = offsets.back().first();
+    const UnsignedInt vertexCount = offsets.back().second();
+
+    /* Allocate the output. Index data are allocated with NoInit as the whole
+       array will be written, vertex data might have holes for attributes not
+       present in all meshes and thus are zero-initialized. A cast to
+       std::size_t is needed in order to allow sizes over 4 GB on 64-bit. */
+    Containers::Array<char> indexData{NoInit, indexCount*sizeof(UnsignedInt)};
+    Containers::Array<char> vertexData{ValueInit, attributeData[0].stride()*std::size_t(vertexCount)};
+    for(Trade::MeshAttributeData& attribute: attributeData)
+        attribute = Implementation::remapAttributeData(attribute, vertexCount, vertexData, vertexData);
+    const Containers::ArrayView<UnsignedInt> indices = Containers::arrayCast<UnsignedInt>(indexData);
+    Trade::MeshData out{first.primitive(),
+        Utility::move(indexData), indexed ?
+            Trade::MeshIndexData{indices} : Trade::MeshIndexData{},
+        Utility::move(vertexData), Utility::move(attributeData), vertexCount};
+
+    /* Query the mutable output attribute views upfront to not need to touch
+       the output MeshData from multiple threads */
+    Containers::Array<Containers::StridedArrayView2D<char>> outAttributes{ValueInit, out.attributeCount()};
+    for(UnsignedInt i = 0; i != out.attributeCount(); ++i)
+        outAttributes[i] = out.mutableAttribute(i);
+
+    /* Each instance writes only to its own index and vertex range, so the
+       instances can be processed in any order and in parallel */
+    const auto processInstance = [&](const std::size_t i) {
+        const Trade::MeshData& mesh = meshes[meshIds[i]];
+        const Matrix4& transformation = transformations[i];
+        const UnsignedInt indexOffset = offsets[i].first();
+        const UnsignedInt vertexOffset = offsets[i].second();
+
+        /* If the mesh is indexed, copy the indices over, expanded to 32bit
+           and adjusted for current vertex offset. Otherwise, if we need an
+           index buffer, generate a trivial one. */
+        if(mesh.isIndexed()) {
+            const Containers::ArrayView<UnsignedInt> dst = indices.sliceSize(indexOffset, mesh.indexCount());
+            mesh.indicesInto(dst);
+            for(UnsignedInt& index: dst)
+                index += vertexOffset;
+        } else if(indexed) {
+            generateTrivialIndicesInto(indices.sliceSize(indexOffset, mesh.vertexCount()), vertexOffset);
+        }
+
+        Containers::Optional<Matrix3x3> normalMatrix;
+        for(UnsignedInt src = 0; src != mesh.attributeCount(); ++src) {
+            const Trade::MeshAttribute name = mesh.attributeName(src);
+            const UnsignedInt id = mesh.attributeId(src);
+            const Int morphTargetId = mesh.attributeMorphTargetId(src);
+            const Containers::Optional<UnsignedInt> dst = out.findAttributeId(name, id, morphTargetId);
+            if(!dst)
+                continue;
+
+            const Containers::StridedArrayView2D<char> dstAttribute = outAttributes[*dst].sliceSize(
+                {vertexOffset, 0},
+                {mesh.vertexCount(), outAttributes[*dst].size()[1]});
+
+            /* Attributes other than positions and TBN are copied as-is. For
+               array attributes we may be copying to just a prefix of the
+               elements in dstAttribute, same as in concatenate(). */
+            if(!isTransformedAttribute(name, id, morphTargetId)) {
+                const Containers::StridedArrayView2D<const char> srcAttribute = mesh.attribute(src);
+                Utility::copy(srcAttribute, dstAttribute.sliceSize(
+                    {0, 0}, {mesh.vertexCount(), srcAttribute.size()[1]}));
+                continue;
+            }
+
+            /* Positions and TBN are unpacked and transformed */
+            /** @todo this needs a proper batch implementation */
+            if(name == Trade::MeshAttribute::Position) {
+                const Containers::StridedArrayView1D<Vector3> positions = Containers::arrayCast<1, Vector3>(dstAttribute);
+                mesh.positions3DInto(positions);
+                for(Vector3& position: positions)
+                    position = transformation.transformPoint(position);
+                continue;
+            }
+
+            if(!normalMatrix)
+                normalMatrix = transformation.normalMatrix();
+            if(name == Trade::MeshAttribute::Tangent && out.attributeFormat(*dst) == VertexFormat::Vector4) {
+                const Containers::StridedArrayView1D<Vector4> tangents = Containers::arrayCast<1, Vector4>(dstAttribute);
+                mesh.tangentsInto(tangents.slice(&Vector4::xyz));
+                mesh.bitangentSignsInto(tangents.slice(&Vector4::w));
+                for(Vector4& tangent: tangents)
+                    tangent.xyz() = *normalMatrix*tangent.xyz();
+                continue;
+            }
+
+            const Containers::StridedArrayView1D<Vector3> vectors = Containers::arrayCast<1, Vector3>(dstAttribute);
+            if(name == Trade::MeshAttribute::Tangent)
+                mesh.tangentsInto(vectors);
+            else if(name == Trade::MeshAttribute::Bitangent)
+                mesh.bitangentsInto(vectors);
+            else if(name == Trade::MeshAttribute::Normal)
+                mesh.normalsInto(vectors);
+            else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+            for(Vector3& vector: vectors)
+                vector = *normalMatrix*vector;
+        }
+    };
+
+    /* Instances can have wildly different sizes, so each is a separate chunk
+       and the pool balances them among the threads */
+    const auto processInstances = [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i != end; ++i)
+            processInstance(i);
+    };
+    if(threadCount)
+        ThreadPool{threadCount}.parallelFor(meshIds.size(), 1, processInstances);
+    else
+        ThreadPool::global().parallelFor(meshIds.size(), 1, processInstances);
+
+    return out;
+}
+
 }}
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto()
+ * @brief Function @ref Magnum::MeshTools::concatenate(), @ref Magnum::MeshTools::concatenateInto(), @ref Magnum::MeshTools::concatenateTransformed3D()
  * @m_since{2020,06}
  */
 
@@ -154,6 +154,42 @@ template<template<class> class Allocator = Containers::ArrayAllocator> void conc
     destination = Implementation::concatenate(Utility::move(indexData), indexVertexCount.second(), Utility::move(vertexData), Utility::move(attributeData), meshes, "MeshTools::concatenateInto():");
 }
 
+/**
+@brief Transform mesh instances and concatenate them together
+@param meshes           Meshes to instance
+@param meshIds          IDs of meshes from @p meshes to place into the output
+@param transformations  Transformation of each instance
+@param threadCount      Count of threads to use. If @cpp 0 @ce, the
+    @ref ThreadPool::global() "global thread pool" is used.
+@param flags            Flags to pass to @ref interleavedLayout()
+@m_since_latest
+
+Equivalent to calling @ref transform3D() on @cpp meshes[meshIds[i]] @ce with
+@cpp transformations[i] @ce for every item of @p meshIds and then passing the
+result to @ref concatenate(), but without any temporary allocations. Total
+index and vertex count and offsets of all instances are calculated upfront,
+after which every instance is transformed directly into its place in the
+single output allocation. The instances are processed in parallel using a
+@ref ThreadPool with @p threadCount threads, which by default is the global
+one with @ref ThreadPool::globalThreadCount() threads. The output doesn't
+depend on the thread count. The @p meshIds and @p transformations views are
+expected to have the same size, and at least one item, and all IDs are
+expected to be less than size of @p meshes. A typical use is baking a whole
+scene hierarchy into a single mesh:
+
+@snippet SceneTools.cpp absoluteFieldTransformations3D-mesh-concatenateTransformed3D
+
+The attribute layout is taken from the mesh referenced by the first instance,
+which is expected to have 3D positions. Only the first position, normal,
+tangent and bitangent attribute that's not a morph target is transformed, same
+as with @ref transform3D() with default arguments. These are expanded to
+@ref VertexFormat::Vector3 or @ref VertexFormat::Vector4 in the output if they
+aren't floating-point already, subsequent meshes are then expected to have the
+same component count for these. Other attributes and the primitive follow the
+same rules as with @ref concatenate(const Containers::Iterable<const Trade::MeshData>&, InterleaveFlags).
+*/
+MAGNUM_MESHTOOLS_EXPORT Trade::MeshData concatenateTransformed3D(const Containers::Iterable<const Trade::MeshData>& meshes, const Containers::StridedArrayView1D<const UnsignedInt>& meshIds, const Containers::StridedArrayView1D<const Matrix4>& transformations, UnsignedInt threadCount = 0, InterleaveFlags flags = InterleaveFlag::PreserveInterleavedAttributes);
+
 }}
 
 #endif
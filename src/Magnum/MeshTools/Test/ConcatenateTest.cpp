@@ -31,7 +31,9 @@
 #include <Corrade/TestSuite/Compare/String.h>
 
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix4.h"
 #include "Magnum/MeshTools/Concatenate.h"
+#include "Magnum/ThreadPool.h"
 
 namespace Magnum { namespace MeshTools { namespace Test { namespace {
 
@@ -47,6 +49,8 @@ struct ConcatenateTest: TestSuite::Tester {
     void concatenateInto();
     void concatenateIntoNoIndexArray();
     void concatenateIntoNonOwnedAttributeArray();
+    void concatenateTransformed3D();
+    void concatenateTransformed3DVector4Tangents();
 
     void concatenateUnsupportedPrimitive();
     void concatenateInconsistentPrimitive();
@@ -56,6 +60,7 @@ struct ConcatenateTest: TestSuite::Tester {
     void concatenateImplementationSpecificIndexType();
     void concatenateImplementationSpecificVertexFormat();
     void concatenateIntoNoMeshes();
+    void concatenateTransformed3DInvalid();
 };
 
 const struct {
@@ -67,6 +72,16 @@ const struct {
     {"don't preserve layout", InterleaveFlags{}, false},
 };
 
+const struct {
+    const char* name;
+    UnsignedInt threadCount, globalThreadCount;
+} ConcatenateTransformed3DData[]{
+    {"single thread", 1, 1},
+    {"three threads", 3, 1},
+    {"global thread pool, single thread", 0, 1},
+    {"global thread pool, three threads", 0, 3},
+};
+
 ConcatenateTest::ConcatenateTest() {
     addInstancedTests({&ConcatenateTest::concatenate},
         Containers::arraySize(ConcatenateData));
@@ -78,7 +93,12 @@ ConcatenateTest::ConcatenateTest() {
               &ConcatenateTest::concatenateNone,
               &ConcatenateTest::concatenateInto,
               &ConcatenateTest::concatenateIntoNoIndexArray,
-              &ConcatenateTest::concatenateIntoNonOwnedAttributeArray,
+              &ConcatenateTest::concatenateIntoNonOwnedAttributeArray});
+
+    addInstancedTests({&ConcatenateTest::concatenateTransformed3D},
+        Containers::arraySize(ConcatenateTransformed3DData));
+
+    addTests({&ConcatenateTest::concatenateTransformed3DVector4Tangents,
 
               &ConcatenateTest::concatenateUnsupportedPrimitive,
               &ConcatenateTest::concatenateInconsistentPrimitive,
@@ -87,7 +107,8 @@ ConcatenateTest::ConcatenateTest() {
               &ConcatenateTest::concatenateTooLargeAttributeArraySize,
               &ConcatenateTest::concatenateImplementationSpecificIndexType,
               &ConcatenateTest::concatenateImplementationSpecificVertexFormat,
-              &ConcatenateTest::concatenateIntoNoMeshes});
+              &ConcatenateTest::concatenateIntoNoMeshes,
+              &ConcatenateTest::concatenateTransformed3DInvalid});
 }
 
 /* MSVC 2015 doesn't like unnamed bitfields in local structs, so this has to
@@ -634,6 +655,155 @@ void ConcatenateTest::concatenateIntoNonOwnedAttributeArray() {
     CORRADE_COMPARE(dst.vertexData().data(), vertexDataPointer);
 }
 
+struct VertexDataTransformedA {
+    Vector3s position;
+    Vector3 normal;
+    Vector2 textureCoordinates;
+};
+
+void ConcatenateTest::concatenateTransformed3D() {
+    auto&& data = ConcatenateTransformed3DData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    using namespace Math::Literals;
+
+    /* First is indexed and has packed positions, which get expanded to
+       floats */
+    const VertexDataTransformedA vertexDataA[]{
+        {{1, 0, 0}, {0.0f, 0.0f, 1.0f}, {0.5f, 0.5f}},
+        {{0, 1, 0}, {1.0f, 0.0f, 0.0f}, {1.0f, 1.0f}},
+    };
+    Containers::StridedArrayView1D<const VertexDataTransformedA> verticesA = vertexDataA;
+    const UnsignedShort indicesA[]{1, 0};
+    Trade::MeshData a{MeshPrimitive::Points,
+        {}, indicesA, Trade::MeshIndexData{indicesA}, {}, vertexDataA, {
+            Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+                verticesA.slice(&VertexDataTransformedA::position)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::Normal,
+                verticesA.slice(&VertexDataTransformedA::normal)},
+            Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+                verticesA.slice(&VertexDataTransformedA::textureCoordinates)},
+        }};
+
+    /* Second is non-indexed, has float positions and no normals, so those get
+       zero-filled */
+    const struct VertexDataB {
+        Vector2 textureCoordinates;
+        Vector3 position;
+    } vertexDataB[]{
+        {{0.25f, 0.75f}, {1.0f, 1.0f, 1.0f}},
+        {{0.0f, 0.0f}, {2.0f, 2.0f, 2.0f}},
+        {{1.0f, 0.0f}, {3.0f, 3.0f, 3.0f}},
+    };
+    Containers::StridedArrayView1D<const VertexDataB> verticesB = vertexDataB;
+    Trade::MeshData b{MeshPrimitive::Points, {}, vertexDataB, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            verticesB.slice(&VertexDataB::textureCoordinates)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            verticesB.slice(&VertexDataB::position)},
+    }};
+
+    const UnsignedInt meshIds[]{0, 1, 0};
+    const Matrix4 transformations[]{
+        Matrix4::translation({1.0f, 0.0f, 0.0f}),
+        Matrix4::scaling(Vector3{2.0f}),
+        Matrix4::rotationZ(90.0_degf)
+    };
+    ThreadPool::setGlobalThreadCount(data.globalThreadCount);
+    Trade::MeshData dst = MeshTools::concatenateTransformed3D({a, b}, meshIds, transformations, data.threadCount);
+    ThreadPool::setGlobalThreadCount(1);
+    CORRADE_COMPARE(dst.primitive(), MeshPrimitive::Points);
+    CORRADE_COMPARE(dst.vertexCount(), 7);
+    CORRADE_COMPARE(dst.attributeCount(), 3);
+    CORRADE_COMPARE(dst.attributeName(0), Trade::MeshAttribute::Position);
+    CORRADE_COMPARE(dst.attributeFormat(0), VertexFormat::Vector3);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(0),
+        Containers::arrayView<Vector3>({
+            {2.0f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 0.0f},
+            {2.0f, 2.0f, 2.0f},
+            {4.0f, 4.0f, 4.0f},
+            {6.0f, 6.0f, 6.0f},
+            {0.0f, 1.0f, 0.0f},
+            {-1.0f, 0.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(dst.attributeName(1), Trade::MeshAttribute::Normal);
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(1),
+        Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f},
+            {},
+            {},
+            {},
+            {0.0f, 0.0f, 1.0f},
+            {0.0f, 1.0f, 0.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(dst.attributeName(2), Trade::MeshAttribute::TextureCoordinates);
+    CORRADE_COMPARE_AS(dst.attribute<Vector2>(2),
+        Containers::arrayView<Vector2>({
+            {0.5f, 0.5f},
+            {1.0f, 1.0f},
+            {0.25f, 0.75f},
+            {0.0f, 0.0f},
+            {1.0f, 0.0f},
+            {0.5f, 0.5f},
+            {1.0f, 1.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_VERIFY(dst.isIndexed());
+    CORRADE_COMPARE(dst.indexType(), MeshIndexType::UnsignedInt);
+    CORRADE_COMPARE_AS(dst.indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            1, 0,
+            2, 3, 4,
+            6, 5
+        }), TestSuite::Compare::Container);
+}
+
+void ConcatenateTest::concatenateTransformed3DVector4Tangents() {
+    using namespace Math::Literals;
+
+    /* Four-component tangents should have just the XYZ part transformed, the
+       bitangent sign is kept. Interleaved layout of the input should be
+       preserved as there's no format change. */
+    const struct Vertex {
+        Vector3 position;
+        Vector4 tangent;
+    } vertexData[]{
+        {{1.0f, 0.0f, 0.0f}, {1.0f, 0.0f, 0.0f, -1.0f}},
+        {{0.0f, 0.0f, 1.0f}, {0.0f, 0.0f, 1.0f, 1.0f}},
+    };
+    Containers::StridedArrayView1D<const Vertex> vertices = vertexData;
+    Trade::MeshData a{MeshPrimitive::Points, {}, vertexData, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::Tangent,
+            vertices.slice(&Vertex::tangent)},
+    }};
+
+    const UnsignedInt meshIds[]{0, 0};
+    const Matrix4 transformations[]{
+        Matrix4::rotationY(90.0_degf),
+        Matrix4::translation({0.0f, 1.0f, 0.0f})
+    };
+    Trade::MeshData dst = MeshTools::concatenateTransformed3D({a}, meshIds, transformations);
+    CORRADE_VERIFY(!dst.isIndexed());
+    CORRADE_COMPARE(dst.attributeStride(0), sizeof(Vertex));
+    CORRADE_COMPARE_AS(dst.attribute<Vector3>(Trade::MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.0f, 0.0f, -1.0f},
+            {1.0f, 0.0f, 0.0f},
+            {1.0f, 1.0f, 0.0f},
+            {0.0f, 1.0f, 1.0f},
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(dst.attribute<Vector4>(Trade::MeshAttribute::Tangent),
+        Containers::arrayView<Vector4>({
+            {0.0f, 0.0f, -1.0f, -1.0f},
+            {1.0f, 0.0f, 0.0f, 1.0f},
+            {1.0f, 0.0f, 0.0f, -1.0f},
+            {0.0f, 0.0f, 1.0f, 1.0f},
+        }), TestSuite::Compare::Container);
+}
+
 void ConcatenateTest::concatenateUnsupportedPrimitive() {
     CORRADE_SKIP_IF_NO_ASSERT();
 
@@ -841,6 +1011,81 @@ void ConcatenateTest::concatenateIntoNoMeshes() {
     CORRADE_COMPARE(out, "MeshTools::concatenateInto(): no meshes passed\n");
 }
 
+void ConcatenateTest::concatenateTransformed3DInvalid() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const Vector2 positions2D[2]{};
+    const Vector3 positions[2]{};
+    const Vector2 textureCoordinates[2]{};
+    const struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertexData[2]{};
+    Containers::StridedArrayView1D<const Vertex> vertices = vertexData;
+
+    Trade::MeshData a{MeshPrimitive::Triangles, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+    Trade::MeshData lines{MeshPrimitive::Lines, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+    Trade::MeshData strip{MeshPrimitive::TriangleStrip, {}, positions, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions)}
+    }};
+    Trade::MeshData noPositions{MeshPrimitive::Triangles, {}, textureCoordinates, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            Containers::arrayView(textureCoordinates)}
+    }};
+    Trade::MeshData positions2DMesh{MeshPrimitive::Triangles, {}, positions2D, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            Containers::arrayView(positions2D)}
+    }};
+    Trade::MeshData texcoords{MeshPrimitive::Triangles, {}, vertexData, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            vertices.slice(&Vertex::textureCoordinates)}
+    }};
+    Trade::MeshData texcoordsPacked{MeshPrimitive::Triangles, {}, vertexData, {
+        Trade::MeshAttributeData{Trade::MeshAttribute::Position,
+            vertices.slice(&Vertex::position)},
+        Trade::MeshAttributeData{Trade::MeshAttribute::TextureCoordinates,
+            VertexFormat::Vector2usNormalized,
+            vertices.slice(&Vertex::textureCoordinates)}
+    }};
+
+    const UnsignedInt meshIds[]{0, 1, 0};
+    const UnsignedInt meshIdsFirst[]{2};
+    const Matrix4 transformations[3]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    MeshTools::concatenateTransformed3D({a}, meshIds, Containers::arrayView(transformations).prefix(2));
+    MeshTools::concatenateTransformed3D({a}, nullptr, nullptr);
+    MeshTools::concatenateTransformed3D({a}, meshIds, transformations);
+    /* The first instance mesh is what matters, not the first mesh */
+    MeshTools::concatenateTransformed3D({a, a, strip}, meshIdsFirst, Containers::arrayView(transformations).prefix(1));
+    MeshTools::concatenateTransformed3D({a, a, noPositions}, meshIdsFirst, Containers::arrayView(transformations).prefix(1));
+    MeshTools::concatenateTransformed3D({a, a, positions2DMesh}, meshIdsFirst, Containers::arrayView(transformations).prefix(1));
+    MeshTools::concatenateTransformed3D({a, lines}, meshIds, transformations);
+    MeshTools::concatenateTransformed3D({a, positions2DMesh}, meshIds, transformations);
+    MeshTools::concatenateTransformed3D({texcoords, texcoordsPacked}, meshIds, transformations);
+    CORRADE_COMPARE_AS(out,
+        "MeshTools::concatenateTransformed3D(): expected the same count of mesh IDs and transformations but got 3 and 2\n"
+        "MeshTools::concatenateTransformed3D(): expected at least one instance\n"
+        "MeshTools::concatenateTransformed3D(): mesh ID 1 at index 1 out of range for 1 meshes\n"
+        "MeshTools::concatenateTransformed3D(): MeshPrimitive::TriangleStrip is not supported, turn it into a plain indexed mesh first\n"
+        "MeshTools::concatenateTransformed3D(): the first instance mesh has no positions\n"
+        "MeshTools::concatenateTransformed3D(): expected 3D positions but got VertexFormat::Vector2\n"
+        "MeshTools::concatenateTransformed3D(): expected MeshPrimitive::Triangles but got MeshPrimitive::Lines in mesh 1\n"
+        "MeshTools::concatenateTransformed3D(): expected 3 components for attribute 0 (Trade::MeshAttribute::Position) but got VertexFormat::Vector2 in mesh 1 attribute 0\n"
+        "MeshTools::concatenateTransformed3D(): expected VertexFormat::Vector2 for attribute 1 (Trade::MeshAttribute::TextureCoordinates) but got VertexFormat::Vector2usNormalized in mesh 1 attribute 1\n",
+        TestSuite::Compare::String);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::MeshTools::Test::ConcatenateTest)
@@ -0,0 +1,354 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "PixelFormatConversion.h"
+
+#include <cstring>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/imageUtilities.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/PackingBatch.h"
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum {
+
+namespace {
+
+/* Channel formats that can be converted between each other through a
+   floating-point intermediate */
+bool isFloatConvertible(const PixelFormat channelFormat) {
+    return channelFormat == PixelFormat::R8Unorm ||
+           channelFormat == PixelFormat::R8Snorm ||
+           channelFormat == PixelFormat::R8Srgb ||
+           channelFormat == PixelFormat::R16Unorm ||
+           channelFormat == PixelFormat::R16Snorm ||
+           channelFormat == PixelFormat::R16F ||
+           channelFormat == PixelFormat::R32F;
+}
+
+}
+
+bool isPixelFormatConversionSupported(const PixelFormat source, const PixelFormat destination) {
+    if(isPixelFormatImplementationSpecific(source) ||
+       isPixelFormatImplementationSpecific(destination) ||
+       isPixelFormatDepthOrStencil(source) ||
+       isPixelFormatDepthOrStencil(destination))
+        return false;
+
+    const PixelFormat sourceChannelFormat = pixelFormatChannelFormat(source);
+    const PixelFormat destinationChannelFormat = pixelFormatChannelFormat(destination);
+    return sourceChannelFormat == destinationChannelFormat ||
+        (isFloatConvertible(sourceChannelFormat) &&
+         isFloatConvertible(destinationChannelFormat));
+}
+
+namespace {
+
+/* Bit pattern of a value of 1 in given channel format, or of the maximum for
+   normalized formats, used to fill a missing alpha channel */
+void fillOne(const PixelFormat channelFormat, char* const out) {
+    switch(channelFormat) {
+        case PixelFormat::R8Unorm:
+        case PixelFormat::R8Srgb: {
+            const UnsignedByte one = 0xff;
+            std::memcpy(out, &one, 1);
+        } break;
+        case PixelFormat::R8Snorm: {
+            const Byte one = 0x7f;
+            std::memcpy(out, &one, 1);
+        } break;
+        case PixelFormat::R8UI:
+        case PixelFormat::R8I: {
+            const UnsignedByte one = 1;
+            std::memcpy(out, &one, 1);
+        } break;
+        case PixelFormat::R16Unorm: {
+            const UnsignedShort one = 0xffff;
+            std::memcpy(out, &one, 2);
+        } break;
+        case PixelFormat::R16Snorm: {
+            const Short one = 0x7fff;
+            std::memcpy(out, &one, 2);
+        } break;
+        case PixelFormat::R16UI:
+        case PixelFormat::R16I: {
+            const UnsignedShort one = 1;
+            std::memcpy(out, &one, 2);
+        } break;
+        case PixelFormat::R16F: {
+            const UnsignedShort one = 0x3c00;
+            std::memcpy(out, &one, 2);
+        } break;
+        case PixelFormat::R32UI:
+        case PixelFormat::R32I: {
+            const UnsignedInt one = 1;
+            std::memcpy(out, &one, 4);
+        } break;
+        case PixelFormat::R32F: {
+            const Float one = 1.0f;
+            std::memcpy(out, &one, 4);
+        } break;
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+/* Conversion between formats of the same channel type, i.e. just copying
+   channels around bit-exactly */
+void convertChannels(const Containers::StridedArrayView4D<const char>& source, const PixelFormat sourceFormat, const Containers::StridedArrayView4D<char>& destination, const PixelFormat destinationFormat, const Vector4ub& swizzle) {
+    const PixelFormat channelFormat = pixelFormatChannelFormat(sourceFormat);
+    const std::size_t componentSize = pixelFormatSize(channelFormat);
+    const UnsignedInt sourceChannelCount = pixelFormatChannelCount(sourceFormat);
+    const UnsignedInt destinationChannelCount = pixelFormatChannelCount(destinationFormat);
+    const std::size_t width = source.size()[2];
+
+    char zero[4]{};
+    char one[4];
+    fillOne(channelFormat, one);
+
+    const std::size_t rowCount = source.size()[0]*source.size()[1];
+    ThreadPool::global().parallelFor(rowCount, Math::max(std::size_t{1}, 16384/Math::max(width, std::size_t{1})), [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const Containers::StridedArrayView2D<const char> sourceRow = source[row/source.size()[1]][row%source.size()[1]];
+            const Containers::StridedArrayView2D<char> destinationRow = destination[row/source.size()[1]][row%source.size()[1]];
+            for(UnsignedInt c = 0; c != destinationChannelCount; ++c) {
+                const Containers::StridedArrayView2D<char> destinationChannel = destinationRow.sliceSize({0, c*componentSize}, {width, componentSize});
+                if(swizzle[c] < sourceChannelCount) {
+                    Utility::copy(sourceRow.sliceSize({0, swizzle[c]*componentSize}, {width, componentSize}), destinationChannel);
+                    continue;
+                }
+
+                const char* const fill = swizzle[c] == 3 ? one : zero;
+                for(std::size_t x = 0; x != width; ++x)
+                    std::memcpy(&destinationChannel[x][0], fill, componentSize);
+            }
+        }
+    });
+}
+
+/* Unpacks a row of pixels to floats, optionally converting sRGB channels to
+   linear */
+void unpackRow(const PixelFormat channelFormat, const Containers::StridedArrayView2D<const char>& in, const Containers::StridedArrayView2D<Float>& out, const bool decodeSrgb) {
+    switch(channelFormat) {
+        case PixelFormat::R8Unorm:
+        case PixelFormat::R8Srgb:
+            Math::unpackInto(Containers::arrayCast<2, const UnsignedByte>(in), out);
+            break;
+        case PixelFormat::R8Snorm:
+            Math::unpackInto(Containers::arrayCast<2, const Byte>(in), out);
+            break;
+        case PixelFormat::R16Unorm:
+            Math::unpackInto(Containers::arrayCast<2, const UnsignedShort>(in), out);
+            break;
+        case PixelFormat::R16Snorm:
+            Math::unpackInto(Containers::arrayCast<2, const Short>(in), out);
+            break;
+        case PixelFormat::R16F:
+            Math::unpackHalfInto(Containers::arrayCast<2, const UnsignedShort>(in), out);
+            break;
+        case PixelFormat::R32F:
+            Utility::copy(Containers::arrayCast<2, const Float>(in), out);
+            break;
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    /* Only the first three channels are sRGB, alpha is linear */
+    if(decodeSrgb && channelFormat == PixelFormat::R8Srgb) {
+        const Containers::StridedArrayView2D<const UnsignedByte> srgb = Containers::arrayCast<2, const UnsignedByte>(in);
+        for(std::size_t x = 0; x != out.size()[0]; ++x)
+            for(std::size_t c = 0, cEnd = Math::min(out.size()[1], std::size_t{3}); c != cEnd; ++c)
+                out[x][c] = Implementation::srgbToLinear(srgb[x][c]);
+    }
+}
+
+/* Inverse of unpackRow(), clamps the input to the range of normalized
+   formats. Modifies the input. */
+void packRow(const PixelFormat channelFormat, const Containers::StridedArrayView2D<Float>& in, const Containers::StridedArrayView2D<char>& out, const bool encodeSrgb) {
+    if(encodeSrgb && channelFormat == PixelFormat::R8Srgb) {
+        for(std::size_t x = 0; x != in.size()[0]; ++x)
+            for(std::size_t c = 0, cEnd = Math::min(in.size()[1], std::size_t{3}); c != cEnd; ++c)
+                in[x][c] = Implementation::linearToSrgb(in[x][c]);
+    }
+
+    const Float min = channelFormat == PixelFormat::R8Snorm ||
+                      channelFormat == PixelFormat::R16Snorm ? -1.0f : 0.0f;
+    if(channelFormat != PixelFormat::R16F && channelFormat != PixelFormat::R32F) {
+        for(Containers::StridedArrayView1D<Float> pixel: in)
+            for(Float& value: pixel)
+                value = Math::clamp(value, min, 1.0f);
+    }
+
+    switch(channelFormat) {
+        case PixelFormat::R8Unorm:
+        case PixelFormat::R8Srgb:
+            Math::packInto(in, Containers::arrayCast<2, UnsignedByte>(out));
+            break;
+        case PixelFormat::R8Snorm:
+            Math::packInto(in, Containers::arrayCast<2, Byte>(out));
+            break;
+        case PixelFormat::R16Unorm:
+            Math::packInto(in, Containers::arrayCast<2, UnsignedShort>(out));
+            break;
+        case PixelFormat::R16Snorm:
+            Math::packInto(in, Containers::arrayCast<2, Short>(out));
+            break;
+        case PixelFormat::R16F:
+            Math::packHalfInto(in, Containers::arrayCast<2, UnsignedShort>(out));
+            break;
+        case PixelFormat::R32F:
+            Utility::copy(Containers::StridedArrayView2D<const Float>{in}, Containers::arrayCast<2, Float>(out));
+            break;
+        default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+}
+
+/* Conversion through a floating-point intermediate. Each row is unpacked to
+   four float channels, with missing channels being 0 or 1 for alpha, then
+   swizzled into the destination channel count and packed. */
+void convertThroughFloat(const Containers::StridedArrayView4D<const char>& source, const PixelFormat sourceFormat, const Containers::StridedArrayView4D<char>& destination, const PixelFormat destinationFormat, const Vector4ub& swizzle) {
+    const PixelFormat sourceChannelFormat = pixelFormatChannelFormat(sourceFormat);
+    const PixelFormat destinationChannelFormat = pixelFormatChannelFormat(destinationFormat);
+    const std::size_t sourceChannelCount = pixelFormatChannelCount(sourceFormat);
+    const std::size_t destinationChannelCount = pixelFormatChannelCount(destinationFormat);
+    const bool decodeSrgb = isPixelFormatSrgb(sourceFormat) && !isPixelFormatSrgb(destinationFormat);
+    const bool encodeSrgb = !isPixelFormatSrgb(sourceFormat) && isPixelFormatSrgb(destinationFormat);
+    const std::size_t width = source.size()[2];
+
+    /* Per-thread scratch memory for the unpacked and swizzled rows */
+    ThreadPool& pool = ThreadPool::global();
+    const std::size_t scratchSize = width*(4 + destinationChannelCount);
+    Containers::Array<Float> scratch{NoInit, pool.threadCount()*scratchSize};
+
+    const std::size_t rowCount = source.size()[0]*source.size()[1];
+    pool.parallelFor(rowCount, Math::max(std::size_t{1}, 16384/Math::max(width, std::size_t{1})), [&](const std::size_t begin, const std::size_t end, const UnsignedInt thread) {
+        const Containers::StridedArrayView2D<Float> unpacked{scratch.sliceSize(thread*scratchSize, width*4), {width, 4}};
+        const Containers::StridedArrayView2D<Float> swizzled{scratch.sliceSize(thread*scratchSize + width*4, width*destinationChannelCount), {width, destinationChannelCount}};
+        const Containers::StridedArrayView2D<const Float> unpackedChannels = unpacked.transposed<0, 1>();
+        const Containers::StridedArrayView2D<Float> swizzledChannels = swizzled.transposed<0, 1>();
+
+        /* Fill the channels not present in the source just once */
+        for(std::size_t c = sourceChannelCount; c != 4; ++c) {
+            const Float fill = c == 3 ? 1.0f : 0.0f;
+            for(std::size_t x = 0; x != width; ++x)
+                unpacked[x][c] = fill;
+        }
+
+        for(std::size_t row = begin; row != end; ++row) {
+            unpackRow(sourceChannelFormat, source[row/source.size()[1]][row%source.size()[1]], unpacked.prefix({width, sourceChannelCount}), decodeSrgb);
+            for(std::size_t c = 0; c != destinationChannelCount; ++c)
+                Utility::copy(unpackedChannels[swizzle[c]], swizzledChannels[c]);
+            packRow(destinationChannelFormat, swizzled, destination[row/source.size()[1]][row%source.size()[1]], encodeSrgb);
+        }
+    });
+}
+
+void convertPixelFormatImplementation(const Containers::StridedArrayView4D<const char>& source, const PixelFormat sourceFormat, const Containers::StridedArrayView4D<char>& destination, const PixelFormat destinationFormat, const Vector4ub& swizzle) {
+    /* Same format with an identity swizzle is just a copy */
+    const UnsignedInt destinationChannelCount = pixelFormatChannelCount(destinationFormat);
+    bool identity = sourceFormat == destinationFormat;
+    for(UnsignedInt c = 0; c != destinationChannelCount; ++c)
+        identity = identity && swizzle[c] == c;
+    if(identity)
+        Utility::copy(source, destination);
+    else if(pixelFormatChannelFormat(sourceFormat) == pixelFormatChannelFormat(destinationFormat))
+        convertChannels(source, sourceFormat, destination, destinationFormat, swizzle);
+    else
+        convertThroughFloat(source, sourceFormat, destination, destinationFormat, swizzle);
+}
+
+/* Images of all dimensions are treated as 3D, with the views being
+   [z][y][x][byte] */
+Containers::StridedArrayView4D<const char> pixels4D(const ImageView1D& image) {
+    return image.pixels().expanded<0>(Containers::Size3D{1, 1, std::size_t(image.size().x())});
+}
+Containers::StridedArrayView4D<const char> pixels4D(const ImageView2D& image) {
+    return image.pixels().expanded<0>(Containers::Size2D{1, std::size_t(image.size().y())});
+}
+Containers::StridedArrayView4D<const char> pixels4D(const ImageView3D& image) {
+    return image.pixels();
+}
+Containers::StridedArrayView4D<char> pixels4D(const MutableImageView1D& image) {
+    return image.pixels().expanded<0>(Containers::Size3D{1, 1, std::size_t(image.size().x())});
+}
+Containers::StridedArrayView4D<char> pixels4D(const MutableImageView2D& image) {
+    return image.pixels().expanded<0>(Containers::Size2D{1, std::size_t(image.size().y())});
+}
+Containers::StridedArrayView4D<char> pixels4D(const MutableImageView3D& image) {
+    return image.pixels();
+}
+
+template<UnsignedInt dimensions> void convertPixelFormatInternal(const BasicImageView<dimensions>& source, const BasicMutableImageView<dimensions>& destination, const Vector4ub& swizzle) {
+    CORRADE_ASSERT(source.size() == destination.size(),
+        "convertPixelFormat(): expected source and destination size to match but got" << Debug::packed << source.size() << "and" << Debug::packed << destination.size(), );
+    CORRADE_ASSERT(isPixelFormatConversionSupported(source.format(), destination.format()),
+        "convertPixelFormat(): conversion from" << source.format() << "to" << destination.format() << "is not supported", );
+    CORRADE_ASSERT((swizzle < Vector4ub{4}).all(),
+        "convertPixelFormat(): expected swizzle components to be less than 4 but got" << Debug::packed << swizzle, );
+
+    convertPixelFormatImplementation(pixels4D(source), source.format(), pixels4D(destination), destination.format(), swizzle);
+}
+
+template<UnsignedInt dimensions> Image<dimensions> convertPixelFormatInternal(const BasicImageView<dimensions>& source, const PixelFormat format, const Vector4ub& swizzle) {
+    /* Checked here already to not allocate an image of a potentially
+       implementation-specific format */
+    CORRADE_ASSERT(isPixelFormatConversionSupported(source.format(), format),
+        "convertPixelFormat(): conversion from" << source.format() << "to" << format << "is not supported", (Image<dimensions>{format}));
+
+    Image<dimensions> out = Implementation::allocateImage<dimensions>(format, source.size(), source.flags());
+    convertPixelFormatInternal<dimensions>(source, out, swizzle);
+    return out;
+}
+
+}
+
+void convertPixelFormat(const ImageView1D& source, const MutableImageView1D& destination, const Vector4ub& swizzle) {
+    convertPixelFormatInternal<1>(source, destination, swizzle);
+}
+
+void convertPixelFormat(const ImageView2D& source, const MutableImageView2D& destination, const Vector4ub& swizzle) {
+    convertPixelFormatInternal<2>(source, destination, swizzle);
+}
+
+void convertPixelFormat(const ImageView3D& source, const MutableImageView3D& destination, const Vector4ub& swizzle) {
+    convertPixelFormatInternal<3>(source, destination, swizzle);
+}
+
+Image1D convertPixelFormat(const ImageView1D& source, const PixelFormat format, const Vector4ub& swizzle) {
+    return convertPixelFormatInternal<1>(source, format, swizzle);
+}
+
+Image2D convertPixelFormat(const ImageView2D& source, const PixelFormat format, const Vector4ub& swizzle) {
+    return convertPixelFormatInternal<2>(source, format, swizzle);
+}
+
+Image3D convertPixelFormat(const ImageView3D& source, const PixelFormat format, const Vector4ub& swizzle) {
+    return convertPixelFormatInternal<3>(source, format, swizzle);
+}
+
+}
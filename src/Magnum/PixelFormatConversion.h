@@ -0,0 +1,144 @@
+#ifndef Magnum_PixelFormatConversion_h
+#define Magnum_PixelFormatConversion_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::isPixelFormatConversionSupported(), @ref Magnum::convertPixelFormat()
+ * @m_since_latest
+ */
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/Math/Vector4.h"
+
+namespace Magnum {
+
+/**
+@brief Whether a pixel format conversion is supported
+@m_since_latest
+
+Returns @cpp true @ce if @p source can be converted to @p destination with
+@ref convertPixelFormat(), @cpp false @ce otherwise. Supported are:
+
+-   Conversion between any two formats with the same
+    @ref pixelFormatChannelFormat(), i.e. adding, removing or reordering
+    channels, including integral formats. Channels are copied bit-exactly.
+-   Conversion between any two formats with a channel format being
+    @ref PixelFormat::R8Unorm, @relativeref{PixelFormat,R8Snorm},
+    @relativeref{PixelFormat,R8Srgb}, @relativeref{PixelFormat,R16Unorm},
+    @relativeref{PixelFormat,R16Snorm}, @relativeref{PixelFormat,R16F} or
+    @relativeref{PixelFormat,R32F}, in any channel count. When converting from
+    an sRGB to a non-sRGB format or vice versa, the RGB channels are converted
+    from / to linear space, the alpha channel is kept as-is. Values that are
+    outside of the range of the destination normalized format are clamped.
+
+Implementation-specific, depth and stencil formats are not supported.
+@see @ref isPixelFormatImplementationSpecific(),
+    @ref isPixelFormatDepthOrStencil()
+*/
+MAGNUM_EXPORT bool isPixelFormatConversionSupported(PixelFormat source, PixelFormat destination);
+
+/**
+@brief Convert pixel format of a 1D image
+@m_since_latest
+
+Expects that @p source and @p destination have the same size, that the
+conversion between their formats is supported according to
+@ref isPixelFormatConversionSupported() and that all @p swizzle components are
+less than @cpp 4 @ce. Channel @cpp i @ce of the destination is taken from
+channel @cpp swizzle[i] @ce of the source. If the source doesn't have such
+channel, it's filled with @cpp 0 @ce for the RGB channels and with @cpp 1 @ce
+for the alpha channel, which means the default swizzle expands RGB to RGBA
+with an opaque alpha or drops trailing channels. For example, a
+@cpp {2, 1, 0, 3} @ce swizzle converts BGRA data to RGBA.
+
+Both images can have arbitrary @ref PixelStorage parameters, the source and
+destination memory is expected to not overlap. The conversion is done with
+batch functions from @ref Math/PackingBatch.h and is executed in parallel on
+the @ref ThreadPool::global() thread pool.
+@see @ref pixelFormatChannelFormat(), @ref pixelFormatChannelCount(),
+    @ref Math::packInto(), @ref Math::unpackInto(),
+    @ref Math::packHalfInto(), @ref Math::unpackHalfInto()
+*/
+MAGNUM_EXPORT void convertPixelFormat(const ImageView1D& source, const MutableImageView1D& destination, const Vector4ub& swizzle = {0, 1, 2, 3});
+
+/**
+@brief Convert pixel format of a 2D image
+@m_since_latest
+
+Like @ref convertPixelFormat(const ImageView1D&, const MutableImageView1D&, const Vector4ub&)
+but for 2D images.
+
+@snippet Magnum.cpp convertPixelFormat
+*/
+MAGNUM_EXPORT void convertPixelFormat(const ImageView2D& source, const MutableImageView2D& destination, const Vector4ub& swizzle = {0, 1, 2, 3});
+
+/**
+@brief Convert pixel format of a 3D image
+@m_since_latest
+
+Like @ref convertPixelFormat(const ImageView1D&, const MutableImageView1D&, const Vector4ub&)
+but for 3D images.
+*/
+MAGNUM_EXPORT void convertPixelFormat(const ImageView3D& source, const MutableImageView3D& destination, const Vector4ub& swizzle = {0, 1, 2, 3});
+
+/**
+@brief Convert a 1D image to a newly allocated image of given pixel format
+@m_since_latest
+
+Allocates an image of @p format with the same size and @ref ImageFlags1D as
+@p source and with the default @ref PixelStorage and delegates to
+@ref convertPixelFormat(const ImageView1D&, const MutableImageView1D&, const Vector4ub&).
+See its documentation for more information.
+*/
+MAGNUM_EXPORT Image1D convertPixelFormat(const ImageView1D& source, PixelFormat format, const Vector4ub& swizzle = {0, 1, 2, 3});
+
+/**
+@brief Convert a 2D image to a newly allocated image of given pixel format
+@m_since_latest
+
+Allocates an image of @p format with the same size and @ref ImageFlags2D as
+@p source and with the default @ref PixelStorage and delegates to
+@ref convertPixelFormat(const ImageView2D&, const MutableImageView2D&, const Vector4ub&).
+See its documentation for more information.
+*/
+MAGNUM_EXPORT Image2D convertPixelFormat(const ImageView2D& source, PixelFormat format, const Vector4ub& swizzle = {0, 1, 2, 3});
+
+/**
+@brief Convert a 3D image to a newly allocated image of given pixel format
+@m_since_latest
+
+Allocates an image of @p format with the same size and @ref ImageFlags3D as
+@p source and with the default @ref PixelStorage and delegates to
+@ref convertPixelFormat(const ImageView3D&, const MutableImageView3D&, const Vector4ub&).
+See its documentation for more information.
+*/
+MAGNUM_EXPORT Image3D convertPixelFormat(const ImageView3D& source, PixelFormat format, const Vector4ub& swizzle = {0, 1, 2, 3});
+
+}
+
+#endif
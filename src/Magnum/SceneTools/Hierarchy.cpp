@@ -36,6 +36,7 @@
 #include "Magnum/DimensionTraits.h"
 #include "Magnum/Math/Matrix3.h"
 #include "Magnum/Math/Matrix4.h"
+#include "Magnum/SceneTools/Map.h"
 #include "Magnum/Trade/SceneData.h"
 
 namespace Magnum { namespace SceneTools {
@@ -260,6 +261,64 @@ void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::Str
 
 namespace {
 
+void objectMappingImplementation(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& orderedObjects, const Containers::ArrayView<UnsignedInt> out) {
+    /* Objects in the hierarchy get numbered first, in given order */
+    UnsignedInt next = 0;
+    for(const UnsignedInt object: orderedObjects)
+        out[object] = next++;
+
+    /* All remaining objects after, keeping their relative order */
+    for(UnsignedInt& i: out)
+        if(i == ~UnsignedInt{}) i = next++;
+
+    CORRADE_INTERNAL_ASSERT(next == scene.mappingBound());
+    #ifdef CORRADE_NO_ASSERT
+    static_cast<void>(scene);
+    #endif
+}
+
+}
+
+Containers::Array<UnsignedInt> objectMappingDepthFirst(const Trade::SceneData& scene) {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::objectMappingDepthFirst(): the scene has no hierarchy", {});
+
+    Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>> children = childrenDepthFirst(scene);
+    Containers::Array<UnsignedInt> out{DirectInit, std::size_t(scene.mappingBound()), ~UnsignedInt{}};
+    objectMappingImplementation(scene, stridedArrayView(children).slice(&decltype(children)::Type::first), out);
+    return out;
+}
+
+Containers::Array<UnsignedInt> objectMappingBreadthFirst(const Trade::SceneData& scene) {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::objectMappingBreadthFirst(): the scene has no hierarchy", {});
+
+    Containers::Array<Containers::Pair<UnsignedInt, Int>> parents = parentsBreadthFirst(scene);
+    Containers::Array<UnsignedInt> out{DirectInit, std::size_t(scene.mappingBound()), ~UnsignedInt{}};
+    objectMappingImplementation(scene, stridedArrayView(parents).slice(&decltype(parents)::Type::first), out);
+    return out;
+}
+
+Trade::SceneData orderObjectsDepthFirst(const Trade::SceneData& scene) {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::orderObjectsDepthFirst(): the scene has no hierarchy",
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    const Containers::Array<UnsignedInt> mapping = objectMappingDepthFirst(scene);
+    return mapObjects(scene, stridedArrayView(mapping));
+}
+
+Trade::SceneData orderObjectsBreadthFirst(const Trade::SceneData& scene) {
+    CORRADE_ASSERT(scene.hasField(Trade::SceneField::Parent),
+        "SceneTools::orderObjectsBreadthFirst(): the scene has no hierarchy",
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+
+    const Containers::Array<UnsignedInt> mapping = objectMappingBreadthFirst(scene);
+    return mapObjects(scene, stridedArrayView(mapping));
+}
+
+namespace {
+
 template<UnsignedInt> struct SceneDataDimensionTraits;
 template<> struct SceneDataDimensionTraits<2> {
     static bool isDimensions(const Trade::SceneData& scene) {
@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::SceneTools::parentsBreadthFirst(), @ref Magnum::SceneTools::parentsBreadthFirstInto(), @ref Magnum::SceneTools::childrenDepthFirst(), @ref Magnum::SceneTools::childrenDepthFirstInto(), @ref Magnum::SceneTools::absoluteFieldTransformations2D(), @ref Magnum::SceneTools::absoluteFieldTransformations2DInto(), @ref Magnum::SceneTools::absoluteFieldTransformations3D(), @ref Magnum::SceneTools::absoluteFieldTransformations3DInto()
+ * @brief Function @ref Magnum::SceneTools::parentsBreadthFirst(), @ref Magnum::SceneTools::parentsBreadthFirstInto(), @ref Magnum::SceneTools::childrenDepthFirst(), @ref Magnum::SceneTools::childrenDepthFirstInto(), @ref Magnum::SceneTools::absoluteFieldTransformations2D(), @ref Magnum::SceneTools::absoluteFieldTransformations2DInto(), @ref Magnum::SceneTools::absoluteFieldTransformations3D(), @ref Magnum::SceneTools::absoluteFieldTransformations3DInto(), @ref Magnum::SceneTools::objectMappingDepthFirst(), @ref Magnum::SceneTools::objectMappingBreadthFirst(), @ref Magnum::SceneTools::orderObjectsDepthFirst(), @ref Magnum::SceneTools::orderObjectsBreadthFirst()
  * @m_since_latest
  */
 
@@ -131,6 +131,71 @@ in @p scene.
 */
 MAGNUM_SCENETOOLS_EXPORT void childrenDepthFirstInto(const Trade::SceneData& scene, const Containers::StridedArrayView1D<UnsignedInt>& mappingDestination, const Containers::StridedArrayView1D<UnsignedInt>& childCountDestination);
 
+/**
+@brief Calculate a depth-first object mapping
+@m_since_latest
+
+Returns an array of @ref Trade::SceneData::mappingBound() items where a value
+at index @cpp i @ce is a new ID for object @cpp i @ce such that objects in
+the hierarchy are numbered in the order returned by @ref childrenDepthFirst(),
+i.e. each object is directly followed by its whole subtree. Objects that
+aren't a part of the @ref Trade::SceneField::Parent field are numbered after
+all objects in the hierarchy, preserving their relative order. The result is
+meant to be passed to @ref mapObjects(); see also @ref orderObjectsDepthFirst()
+which does both in a single step.
+
+The operation is done in an @f$ \mathcal{O}(n) @f$ execution time and memory
+complexity, with @f$ n @f$ being @ref Trade::SceneData::mappingBound(). The
+same expectations as for @ref childrenDepthFirst() apply.
+
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<UnsignedInt> objectMappingDepthFirst(const Trade::SceneData& scene);
+
+/**
+@brief Calculate a breadth-first object mapping
+@m_since_latest
+
+Like @ref objectMappingDepthFirst(), but objects in the hierarchy are numbered
+in the order returned by @ref parentsBreadthFirst(), i.e. a parent is always
+before its children and children of the same parent are next to each other.
+The result is meant to be passed to @ref mapObjects(); see also
+@ref orderObjectsBreadthFirst() which does both in a single step.
+
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<UnsignedInt> objectMappingBreadthFirst(const Trade::SceneData& scene);
+
+/**
+@brief Renumber objects in a scene in a depth-first order
+@m_since_latest
+
+Calls @ref mapObjects() with the output of @ref objectMappingDepthFirst().
+The objects are then numbered in the order they're visited in a depth-first
+traversal, with each subtree being a contiguous range of object IDs, and all
+fields have their entries sorted by the object ID. Hierarchy traversals,
+transformation propagation and subsequent per-object field lookups thus
+become a linear memory walk. See @ref mapObjects() for details and further
+expectations.
+
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData orderObjectsDepthFirst(const Trade::SceneData& scene);
+
+/**
+@brief Renumber objects in a scene in a breadth-first order
+@m_since_latest
+
+Calls @ref mapObjects() with the output of @ref objectMappingBreadthFirst().
+Compared to @ref orderObjectsDepthFirst() the resulting order matches the
+output of @ref parentsBreadthFirst(), which is the order in which
+@ref absoluteFieldTransformations3D() and similar calculate the absolute
+transformations. See @ref mapObjects() for details and further expectations.
+
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData orderObjectsBreadthFirst(const Trade::SceneData& scene);
+
 /**
 @brief Calculate absolute 2D transformations for given field
 @m_since_latest
@@ -256,6 +321,12 @@ single mesh:
 
 @snippet SceneTools.cpp absoluteFieldTransformations3D-mesh-concatenate
 
+The same can be done with @ref MeshTools::concatenateTransformed3D(), which
+avoids the temporary per-instance copies and can process the instances in
+parallel:
+
+@snippet SceneTools.cpp absoluteFieldTransformations3D-mesh-concatenateTransformed3D
+
 @experimental
 
 @see @ref absoluteFieldTransformations3D(const Trade::SceneData&, UnsignedInt, const Matrix4&),
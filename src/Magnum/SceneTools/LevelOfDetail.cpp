@@ -0,0 +1,118 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "LevelOfDetail.h"
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools {
+
+Containers::Array<UnsignedInt> selectLevelOfDetail(const Trade::SceneData& scene, const Trade::SceneField meshField, const Trade::SceneField screenSizeField, const Containers::StridedArrayView1D<const Matrix4>& transformations, const Matrix4& camera, const Matrix4& projection) {
+    Containers::Array<UnsignedInt> out{NoInit, std::size_t(scene.mappingBound())};
+    selectLevelOfDetailInto(scene, meshField, screenSizeField, transformations, camera, projection, out);
+    return out;
+}
+
+void selectLevelOfDetailInto(const Trade::SceneData& scene, const Trade::SceneField meshField, const Trade::SceneField screenSizeField, const Containers::StridedArrayView1D<const Matrix4>& transformations, const Matrix4& camera, const Matrix4& projection, const Containers::StridedArrayView1D<UnsignedInt>& meshDestination) {
+    const Containers::Optional<UnsignedInt> meshFieldId = scene.findFieldId(meshField);
+    CORRADE_ASSERT(meshFieldId,
+        "SceneTools::selectLevelOfDetailInto(): field" << meshField << "not found", );
+    const Containers::Optional<UnsignedInt> screenSizeFieldId = scene.findFieldId(screenSizeField);
+    CORRADE_ASSERT(screenSizeFieldId,
+        "SceneTools::selectLevelOfDetailInto(): field" << screenSizeField << "not found", );
+    CORRADE_ASSERT(scene.fieldType(*meshFieldId) == Trade::SceneFieldType::UnsignedInt,
+        "SceneTools::selectLevelOfDetailInto(): expected" << meshField << "to be" << Trade::SceneFieldType::UnsignedInt << "but got" << scene.fieldType(*meshFieldId), );
+    CORRADE_ASSERT(scene.fieldType(*screenSizeFieldId) == Trade::SceneFieldType::Float,
+        "SceneTools::selectLevelOfDetailInto(): expected" << screenSizeField << "to be" << Trade::SceneFieldType::Float << "but got" << scene.fieldType(*screenSizeFieldId), );
+    CORRADE_ASSERT(!scene.fieldArraySize(*meshFieldId) && !scene.fieldArraySize(*screenSizeFieldId),
+        "SceneTools::selectLevelOfDetailInto(): array fields aren't supported", );
+    const std::size_t fieldSize = scene.fieldSize(*meshFieldId);
+    CORRADE_ASSERT(scene.fieldSize(*screenSizeFieldId) == fieldSize,
+        "SceneTools::selectLevelOfDetailInto(): expected" << screenSizeField << "to have" << fieldSize << "entries but got" << scene.fieldSize(*screenSizeFieldId), );
+    CORRADE_ASSERT(transformations.size() == fieldSize,
+        "SceneTools::selectLevelOfDetailInto(): expected" << fieldSize << "transformations but got" << transformations.size(), );
+    CORRADE_ASSERT(meshDestination.size() == scene.mappingBound(),
+        "SceneTools::selectLevelOfDetailInto(): expected mesh destination view with" << scene.mappingBound() << "elements but got" << meshDestination.size(), );
+
+    /* Reference the mapping directly if it's of the right type, otherwise
+       convert it to a temporary array */
+    Containers::Array<UnsignedInt> mappingStorage;
+    Containers::StridedArrayView1D<const UnsignedInt> mapping;
+    if(scene.mappingType() == Trade::SceneMappingType::UnsignedInt)
+        mapping = scene.mapping<UnsignedInt>(*meshFieldId);
+    else {
+        mappingStorage = scene.mappingAsArray(*meshFieldId);
+        mapping = mappingStorage;
+    }
+    const Containers::StridedArrayView1D<const UnsignedInt> meshes = scene.field<UnsignedInt>(*meshFieldId);
+    const Containers::StridedArrayView1D<const Float> screenSizes = scene.field<Float>(*screenSizeFieldId);
+
+    /* Objects with no levels get nothing */
+    for(UnsignedInt& i: meshDestination) i = ~UnsignedInt{};
+
+    /* The W component of a clip-space position is a dot product of the last
+       projection row with a camera-space position. It's -Z for perspective
+       projections, i.e. distance from the camera, and 1 for orthographic
+       projections. The vertical projection scale then converts a size at
+       given distance to a fraction of the viewport height, which is 2 units
+       in NDC. */
+    const Vector4 projectionW = projection.row(3);
+    const Float projectionScale = projection[1][1]*0.5f;
+
+    for(std::size_t i = 0; i != fieldSize; ) {
+        const UnsignedInt object = mapping[i];
+        CORRADE_ASSERT(object < scene.mappingBound(),
+            "SceneTools::selectLevelOfDetailInto(): object" << object << "out of range for" << scene.mappingBound() << "objects", );
+
+        /* A diameter of a unit sphere scaled by the largest axis scale of the
+           object transformation, projected to the screen. An object behind
+           the camera has W negative and isn't visible at all. An object on
+           the camera plane has W zero, clamp it to get a large screen size
+           instead of a division by zero. */
+        const Matrix4 transformation = camera*transformations[i];
+        const Float w = Math::dot(projectionW, Vector4{transformation.translation(), 1.0f});
+        const bool visible = w >= 0.0f;
+        const Float screenSize = 2.0f*transformation.scaling().max()*projectionScale/Math::max(w, Math::TypeTraits<Float>::epsilon());
+
+        /* Go through all levels of this object and pick the first that fits.
+           If none does or the object isn't visible, it stays with no mesh. */
+        UnsignedInt selected = ~UnsignedInt{};
+        for(; i != fieldSize && mapping[i] == object; ++i) {
+            if(visible && selected == ~UnsignedInt{} && screenSizes[i] <= screenSize)
+                selected = meshes[i];
+        }
+        meshDestination[object] = selected;
+    }
+}
+
+}}
@@ -0,0 +1,102 @@
+#ifndef Magnum_SceneTools_LevelOfDetail_h
+#define Magnum_SceneTools_LevelOfDetail_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Function @ref Magnum::SceneTools::selectLevelOfDetail(), @ref Magnum::SceneTools::selectLevelOfDetailInto()
+ * @m_since_latest
+ */
+
+#include "Magnum/Magnum.h"
+#include "Magnum/SceneTools/visibility.h"
+#include "Magnum/Trade/Trade.h"
+
+namespace Magnum { namespace SceneTools {
+
+/**
+@brief Select a level of detail for each object
+@m_since_latest
+
+Levels of detail are described by a pair of custom fields sharing the same
+object mapping. The @p meshField is expected to be a
+@ref Trade::SceneFieldType::UnsignedInt containing a mesh ID for each level of
+detail and @p screenSizeField a @ref Trade::SceneFieldType::Float containing a
+screen size threshold for each corresponding level. Entries belonging to the
+same object are expected to be next to each other and ordered from the most
+detailed level with the largest threshold to the least detailed one with the
+smallest threshold:
+
+@snippet SceneTools.cpp selectLevelOfDetail-fields
+
+The @p transformations are expected to be absolute object transformations
+corresponding to entries of @p meshField, such as the output of
+@ref absoluteFieldTransformations3D(const Trade::SceneData&, Trade::SceneField, const Matrix4&)
+called with @p meshField. For each object, a screen size is calculated as the
+height of a unit sphere in object space projected with @p camera and
+@p projection, relative to the viewport height. It's the first level with a
+threshold not larger than this size that gets picked. To have the thresholds
+relative to the actual mesh size, divide them by the mesh bounding sphere
+radius. Objects on the camera plane get the most detailed level, objects
+behind the camera plane aren't visible and get no level at all. The selection
+is done with a scalar loop over the entries.
+
+Expects that both fields exist in @p scene, are of the above types, aren't
+arrays and have the same size, that @p transformations have the same size
+as @p meshField and that all object IDs in the fields are less than
+@ref Trade::SceneData::mappingBound().
+
+The returned array is indexed by object ID and has a size of
+@ref Trade::SceneData::mappingBound(). Objects that aren't in @p meshField,
+objects behind the camera and objects with the screen size below the threshold
+of the least detailed level have the value set to @cpp 0xffffffffu @ce. If you
+want the least detailed level to be always picked for objects in front of the
+camera, give it a threshold of @cpp 0.0f @ce.
+@experimental
+
+@see @ref selectLevelOfDetailInto(), @ref Trade::sceneFieldCustom()
+*/
+MAGNUM_SCENETOOLS_EXPORT Containers::Array<UnsignedInt> selectLevelOfDetail(const Trade::SceneData& scene, Trade::SceneField meshField, Trade::SceneField screenSizeField, const Containers::StridedArrayView1D<const Matrix4>& transformations, const Matrix4& camera, const Matrix4& projection);
+
+/**
+@brief Select a level of detail for each object into an existing array
+@m_since_latest
+
+Like @ref selectLevelOfDetail(), but puts the result into @p meshDestination
+instead of allocating a new array. Expects that @p meshDestination has a size
+of @ref Trade::SceneData::mappingBound(). If the object mapping type is
+@ref Trade::SceneMappingType::UnsignedInt, the function doesn't allocate any
+temporary memory, making it suitable for calling every frame with the same
+@p meshDestination.
+
+@snippet SceneTools.cpp selectLevelOfDetail
+@experimental
+*/
+MAGNUM_SCENETOOLS_EXPORT void selectLevelOfDetailInto(const Trade::SceneData& scene, Trade::SceneField meshField, Trade::SceneField screenSizeField, const Containers::StridedArrayView1D<const Matrix4>& transformations, const Matrix4& camera, const Matrix4& projection, const Containers::StridedArrayView1D<UnsignedInt>& meshDestination);
+
+}}
+
+#endif
@@ -26,7 +26,13 @@
 
 #include "Map.h"
 
+#include <algorithm> /* std::stable_sort() */
+#include <cstring>
+#include <map>
+#include <Corrade/Containers/BitArray.h>
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
 
 #include "Magnum/Math/PackingBatch.h"
 #include "Magnum/SceneTools/Combine.h"
@@ -199,4 +205,171 @@ void mapIndexFieldInPlace(Trade::SceneData& scene, const Trade::SceneField field
     return mapIndexFieldInPlace(scene, *fieldId, mapping);
 }
 
+namespace {
+
+template<class T> void mapParentsImplementation(const Containers::StridedArrayView1D<T>& field, const Containers::StridedArrayView1D<const UnsignedInt>& mapping) {
+    for(T& i: field) {
+        if(i == T(-1))
+            continue;
+
+        CORRADE_ASSERT(i >= 0 && UnsignedLong(i) < mapping.size(),
+            "SceneTools::mapObjects(): parent" << i << "out of range for" << mapping.size() << "objects", );
+        CORRADE_ASSERT(mapping[i] < (1ull << (sizeof(T)*8 - 1)),
+            "SceneTools::mapObjects(): mapping value" << mapping[i] << "not representable in" << Trade::Implementation::SceneFieldTypeFor<T>::type(), );
+        i = T(mapping[i]);
+    }
+}
+
+}
+
+Trade::SceneData mapObjects(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& mapping) {
+    CORRADE_ASSERT(mapping.size() == scene.mappingBound(),
+        "SceneTools::mapObjects(): expected" << scene.mappingBound() << "mapping values but got" << mapping.size(),
+        (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != mapping.size(); ++i) {
+        CORRADE_ASSERT(mapping[i] < scene.mappingBound(),
+            "SceneTools::mapObjects(): mapping value" << mapping[i] << "out of range for" << scene.mappingBound() << "objects",
+            (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+    }
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        CORRADE_ASSERT(
+            fieldType != Trade::SceneFieldType::StringOffset8 &&
+            fieldType != Trade::SceneFieldType::StringOffset16 &&
+            fieldType != Trade::SceneFieldType::StringOffset32 &&
+            fieldType != Trade::SceneFieldType::StringOffset64,
+            "SceneTools::mapObjects(): reordering" << fieldType << "fields is not implemented yet, sorry",
+            (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+    }
+    #endif
+
+    /* For every unique mapping view calculate the (new object ID, original
+       entry index) pairs sorted by the new ID, so fields that shared a mapping
+       before get the same reordering and stay shared after as well. A
+       map<tuple> is used for the same reasons as in combineFields(). */
+    std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, UnsignedInt> uniqueMappings;
+    Containers::Array<Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>>> sortedMappings{ValueInit, scene.fieldCount()};
+    Containers::Array<UnsignedInt> sortedMappingForField{NoInit, scene.fieldCount()};
+    Containers::BitArray implicitMapping{ValueInit, scene.fieldCount()};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Containers::StridedArrayView2D<const char> fieldMapping = scene.mapping(i);
+        const std::pair<std::map<std::tuple<const void*, std::size_t, std::ptrdiff_t>, UnsignedInt>::iterator, bool> inserted = uniqueMappings.emplace(std::make_tuple(fieldMapping.data(), fieldMapping.size()[0], fieldMapping.stride()[0]), i);
+        sortedMappingForField[i] = inserted.first->second;
+        if(!inserted.second)
+            continue;
+
+        Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>>& sorted = sortedMappings[i];
+        sorted = Containers::Array<Containers::Pair<UnsignedInt, UnsignedInt>>{NoInit, scene.fieldSize(i)};
+        scene.mappingInto(i, stridedArrayView(sorted).slice(&Containers::Pair<UnsignedInt, UnsignedInt>::first));
+        for(std::size_t j = 0; j != sorted.size(); ++j) {
+            CORRADE_ASSERT(sorted[j].first() < mapping.size(),
+                "SceneTools::mapObjects():" << scene.fieldName(i) << "object" << sorted[j].first() << "out of range for" << mapping.size() << "objects",
+                (Trade::SceneData{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {}}));
+            sorted[j] = {mapping[sorted[j].first()], UnsignedInt(j)};
+        }
+
+        /* Stable sort in order to preserve relative order of multiple entries
+           for the same object */
+        std::stable_sort(sorted.begin(), sorted.end(), [](const Containers::Pair<UnsignedInt, UnsignedInt>& a, const Containers::Pair<UnsignedInt, UnsignedInt>& b) {
+            return a.first() < b.first();
+        });
+
+        /* If the sorted mapping is a contiguous sequence from 0, the field can
+           be marked as implicit */
+        bool implicit = true;
+        for(std::size_t j = 0; j != sorted.size(); ++j) {
+            if(sorted[j].first() != j) {
+                implicit = false;
+                break;
+            }
+        }
+        if(implicit)
+            implicitMapping.set(i);
+    }
+
+    /* Pass the reordered mapping directly, field data either as placeholders
+       or, for bit and string fields, which combineFields() doesn't allow
+       placeholders for, as the original views. Those get overwritten with
+       the reordered contents below. */
+    Containers::Array<Trade::SceneFieldData> fields{ValueInit, scene.fieldCount()};
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const UnsignedInt sortedMappingId = sortedMappingForField[i];
+        const Containers::StridedArrayView1D<const UnsignedInt> fieldMapping = stridedArrayView(sortedMappings[sortedMappingId]).slice(&Containers::Pair<UnsignedInt, UnsignedInt>::first);
+
+        Trade::SceneFieldFlags fieldFlags = scene.fieldFlags(i) & ~(Trade::SceneFieldFlag::OffsetOnly|Trade::SceneFieldFlag::ImplicitMapping);
+        fieldFlags |= implicitMapping[sortedMappingId] ?
+            Trade::SceneFieldFlag::ImplicitMapping :
+            Trade::SceneFieldFlag::OrderedMapping;
+
+        const Trade::SceneFieldType fieldType = scene.fieldType(i);
+        const UnsignedShort fieldArraySize = scene.fieldArraySize(i);
+        if(fieldType == Trade::SceneFieldType::Bit) {
+            if(fieldArraySize)
+                fields[i] = Trade::SceneFieldData{scene.fieldName(i),
+                    Trade::SceneMappingType::UnsignedInt, fieldMapping,
+                    scene.fieldBitArrays(i), fieldFlags};
+            else
+                fields[i] = Trade::SceneFieldData{scene.fieldName(i),
+                    Trade::SceneMappingType::UnsignedInt, fieldMapping,
+                    scene.fieldBits(i), fieldFlags};
+        } else if(Trade::Implementation::isSceneFieldTypeString(fieldType)) {
+            const Trade::SceneFieldData original = scene.fieldData(i);
+            fields[i] = Trade::SceneFieldData{scene.fieldName(i),
+                Trade::SceneMappingType::UnsignedInt, fieldMapping,
+                original.stringData(), fieldType, original.fieldData(),
+                fieldFlags};
+        } else {
+            const std::size_t fieldTypeSize = Trade::sceneFieldTypeSize(fieldType)*(fieldArraySize ? fieldArraySize : 1);
+            fields[i] = Trade::SceneFieldData{scene.fieldName(i),
+                Trade::SceneMappingType::UnsignedInt, fieldMapping,
+                fieldType, Containers::StridedArrayView1D<const void>{{nullptr, fieldTypeSize*fieldMapping.size()}, fieldMapping.size(), std::ptrdiff_t(fieldTypeSize)},
+                fieldArraySize, fieldFlags};
+        }
+    }
+
+    Trade::SceneData out = combineFields(scene.mappingType(), scene.mappingBound(), fields);
+
+    /* Copy the field data in the new order */
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        const Containers::ArrayView<const Containers::Pair<UnsignedInt, UnsignedInt>> sorted = sortedMappings[sortedMappingForField[i]];
+
+        if(scene.fieldType(i) == Trade::SceneFieldType::Bit) {
+            const Containers::StridedBitArrayView2D src = scene.fieldBitArrays(i);
+            const Containers::MutableStridedBitArrayView2D dst = out.mutableFieldBitArrays(i);
+            for(std::size_t j = 0; j != sorted.size(); ++j) {
+                const Containers::StridedBitArrayView1D srcItem = src[sorted[j].second()];
+                const Containers::MutableStridedBitArrayView1D dstItem = dst[j];
+                for(std::size_t k = 0; k != srcItem.size(); ++k) {
+                    if(srcItem[k])
+                        dstItem.set(k);
+                    else
+                        dstItem.reset(k);
+                }
+            }
+        } else {
+            const Containers::StridedArrayView2D<const char> src = scene.field(i);
+            const Containers::StridedArrayView2D<char> dst = out.mutableField(i);
+            for(std::size_t j = 0; j != sorted.size(); ++j)
+                std::memcpy(dst[j].data(), src[sorted[j].second()].data(), dst.size()[1]);
+        }
+    }
+
+    /* Finally update the parent references to the new object IDs */
+    if(const Containers::Optional<UnsignedInt> parentFieldId = out.findFieldId(Trade::SceneField::Parent)) {
+        const Trade::SceneFieldType parentFieldType = out.fieldType(*parentFieldId);
+        if(parentFieldType == Trade::SceneFieldType::Int)
+            mapParentsImplementation(out.mutableField<Int>(*parentFieldId), mapping);
+        else if(parentFieldType == Trade::SceneFieldType::Short)
+            mapParentsImplementation(out.mutableField<Short>(*parentFieldId), mapping);
+        else if(parentFieldType == Trade::SceneFieldType::Byte)
+            mapParentsImplementation(out.mutableField<Byte>(*parentFieldId), mapping);
+        else if(parentFieldType == Trade::SceneFieldType::Long)
+            mapParentsImplementation(out.mutableField<Long>(*parentFieldId), mapping);
+        else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    }
+
+    return out;
+}
+
 }}
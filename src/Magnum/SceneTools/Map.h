@@ -27,7 +27,7 @@
 */
 
 /** @file
- * @brief Function @ref Magnum::SceneTools::mapIndexField(), @ref Magnum::SceneTools::mapIndexFieldInPlace()
+ * @brief Function @ref Magnum::SceneTools::mapIndexField(), @ref Magnum::SceneTools::mapIndexFieldInPlace(), @ref Magnum::SceneTools::mapObjects()
  * @m_since_latest
  */
 
@@ -141,6 +141,41 @@ The @p field is expected to exist in @p scene.
 */
 MAGNUM_SCENETOOLS_EXPORT void mapIndexFieldInPlace(Trade::SceneData& scene, Trade::SceneField field, const Containers::StridedArrayView1D<const UnsignedInt>& mapping);
 
+/**
+@brief Renumber objects in a scene
+@m_since_latest
+
+Replaces every object ID @cpp i @ce in mapping of all fields in @p scene with
+@cpp mapping[i] @ce, and does the same for values of the
+@ref Trade::SceneField::Parent field, with @cpp -1 @ce preserved verbatim.
+Entries of each field are then stably sorted by the new object IDs, meaning
+that all fields in the output have @ref Trade::SceneFieldFlag::OrderedMapping
+set, or @ref Trade::SceneFieldFlag::ImplicitMapping if the resulting mapping
+happens to be a contiguous sequence from @cpp 0 @ce. Other field flags are
+preserved. Fields that shared a mapping view in the input share it in the
+output as well.
+
+Expects that the @p mapping array has exactly
+@ref Trade::SceneData::mappingBound() items, all of them less than
+@ref Trade::SceneData::mappingBound(). The mapping is expected to be a
+permutation, i.e. two objects mapping to the same ID would get merged, which
+is a valid but likely unwanted outcome. The @ref Trade::SceneField::Parent
+field, if present, is expected to be @ref Trade::SceneFieldType::Int,
+@relativeref{Trade::SceneFieldType,Short},
+@relativeref{Trade::SceneFieldType,Byte} or
+@relativeref{Trade::SceneFieldType,Long} and the new IDs of all referenced
+parents are expected to be representable in given type. Fields with
+@ref Trade::SceneFieldType::StringOffset8 and other offset-based string types
+aren't supported as their entries can't be reordered independently.
+
+The operation is done in an @f$ \mathcal{O}(n \log{} n) @f$ execution time
+with @f$ n @f$ being the size of the largest field. Returned data flags have
+both @ref Trade::DataFlag::Mutable and @ref Trade::DataFlag::Owned. See
+@ref orderObjectsDepthFirst() and @ref orderObjectsBreadthFirst() for
+calculating a mapping that makes a hierarchy traversal a linear memory walk.
+*/
+MAGNUM_SCENETOOLS_EXPORT Trade::SceneData mapObjects(const Trade::SceneData& scene, const Containers::StridedArrayView1D<const UnsignedInt>& mapping);
+
 }}
 
 #endif
@@ -25,6 +25,7 @@
 */
 
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/TestSuite/Tester.h>
@@ -54,6 +55,11 @@ struct HierarchyTest: TestSuite::Tester {
     void parentsBreadthFirstChildrenDepthFirstCyclicDeep();
     void parentsBreadthFirstChildrenDepthFirstSparseAndCyclic();
 
+    void objectMappingDepthFirstBreadthFirst();
+    void orderObjectsDepthFirst();
+    void orderObjectsBreadthFirst();
+    void orderObjectsNoParentField();
+
     void absoluteFieldTransformations2D();
     void absoluteFieldTransformations3D();
 
@@ -130,7 +136,12 @@ HierarchyTest::HierarchyTest() {
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSparse,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstCyclic,
               &HierarchyTest::parentsBreadthFirstChildrenDepthFirstCyclicDeep,
-              &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSparseAndCyclic});
+              &HierarchyTest::parentsBreadthFirstChildrenDepthFirstSparseAndCyclic,
+
+              &HierarchyTest::objectMappingDepthFirstBreadthFirst,
+              &HierarchyTest::orderObjectsDepthFirst,
+              &HierarchyTest::orderObjectsBreadthFirst,
+              &HierarchyTest::orderObjectsNoParentField});
 
     addInstancedTests({&HierarchyTest::absoluteFieldTransformations2D,
                        &HierarchyTest::absoluteFieldTransformations3D},
@@ -561,6 +572,132 @@ const struct Scene {
      {16, 113}}
 }};
 
+/* Object 3 is deliberately not a part of the hierarchy */
+const struct {
+    UnsignedShort parentMapping[5];
+    Byte parent[5];
+    UnsignedShort meshMapping[4];
+    UnsignedInt mesh[4];
+    bool visible[4];
+} OrderObjectsData[]{{
+    {4, 2, 0, 5, 1},
+    {-1, 4, -1, 0, 4},
+    {1, 3, 4, 4},
+    {10, 11, 12, 13},
+    {true, true, false, false}
+}};
+
+Trade::SceneData orderObjectsScene() {
+    return Trade::SceneData{Trade::SceneMappingType::UnsignedShort, 6, {}, OrderObjectsData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(OrderObjectsData->parentMapping),
+            Containers::arrayView(OrderObjectsData->parent)},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Containers::arrayView(OrderObjectsData->meshMapping),
+            Containers::arrayView(OrderObjectsData->mesh),
+            Trade::SceneFieldFlag::MultiEntry},
+        /* Shares the mapping with the mesh */
+        Trade::SceneFieldData{Trade::sceneFieldCustom(0),
+            Containers::arrayView(OrderObjectsData->meshMapping),
+            Containers::stridedArrayView(OrderObjectsData->visible).sliceBit(0)},
+    }};
+}
+
+void HierarchyTest::objectMappingDepthFirstBreadthFirst() {
+    Trade::SceneData scene = orderObjectsScene();
+
+    /* Depth-first order is 4, 2, 1, 0, 5 and then the remaining 3 */
+    CORRADE_COMPARE_AS(SceneTools::objectMappingDepthFirst(scene), Containers::arrayView<UnsignedInt>({
+        3, 2, 1, 5, 0, 4
+    }), TestSuite::Compare::Container);
+
+    /* Breadth-first order is 4, 0, 2, 1, 5 and then the remaining 3 */
+    CORRADE_COMPARE_AS(SceneTools::objectMappingBreadthFirst(scene), Containers::arrayView<UnsignedInt>({
+        1, 3, 2, 5, 0, 4
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::orderObjectsDepthFirst() {
+    Trade::SceneData scene = SceneTools::orderObjectsDepthFirst(orderObjectsScene());
+    CORRADE_COMPARE(scene.mappingBound(), 6);
+    CORRADE_COMPARE(scene.mappingType(), Trade::SceneMappingType::UnsignedShort);
+
+    /* The hierarchy is now a contiguous sequence with parents referring to
+       the new IDs */
+    CORRADE_COMPARE(scene.fieldFlags(Trade::SceneField::Parent), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedShort>(Trade::SceneField::Parent), Containers::arrayView<UnsignedShort>({
+        0, 1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Byte>(Trade::SceneField::Parent), Containers::arrayView<Byte>({
+        -1, 0, 0, -1, 3
+    }), TestSuite::Compare::Container);
+
+    /* Multiple entries of the same object stay in the original order */
+    CORRADE_COMPARE(scene.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlag::MultiEntry|Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedShort>(Trade::SceneField::Mesh), Containers::arrayView<UnsignedShort>({
+        0, 0, 2, 5
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<UnsignedInt>(Trade::SceneField::Mesh), Containers::arrayView<UnsignedInt>({
+        12, 13, 10, 11
+    }), TestSuite::Compare::Container);
+
+    /* The mapping stays shared */
+    CORRADE_COMPARE(scene.mapping(Trade::sceneFieldCustom(0)).data(), scene.mapping(Trade::SceneField::Mesh).data());
+    CORRADE_COMPARE(scene.fieldFlags(Trade::sceneFieldCustom(0)), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(scene.fieldBits(Trade::sceneFieldCustom(0)), Containers::stridedArrayView({
+        false, false, true, true
+    }).sliceBit(0), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::orderObjectsBreadthFirst() {
+    Trade::SceneData scene = SceneTools::orderObjectsBreadthFirst(orderObjectsScene());
+    CORRADE_COMPARE(scene.mappingBound(), 6);
+    CORRADE_COMPARE(scene.mappingType(), Trade::SceneMappingType::UnsignedShort);
+
+    CORRADE_COMPARE(scene.fieldFlags(Trade::SceneField::Parent), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedShort>(Trade::SceneField::Parent), Containers::arrayView<UnsignedShort>({
+        0, 1, 2, 3, 4
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<Byte>(Trade::SceneField::Parent), Containers::arrayView<Byte>({
+        -1, -1, 0, 0, 1
+    }), TestSuite::Compare::Container);
+
+    /* The output of parentsBreadthFirst() is now monotonic */
+    CORRADE_COMPARE_AS(SceneTools::parentsBreadthFirst(scene), (Containers::arrayView<Containers::Pair<UnsignedInt, Int>>({
+        {0, -1},
+        {1, -1},
+        {2, 0},
+        {3, 0},
+        {4, 1}
+    })), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(scene.fieldFlags(Trade::SceneField::Mesh), Trade::SceneFieldFlag::MultiEntry|Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(scene.mapping<UnsignedShort>(Trade::SceneField::Mesh), Containers::arrayView<UnsignedShort>({
+        0, 0, 3, 5
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene.field<UnsignedInt>(Trade::SceneField::Mesh), Containers::arrayView<UnsignedInt>({
+        12, 13, 10, 11
+    }), TestSuite::Compare::Container);
+}
+
+void HierarchyTest::orderObjectsNoParentField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedByte, 0, nullptr, {}};
+
+    Containers::String out;
+    Error redirectError{&out};
+    SceneTools::objectMappingDepthFirst(scene);
+    SceneTools::objectMappingBreadthFirst(scene);
+    SceneTools::orderObjectsDepthFirst(scene);
+    SceneTools::orderObjectsBreadthFirst(scene);
+    CORRADE_COMPARE(out,
+        "SceneTools::objectMappingDepthFirst(): the scene has no hierarchy\n"
+        "SceneTools::objectMappingBreadthFirst(): the scene has no hierarchy\n"
+        "SceneTools::orderObjectsDepthFirst(): the scene has no hierarchy\n"
+        "SceneTools::orderObjectsBreadthFirst(): the scene has no hierarchy\n");
+}
+
 void HierarchyTest::absoluteFieldTransformations2D() {
     auto&& data = TestData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
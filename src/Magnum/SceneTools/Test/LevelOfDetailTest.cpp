@@ -0,0 +1,324 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+
+#include "Magnum/Math/Matrix4.h"
+#include "Magnum/Math/TypeTraits.h"
+#include "Magnum/SceneTools/LevelOfDetail.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace SceneTools { namespace Test { namespace {
+
+struct LevelOfDetailTest: TestSuite::Tester {
+    explicit LevelOfDetailTest();
+
+    template<class T> void select();
+    void selectOrthographic();
+    void selectEmpty();
+
+    void selectFieldNotFound();
+    void selectInvalidFieldType();
+    void selectArrayField();
+    void selectInvalidSize();
+    void selectObjectOutOfRange();
+};
+
+using namespace Math::Literals;
+
+constexpr Trade::SceneField SceneFieldLodMesh = Trade::sceneFieldCustom(0);
+constexpr Trade::SceneField SceneFieldLodScreenSize = Trade::sceneFieldCustom(1);
+
+const struct {
+    const char* name;
+    bool into;
+} SelectData[]{
+    {"", false},
+    {"into", true}
+};
+
+LevelOfDetailTest::LevelOfDetailTest() {
+    addInstancedTests<LevelOfDetailTest>({
+        &LevelOfDetailTest::select<UnsignedInt>,
+        &LevelOfDetailTest::select<UnsignedShort>},
+        Containers::arraySize(SelectData));
+
+    addTests({&LevelOfDetailTest::selectOrthographic,
+              &LevelOfDetailTest::selectEmpty,
+
+              &LevelOfDetailTest::selectFieldNotFound,
+              &LevelOfDetailTest::selectInvalidFieldType,
+              &LevelOfDetailTest::selectArrayField,
+              &LevelOfDetailTest::selectInvalidSize,
+              &LevelOfDetailTest::selectObjectOutOfRange});
+}
+
+template<class T> void LevelOfDetailTest::select() {
+    auto&& data = SelectData[testCaseInstanceId()];
+    setTestCaseTemplateName(Math::TypeTraits<T>::name());
+    setTestCaseDescription(data.name);
+
+    const struct Lod {
+        T object;
+        UnsignedInt mesh;
+        Float screenSize;
+        Matrix4 transformation;
+    } lods[]{
+        /* Unit sphere at a distance of 2 is 0.5 of the viewport height, picks
+           the second level */
+        {0, 10, 0.6f, Matrix4::translation(Vector3::zAxis(-1.0f))},
+        {0, 11, 0.3f, Matrix4::translation(Vector3::zAxis(-1.0f))},
+        {0, 12, 0.0f, Matrix4::translation(Vector3::zAxis(-1.0f))},
+        /* Sphere scaled 2x at a distance of 10 is 0.2 of the viewport height,
+           smaller than all levels, so it gets culled */
+        {2, 20, 0.5f, Matrix4::translation(Vector3::zAxis(-9.0f))*Matrix4::scaling({1.0f, 2.0f, 1.0f})},
+        {2, 21, 0.25f, Matrix4::translation(Vector3::zAxis(-9.0f))*Matrix4::scaling({1.0f, 2.0f, 1.0f})},
+        /* Right behind the camera at a distance of 1. Not visible, so it
+           gets nothing even though the last level has a zero threshold. */
+        {3, 30, 0.5f, Matrix4::translation(Vector3::zAxis(2.0f))},
+        {3, 31, 0.0f, Matrix4::translation(Vector3::zAxis(2.0f))},
+        /* On the camera plane, i.e. at a distance of 0. Shouldn't divide by
+           zero but pick the most detailed level instead. */
+        {4, 40, 1000.0f, Matrix4::translation(Vector3::zAxis(1.0f))},
+        {4, 41, 0.0f, Matrix4::translation(Vector3::zAxis(1.0f))},
+    };
+    Containers::StridedArrayView1D<const Lod> view = lods;
+
+    Trade::SceneData scene{Trade::Implementation::sceneMappingTypeFor<T>(), 5, {}, lods, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            view.slice(&Lod::object), view.slice(&Lod::mesh)},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            view.slice(&Lod::object), view.slice(&Lod::screenSize)},
+    }};
+
+    /* Camera at Z = 1, 90° FoV gives a projection scale of 1 */
+    const Matrix4 camera = Matrix4::translation(Vector3::zAxis(1.0f)).inverted();
+    const Matrix4 projection = Matrix4::perspectiveProjection(90.0_degf, 1.0f, 0.1f, 100.0f);
+
+    Containers::Array<UnsignedInt> out;
+    if(data.into) {
+        out = Containers::Array<UnsignedInt>{DirectInit, 5, 0xcececece};
+        selectLevelOfDetailInto(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, view.slice(&Lod::transformation), camera, projection, out);
+    } else {
+        out = selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, view.slice(&Lod::transformation), camera, projection);
+    }
+
+    CORRADE_COMPARE_AS(out, Containers::arrayView<UnsignedInt>({
+        11,
+        ~UnsignedInt{},
+        ~UnsignedInt{},
+        ~UnsignedInt{},
+        40
+    }), TestSuite::Compare::Container);
+}
+
+void LevelOfDetailTest::selectOrthographic() {
+    const struct Lod {
+        UnsignedInt object;
+        UnsignedInt mesh;
+        Float screenSize;
+        Matrix4 transformation;
+    } lods[]{
+        /* The distance doesn't matter, unit sphere is always 0.5 of the
+           viewport height */
+        {0, 10, 0.6f, Matrix4::translation(Vector3::zAxis(-1.0f))},
+        {0, 11, 0.3f, Matrix4::translation(Vector3::zAxis(-1.0f))},
+        {1, 20, 0.6f, Matrix4::translation(Vector3::zAxis(-50.0f))},
+        {1, 21, 0.3f, Matrix4::translation(Vector3::zAxis(-50.0f))},
+        /* Unless it's scaled */
+        {2, 30, 0.6f, Matrix4::translation(Vector3::zAxis(-50.0f))*Matrix4::scaling(Vector3{1.5f})},
+        {2, 31, 0.3f, Matrix4::translation(Vector3::zAxis(-50.0f))*Matrix4::scaling(Vector3{1.5f})},
+    };
+    Containers::StridedArrayView1D<const Lod> view = lods;
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, {}, lods, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            view.slice(&Lod::object), view.slice(&Lod::mesh)},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            view.slice(&Lod::object), view.slice(&Lod::screenSize)},
+    }};
+
+    CORRADE_COMPARE_AS(selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, view.slice(&Lod::transformation), Matrix4{}, Matrix4::orthographicProjection({4.0f, 4.0f}, 0.1f, 100.0f)), Containers::arrayView<UnsignedInt>({
+        11,
+        21,
+        30
+    }), TestSuite::Compare::Container);
+}
+
+void LevelOfDetailTest::selectEmpty() {
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, nullptr, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedInt, nullptr},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Float, nullptr},
+    }};
+
+    CORRADE_COMPARE_AS(selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, nullptr, Matrix4{}, Matrix4{}), Containers::arrayView<UnsignedInt>({
+        ~UnsignedInt{},
+        ~UnsignedInt{},
+        ~UnsignedInt{}
+    }), TestSuite::Compare::Container);
+}
+
+void LevelOfDetailTest::selectFieldNotFound() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedInt, nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    selectLevelOfDetail(scene, Trade::SceneField::Mesh, SceneFieldLodScreenSize, nullptr, Matrix4{}, Matrix4{});
+    selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, nullptr, Matrix4{}, Matrix4{});
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::selectLevelOfDetailInto(): field Trade::SceneField::Mesh not found\n"
+        "SceneTools::selectLevelOfDetailInto(): field Trade::SceneField::Custom(1) not found\n",
+        TestSuite::Compare::String);
+}
+
+void LevelOfDetailTest::selectInvalidFieldType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedShort, nullptr},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Float, nullptr},
+        Trade::SceneFieldData{Trade::SceneField::Mesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedInt, nullptr},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(2),
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Half, nullptr},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, nullptr, Matrix4{}, Matrix4{});
+    selectLevelOfDetail(scene, Trade::SceneField::Mesh, Trade::sceneFieldCustom(2), nullptr, Matrix4{}, Matrix4{});
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::selectLevelOfDetailInto(): expected Trade::SceneField::Custom(0) to be Trade::SceneFieldType::UnsignedInt but got Trade::SceneFieldType::UnsignedShort\n"
+        "SceneTools::selectLevelOfDetailInto(): expected Trade::SceneField::Custom(2) to be Trade::SceneFieldType::Float but got Trade::SceneFieldType::Half\n",
+        TestSuite::Compare::String);
+}
+
+void LevelOfDetailTest::selectArrayField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 0, nullptr, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::UnsignedInt, nullptr},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            Trade::SceneMappingType::UnsignedInt, nullptr,
+            Trade::SceneFieldType::Float, nullptr, 2},
+    }};
+
+    Containers::String out;
+    Error redirectError{&out};
+    selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, nullptr, Matrix4{}, Matrix4{});
+    CORRADE_COMPARE(out, "SceneTools::selectLevelOfDetailInto(): array fields aren't supported\n");
+}
+
+void LevelOfDetailTest::selectInvalidSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct Data {
+        UnsignedInt object[3];
+        UnsignedInt mesh[3];
+        Float screenSize[3];
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 5, {}, data, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            Containers::arrayView(data->object),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            Containers::arrayView(data->object),
+            Containers::arrayView(data->screenSize)},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(2),
+            Containers::arrayView(data->object).prefix(2),
+            Containers::arrayView(data->screenSize).prefix(2)},
+    }};
+
+    Matrix4 transformations[3];
+    UnsignedInt meshes[6];
+
+    Containers::String out;
+    Error redirectError{&out};
+    selectLevelOfDetailInto(scene, SceneFieldLodMesh, Trade::sceneFieldCustom(2), transformations, Matrix4{}, Matrix4{}, Containers::arrayView(meshes).prefix(5));
+    selectLevelOfDetailInto(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, Containers::arrayView(transformations).prefix(2), Matrix4{}, Matrix4{}, Containers::arrayView(meshes).prefix(5));
+    selectLevelOfDetailInto(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, transformations, Matrix4{}, Matrix4{}, meshes);
+    CORRADE_COMPARE_AS(out,
+        "SceneTools::selectLevelOfDetailInto(): expected Trade::SceneField::Custom(2) to have 3 entries but got 2\n"
+        "SceneTools::selectLevelOfDetailInto(): expected 3 transformations but got 2\n"
+        "SceneTools::selectLevelOfDetailInto(): expected mesh destination view with 5 elements but got 6\n",
+        TestSuite::Compare::String);
+}
+
+void LevelOfDetailTest::selectObjectOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct Data {
+        UnsignedInt object[3];
+        UnsignedInt mesh[3];
+        Float screenSize[3];
+    } data[1]{{
+        {0, 1, 5},
+        {},
+        {}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 5, {}, data, {
+        Trade::SceneFieldData{SceneFieldLodMesh,
+            Containers::arrayView(data->object),
+            Containers::arrayView(data->mesh)},
+        Trade::SceneFieldData{SceneFieldLodScreenSize,
+            Containers::arrayView(data->object),
+            Containers::arrayView(data->screenSize)},
+    }};
+
+    Matrix4 transformations[3];
+
+    Containers::String out;
+    Error redirectError{&out};
+    selectLevelOfDetail(scene, SceneFieldLodMesh, SceneFieldLodScreenSize, transformations, Matrix4{}, Matrix4{});
+    CORRADE_COMPARE(out, "SceneTools::selectLevelOfDetailInto(): object 5 out of range for 5 objects\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::SceneTools::Test::LevelOfDetailTest)
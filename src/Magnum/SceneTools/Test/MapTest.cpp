@@ -54,6 +54,11 @@ struct MapTest: TestSuite::Tester {
     void indexFieldRvalueSigned();
     void indexFieldRvalueNotOwned();
     void indexFieldRvalueNotFullType();
+
+    void objects();
+    void objectsInvalidMapping();
+    void objectsParentNotRepresentable();
+    void objectsStringOffsetField();
 };
 
 const struct {
@@ -97,7 +102,12 @@ MapTest::MapTest() {
         Containers::arraySize(IndexFieldRvalueData));
 
     addTests({&MapTest::indexFieldRvalueNotOwned,
-              &MapTest::indexFieldRvalueNotFullType});
+              &MapTest::indexFieldRvalueNotFullType,
+
+              &MapTest::objects,
+              &MapTest::objectsInvalidMapping,
+              &MapTest::objectsParentNotRepresentable,
+              &MapTest::objectsStringOffsetField});
 }
 
 template<class> struct IndexFieldTraits;
@@ -753,6 +763,150 @@ void MapTest::indexFieldRvalueNotFullType() {
     CORRADE_VERIFY(mapped.fieldData().data() != originalFields);
 }
 
+void MapTest::objects() {
+    struct {
+        UnsignedByte parentMapping[4];
+        Short parent[4];
+        UnsignedByte customMapping[3];
+        Short custom[3][2];
+        UnsignedByte visibleMapping[3];
+        bool visible[3];
+    } sceneData[]{{
+        {0, 1, 2, 3},
+        {-1, 0, 1, 0},
+        {3, 1, 3},
+        {{1, 2}, {3, 4}, {5, 6}},
+        {2, 0, 1},
+        {true, false, true}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedByte, 4, {}, sceneData, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(sceneData->parentMapping),
+            Containers::arrayView(sceneData->parent),
+            Trade::SceneFieldFlag::ImplicitMapping},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(1),
+            Trade::SceneMappingType::UnsignedByte,
+            Containers::arrayView(sceneData->customMapping),
+            Trade::SceneFieldType::Short,
+            Containers::arrayView(sceneData->custom), 2,
+            /* Verify that the flags get preserved */
+            Trade::SceneFieldFlag::MultiEntry},
+        Trade::SceneFieldData{Trade::sceneFieldCustom(2),
+            Containers::arrayView(sceneData->visibleMapping),
+            Containers::stridedArrayView(sceneData->visible).sliceBit(0)},
+    }};
+
+    const UnsignedInt mapping[]{2, 0, 3, 1};
+
+    Trade::SceneData result = mapObjects(scene, mapping);
+    CORRADE_COMPARE(result.dataFlags(), Trade::DataFlag::Owned|Trade::DataFlag::Mutable);
+    CORRADE_COMPARE(result.mappingBound(), 4);
+    CORRADE_COMPARE(result.mappingType(), Trade::SceneMappingType::UnsignedByte);
+    CORRADE_COMPARE(result.fieldCount(), 3);
+
+    /* Parent mapping stays contiguous, the values get mapped as well */
+    CORRADE_COMPARE(result.fieldFlags(0), Trade::SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(result.mapping<UnsignedByte>(0), Containers::arrayView<UnsignedByte>({
+        0, 1, 2, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(result.field<Short>(0), Containers::arrayView<Short>({
+        2, 2, -1, 0
+    }), TestSuite::Compare::Container);
+
+    /* Entries for the same object keep their relative order */
+    CORRADE_COMPARE(result.fieldFlags(1), Trade::SceneFieldFlag::MultiEntry|Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(result.mapping<UnsignedByte>(1), Containers::arrayView<UnsignedByte>({
+        0, 1, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS((result.field<Short[]>(1).transposed<0, 1>()[0]), Containers::arrayView<Short>({
+        3, 1, 5
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS((result.field<Short[]>(1).transposed<0, 1>()[1]), Containers::arrayView<Short>({
+        4, 2, 6
+    }), TestSuite::Compare::Container);
+
+    /* Bit fields get reordered as well */
+    CORRADE_COMPARE(result.fieldFlags(2), Trade::SceneFieldFlag::OrderedMapping);
+    CORRADE_COMPARE_AS(result.mapping<UnsignedByte>(2), Containers::arrayView<UnsignedByte>({
+        0, 2, 3
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(result.fieldBits(2), Containers::stridedArrayView({
+        true, false, true
+    }).sliceBit(0), TestSuite::Compare::Container);
+}
+
+void MapTest::objectsInvalidMapping() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedInt, 3, nullptr, {}};
+
+    const UnsignedInt mappingWrongSize[2]{};
+    const UnsignedInt mappingOutOfRange[]{0, 3, 1};
+
+    Containers::String out;
+    Error redirectError{&out};
+    mapObjects(scene, mappingWrongSize);
+    mapObjects(scene, mappingOutOfRange);
+    CORRADE_COMPARE(out,
+        "SceneTools::mapObjects(): expected 3 mapping values but got 2\n"
+        "SceneTools::mapObjects(): mapping value 3 out of range for 3 objects\n");
+}
+
+void MapTest::objectsParentNotRepresentable() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedByte parentMapping[2];
+        Byte parent[2];
+    } data[]{{
+        {0, 1},
+        {-1, 0}
+    }};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedByte, 200, {}, data, {
+        Trade::SceneFieldData{Trade::SceneField::Parent,
+            Containers::arrayView(data->parentMapping),
+            Containers::arrayView(data->parent)},
+    }};
+
+    /* Object 0 gets mapped to 150, which the parent of object 1 can't
+       reference in a Byte field */
+    UnsignedInt mapping[200];
+    for(UnsignedInt i = 0; i != 200; ++i) mapping[i] = i;
+    mapping[0] = 150;
+    mapping[150] = 0;
+
+    Containers::String out;
+    Error redirectError{&out};
+    mapObjects(scene, mapping);
+    CORRADE_COMPARE(out, "SceneTools::mapObjects(): mapping value 150 not representable in Trade::SceneFieldType::Byte\n");
+}
+
+void MapTest::objectsStringOffsetField() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const struct {
+        UnsignedShort nameMapping[2];
+        UnsignedInt nameOffset[2];
+        char nameString[1];
+    } data[1]{};
+
+    Trade::SceneData scene{Trade::SceneMappingType::UnsignedShort, 2, {}, data, {
+        Trade::SceneFieldData{Trade::sceneFieldCustom(15),
+            Containers::arrayView(data->nameMapping),
+            data->nameString, Trade::SceneFieldType::StringOffset32,
+            Containers::arrayView(data->nameOffset)},
+    }};
+
+    const UnsignedInt mapping[]{1, 0};
+
+    Containers::String out;
+    Error redirectError{&out};
+    mapObjects(scene, mapping);
+    CORRADE_COMPARE(out, "SceneTools::mapObjects(): reordering Trade::SceneFieldType::StringOffset32 fields is not implemented yet, sorry\n");
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::SceneTools::Test::MapTest)
@@ -301,6 +301,23 @@ const struct {
         "Mesh 0 duplicate removal: 5 -> 4 vertices\n"
         "Mesh 1 duplicate removal: 6 -> 4 vertices\n"
         "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    {"two meshes + scene, remove duplicate vertices, two jobs, verbose", {InPlaceInit, {
+            /* Same as above, the output and its order should be the same
+               even though the meshes are processed in parallel */
+            "--remove-duplicate-vertices", "-v", "-j", "2",
+            "-I", "GltfImporter", "-C", "GltfSceneConverter",
+            /* Removing the generator identifier for a smaller file */
+            "-c", "generator=",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/two-quads-duplicates.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/two-quads.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter", {}, nullptr,
+        "two-quads.gltf", "two-quads.bin",
+        "Mesh 0 duplicate removal: 5 -> 4 vertices\n"
+        "Mesh 1 duplicate removal: 6 -> 4 vertices\n"
+        "Trade::AbstractSceneConverter::addImporterContents(): adding scene 0 out of 1\n"},
+    #endif
     {"one implicit mesh, remove duplicate vertices fuzzy", {InPlaceInit, {
             "--remove-duplicate-vertices-fuzzy", "1.0e-1",
             Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/quad-duplicates-fuzzy.obj"),
@@ -660,6 +677,23 @@ const struct {
         "mesh-passthrough-on-failure.gltf", "mesh-passthrough-on-failure.bin",
         "Trade::MeshOptimizerSceneConverter::convert(): expected an indexed mesh\n"
         "Cannot process mesh 0 with MeshOptimizerSceneConverter, passing the original through\n"},
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    {"mesh converter, passthrough on failure, two jobs", {InPlaceInit, {
+            /* Same as above, the warnings captured in the worker thread
+               should get printed as well */
+            "-M", "MeshOptimizerSceneConverter", "-j", "2",
+            "--passthrough-on-mesh-converter-failure",
+            /* Removing the generator identifier for a roundtrip */
+            "-c", "generator=",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/mesh-passthrough-on-failure.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/mesh-passthrough-on-failure.gltf")
+        }},
+        "GltfImporter", nullptr, "GltfSceneConverter",
+        {}, "MeshOptimizerSceneConverter",
+        "mesh-passthrough-on-failure.gltf", "mesh-passthrough-on-failure.bin",
+        "Trade::MeshOptimizerSceneConverter::convert(): expected an indexed mesh\n"
+        "Cannot process mesh 0 with MeshOptimizerSceneConverter, passing the original through\n"},
+    #endif
     {"2D image converter, two images", {InPlaceInit, {
             "-P", "StbResizeImageConverter", "-p", "size=\"1 1\"",
             /* Removing the generator identifier for a smaller file, bundling
@@ -707,6 +741,29 @@ const struct {
         "Trade::AnyImageImporter::openFile(): using PngImporter\n"
         "Processing 2D image 1 (1/2) with StbResizeImageConverter...\n"
         "Processing 2D image 1 (2/2) with StbResizeImageConverter...\n"},
+    #ifdef CORRADE_BUILD_MULTITHREADED
+    {"two 2D image converters, two images, two jobs, verbose", {InPlaceInit, {
+            /* Same as above, except that all images are imported first,
+               before the parallel processing starts. The processing output
+               should be in the same order even though the images are
+               processed in parallel. */
+            "-I", "GltfImporter", "-C", "GltfSceneConverter",
+            "-P", "StbResizeImageConverter", "-p", "size=\"2 2\"",
+            "-P", "StbResizeImageConverter", "-p", "size=\"1 1\"",
+            "-c", "bundleImages,generator=", "-v", "-j", "2",
+            Utility::Path::join(SCENETOOLS_TEST_DIR, "SceneConverterTestFiles/images-2d.gltf"),
+            Utility::Path::join(SCENETOOLS_TEST_OUTPUT_DIR, "SceneConverterTestFiles/images-2d-1x1.gltf")
+        }},
+        "GltfImporter", "PngImporter", "GltfSceneConverter",
+        {"StbResizeImageConverter", "PngImageConverter"}, nullptr,
+        "images-2d-1x1.gltf", "images-2d-1x1.bin",
+        "Trade::AnyImageImporter::openFile(): using PngImporter\n"
+        "Trade::AnyImageImporter::openFile(): using PngImporter\n"
+        "Processing 2D image 0 (1/2) with StbResizeImageConverter...\n"
+        "Processing 2D image 0 (2/2) with StbResizeImageConverter...\n"
+        "Processing 2D image 1 (1/2) with StbResizeImageConverter...\n"
+        "Processing 2D image 1 (2/2) with StbResizeImageConverter...\n"},
+    #endif
     {"3D image converter, two images", {InPlaceInit, {
             /* Removing the KTX generator identifier for predictable output */
             "--set", "KtxImageConverter:generator=",
@@ -24,6 +24,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <iostream>
 #include <sstream>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
@@ -34,18 +35,20 @@
 #include <Corrade/Utility/Path.h>
 #include <Corrade/Utility/String.h> /* parseNumberSequence() */
 
+#include "Magnum/Math/Functions.h"
 #include "Magnum/MaterialTools/PhongToPbrMetallicRoughness.h"
 #include "Magnum/MaterialTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Concatenate.h"
 #include "Magnum/MeshTools/Copy.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
-#include "Magnum/MeshTools/Transform.h"
 #include "Magnum/SceneTools/Hierarchy.h"
 #include "Magnum/SceneTools/Map.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/ImporterCache.h"
 
 #include "Magnum/Implementation/converterUtilities.h"
 #include "Magnum/SceneTools/Implementation/sceneConverterUtilities.h"
@@ -184,15 +187,16 @@ magnum-sceneconverter [-h|--help] [-I|--importer PLUGIN]
     [-C|--converter PLUGIN]... [-P|--image-converter PLUGIN]...
     [-M|--mesh-converter PLUGIN]... [--plugin-dir DIR]
     [--prefer alias:plugin1,plugin2,…]... [--set plugin:key=val,key2=val2,…]...
-    [--map] [--only-mesh-attributes N1,N2-N3…] [--remove-duplicate-vertices]
-    [--remove-duplicate-vertices-fuzzy EPSILON] [--phong-to-pbr]
+    [--map] [--cache DIR] [--only-mesh-attributes N1,N2-N3…]
+    [--remove-duplicate-vertices] [--remove-duplicate-vertices-fuzzy EPSILON]
+    [--phong-to-pbr]
     [--remove-duplicate-materials]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]...
     [-p|--image-converter-options key=val,key2=val2,…]...
     [-m|--mesh-converter-options key=val,key2=val2,…]...
     [--passthrough-on-image-converter-failure]
-    [--passthrough-on-mesh-converter-failure]
+    [--passthrough-on-mesh-converter-failure] [-j|--jobs N]
     [--mesh ID] [--mesh-level INDEX] [--concatenate-meshes] [--info-importer]
     [--info-converter] [--info-image-converter] [--info-animations]
     [--info-images] [--info-lights] [--info-cameras] [--info-materials]
@@ -219,6 +223,9 @@ Arguments:
 -   `--set plugin:key=val,key2=val2,…` ---  set global plugin(s) option
 -   `--map` --- memory-map the input for zero-copy import (works only for
     standalone files)
+-   `--cache DIR` --- cache imported data in given directory using
+    @ref Trade::ImporterCache and reuse them in subsequent runs with the same
+    input and importer options. Can't be used together with `--map`.
 -   `--only-mesh-attributes N1,N2-N3…` --- include only mesh attributes of
     given IDs in the output. See
     @relativeref{Corrade,Utility::String::parseNumberSequence()} for syntax
@@ -245,6 +252,8 @@ Arguments:
     if `--image-converter` fails
 -   `--passthrough-on-mesh-converter-failure` --- pass original data through
     if `--mesh-converter` fails
+-   `-j`, `--jobs N` --- process images and meshes in given count of parallel
+    jobs, `0` to use all available cores (default: `1`)
 -   `--mesh ID` --- convert just a single mesh instead of the whole scene
 -   `--mesh-level LEVEL` --- level to select for single-mesh conversion
 -   `--concatenate-meshes` --- flatten mesh hierarchy and concatenate them all
@@ -318,9 +327,22 @@ The `--remove-duplicate-vertices`, `--phong-to-pbr` and
 `--remove-duplicate-materials` operations are performed on meshes and materials
 before passing them to any converter.
 
+If `--jobs` is set to a value other than `1`, the `--image-converter`
+operations are performed on multiple images and the
+`--remove-duplicate-vertices` and `--mesh-converter` operations on multiple
+meshes in parallel on a @ref ThreadPool, with each job having its own instance
+of each image and mesh converter plugin. Importer plugins aren't thread-safe,
+so images and meshes are still imported serially, before the parallel
+processing starts. The order of images and meshes in the output as well as the
+order of diagnostic output across them is preserved, however for each image or
+mesh all its standard output is printed before its error output. With
+`--concatenate-meshes` the value is used for transforming and concatenating the
+mesh instances in parallel.
+
 If `--concatenate-meshes` is given, all meshes of the input file are
-first concatenated into a single mesh using @ref MeshTools::concatenate(), with
-the scene hierarchy transformation baked in using
+first concatenated into a single mesh using
+@ref MeshTools::concatenateTransformed3D(), with the scene hierarchy
+transformation calculated using
 @ref SceneTools::absoluteFieldTransformations3D(), and then passed through the
 remaining operations. Only attributes that are present in the first mesh are
 taken, if `--only-mesh-attributes` is specified as well, the IDs reference
@@ -354,64 +376,103 @@ bool isDataInfoRequested(const Utility::Arguments& args) {
            args.isSet("info");
 }
 
-template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const UnsignedInt i, Containers::Optional<Trade::ImageData<dimensions>>& image) {
-    const bool passthroughOnConversionFailure = args.isSet("passthrough-on-image-converter-failure");
+/* Output of a single mesh or image processed in a parallel job. The standard
+   and error output is captured separately to not mix the two together, which
+   means that for each item the standard output is printed first and the error
+   output after, even if the messages were originally interleaved. */
+struct JobOutput {
+    std::ostringstream out;
+    std::ostringstream err;
+    bool failed = false;
+};
+
+/* Prints the captured output in order, stops at the first failure the same
+   way as the serial code path would */
+bool printJobOutputs(const Containers::ArrayView<const JobOutput> outputs) {
+    for(const JobOutput& output: outputs) {
+        std::cout << output.out.str();
+        std::cerr << output.err.str();
+        if(output.failed)
+            return false;
+    }
 
-    for(std::size_t j = 0, imageConverterCount = args.arrayValueCount("image-converter"); j != imageConverterCount; ++j) {
-        const Containers::StringView imageConverterName = args.arrayValue<Containers::StringView>("image-converter", j);
-        if(args.isSet("verbose")) {
-            Debug d;
-            d << "Processing" << dimensions << Debug::nospace << "D image" << i;
-            if(imageConverterCount > 1)
-                d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << imageConverterCount << Debug::nospace << ")";
-            d << "with" << imageConverterName << Debug::nospace << "...";
-        }
+    return true;
+}
 
-        Containers::Pointer<Trade::AbstractImageConverter> imageConverter = imageConverterManager.loadAndInstantiate(imageConverterName);
-        if(!imageConverter) {
-            Debug{} << "Available image converter plugins:" << ", "_s.join(imageConverterManager.aliasList());
-            return false;
-        }
+void printImageConverterProgress(const Utility::Arguments& args, const UnsignedInt dimensions, const UnsignedInt i, const std::size_t j) {
+    if(!args.isSet("verbose")) return;
 
-        /* Set options, if passed. The AnyImageConverter check makes no
-            sense here, is just there because the helper wants it */
-        if(args.isSet("verbose"))
-            imageConverter->addFlags(Trade::ImageConverterFlag::Verbose);
-        if(j < args.arrayValueCount("image-converter-options"))
-            Implementation::setOptions(*imageConverter, "AnyImageConverter", args.arrayValue("image-converter-options", j));
-
-        Trade::ImageConverterFeatures expectedFeatures;
-        if(dimensions == 2) {
-            expectedFeatures = image->isCompressed() ?
-                Trade::ImageConverterFeature::ConvertCompressed2D :
-                Trade::ImageConverterFeature::Convert2D;
-        } else if(dimensions == 3) {
-            expectedFeatures = image->isCompressed() ?
-                Trade::ImageConverterFeature::ConvertCompressed3D :
-                Trade::ImageConverterFeature::Convert3D;
-        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
-        /** @todo level-related features, once testable */
-        if(!(imageConverter->features() >= expectedFeatures)) {
-            Error err;
-            err << imageConverterName << "doesn't support";
-            /** @todo level-related message, once testable */
-            if(image->isCompressed())
-                err << "compressed";
-            err << dimensions << Debug::nospace << "D image conversion, only" << Debug::packed << imageConverter->features();
-            return false;
-        }
+    const std::size_t imageConverterCount = args.arrayValueCount("image-converter");
+    Debug d;
+    d << "Processing" << dimensions << Debug::nospace << "D image" << i;
+    if(imageConverterCount > 1)
+        d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << imageConverterCount << Debug::nospace << ")";
+    d << "with" << args.arrayValue<Containers::StringView>("image-converter", j) << Debug::nospace << "...";
+}
 
-        /** @todo handle image levels here, once GltfSceneConverter is capable
-            of converting them (which needs AbstractImageConverter to be
-            reworked around ImageData) */
-        if(Containers::Optional<Trade::ImageData<dimensions>> converted = imageConverter->convert(*image)) {
-            image = Utility::move(converted);
-        } else if(passthroughOnConversionFailure) {
-            Warning{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName << Debug::nospace << ", passing the original through";
-        } else {
-            Error{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName;
+Containers::Pointer<Trade::AbstractImageConverter> instantiateImageConverter(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const std::size_t j) {
+    Containers::Pointer<Trade::AbstractImageConverter> imageConverter = imageConverterManager.loadAndInstantiate(args.arrayValue<Containers::StringView>("image-converter", j));
+    if(!imageConverter) {
+        Debug{} << "Available image converter plugins:" << ", "_s.join(imageConverterManager.aliasList());
+        return {};
+    }
+
+    /* Set options, if passed. The AnyImageConverter check makes no sense
+       here, is just there because the helper wants it */
+    if(args.isSet("verbose"))
+        imageConverter->addFlags(Trade::ImageConverterFlag::Verbose);
+    if(j < args.arrayValueCount("image-converter-options"))
+        Implementation::setOptions(*imageConverter, "AnyImageConverter", args.arrayValue("image-converter-options", j));
+
+    return imageConverter;
+}
+
+template<UnsignedInt dimensions> bool runImageConverter(Trade::AbstractImageConverter& imageConverter, const Utility::Arguments& args, const UnsignedInt i, const std::size_t j, Trade::ImageData<dimensions>& image) {
+    const Containers::StringView imageConverterName = args.arrayValue<Containers::StringView>("image-converter", j);
+
+    Trade::ImageConverterFeatures expectedFeatures;
+    if(dimensions == 2) {
+        expectedFeatures = image.isCompressed() ?
+            Trade::ImageConverterFeature::ConvertCompressed2D :
+            Trade::ImageConverterFeature::Convert2D;
+    } else if(dimensions == 3) {
+        expectedFeatures = image.isCompressed() ?
+            Trade::ImageConverterFeature::ConvertCompressed3D :
+            Trade::ImageConverterFeature::Convert3D;
+    } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+    /** @todo level-related features, once testable */
+    if(!(imageConverter.features() >= expectedFeatures)) {
+        Error err;
+        err << imageConverterName << "doesn't support";
+        /** @todo level-related message, once testable */
+        if(image.isCompressed())
+            err << "compressed";
+        err << dimensions << Debug::nospace << "D image conversion, only" << Debug::packed << imageConverter.features();
+        return false;
+    }
+
+    /** @todo handle image levels here, once GltfSceneConverter is capable
+        of converting them (which needs AbstractImageConverter to be
+        reworked around ImageData) */
+    if(Containers::Optional<Trade::ImageData<dimensions>> converted = imageConverter.convert(image)) {
+        image = *Utility::move(converted);
+    } else if(args.isSet("passthrough-on-image-converter-failure")) {
+        Warning{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName << Debug::nospace << ", passing the original through";
+    } else {
+        Error{} << "Cannot process" << dimensions << Debug::nospace << "D image" << i << "with" << imageConverterName;
+        return false;
+    }
+
+    return true;
+}
+
+template<UnsignedInt dimensions> bool runImageConverters(PluginManager::Manager<Trade::AbstractImageConverter>& imageConverterManager, const Utility::Arguments& args, const UnsignedInt i, Trade::ImageData<dimensions>& image) {
+    for(std::size_t j = 0, imageConverterCount = args.arrayValueCount("image-converter"); j != imageConverterCount; ++j) {
+        printImageConverterProgress(args, dimensions, i, j);
+
+        Containers::Pointer<Trade::AbstractImageConverter> imageConverter = instantiateImageConverter(imageConverterManager, args, j);
+        if(!imageConverter || !runImageConverter(*imageConverter, args, i, j, image))
             return false;
-        }
     }
 
     return true;
@@ -435,6 +496,7 @@ int main(int argc, char** argv) {
         #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
         .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
         #endif
+        .addOption("cache").setHelp("cache", "cache imported data in given directory and reuse them in subsequent runs", "DIR")
         .addOption("only-mesh-attributes").setHelp("only-mesh-attributes", "include only mesh attributes of given IDs in the output", "N1,N2-N3…")
         .addBooleanOption("remove-duplicate-vertices").setHelp("remove-duplicate-vertices", "remove duplicate vertices in all meshes after import")
         .addOption("remove-duplicate-vertices-fuzzy").setHelp("remove-duplicate-vertices-fuzzy", "remove duplicate vertices with fuzzy comparison in all meshes after import", "EPSILON")
@@ -446,6 +508,7 @@ int main(int argc, char** argv) {
         .addArrayOption('m', "mesh-converter-options").setHelp("mesh-converter-options", "configuration options to pass to the mesh converter(s)", "key=val,key2=val2,…")
         .addBooleanOption("passthrough-on-image-converter-failure").setHelp("passthrough-on-image-converter-failure", "pass original data through if --image-converter fails")
         .addBooleanOption("passthrough-on-mesh-converter-failure").setHelp("passthrough-on-mesh-converter-failure", "pass original data through if --mesh-converter fails")
+        .addOption('j', "jobs", "1").setHelp("jobs", "process images and meshes in given count of parallel jobs, 0 to use all available cores", "N")
         .addOption("mesh").setHelp("mesh", "convert just a single mesh instead of the whole scene, ignored if --concatenate-meshes is specified", "ID")
         .addOption("mesh-level").setHelp("mesh-level", "level to select for single-mesh conversion", "index")
         .addBooleanOption("concatenate-meshes").setHelp("concatenate-meshes", "flatten mesh hierarchy and concatenate them all together")
@@ -522,6 +585,17 @@ The --remove-duplicate-vertices, --phong-to-pbr and
 --remove-duplicate-materials operations are performed on meshes and materials
 before passing them to any converter.
 
+If --jobs is set to a value other than 1, the --image-converter operations are
+performed on multiple images and the --remove-duplicate-vertices and
+--mesh-converter operations on multiple meshes in parallel, with each job
+having its own instance of each image and mesh converter plugin. Images and
+meshes are still imported serially, before the parallel processing starts. The
+order of images and meshes in the output as well as the order of diagnostic
+output across them is preserved, however for each image or mesh all its
+standard output is printed before its error output. With --concatenate-meshes
+the value is used for transforming and concatenating the mesh instances in
+parallel.
+
 If --concatenate-meshes is given, all meshes of the input file are first
 concatenated into a single mesh, with the scene hierarchy transformation baked
 in, and then passed through the remaining operations. Only attributes that are
@@ -576,6 +650,25 @@ well, the IDs reference attributes of the first mesh.)")
         Error{} << "The --mesh-level option can only be used with --mesh";
         return 1;
     }
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    if(args.isSet("map") && args.value<Containers::StringView>("cache")) {
+        Error{} << "The --map and --cache options are mutually exclusive";
+        return 1;
+    }
+    #endif
+    /* The global pool is used for the per-image and per-mesh processing below
+       as well as for concatenateTransformed3D() and parallel mesh import in
+       plugins */
+    ThreadPool::setGlobalThreadCount(args.value<UnsignedInt>("jobs"));
+    const UnsignedInt jobs = ThreadPool::global().threadCount();
+    #ifndef CORRADE_BUILD_MULTITHREADED
+    /* Debug output redirection isn't thread-local in this case, which would
+       make the per-job output capturing below clash */
+    if(jobs != 1) {
+        Error{} << "The --jobs option requires Corrade built with CORRADE_BUILD_MULTITHREADED";
+        return 1;
+    }
+    #endif
     /** @todo remove this once only-mesh-attributes can work with attribute
         names and thus for more meshes */
     if(args.value<Containers::StringView>("only-mesh-attributes") && !args.value<Containers::StringView>("mesh") && !args.isSet("concatenate-meshes")) {
@@ -746,6 +839,10 @@ well, the IDs reference attributes of the first mesh.)")
         return 0;
     }
 
+    /* Declared before the importer as it has to outlive it if used, the
+       importer and the imported data reference files mapped by it */
+    Containers::Optional<Trade::ImporterCache> cache;
+
     Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
     if(!importer) {
         Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
@@ -765,9 +862,19 @@ well, the IDs reference attributes of the first mesh.)")
        conversion are measured separately. */
     std::chrono::high_resolution_clock::duration importConversionTime{};
 
-    /* Open the file or map it if requested */
+    /* Open the file, go through the cache or map it if requested */
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
+    #endif
+    if(args.value<Containers::StringView>("cache")) {
+        Trade::Implementation::Duration d{importConversionTime};
+        cache.emplace(importerManager, converterManager, args.value<Containers::StringView>("cache"));
+        if(!(importer = cache->openFile(Utility::move(importer), args.value("input")))) {
+            Error() << "Cannot open file" << args.value("input");
+            return 3;
+        }
+    } else
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     if(args.isSet("map")) {
         Trade::Implementation::Duration d{importConversionTime};
         if(!(mapped = Utility::Path::mapRead(args.value("input"))) || !importer->openMemory(*mapped)) {
@@ -875,19 +982,22 @@ well, the IDs reference attributes of the first mesh.)")
                     meshesMaterials = scene->meshesMaterialsAsArray();
                 Containers::Array<Matrix4> transformations =
                     SceneTools::absoluteFieldTransformations3D(*scene, Trade::SceneField::Mesh);
-                Containers::Array<Trade::MeshData> flattenedMeshes;
-                {
-                    Trade::Implementation::Duration d{conversionTime};
-                    /** @todo once there are 2D scenes, check the scene is 3D */
-                    for(std::size_t i = 0; i != meshesMaterials.size(); ++i) {
-                        arrayAppend(flattenedMeshes, MeshTools::transform3D(
-                            meshes[meshesMaterials[i].second().first()], transformations[i]));
-                    }
-                }
-                meshes = Utility::move(flattenedMeshes);
-            }
 
-            {
+                /* Transform and concatenate in a single step, with the
+                   instances processed in parallel if desired */
+                Trade::Implementation::Duration d{conversionTime};
+                /** @todo once there are 2D scenes, check the scene is 3D */
+                /** @todo this will assert if the meshes have incompatible
+                    primitives (such as some triangles, some lines), or if
+                    they have loops/strips/fans -- handle that explicitly */
+                mesh = MeshTools::concatenateTransformed3D(meshes,
+                    stridedArrayView(meshesMaterials)
+                        .slice(&Containers::Pair<UnsignedInt, Containers::Pair<UnsignedInt, Int>>::second)
+                        .slice(&Containers::Pair<UnsignedInt, Int>::first),
+                    transformations);
+
+            /* Otherwise assume all meshes are in the root */
+            } else {
                 Trade::Implementation::Duration d{conversionTime};
                 /** @todo this will assert if the meshes have incompatible primitives
                     (such as some triangles, some lines), or if they have
@@ -996,44 +1106,127 @@ well, the IDs reference attributes of the first mesh.)")
             return 1;
         }
 
-        for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
-            Containers::Optional<Trade::ImageData2D> image;
-            {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image2D(i))) {
-                    Error{} << "Cannot import 2D image" << i;
+        if(jobs == 1) {
+            for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
+                Containers::Optional<Trade::ImageData2D> image;
+                {
+                    /** @todo handle image levels once GltfSceneConverter can
+                        save them (which needs AbstractImageConverter to be
+                        reworked around ImageData) -- there could be an
+                        image2DOffsets array saying which subrange is levels
+                        for which image */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    if(!(image = importer->image2D(i))) {
+                        Error{} << "Cannot import 2D image" << i;
+                        return 1;
+                    }
+                }
+
+                if(!runImageConverters(imageConverterManager, args, i, *image))
+                    return 1;
+
+                arrayAppend(images2D, *Utility::move(image));
+            }
+
+            for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
+                Containers::Optional<Trade::ImageData3D> image;
+                {
+                    /** @todo handle image levels once GltfSceneConverter can
+                        save them (which needs AbstractImageConverter to be
+                        reworked around ImageData) -- there could be an
+                        image2DOffsets array saying which subrange is levels
+                        for which image */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    if(!(image = importer->image3D(i))) {
+                        Error{} << "Cannot import 3D image" << i;
+                        return 1;
+                    }
+                }
+
+                if(!runImageConverters(imageConverterManager, args, i, *image))
                     return 1;
+
+                arrayAppend(images3D, *Utility::move(image));
+            }
+
+        /* Parallel processing. The importer isn't thread-safe, so all images
+           are imported upfront, serially, same as meshes below. */
+        } else {
+            for(UnsignedInt i = 0; i != importer->image2DCount(); ++i) {
+                Containers::Optional<Trade::ImageData2D> image;
+                {
+                    Trade::Implementation::Duration d{importConversionTime};
+                    if(!(image = importer->image2D(i))) {
+                        Error{} << "Cannot import 2D image" << i;
+                        return 1;
+                    }
                 }
+
+                arrayAppend(images2D, *Utility::move(image));
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
-                return 1;
+            for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
+                Containers::Optional<Trade::ImageData3D> image;
+                {
+                    Trade::Implementation::Duration d{importConversionTime};
+                    if(!(image = importer->image3D(i))) {
+                        Error{} << "Cannot import 3D image" << i;
+                        return 1;
+                    }
+                }
 
-            arrayAppend(images2D, *Utility::move(image));
-        }
+                arrayAppend(images3D, *Utility::move(image));
+            }
 
-        for(UnsignedInt i = 0; i != importer->image3DCount(); ++i) {
-            Containers::Optional<Trade::ImageData3D> image;
+            /* Plugin loading and instantiation isn't thread-safe, so create
+               a dedicated set of converter instances for each job here.
+               Unrecognized option warnings get printed only for the first
+               job, the others would be just duplicates. */
+            const std::size_t imageConverterCount = args.arrayValueCount("image-converter");
+            const std::size_t imageCount = images2D.size() + images3D.size();
+            const UnsignedInt jobCount = UnsignedInt(Math::min(std::size_t{jobs}, imageCount));
+            Containers::Array<Containers::Pointer<Trade::AbstractImageConverter>> imageConverters{jobCount*imageConverterCount};
+            for(UnsignedInt job = 0; job != jobCount; ++job) {
+                Warning redirectWarning{job ? nullptr : Warning::output()};
+                for(std::size_t j = 0; j != imageConverterCount; ++j)
+                    if(!(imageConverters[job*imageConverterCount + j] = instantiateImageConverter(imageConverterManager, args, j)))
+                        return 1;
+            }
+
+            /* Each image is a separate chunk for the thread pool, 2D images
+               first and 3D images after, the thread index picks the
+               converter instances. Output is captured per image and printed
+               in order once all jobs finish. As with meshes below, anything
+               the converters run on the global pool executes serially on the
+               job that called it. */
+            Containers::Array<JobOutput> outputs{ValueInit, imageCount};
             {
-                /** @todo handle image levels once GltfSceneConverter can save
-                    them (which needs AbstractImageConverter to be reworked
-                    around ImageData) -- there could be an image2DOffsets
-                    array saying which subrange is levels for which image */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(image = importer->image3D(i))) {
-                    Error{} << "Cannot import 3D image" << i;
-                    return 1;
-                }
+                Trade::Implementation::Duration d{conversionTime};
+                ThreadPool::global().parallelFor(imageCount, 1, [&](const std::size_t begin, const std::size_t end, const UnsignedInt job) {
+                    for(std::size_t i = begin; i != end; ++i) {
+                        JobOutput& output = outputs[i];
+                        Debug redirectOutput{&output.out};
+                        Warning redirectWarning{&output.err};
+                        Error redirectError{&output.err};
+
+                        for(std::size_t j = 0; j != imageConverterCount; ++j) {
+                            Trade::AbstractImageConverter& imageConverter = *imageConverters[job*imageConverterCount + j];
+                            if(i < images2D.size()) {
+                                printImageConverterProgress(args, 2, UnsignedInt(i), j);
+                                output.failed = !runImageConverter(imageConverter, args, UnsignedInt(i), j, images2D[i]);
+                            } else {
+                                const UnsignedInt i3D = UnsignedInt(i - images2D.size());
+                                printImageConverterProgress(args, 3, i3D, j);
+                                output.failed = !runImageConverter(imageConverter, args, i3D, j, images3D[i3D]);
+                            }
+                            if(output.failed) break;
+                        }
+                    }
+                });
             }
 
-            if(!runImageConverters(imageConverterManager, args, i, image))
+            if(!printJobOutputs(outputs))
                 return 1;
-
-            arrayAppend(images3D, *Utility::move(image));
         }
     }
 
@@ -1045,94 +1238,201 @@ well, the IDs reference attributes of the first mesh.)")
        args.arrayValueCount("mesh-converter"))
     {
         const bool passthroughOnConversionFailure = args.isSet("passthrough-on-mesh-converter-failure");
+        const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
+        const bool removeDuplicateVertices = fuzzy || args.isSet("remove-duplicate-vertices");
+        const std::size_t meshConverterCount = args.arrayValueCount("mesh-converter");
+
+        /* Duplicate removal, shared by the serial and the parallel code path
+           below. Time measurement is done by the caller. */
+        const auto removeDuplicateVerticesIn = [&](const UnsignedInt i, Trade::MeshData& mesh) {
+            const UnsignedInt beforeVertexCount = mesh.vertexCount();
+
+            /** @todo accept two values for float and double fuzzy comparison,
+                or maybe also different for positions, normals and texcoords?
+                ugh... */
+            if(fuzzy)
+                mesh = MeshTools::removeDuplicatesFuzzy(Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
+            else
+                mesh = MeshTools::removeDuplicates(Utility::move(mesh));
+
+            if(args.isSet("verbose")) {
+                Debug d;
+                /* Mesh index 0 would be confusing in case of
+                    --concatenate-meshes and plain wrong with --mesh, so don't
+                    even print it */
+                if(singleMesh)
+                    d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
+                else
+                    d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
+                d << beforeVertexCount << "->" << mesh.vertexCount() << "vertices";
+            }
+        };
 
         arrayReserve(meshes, importer->meshCount());
 
-        for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
-            Containers::Optional<Trade::MeshData> mesh;
-            {
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of importing them */
-                Trade::Implementation::Duration d{importConversionTime};
-                if(!(mesh = importer->mesh(i))) {
-                    Error{} << "Cannot import mesh" << i;
-                    return 1;
+        if(jobs == 1) {
+            for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+                Containers::Optional<Trade::MeshData> mesh;
+                {
+                    /** @todo handle mesh levels here, once any plugin is
+                        capable of importing them */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    if(!(mesh = importer->mesh(i))) {
+                        Error{} << "Cannot import mesh" << i;
+                        return 1;
+                    }
                 }
-            }
-
-            /* Duplicate removal */
-            if(args.isSet("remove-duplicate-vertices") ||
-               args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy"))
-            {
-                const UnsignedInt beforeVertexCount = mesh->vertexCount();
-                const bool fuzzy = !!args.value<Containers::StringView>("remove-duplicate-vertices-fuzzy");
 
-                /** @todo accept two values for float and double fuzzy
-                    comparison, or maybe also different for positions, normals
-                    and texcoords? ugh... */
-                if(fuzzy) {
+                /* Duplicate removal */
+                if(removeDuplicateVertices) {
                     Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicatesFuzzy(*Utility::move(mesh), args.value<Float>("remove-duplicate-vertices-fuzzy"));
-                } else {
-                    Trade::Implementation::Duration d{conversionTime};
-                    mesh = MeshTools::removeDuplicates(*Utility::move(mesh));
+                    removeDuplicateVerticesIn(i, *mesh);
                 }
 
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    /* Mesh index 0 would be confusing in case of
-                        --concatenate-meshes and plain wrong with --mesh, so
-                        don't even print it */
-                    if(singleMesh)
-                        d << (fuzzy ? "Fuzzy duplicate removal:" : "Duplicate removal:");
-                    else
-                        d << "Mesh" << i << (fuzzy ? "fuzzy duplicate removal:" : "duplicate removal:");
-                    d << beforeVertexCount << "->" << mesh->vertexCount() << "vertices";
+                /* Arbitrary mesh converters */
+                for(std::size_t j = 0; j != meshConverterCount; ++j) {
+                    const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
+                    if(args.isSet("verbose")) {
+                        Debug d;
+                        d << "Processing mesh" << i;
+                        if(meshConverterCount > 1)
+                            d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
+                        d << "with" << meshConverterName << Debug::nospace << "...";
+                    }
+
+                    Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(meshConverterName);
+                    if(!meshConverter) {
+                        Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
+                        return 2;
+                    }
+
+                    /* Set options, if passed. The AnySceneConverter check makes
+                       no sense here, is just there because the helper wants
+                       it */
+                    if(args.isSet("verbose"))
+                        meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
+                    if(j < args.arrayValueCount("mesh-converter-options"))
+                        Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+
+                    if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
+                        Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
+                        return 1;
+                    }
+
+                    /** @todo handle mesh levels here, once any plugin is
+                        capable of converting them */
+                    if(Containers::Optional<Trade::MeshData> converted = meshConverter->convert(*mesh)) {
+                        mesh = Utility::move(converted);
+                    } else if(passthroughOnConversionFailure) {
+                        Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
+                    } else {
+                        Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
+                        return 1;
+                    }
                 }
+
+                arrayAppend(meshes, *Utility::move(mesh));
             }
 
-            /* Arbitrary mesh converters */
-            for(std::size_t j = 0, meshConverterCount = args.arrayValueCount("mesh-converter"); j != meshConverterCount; ++j) {
-                const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
-                if(args.isSet("verbose")) {
-                    Debug d;
-                    d << "Processing mesh" << i;
-                    if(meshConverterCount > 1)
-                        d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
-                    d << "with" << meshConverterName << Debug::nospace << "...";
+        /* Parallel processing. The importer isn't thread-safe, so all meshes
+           are imported upfront, serially. Parallelizing the import would need
+           a dedicated importer instance for each job, with each opening the
+           file again, which is out of scope here. */
+        } else {
+            for(UnsignedInt i = 0; i != importer->meshCount(); ++i) {
+                Containers::Optional<Trade::MeshData> mesh;
+                {
+                    /** @todo handle mesh levels here, once any plugin is
+                        capable of importing them */
+                    Trade::Implementation::Duration d{importConversionTime};
+                    if(!(mesh = importer->mesh(i))) {
+                        Error{} << "Cannot import mesh" << i;
+                        return 1;
+                    }
                 }
 
-                Containers::Pointer<Trade::AbstractSceneConverter> meshConverter = converterManager.loadAndInstantiate(meshConverterName);
-                if(!meshConverter) {
-                    Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
-                    return 2;
-                }
+                arrayAppend(meshes, *Utility::move(mesh));
+            }
 
-                /* Set options, if passed. The AnySceneConverter check makes no
-                   sense here, is just there because the helper wants it */
-                if(args.isSet("verbose"))
-                    meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
-                if(j < args.arrayValueCount("mesh-converter-options"))
-                    Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+            /* Plugin loading and instantiation isn't thread-safe either, so
+               create a dedicated set of converter instances for each job
+               here. Unrecognized option warnings get printed only for the
+               first job, the others would be just duplicates. */
+            const UnsignedInt jobCount = Math::min(jobs, UnsignedInt(meshes.size()));
+            Containers::Array<Containers::Pointer<Trade::AbstractSceneConverter>> meshConverters{jobCount*meshConverterCount};
+            for(UnsignedInt job = 0; job != jobCount; ++job) {
+                for(std::size_t j = 0; j != meshConverterCount; ++j) {
+                    const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
+                    Containers::Pointer<Trade::AbstractSceneConverter>& meshConverter = meshConverters[job*meshConverterCount + j];
+                    if(!(meshConverter = converterManager.loadAndInstantiate(meshConverterName))) {
+                        Debug{} << "Available mesh converter plugins:" << ", "_s.join(converterManager.aliasList());
+                        return 2;
+                    }
 
-                if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
-                    Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
-                    return 1;
+                    if(args.isSet("verbose"))
+                        meshConverter->addFlags(Trade::SceneConverterFlag::Verbose);
+                    if(j < args.arrayValueCount("mesh-converter-options")) {
+                        Warning redirectWarning{job ? nullptr : Warning::output()};
+                        Implementation::setOptions(*meshConverter, "AnySceneConverter", args.arrayValue("mesh-converter-options", j));
+                    }
+
+                    if(!(meshConverter->features() & (Trade::SceneConverterFeature::ConvertMesh))) {
+                        Error{} << meshConverterName << "doesn't support mesh conversion, only" << Debug::packed << meshConverter->features();
+                        return 1;
+                    }
                 }
+            }
 
-                /** @todo handle mesh levels here, once any plugin is capable
-                    of converting them */
-                if(Containers::Optional<Trade::MeshData> converted = meshConverter->convert(*mesh)) {
-                    mesh = Utility::move(converted);
-                } else if(passthroughOnConversionFailure) {
-                    Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
-                } else {
-                    Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
-                    return 1;
+            /* Each mesh is a separate chunk for the thread pool, the thread
+               index is less than jobCount and picks the converter instances.
+               All output, including the output from the plugins, is captured
+               per mesh and printed in order once all jobs finish. Algorithms
+               and plugins called from the jobs that use the global pool as
+               well execute serially on the job that called them, as calls
+               nested in a pool job are never parallelized. */
+            Containers::Array<JobOutput> outputs{ValueInit, meshes.size()};
+            const auto processMeshes = [&](const std::size_t begin, const std::size_t end, const UnsignedInt job) {
+                for(UnsignedInt i = UnsignedInt(begin); i != end; ++i) {
+                    JobOutput& output = outputs[i];
+                    Debug redirectOutput{&output.out};
+                    Warning redirectWarning{&output.err};
+                    Error redirectError{&output.err};
+
+                    if(removeDuplicateVertices)
+                        removeDuplicateVerticesIn(i, meshes[i]);
+
+                    for(std::size_t j = 0; j != meshConverterCount; ++j) {
+                        const Containers::StringView meshConverterName = args.arrayValue<Containers::StringView>("mesh-converter", j);
+                        if(args.isSet("verbose")) {
+                            Debug d;
+                            d << "Processing mesh" << i;
+                            if(meshConverterCount > 1)
+                                d << "(" << Debug::nospace << (j+1) << Debug::nospace << "/" << Debug::nospace << meshConverterCount << Debug::nospace << ")";
+                            d << "with" << meshConverterName << Debug::nospace << "...";
+                        }
+
+                        /** @todo handle mesh levels here, once any plugin is
+                            capable of converting them */
+                        if(Containers::Optional<Trade::MeshData> converted = meshConverters[job*meshConverterCount + j]->convert(meshes[i])) {
+                            meshes[i] = *Utility::move(converted);
+                        } else if(passthroughOnConversionFailure) {
+                            Warning{} << "Cannot process mesh" << i << "with" << meshConverterName << Debug::nospace << ", passing the original through";
+                        } else {
+                            Error{} << "Cannot process mesh" << i << "with" << meshConverterName;
+                            output.failed = true;
+                            break;
+                        }
+                    }
                 }
+            };
+
+            {
+                Trade::Implementation::Duration d{conversionTime};
+                ThreadPool::global().parallelFor(meshes.size(), 1, processMeshes);
             }
 
-            arrayAppend(meshes, *Utility::move(mesh));
+            if(!printJobOutputs(outputs))
+                return 1;
         }
     }
 
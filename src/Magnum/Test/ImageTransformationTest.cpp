@@ -0,0 +1,330 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageTransformation.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ImageTransformationTest: TestSuite::Tester {
+    explicit ImageTransformationTest();
+
+    void xFlip();
+    void xFlipUnusualPixelSize();
+    void xFlip3D();
+    void yFlip();
+    void yFlipOddHeight();
+    void yFlip3D();
+
+    void rotateClockwise();
+    void rotateCounterClockwise();
+    void rotateLarge();
+    void rotate3D();
+    void rotateAllocate();
+
+    void rotateFormatMismatch();
+    void rotatePixelSizeMismatch();
+    void rotateSizeMismatch();
+};
+
+using namespace Math::Literals;
+
+ImageTransformationTest::ImageTransformationTest() {
+    addTests({&ImageTransformationTest::xFlip,
+              &ImageTransformationTest::xFlipUnusualPixelSize,
+              &ImageTransformationTest::xFlip3D,
+              &ImageTransformationTest::yFlip,
+              &ImageTransformationTest::yFlipOddHeight,
+              &ImageTransformationTest::yFlip3D,
+
+              &ImageTransformationTest::rotateClockwise,
+              &ImageTransformationTest::rotateCounterClockwise,
+              &ImageTransformationTest::rotateLarge,
+              &ImageTransformationTest::rotate3D,
+              &ImageTransformationTest::rotateAllocate,
+
+              &ImageTransformationTest::rotateFormatMismatch,
+              &ImageTransformationTest::rotatePixelSizeMismatch,
+              &ImageTransformationTest::rotateSizeMismatch});
+}
+
+/* A 3x2 image, with each row padded to four bytes:
+
+    d e f
+    a b c   */
+const char Source3x2[]{
+    'a', 'b', 'c', '_',
+    'd', 'e', 'f', '_'
+};
+
+void ImageTransformationTest::xFlip() {
+    /* Rows padded to eight bytes, padding should stay untouched */
+    Color3ub data[]{
+        0x112233_rgb, 0x445566_rgb, 0x778899_rgb, 0x000000_rgb,
+        0xaabbcc_rgb, 0xddeeff_rgb, 0x010203_rgb, 0x000000_rgb
+    };
+    Magnum::xFlipInPlace(MutableImageView2D{PixelStorage{}.setRowLength(4), PixelFormat::RGB8Unorm, {3, 2}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView({
+        0x778899_rgb, 0x445566_rgb, 0x112233_rgb, 0x000000_rgb,
+        0x010203_rgb, 0xddeeff_rgb, 0xaabbcc_rgb, 0x000000_rgb
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::xFlipUnusualPixelSize() {
+    /* An implementation-specific format with a 5-byte pixel goes through the
+       generic fallback */
+    char data[]{
+        'a', 'a', 'a', 'a', 'A',
+        'b', 'b', 'b', 'b', 'B',
+        'c', 'c', 'c', 'c', 'C',
+        '_'
+    };
+    Magnum::xFlipInPlace(MutableImageView2D{PixelStorage{}.setAlignment(1), pixelFormatWrap(0xdead), 0, 5, {3, 1}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView({
+        'c', 'c', 'c', 'c', 'C',
+        'b', 'b', 'b', 'b', 'B',
+        'a', 'a', 'a', 'a', 'A',
+        '_'
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::xFlip3D() {
+    UnsignedShort data[]{
+        1, 2,
+        3, 4,
+
+        5, 6,
+        7, 8
+    };
+    Magnum::xFlipInPlace(MutableImageView3D{PixelFormat::R16UI, {2, 2, 2}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<UnsignedShort>({
+        2, 1,
+        4, 3,
+
+        6, 5,
+        8, 7
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::yFlip() {
+    char data[Containers::arraySize(Source3x2)];
+    Utility::copy(Containers::arrayView(Source3x2), Containers::arrayView(data));
+    Magnum::yFlipInPlace(MutableImageView2D{PixelFormat::R8Unorm, {3, 2}, data});
+    /* Padding is swapped together with the rows, which is fine */
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView({
+        'd', 'e', 'f', '_',
+        'a', 'b', 'c', '_'
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::yFlipOddHeight() {
+    UnsignedInt data[]{
+        1, 2,
+        3, 4,
+        5, 6
+    };
+    /* The middle row stays in place */
+    Magnum::yFlipInPlace(MutableImageView2D{PixelFormat::R32UI, {2, 3}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<UnsignedInt>({
+        5, 6,
+        3, 4,
+        1, 2
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::yFlip3D() {
+    UnsignedByte data[]{
+        1, 2, 0, 0,
+        3, 4, 0, 0,
+
+        5, 6, 0, 0,
+        7, 8, 0, 0
+    };
+    Magnum::yFlipInPlace(MutableImageView3D{PixelFormat::R8UI, {2, 2, 2}, data});
+    CORRADE_COMPARE_AS(Containers::arrayView(data), Containers::arrayView<UnsignedByte>({
+        3, 4, 0, 0,
+        1, 2, 0, 0,
+
+        7, 8, 0, 0,
+        5, 6, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::rotateClockwise() {
+    /* Rotated clockwise, i.e. with the left column becoming the top row:
+
+        a d
+        b e
+        c f
+
+       Destination rows are padded to four bytes as well */
+    char out[3*4]{};
+    Magnum::rotateClockwise(
+        ImageView2D{PixelFormat::R8Unorm, {3, 2}, Source3x2},
+        MutableImageView2D{PixelFormat::R8Unorm, {2, 3}, out});
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        'c', 'f', '\0', '\0',
+        'b', 'e', '\0', '\0',
+        'a', 'd', '\0', '\0'
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::rotateCounterClockwise() {
+    /* Rotated counterclockwise, i.e. with the right column becoming the top
+       row:
+
+        f c
+        e b
+        d a */
+    char out[3*4]{};
+    Magnum::rotateCounterClockwise(
+        ImageView2D{PixelFormat::R8Unorm, {3, 2}, Source3x2},
+        MutableImageView2D{PixelFormat::R8Unorm, {2, 3}, out});
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView({
+        'd', 'a', '\0', '\0',
+        'e', 'b', '\0', '\0',
+        'f', 'c', '\0', '\0'
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::rotateLarge() {
+    /* Larger than a single tile and not a multiple of it in either
+       dimension */
+    Image2D image{PixelFormat::R32UI, {71, 37}, Containers::Array<char>{NoInit, 71*37*4}};
+    const Containers::StridedArrayView2D<UnsignedInt> pixels = image.pixels<UnsignedInt>();
+    for(std::size_t y = 0; y != pixels.size()[0]; ++y)
+        for(std::size_t x = 0; x != pixels.size()[1]; ++x)
+            pixels[y][x] = y*1000 + x;
+
+    Image2D rotated = Magnum::rotateClockwise(image);
+    CORRADE_COMPARE(rotated.size(), (Vector2i{37, 71}));
+    /* Bottom left of the output is bottom right of the input, top left is
+       bottom left */
+    CORRADE_COMPARE(rotated.pixels<UnsignedInt>()[0][0], 70u);
+    CORRADE_COMPARE(rotated.pixels<UnsignedInt>()[70][0], 0u);
+    CORRADE_COMPARE(rotated.pixels<UnsignedInt>()[70][36], 36000u);
+    CORRADE_COMPARE(rotated.pixels<UnsignedInt>()[35][20], 20*1000u + 70 - 35);
+
+    /* Rotating back gives the original */
+    Image2D back = Magnum::rotateCounterClockwise(rotated);
+    CORRADE_COMPARE_AS(back.data(), image.data(), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::rotate3D() {
+    const UnsignedShort data[]{
+        1, 2,
+        3, 4,
+
+        5, 6,
+        7, 8
+    };
+    UnsignedShort out[8]{};
+    Magnum::rotateClockwise(
+        ImageView3D{PixelFormat::R16UI, {2, 2, 2}, data},
+        MutableImageView3D{PixelFormat::R16UI, {2, 2, 2}, out});
+    CORRADE_COMPARE_AS(Containers::arrayView(out), Containers::arrayView<UnsignedShort>({
+        2, 4,
+        1, 3,
+
+        6, 8,
+        5, 7
+    }), TestSuite::Compare::Container);
+}
+
+void ImageTransformationTest::rotateAllocate() {
+    Image2D out = Magnum::rotateCounterClockwise(ImageView2D{PixelFormat::R8Unorm, {3, 2}, Source3x2, ImageFlag2D::Array});
+    CORRADE_COMPARE(out.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{2, 3}));
+    /* The array flag doesn't make sense anymore */
+    CORRADE_COMPARE(out.flags(), ImageFlags2D{});
+    CORRADE_COMPARE_AS(out.pixels<char>()[2], Containers::arrayView({
+        'f', 'c'
+    }), TestSuite::Compare::Container);
+
+    /* 3D flags are preserved */
+    const UnsignedByte data[2*4]{};
+    Image3D out3D = Magnum::rotateClockwise(ImageView3D{PixelFormat::R8Unorm, {1, 1, 2}, data, ImageFlag3D::Array});
+    CORRADE_COMPARE(out3D.size(), (Vector3i{1, 1, 2}));
+    CORRADE_COMPARE(out3D.flags(), ImageFlag3D::Array);
+}
+
+void ImageTransformationTest::rotateFormatMismatch() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char out[3*4];
+
+    Containers::String outError;
+    Error redirectError{&outError};
+    Magnum::rotateClockwise(
+        ImageView2D{PixelFormat::R8Unorm, {3, 2}, Source3x2},
+        MutableImageView2D{PixelFormat::R8UI, {2, 3}, out});
+    CORRADE_COMPARE(outError,
+        "rotateClockwise(): expected destination format PixelFormat::R8Unorm but got PixelFormat::R8UI\n");
+}
+
+void ImageTransformationTest::rotatePixelSizeMismatch() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char out[3*4];
+
+    Containers::String outError;
+    Error redirectError{&outError};
+    Magnum::rotateCounterClockwise(
+        ImageView2D{PixelStorage{}, pixelFormatWrap(0xdead), 0, 1, {3, 2}, Source3x2},
+        MutableImageView2D{PixelStorage{}, pixelFormatWrap(0xdead), 0, 2, {2, 3}, out});
+    CORRADE_COMPARE(outError,
+        "rotateCounterClockwise(): expected destination pixel size 1 but got 2\n");
+}
+
+void ImageTransformationTest::rotateSizeMismatch() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char out[3*4];
+    UnsignedByte out3D[4*3*2];
+
+    Containers::String outError;
+    Error redirectError{&outError};
+    Magnum::rotateClockwise(
+        ImageView2D{PixelFormat::R8Unorm, {3, 2}, Source3x2},
+        MutableImageView2D{PixelFormat::R8Unorm, {3, 2}, out});
+    Magnum::rotateCounterClockwise(
+        ImageView3D{PixelFormat::R8Unorm, {3, 2, 1}, Source3x2},
+        MutableImageView3D{PixelFormat::R8Unorm, {2, 3, 2}, out3D});
+    CORRADE_COMPARE(outError,
+        "rotateClockwise(): expected destination size {2, 3} but got {3, 2}\n"
+        "rotateCounterClockwise(): expected destination size {2, 3, 1} but got {2, 3, 2}\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ImageTransformationTest)
@@ -0,0 +1,413 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/PixelFormatConversion.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Half.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct PixelFormatConversionTest: TestSuite::Tester {
+    explicit PixelFormatConversionTest();
+
+    void supported();
+
+    void copy();
+    void channelsExpand();
+    void channelsExpandFloat();
+    void channelsStrip();
+    void channelsSwizzle();
+    void unormToFloat();
+    void floatToUnormClamp();
+    void floatToSnormClamp();
+    void halfToUnorm();
+    void srgbToFloat();
+    void floatToSrgb();
+    void srgbToUnorm();
+    void srgbToSrgb();
+    void swizzleThroughFloat();
+
+    void convert1D();
+    void convert3D();
+    void convertAllocate();
+
+    void sizeMismatch();
+    void unsupported();
+    void invalidSwizzle();
+};
+
+using namespace Math::Literals;
+
+PixelFormatConversionTest::PixelFormatConversionTest() {
+    addTests({&PixelFormatConversionTest::supported,
+
+              &PixelFormatConversionTest::copy,
+              &PixelFormatConversionTest::channelsExpand,
+              &PixelFormatConversionTest::channelsExpandFloat,
+              &PixelFormatConversionTest::channelsStrip,
+              &PixelFormatConversionTest::channelsSwizzle,
+              &PixelFormatConversionTest::unormToFloat,
+              &PixelFormatConversionTest::floatToUnormClamp,
+              &PixelFormatConversionTest::floatToSnormClamp,
+              &PixelFormatConversionTest::halfToUnorm,
+              &PixelFormatConversionTest::srgbToFloat,
+              &PixelFormatConversionTest::floatToSrgb,
+              &PixelFormatConversionTest::srgbToUnorm,
+              &PixelFormatConversionTest::srgbToSrgb,
+              &PixelFormatConversionTest::swizzleThroughFloat,
+
+              &PixelFormatConversionTest::convert1D,
+              &PixelFormatConversionTest::convert3D,
+              &PixelFormatConversionTest::convertAllocate,
+
+              &PixelFormatConversionTest::sizeMismatch,
+              &PixelFormatConversionTest::unsupported,
+              &PixelFormatConversionTest::invalidSwizzle});
+}
+
+void PixelFormatConversionTest::supported() {
+    /* Same channel format, any channel count */
+    CORRADE_VERIFY(isPixelFormatConversionSupported(PixelFormat::RGBA8UI, PixelFormat::RGBA8UI));
+    CORRADE_VERIFY(isPixelFormatConversionSupported(PixelFormat::RGBA8UI, PixelFormat::RG8UI));
+    CORRADE_VERIFY(isPixelFormatConversionSupported(PixelFormat::R32I, PixelFormat::RGB32I));
+
+    /* Conversion through floats */
+    CORRADE_VERIFY(isPixelFormatConversionSupported(PixelFormat::RGBA8Unorm, PixelFormat::RGB16F));
+    CORRADE_VERIFY(isPixelFormatConversionSupported(PixelFormat::RGB8Srgb, PixelFormat::RGBA16Snorm));
+    CORRADE_VERIFY(isPixelFormatConversionSupported(PixelFormat::R32F, PixelFormat::RG8Snorm));
+
+    /* Integral to normalized or between integral types isn't */
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(PixelFormat::RGBA8UI, PixelFormat::RGBA8Unorm));
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(PixelFormat::R8UI, PixelFormat::R16UI));
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(PixelFormat::R32F, PixelFormat::R32I));
+
+    /* Depth, stencil and implementation-specific formats aren't at all */
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(PixelFormat::Depth32F, PixelFormat::Depth32F));
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(PixelFormat::R32F, PixelFormat::Depth32F));
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(pixelFormatWrap(0xdead), PixelFormat::R8Unorm));
+    CORRADE_VERIFY(!isPixelFormatConversionSupported(PixelFormat::R8Unorm, pixelFormatWrap(0xdead)));
+}
+
+void PixelFormatConversionTest::copy() {
+    /* Rows padded to four bytes in the source, to eight in the
+       destination */
+    const UnsignedByte source[]{
+        1, 2, 3, 4, 5, 6, 0, 0,
+        7, 8, 9, 10, 11, 12, 0, 0
+    };
+    UnsignedByte destination[16]{};
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGB8Unorm, {2, 2}, source},
+        MutableImageView2D{PixelStorage{}.setAlignment(8), PixelFormat::RGB8Unorm, {2, 2}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<UnsignedByte>({
+        1, 2, 3, 4, 5, 6, 0, 0,
+        7, 8, 9, 10, 11, 12, 0, 0
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::channelsExpand() {
+    const Vector3ub source[]{
+        {1, 2, 3}, {4, 5, 6}
+    };
+    Vector4ub destination[2];
+    convertPixelFormat(
+        ImageView2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8UI, {2, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA8UI, {2, 1}, destination});
+    /* Alpha is filled with 1 for integral formats */
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<Vector4ub>({
+        {1, 2, 3, 1}, {4, 5, 6, 1}
+    }), TestSuite::Compare::Container);
+
+    /* And with the max value for normalized formats, other channels with
+       zero */
+    const UnsignedByte sourceNormalized[]{
+        0x33, 0xcc, 0, 0
+    };
+    convertPixelFormat(
+        ImageView2D{PixelFormat::R8Unorm, {2, 1}, sourceNormalized},
+        MutableImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<Vector4ub>({
+        {0x33, 0, 0, 0xff}, {0xcc, 0, 0, 0xff}
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::channelsExpandFloat() {
+    const Vector2h source[]{
+        {0.5_h, -1.0_h}
+    };
+    Vector4h destination[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RG16F, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA16F, {1, 1}, destination});
+    CORRADE_COMPARE(destination[0], (Vector4h{0.5_h, -1.0_h, 0.0_h, 1.0_h}));
+
+    const Vector3 sourceFloat[]{
+        {0.5f, -1.0f, 7.0f}
+    };
+    Vector4 destinationFloat[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGB32F, {1, 1}, sourceFloat},
+        MutableImageView2D{PixelFormat::RGBA32F, {1, 1}, destinationFloat});
+    CORRADE_COMPARE(destinationFloat[0], (Vector4{0.5f, -1.0f, 7.0f, 1.0f}));
+}
+
+void PixelFormatConversionTest::channelsStrip() {
+    const Vector4us source[]{
+        {1, 2, 3, 4}, {5, 6, 7, 8}
+    };
+    Vector2us destination[2];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA16Unorm, {1, 2}, source},
+        MutableImageView2D{PixelFormat::RG16Unorm, {1, 2}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<Vector2us>({
+        {1, 2}, {5, 6}
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::channelsSwizzle() {
+    const Color4ub source[]{
+        0x11223344_rgba, 0x55667788_rgba
+    };
+    Color4ub destination[2];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA8Unorm, {2, 1}, destination},
+        {2, 1, 0, 3});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView({
+        0x33221144_rgba, 0x77665588_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::unormToFloat() {
+    const Color4ub source[]{
+        0x00ff3366_rgba
+    };
+    Color4 destination[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA32F, {1, 1}, destination});
+    CORRADE_COMPARE(destination[0], 0x00ff3366_rgbaf);
+}
+
+void PixelFormatConversionTest::floatToUnormClamp() {
+    const Float source[]{
+        -0.5f, 0.5f, 2.0f, 1.0f
+    };
+    UnsignedByte destination[4];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::R32F, {4, 1}, source},
+        MutableImageView2D{PixelFormat::R8Unorm, {4, 1}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<UnsignedByte>({
+        0, 128, 255, 255
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::floatToSnormClamp() {
+    const Float source[]{
+        -2.0f, -0.5f, 1.0f, 3.0f
+    };
+    Byte destination[4];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::R32F, {4, 1}, source},
+        MutableImageView2D{PixelFormat::R8Snorm, {4, 1}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<Byte>({
+        -127, -64, 127, 127
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::halfToUnorm() {
+    const Vector3h source[]{
+        {0.0_h, 1.0_h, 0.5_h},
+        {-1.0_h, 4.0_h, 0.25_h}
+    };
+    Vector2us destination[2];
+    convertPixelFormat(
+        ImageView2D{PixelStorage{}.setAlignment(2), PixelFormat::RGB16F, {1, 2}, source},
+        MutableImageView2D{PixelFormat::RG16Unorm, {1, 2}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<Vector2us>({
+        {0, 65535}, {0, 65535}
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::srgbToFloat() {
+    /* RGB gets converted to linear, alpha is kept */
+    const Color4ub source[]{
+        0x33ccff80_srgba
+    };
+    Color4 destination[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA8Srgb, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA32F, {1, 1}, destination});
+    CORRADE_COMPARE(destination[0], 0x33ccff80_srgbaf);
+}
+
+void PixelFormatConversionTest::floatToSrgb() {
+    const Color4 source[]{
+        0x33ccff80_srgbaf
+    };
+    Color4ub destination[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA32F, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA8Srgb, {1, 1}, destination});
+    CORRADE_COMPARE(destination[0], 0x33ccff80_srgba);
+}
+
+void PixelFormatConversionTest::srgbToUnorm() {
+    /* Linear 0.5 is 0xbc in sRGB */
+    const Color4ub source[]{
+        0xbcbcbc80_srgba
+    };
+    Color4ub destination[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA8Srgb, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, destination});
+    CORRADE_COMPARE(destination[0], 0x80808080_rgba);
+}
+
+void PixelFormatConversionTest::srgbToSrgb() {
+    /* Between two sRGB formats the data are just copied */
+    const Color4ub source[]{
+        0xbcbcbc80_srgba
+    };
+    Vector3ub destination[2];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA8Srgb, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGB8Srgb, {1, 1}, destination});
+    CORRADE_COMPARE(destination[0], (Vector3ub{0xbc, 0xbc, 0xbc}));
+}
+
+void PixelFormatConversionTest::swizzleThroughFloat() {
+    /* BGR to RGBA, with alpha taken from the nonexistent fourth channel */
+    const Vector3ub source[]{
+        {0x00, 0x80, 0xff}, {}
+    };
+    Vector4us destination[1];
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGB8Unorm, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA16Unorm, {1, 1}, destination},
+        {2, 1, 0, 3});
+    CORRADE_COMPARE(destination[0], (Vector4us{0xffff, 0x8080, 0x0000, 0xffff}));
+}
+
+void PixelFormatConversionTest::convert1D() {
+    const Vector3ub source[]{
+        {1, 2, 3}, {4, 5, 6}
+    };
+    Vector4ub destination[2];
+    convertPixelFormat(
+        ImageView1D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8UI, 2, source},
+        MutableImageView1D{PixelFormat::RGBA8UI, 2, destination},
+        {3, 2, 1, 0});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView<Vector4ub>({
+        {1, 3, 2, 1}, {1, 6, 5, 4}
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::convert3D() {
+    const Half source[]{
+        0.0_h, 0.5_h,
+        1.0_h, 2.0_h,
+    };
+    Float destination[4];
+    convertPixelFormat(
+        ImageView3D{PixelStorage{}.setAlignment(2), PixelFormat::R16F, {1, 2, 2}, source},
+        MutableImageView3D{PixelFormat::R32F, {1, 2, 2}, destination});
+    CORRADE_COMPARE_AS(Containers::arrayView(destination), Containers::arrayView({
+        0.0f, 0.5f, 1.0f, 2.0f
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::convertAllocate() {
+    const Color4ub source[]{
+        0x11223344_rgba,
+        0x55667788_rgba
+    };
+    Image2D out = convertPixelFormat(ImageView2D{PixelFormat::RGBA8Unorm, {1, 2}, source, ImageFlag2D::Array}, PixelFormat::RGB8Unorm, {2, 1, 0, 3});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{1, 2}));
+    CORRADE_COMPARE(out.flags(), ImageFlag2D::Array);
+    /* Rows are padded to four bytes */
+    CORRADE_COMPARE(out.storage().alignment(), 4);
+    CORRADE_COMPARE(out.data().size(), 8);
+    CORRADE_COMPARE_AS(out.pixels<Color3ub>().transposed<0, 1>()[0], Containers::arrayView({
+        0x332211_rgb,
+        0x776655_rgb
+    }), TestSuite::Compare::Container);
+}
+
+void PixelFormatConversionTest::sizeMismatch() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[16]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    convertPixelFormat(
+        ImageView2D{PixelFormat::R8Unorm, {2, 2}, data},
+        MutableImageView2D{PixelFormat::R8Unorm, {2, 1}, data});
+    CORRADE_COMPARE(out, "convertPixelFormat(): expected source and destination size to match but got {2, 2} and {2, 1}\n");
+}
+
+void PixelFormatConversionTest::unsupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char data[16]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    convertPixelFormat(
+        ImageView2D{PixelFormat::R8UI, {1, 1}, data},
+        MutableImageView2D{PixelFormat::R8Unorm, {1, 1}, data});
+    convertPixelFormat(ImageView2D{PixelFormat::R32F, {1, 1}, data}, PixelFormat::Depth32F);
+    CORRADE_COMPARE(out,
+        "convertPixelFormat(): conversion from PixelFormat::R8UI to PixelFormat::R8Unorm is not supported\n"
+        "convertPixelFormat(): conversion from PixelFormat::R32F to PixelFormat::Depth32F is not supported\n");
+}
+
+void PixelFormatConversionTest::invalidSwizzle() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    char source[16]{};
+    char destination[16]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    convertPixelFormat(
+        ImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, source},
+        MutableImageView2D{PixelFormat::RGBA8Unorm, {1, 1}, destination},
+        {0, 1, 4, 3});
+    CORRADE_COMPARE(out, "convertPixelFormat(): expected swizzle components to be less than 4 but got {0, 1, 4, 3}\n");
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::PixelFormatConversionTest)
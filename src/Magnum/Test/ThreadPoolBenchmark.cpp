@@ -0,0 +1,156 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum { namespace Test { namespace {
+
+/* Measures the overhead of scheduling tiny tasks, which is what matters when
+   deciding on a grain size. The actual work is just a single addition. */
+
+struct ThreadPoolBenchmark: TestSuite::Tester {
+    explicit ThreadPoolBenchmark();
+
+    void loop();
+    void parallelFor();
+    void parallelForSingleChunk();
+    void parallelForGrainSize1();
+    void parallelReduce();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ThreadCountData[]{
+    {"1 thread", 1},
+    {"2 threads", 2},
+    {"4 threads", 4},
+    {"all threads", 0},
+};
+
+enum: std::size_t {
+    Repeats = 100,
+    Count = 4096
+};
+
+ThreadPoolBenchmark::ThreadPoolBenchmark() {
+    addBenchmarks({&ThreadPoolBenchmark::loop}, 10);
+
+    addInstancedBenchmarks({&ThreadPoolBenchmark::parallelFor,
+                            &ThreadPoolBenchmark::parallelForSingleChunk,
+                            &ThreadPoolBenchmark::parallelForGrainSize1,
+                            &ThreadPoolBenchmark::parallelReduce}, 10,
+        Containers::arraySize(ThreadCountData));
+}
+
+void ThreadPoolBenchmark::loop() {
+    /* Baseline to compare the overhead against */
+    Containers::Array<UnsignedInt> data{ValueInit, Count};
+    CORRADE_BENCHMARK(Repeats) {
+        for(std::size_t i = 0; i != Count; ++i)
+            data[i] += 1;
+    }
+
+    CORRADE_COMPARE(data[Count - 1], Repeats);
+}
+
+void ThreadPoolBenchmark::parallelFor() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.threadCount};
+    Containers::Array<UnsignedInt> out{ValueInit, Count};
+    CORRADE_BENCHMARK(Repeats) {
+        pool.parallelFor(Count, 64, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                out[i] += 1;
+        });
+    }
+
+    CORRADE_COMPARE(out[Count - 1], Repeats);
+}
+
+void ThreadPoolBenchmark::parallelForSingleChunk() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Should have no overhead compared to a plain loop as it's executed
+       directly */
+    ThreadPool pool{data.threadCount};
+    Containers::Array<UnsignedInt> out{ValueInit, Count};
+    CORRADE_BENCHMARK(Repeats) {
+        pool.parallelFor(Count, Count, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                out[i] += 1;
+        });
+    }
+
+    CORRADE_COMPARE(out[Count - 1], Repeats);
+}
+
+void ThreadPoolBenchmark::parallelForGrainSize1() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Worst case, the per-chunk overhead dominates */
+    ThreadPool pool{data.threadCount};
+    Containers::Array<UnsignedInt> out{ValueInit, Count};
+    CORRADE_BENCHMARK(Repeats) {
+        pool.parallelFor(Count, 1, [&](std::size_t begin, std::size_t) {
+            out[begin] += 1;
+        });
+    }
+
+    CORRADE_COMPARE(out[Count - 1], Repeats);
+}
+
+void ThreadPoolBenchmark::parallelReduce() {
+    auto&& data = ThreadCountData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.threadCount};
+    std::size_t sum = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        sum += pool.parallelReduce(std::size_t(Count), std::size_t(64), std::size_t{},
+            [](std::size_t begin, std::size_t end) {
+                std::size_t sum = 0;
+                for(std::size_t i = begin; i != end; ++i)
+                    sum += i;
+                return sum;
+            },
+            [](std::size_t a, std::size_t b) { return a + b; });
+    }
+
+    CORRADE_COMPARE(sum, Repeats*(Count*(Count - 1)/2));
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ThreadPoolBenchmark)
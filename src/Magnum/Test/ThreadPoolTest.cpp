@@ -0,0 +1,345 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <atomic>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum { namespace Test { namespace {
+
+struct ThreadPoolTest: TestSuite::Tester {
+    explicit ThreadPoolTest();
+
+    void construct();
+    void constructHardwareConcurrency();
+    void constructCopy();
+    void constructMove();
+
+    void parallelFor();
+    void parallelForEmpty();
+    void parallelForSingleChunk();
+    void parallelForThreadIndex();
+    void parallelForNested();
+    void parallelForNestedDifferentPool();
+    void parallelForNestedInReduce();
+    void parallelForZeroGrainSize();
+
+    void parallelReduce();
+    void parallelReduceEmpty();
+    void parallelReduceZeroGrainSize();
+
+    void global();
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+    std::size_t count, grainSize;
+} ParallelForData[]{
+    {"single thread", 1, 1000, 7},
+    {"two threads", 2, 1000, 7},
+    {"more threads than chunks", 8, 25, 7},
+    {"many threads, grain size 1", 16, 1000, 1},
+    {"grain size larger than count", 4, 1000, 100000},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ParallelReduceData[]{
+    {"single thread", 1},
+    {"two threads", 2},
+    {"three threads", 3},
+    {"sixteen threads", 16},
+};
+
+ThreadPoolTest::ThreadPoolTest() {
+    addTests({&ThreadPoolTest::construct,
+              &ThreadPoolTest::constructHardwareConcurrency,
+              &ThreadPoolTest::constructCopy,
+              &ThreadPoolTest::constructMove});
+
+    addInstancedTests({&ThreadPoolTest::parallelFor},
+        Containers::arraySize(ParallelForData));
+
+    addTests({&ThreadPoolTest::parallelForEmpty,
+              &ThreadPoolTest::parallelForSingleChunk,
+              &ThreadPoolTest::parallelForThreadIndex,
+              &ThreadPoolTest::parallelForNested,
+              &ThreadPoolTest::parallelForNestedDifferentPool,
+              &ThreadPoolTest::parallelForNestedInReduce,
+              &ThreadPoolTest::parallelForZeroGrainSize});
+
+    addInstancedTests({&ThreadPoolTest::parallelReduce},
+        Containers::arraySize(ParallelReduceData));
+
+    addTests({&ThreadPoolTest::parallelReduceEmpty,
+              &ThreadPoolTest::parallelReduceZeroGrainSize,
+
+              &ThreadPoolTest::global});
+}
+
+void ThreadPoolTest::construct() {
+    ThreadPool pool{3};
+    CORRADE_COMPARE(pool.threadCount(), 3);
+}
+
+void ThreadPoolTest::constructHardwareConcurrency() {
+    ThreadPool pool{0};
+    CORRADE_COMPARE_AS(pool.threadCount(), 1,
+        TestSuite::Compare::GreaterOrEqual);
+}
+
+void ThreadPoolTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<ThreadPool>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<ThreadPool>{});
+}
+
+void ThreadPoolTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<ThreadPool>{});
+    CORRADE_VERIFY(!std::is_move_assignable<ThreadPool>{});
+}
+
+void ThreadPoolTest::parallelFor() {
+    auto&& data = ParallelForData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    ThreadPool pool{data.threadCount};
+
+    /* Each item should be visited exactly once and the ranges should be
+       aligned to the grain size. Execute several times to catch issues with
+       reusing the workers. */
+    for(std::size_t iteration = 0; iteration != 10; ++iteration) {
+        CORRADE_ITERATION(iteration);
+
+        Containers::Array<std::atomic<UnsignedInt>> visited{ValueInit, data.count};
+        std::atomic<UnsignedInt> misaligned{};
+        pool.parallelFor(data.count, data.grainSize, [&](std::size_t begin, std::size_t end) {
+            if(begin % data.grainSize || (end - begin != data.grainSize && end != data.count))
+                ++misaligned;
+            for(std::size_t i = begin; i != end; ++i)
+                ++visited[i];
+        });
+
+        CORRADE_COMPARE(misaligned.load(), 0);
+        std::size_t visitedOnce = 0;
+        for(const std::atomic<UnsignedInt>& i: visited)
+            if(i == 1) ++visitedOnce;
+        CORRADE_COMPARE(visitedOnce, data.count);
+    }
+}
+
+void ThreadPoolTest::parallelForEmpty() {
+    ThreadPool pool{4};
+
+    int called = 0;
+    pool.parallelFor(0, 16, [&](std::size_t, std::size_t) {
+        ++called;
+    });
+    CORRADE_COMPARE(called, 0);
+}
+
+void ThreadPoolTest::parallelForSingleChunk() {
+    ThreadPool pool{4};
+
+    /* A single chunk is always executed on the calling thread, so no atomics
+       needed here */
+    int called = 0;
+    pool.parallelFor(16, 16, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+        ++called;
+        CORRADE_COMPARE(begin, 0);
+        CORRADE_COMPARE(end, 16);
+        CORRADE_COMPARE(thread, 0);
+    });
+    CORRADE_COMPARE(called, 1);
+}
+
+void ThreadPoolTest::parallelForThreadIndex() {
+    ThreadPool pool{4};
+
+    /* The thread index is less than the thread count and, with just three
+       chunks, also less than the chunk count */
+    Containers::Array<std::atomic<UnsignedInt>> calledOnThread{ValueInit, 4};
+    pool.parallelFor(3000, 1000, [&](std::size_t, std::size_t, UnsignedInt thread) {
+        CORRADE_INTERNAL_ASSERT(thread < 3);
+        ++calledOnThread[thread];
+    });
+    CORRADE_COMPARE(calledOnThread[0] + calledOnThread[1] + calledOnThread[2], 3);
+    CORRADE_COMPARE(calledOnThread[3].load(), 0);
+}
+
+void ThreadPoolTest::parallelForNested() {
+    ThreadPool pool{4};
+
+    /* The nested calls get executed serially on the thread they're called
+       from, including the calling thread that holds the pool lock, so they
+       shouldn't deadlock. Execute several times to make it likely that both
+       the calling thread and the workers run some of the outer chunks. */
+    for(std::size_t iteration = 0; iteration != 10; ++iteration) {
+        CORRADE_ITERATION(iteration);
+
+        std::atomic<std::size_t> count{};
+        pool.parallelFor(16, 1, [&](std::size_t, std::size_t) {
+            pool.parallelFor(100, 10, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+                CORRADE_INTERNAL_ASSERT(thread == 0);
+                count += end - begin;
+            });
+        });
+        CORRADE_COMPARE(count.load(), 1600);
+    }
+
+    /* The pool is usable for non-nested calls afterwards */
+    std::atomic<std::size_t> count{};
+    pool.parallelFor(100, 10, [&](std::size_t begin, std::size_t end) {
+        count += end - begin;
+    });
+    CORRADE_COMPARE(count.load(), 100);
+}
+
+void ThreadPoolTest::parallelForNestedDifferentPool() {
+    ThreadPool outer{4};
+    ThreadPool inner{4};
+
+    /* Calls on a different pool from inside a job are executed serially as
+       well, to not oversubscribe */
+    for(std::size_t iteration = 0; iteration != 10; ++iteration) {
+        CORRADE_ITERATION(iteration);
+
+        std::atomic<std::size_t> count{};
+        outer.parallelFor(16, 1, [&](std::size_t, std::size_t) {
+            inner.parallelFor(100, 10, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+                CORRADE_INTERNAL_ASSERT(thread == 0);
+                count += end - begin;
+            });
+        });
+        CORRADE_COMPARE(count.load(), 1600);
+    }
+}
+
+void ThreadPoolTest::parallelForNestedInReduce() {
+    ThreadPool pool{4};
+
+    /* Same as parallelForNested(), but with the outer call being a
+       reduction */
+    for(std::size_t iteration = 0; iteration != 10; ++iteration) {
+        CORRADE_ITERATION(iteration);
+
+        CORRADE_COMPARE(pool.parallelReduce(16, 1, std::size_t{},
+            [&](std::size_t, std::size_t) {
+                std::atomic<std::size_t> count{};
+                pool.parallelFor(100, 10, [&](std::size_t begin, std::size_t end, UnsignedInt thread) {
+                    CORRADE_INTERNAL_ASSERT(thread == 0);
+                    count += end - begin;
+                });
+                return count.load();
+            },
+            [](std::size_t a, std::size_t b) { return a + b; }), 1600);
+    }
+}
+
+void ThreadPoolTest::parallelForZeroGrainSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ThreadPool pool{2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    pool.parallelFor(16, 0, [](std::size_t, std::size_t) {});
+    CORRADE_COMPARE(out, "ThreadPool::parallelFor(): expected a non-zero grain size\n");
+}
+
+void ThreadPoolTest::parallelReduce() {
+    auto&& data = ParallelReduceData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Floating-point addition isn't associative, so this verifies the
+       per-chunk results are combined always in the same order */
+    const auto map = [](std::size_t begin, std::size_t end) {
+        Double sum = 0.0;
+        for(std::size_t i = begin; i != end; ++i)
+            sum += 1.0/Double(i + 1);
+        return sum;
+    };
+    const auto reduce = [](Double a, Double b) { return a + b; };
+
+    ThreadPool single{1};
+    const Double expected = single.parallelReduce(100003, 37, 0.0, map, reduce);
+
+    ThreadPool pool{data.threadCount};
+    for(std::size_t iteration = 0; iteration != 10; ++iteration) {
+        CORRADE_ITERATION(iteration);
+        /* Deliberately not a fuzzy compare */
+        CORRADE_VERIFY(pool.parallelReduce(100003, 37, 0.0, map, reduce) == expected);
+    }
+}
+
+void ThreadPoolTest::parallelReduceEmpty() {
+    ThreadPool pool{4};
+
+    CORRADE_COMPARE(pool.parallelReduce(0, 16, 7,
+        [](std::size_t, std::size_t) { return 1; },
+        [](int a, int b) { return a + b; }), 7);
+}
+
+void ThreadPoolTest::parallelReduceZeroGrainSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ThreadPool pool{2};
+
+    Containers::String out;
+    Error redirectError{&out};
+    pool.parallelReduce(16, 0, 0,
+        [](std::size_t, std::size_t) { return 1; },
+        [](int a, int b) { return a + b; });
+    CORRADE_COMPARE(out, "ThreadPool::parallelReduce(): expected a non-zero grain size\n");
+}
+
+void ThreadPoolTest::global() {
+    /* Single-threaded by default */
+    CORRADE_COMPARE(ThreadPool::globalThreadCount(), 1);
+    CORRADE_COMPARE(ThreadPool::global().threadCount(), 1);
+
+    /* Returns the same instance if the count doesn't change */
+    ThreadPool& global = ThreadPool::global();
+    CORRADE_COMPARE(&ThreadPool::global(), &global);
+
+    /* Recreated with a new count */
+    ThreadPool::setGlobalThreadCount(3);
+    CORRADE_COMPARE(ThreadPool::globalThreadCount(), 3);
+    CORRADE_COMPARE(ThreadPool::global().threadCount(), 3);
+
+    /* Restore the default for other tests */
+    ThreadPool::setGlobalThreadCount(1);
+    CORRADE_COMPARE(ThreadPool::global().threadCount(), 1);
+}
+
+}}}
+
+CORRADE_TEST_MAIN(Magnum::Test::ThreadPoolTest)
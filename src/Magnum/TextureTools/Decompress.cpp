@@ -0,0 +1,1034 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Decompress.h"
+
+#include <cstring>
+#include <utility>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/ImageProperties.h"
+#include "Magnum/Implementation/imageUtilities.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum { namespace TextureTools {
+
+namespace {
+
+/* All decoders take a single block and output 4x4 pixels in a row-major
+   order, i.e. with pixel (x, y) at index y*4 + x */
+
+/* Division with rounding to nearest, halfway cases away from zero */
+inline Int divideRound(const Int numerator, const Int denominator) {
+    return numerator >= 0 ?
+        (numerator + denominator/2)/denominator :
+        -((-numerator + denominator/2)/denominator);
+}
+
+inline UnsignedByte clampUnorm8(const Int value) {
+    return UnsignedByte(Math::clamp(value, 0, 255));
+}
+
+inline UnsignedLong readLittleEndian(const UnsignedByte* const data, const UnsignedInt size) {
+    UnsignedLong out = 0;
+    for(UnsignedInt i = 0; i != size; ++i)
+        out |= UnsignedLong(data[i]) << 8*i;
+    return out;
+}
+
+/* ETC2 and EAC blocks are stored as big-endian 64-bit values */
+inline UnsignedLong readBigEndian64(const UnsignedByte* const data) {
+    UnsignedLong out = 0;
+    for(UnsignedInt i = 0; i != 8; ++i)
+        out = (out << 8)|data[i];
+    return out;
+}
+
+/* BC1 color block, also used by BC2 and BC3. The three-color mode is never
+   used by BC2 and BC3, in BC1 it has the fourth color transparent black. */
+void decodeBc1Colors(const UnsignedByte* const block, Vector4ub(&out)[16], const bool alwaysFourColor) {
+    const UnsignedInt color0 = readLittleEndian(block, 2);
+    const UnsignedInt color1 = readLittleEndian(block + 2, 2);
+    const UnsignedInt indices = readLittleEndian(block + 4, 4);
+
+    Int palette[4][4];
+    for(const UnsignedInt i: {0, 1}) {
+        const UnsignedInt color = i ? color1 : color0;
+        const UnsignedInt r = (color >> 11) & 0x1f;
+        const UnsignedInt g = (color >> 5) & 0x3f;
+        const UnsignedInt b = color & 0x1f;
+        palette[i][0] = (r << 3)|(r >> 2);
+        palette[i][1] = (g << 2)|(g >> 4);
+        palette[i][2] = (b << 3)|(b >> 2);
+        palette[i][3] = 255;
+    }
+    if(color0 > color1 || alwaysFourColor) for(UnsignedInt c = 0; c != 3; ++c) {
+        palette[2][c] = divideRound(2*palette[0][c] + palette[1][c], 3);
+        palette[3][c] = divideRound(palette[0][c] + 2*palette[1][c], 3);
+    } else for(UnsignedInt c = 0; c != 3; ++c) {
+        palette[2][c] = divideRound(palette[0][c] + palette[1][c], 2);
+        palette[3][c] = 0;
+    }
+    palette[2][3] = 255;
+    palette[3][3] = color0 > color1 || alwaysFourColor ? 255 : 0;
+
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const Int* const color = palette[(indices >> 2*i) & 0x3];
+        out[i] = Vector4ub(color[0], color[1], color[2], color[3]);
+    }
+}
+
+/* BC4 block, also used for BC3 alpha and BC5. Output is strided to allow
+   writing directly to a particular channel. */
+void decodeBc4Unsigned(const UnsignedByte* const block, UnsignedByte* const out, const std::size_t stride) {
+    const Int a0 = block[0];
+    const Int a1 = block[1];
+    const UnsignedLong indices = readLittleEndian(block + 2, 6);
+
+    Int palette[8]{a0, a1};
+    if(a0 > a1) {
+        for(Int i = 1; i != 7; ++i)
+            palette[i + 1] = divideRound((7 - i)*a0 + i*a1, 7);
+    } else {
+        for(Int i = 1; i != 5; ++i)
+            palette[i + 1] = divideRound((5 - i)*a0 + i*a1, 5);
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+
+    for(UnsignedInt i = 0; i != 16; ++i)
+        out[i*stride] = UnsignedByte(palette[(indices >> 3*i) & 0x7]);
+}
+
+void decodeBc4Signed(const UnsignedByte* const block, Byte* const out, const std::size_t stride) {
+    /* -128 is treated the same as -127 */
+    const Int a0 = Math::max(Int(Byte(block[0])), -127);
+    const Int a1 = Math::max(Int(Byte(block[1])), -127);
+    const UnsignedLong indices = readLittleEndian(block + 2, 6);
+
+    Int palette[8]{a0, a1};
+    if(a0 > a1) {
+        for(Int i = 1; i != 7; ++i)
+            palette[i + 1] = divideRound((7 - i)*a0 + i*a1, 7);
+    } else {
+        for(Int i = 1; i != 5; ++i)
+            palette[i + 1] = divideRound((5 - i)*a0 + i*a1, 5);
+        palette[6] = -127;
+        palette[7] = 127;
+    }
+
+    for(UnsignedInt i = 0; i != 16; ++i)
+        out[i*stride] = Byte(palette[(indices >> 3*i) & 0x7]);
+}
+
+void decodeBc1RGB(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeBc1Colors(block, pixels, false);
+    for(UnsignedInt i = 0; i != 16; ++i)
+        std::memcpy(out + i*3, pixels[i].data(), 3);
+}
+
+void decodeBc1RGBA(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeBc1Colors(block, pixels, false);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeBc2(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeBc1Colors(block + 8, pixels, true);
+    for(UnsignedInt i = 0; i != 16; ++i)
+        pixels[i].a() = ((block[i/2] >> 4*(i%2)) & 0xf)*17;
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeBc3(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeBc1Colors(block + 8, pixels, true);
+    decodeBc4Unsigned(block, &pixels[0].a(), 4);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeBc4RUnorm(const UnsignedByte* const block, char* const out) {
+    decodeBc4Unsigned(block, reinterpret_cast<UnsignedByte*>(out), 1);
+}
+
+void decodeBc4RSnorm(const UnsignedByte* const block, char* const out) {
+    decodeBc4Signed(block, reinterpret_cast<Byte*>(out), 1);
+}
+
+void decodeBc5RGUnorm(const UnsignedByte* const block, char* const out) {
+    decodeBc4Unsigned(block, reinterpret_cast<UnsignedByte*>(out), 2);
+    decodeBc4Unsigned(block + 8, reinterpret_cast<UnsignedByte*>(out) + 1, 2);
+}
+
+void decodeBc5RGSnorm(const UnsignedByte* const block, char* const out) {
+    decodeBc4Signed(block, reinterpret_cast<Byte*>(out), 2);
+    decodeBc4Signed(block + 8, reinterpret_cast<Byte*>(out) + 1, 2);
+}
+
+/* BC7 */
+
+struct Bc7Mode {
+    UnsignedByte subsetCount;
+    UnsignedByte partitionBits;
+    UnsignedByte rotationBits;
+    UnsignedByte indexSelectionBits;
+    UnsignedByte colorBits;
+    UnsignedByte alphaBits;
+    UnsignedByte endpointPBits;
+    UnsignedByte sharedPBits;
+    UnsignedByte indexBits;
+    UnsignedByte secondaryIndexBits;
+};
+
+constexpr Bc7Mode Bc7Modes[]{
+    {3, 4, 0, 0, 4, 0, 1, 0, 3, 0},
+    {2, 6, 0, 0, 6, 0, 0, 1, 3, 0},
+    {3, 6, 0, 0, 5, 0, 0, 0, 2, 0},
+    {2, 6, 0, 0, 7, 0, 1, 0, 2, 0},
+    {1, 0, 2, 1, 5, 6, 0, 0, 2, 3},
+    {1, 0, 2, 0, 7, 8, 0, 0, 2, 2},
+    {1, 0, 0, 0, 7, 7, 1, 0, 4, 0},
+    {2, 6, 0, 0, 5, 5, 1, 0, 2, 0}
+};
+
+/* Two-subset partitions, bit i is the subset index of pixel i */
+constexpr UnsignedShort Bc7Partitions2[64]{
+    0xcccc, 0x8888, 0xeeee, 0xecc8, 0xc880, 0xfeec, 0xfec8, 0xec80,
+    0xc800, 0xffec, 0xfe80, 0xe800, 0xffe8, 0xff00, 0xfff0, 0xf000,
+    0xf710, 0x008e, 0x7100, 0x08ce, 0x008c, 0x7310, 0x3100, 0x8cce,
+    0x088c, 0x3110, 0x6666, 0x366c, 0x17e8, 0x0ff0, 0x718e, 0x399c,
+    0xaaaa, 0xf0f0, 0x5a5a, 0x33cc, 0x3c3c, 0x55aa, 0x9696, 0xa55a,
+    0x73ce, 0x13c8, 0x324c, 0x3bdc, 0x6996, 0xc33c, 0x9966, 0x0660,
+    0x0272, 0x04e4, 0x4e40, 0x2720, 0xc936, 0x936c, 0x39c6, 0x639c,
+    0x9336, 0x9cc6, 0x817e, 0xe718, 0xccf0, 0x0fcc, 0x7744, 0xee22
+};
+
+/* Three-subset partitions, subset index of each pixel */
+constexpr UnsignedByte Bc7Partitions3[64][16]{
+    {0,0,1,1,0,0,1,1,0,2,2,1,2,2,2,2}, {0,0,0,1,0,0,1,1,2,2,1,1,2,2,2,1},
+    {0,0,0,0,2,0,0,1,2,2,1,1,2,2,1,1}, {0,2,2,2,0,0,2,2,0,0,1,1,0,1,1,1},
+    {0,0,0,0,0,0,0,0,1,1,2,2,1,1,2,2}, {0,0,1,1,0,0,1,1,0,0,2,2,0,0,2,2},
+    {0,0,2,2,0,0,2,2,1,1,1,1,1,1,1,1}, {0,0,1,1,0,0,1,1,2,2,1,1,2,2,1,1},
+    {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2}, {0,0,0,0,1,1,1,1,1,1,1,1,2,2,2,2},
+    {0,0,0,0,1,1,1,1,2,2,2,2,2,2,2,2}, {0,0,1,2,0,0,1,2,0,0,1,2,0,0,1,2},
+    {0,1,1,2,0,1,1,2,0,1,1,2,0,1,1,2}, {0,1,2,2,0,1,2,2,0,1,2,2,0,1,2,2},
+    {0,0,1,1,0,1,1,2,1,1,2,2,1,2,2,2}, {0,0,1,1,2,0,0,1,2,2,0,0,2,2,2,0},
+    {0,0,0,1,0,0,1,1,0,1,1,2,1,1,2,2}, {0,1,1,1,0,0,1,1,2,0,0,1,2,2,0,0},
+    {0,0,0,0,1,1,2,2,1,1,2,2,1,1,2,2}, {0,0,2,2,0,0,2,2,0,0,2,2,1,1,1,1},
+    {0,1,1,1,0,1,1,1,0,2,2,2,0,2,2,2}, {0,0,0,1,0,0,0,1,2,2,2,1,2,2,2,1},
+    {0,0,0,0,0,0,1,1,0,1,2,2,0,1,2,2}, {0,0,0,0,1,1,0,0,2,2,1,0,2,2,1,0},
+    {0,1,2,2,0,1,2,2,0,0,1,1,0,0,0,0}, {0,0,1,2,0,0,1,2,1,1,2,2,2,2,2,2},
+    {0,1,1,0,1,2,2,1,1,2,2,1,0,1,1,0}, {0,0,0,0,0,1,1,0,1,2,2,1,1,2,2,1},
+    {0,0,2,2,1,1,0,2,1,1,0,2,0,0,2,2}, {0,1,1,0,0,1,1,0,2,0,0,2,2,2,2,2},
+    {0,0,1,1,0,1,2,2,0,1,2,2,0,0,1,1}, {0,0,0,0,2,0,0,0,2,2,1,1,2,2,2,1},
+    {0,0,0,0,0,0,0,2,1,1,2,2,1,2,2,2}, {0,2,2,2,0,0,2,2,0,0,1,2,0,0,1,1},
+    {0,0,1,1,0,0,1,2,0,0,2,2,0,2,2,2}, {0,1,2,0,0,1,2,0,0,1,2,0,0,1,2,0},
+    {0,0,0,0,1,1,1,1,2,2,2,2,0,0,0,0}, {0,1,2,0,1,2,0,1,2,0,1,2,0,1,2,0},
+    {0,1,2,0,2,0,1,2,1,2,0,1,0,1,2,0}, {0,0,1,1,2,2,0,0,1,1,2,2,0,0,1,1},
+    {0,0,1,1,1,1,2,2,2,2,0,0,0,0,1,1}, {0,1,0,1,0,1,0,1,2,2,2,2,2,2,2,2},
+    {0,0,0,0,0,0,0,0,2,1,2,1,2,1,2,1}, {0,0,2,2,1,1,2,2,0,0,2,2,1,1,2,2},
+    {0,0,2,2,0,0,1,1,0,0,2,2,0,0,1,1}, {0,2,2,0,1,2,2,1,0,2,2,0,1,2,2,1},
+    {0,1,0,1,2,2,2,2,2,2,2,2,0,1,0,1}, {0,0,0,0,2,1,2,1,2,1,2,1,2,1,2,1},
+    {0,1,0,1,0,1,0,1,0,1,0,1,2,2,2,2}, {0,2,2,2,0,1,1,1,0,2,2,2,0,1,1,1},
+    {0,0,0,2,1,1,1,2,0,0,0,2,1,1,1,2}, {0,0,0,0,2,1,1,2,2,1,1,2,2,1,1,2},
+    {0,2,2,2,0,1,1,1,0,1,1,1,0,2,2,2}, {0,0,0,2,1,1,1,2,1,1,1,2,0,0,0,2},
+    {0,1,1,0,0,1,1,0,0,1,1,0,2,2,2,2}, {0,0,0,0,0,0,0,0,2,1,1,2,2,1,1,2},
+    {0,1,1,0,0,1,1,0,2,2,2,2,2,2,2,2}, {0,0,2,2,0,0,1,1,0,0,1,1,0,0,2,2},
+    {0,0,2,2,1,1,2,2,1,1,2,2,0,0,2,2}, {0,0,0,0,0,0,0,0,0,0,0,0,2,1,1,2},
+    {0,0,0,2,0,0,0,1,0,0,0,2,0,0,0,1}, {0,2,2,2,1,2,2,2,0,2,2,2,1,2,2,2},
+    {0,1,0,1,2,2,2,2,2,2,2,2,2,2,2,2}, {0,1,1,1,2,0,1,1,2,2,0,1,2,2,2,0}
+};
+
+/* Anchor pixel of the second subset in two-subset partitions and of the
+   second and third subset in three-subset partitions. The anchor pixel of
+   the first subset is always 0. */
+constexpr UnsignedByte Bc7Anchors2[64]{
+    15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+    15,  2,  8,  2,  2,  8,  8, 15,  2,  8,  2,  2,  8,  8,  2,  2,
+    15, 15,  6,  8,  2,  8, 15, 15,  2,  8,  2,  2,  2, 15, 15,  6,
+     6,  2,  6,  8, 15, 15,  2,  2, 15, 15, 15, 15, 15,  2,  2, 15
+};
+constexpr UnsignedByte Bc7Anchors3Second[64]{
+     3,  3, 15, 15,  8,  3, 15, 15,  8,  8,  6,  6,  6,  5,  3,  3,
+     3,  3,  8, 15,  3,  3,  6, 10,  5,  8,  8,  6,  8,  5, 15, 15,
+     8, 15,  3,  5,  6, 10,  8, 15, 15,  3, 15,  5, 15, 15, 15, 15,
+     3, 15,  5,  5,  5,  8,  5, 10,  5, 10,  8, 13, 15, 12,  3,  3
+};
+constexpr UnsignedByte Bc7Anchors3Third[64]{
+    15,  8,  8,  3, 15, 15,  3,  8, 15, 15, 15, 15, 15, 15, 15,  8,
+    15,  8, 15,  3, 15,  8, 15,  8,  3, 15,  6, 10, 15, 15, 10,  8,
+    15,  3, 15, 10, 10,  8,  9, 10,  6, 15,  8, 15,  3,  6,  6,  8,
+    15,  3, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,  3, 15, 15,  8
+};
+
+constexpr UnsignedByte Bc7Weights2[]{0, 21, 43, 64};
+constexpr UnsignedByte Bc7Weights3[]{0, 9, 18, 27, 37, 46, 55, 64};
+constexpr UnsignedByte Bc7Weights4[]{0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64};
+
+inline UnsignedInt bc7Weight(const UnsignedInt bits, const UnsignedInt index) {
+    return bits == 2 ? Bc7Weights2[index] :
+           bits == 3 ? Bc7Weights3[index] : Bc7Weights4[index];
+}
+
+struct Bc7BitReader {
+    const UnsignedByte* data;
+    UnsignedInt position;
+
+    UnsignedInt read(const UnsignedInt count) {
+        UnsignedInt out = 0;
+        for(UnsignedInt i = 0; i != count; ++i, ++position)
+            out |= ((data[position >> 3] >> (position & 7)) & 1) << i;
+        return out;
+    }
+};
+
+void decodeBc7(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+
+    /* The mode is given by the position of the lowest set bit, a block with
+       the first byte zero is reserved and decodes to transparent black */
+    UnsignedInt modeIndex = 0;
+    while(modeIndex != 8 && !(block[0] & (1 << modeIndex))) ++modeIndex;
+    if(modeIndex == 8) {
+        std::memset(out, 0, sizeof(pixels));
+        return;
+    }
+
+    const Bc7Mode& mode = Bc7Modes[modeIndex];
+    Bc7BitReader reader{block, modeIndex + 1};
+    const UnsignedInt partition = reader.read(mode.partitionBits);
+    const UnsignedInt rotation = reader.read(mode.rotationBits);
+    const UnsignedInt indexSelection = reader.read(mode.indexSelectionBits);
+
+    /* Endpoints are stored channel by channel */
+    const UnsignedInt endpointCount = mode.subsetCount*2;
+    UnsignedInt endpoints[6][4];
+    for(UnsignedInt c = 0; c != 3; ++c)
+        for(UnsignedInt e = 0; e != endpointCount; ++e)
+            endpoints[e][c] = reader.read(mode.colorBits);
+    for(UnsignedInt e = 0; e != endpointCount; ++e)
+        endpoints[e][3] = mode.alphaBits ? reader.read(mode.alphaBits) : 255;
+
+    /* P-bits extend all channels by one bit. Either each endpoint has its
+       own or the two endpoints of a subset share one. */
+    UnsignedInt colorBits = mode.colorBits;
+    UnsignedInt alphaBits = mode.alphaBits;
+    if(mode.endpointPBits || mode.sharedPBits) {
+        UnsignedInt p[6];
+        if(mode.endpointPBits) for(UnsignedInt e = 0; e != endpointCount; ++e)
+            p[e] = reader.read(1);
+        else for(UnsignedInt s = 0; s != mode.subsetCount; ++s)
+            p[2*s] = p[2*s + 1] = reader.read(1);
+
+        for(UnsignedInt e = 0; e != endpointCount; ++e) {
+            for(UnsignedInt c = 0; c != 3; ++c)
+                endpoints[e][c] = (endpoints[e][c] << 1)|p[e];
+            if(mode.alphaBits)
+                endpoints[e][3] = (endpoints[e][3] << 1)|p[e];
+        }
+
+        ++colorBits;
+        if(alphaBits) ++alphaBits;
+    }
+
+    /* Expand to 8 bits by replicating the high bits */
+    for(UnsignedInt e = 0; e != endpointCount; ++e) {
+        for(UnsignedInt c = 0; c != 3; ++c)
+            endpoints[e][c] = (endpoints[e][c] << (8 - colorBits))|(endpoints[e][c] >> (2*colorBits - 8));
+        if(alphaBits)
+            endpoints[e][3] = (endpoints[e][3] << (8 - alphaBits))|(endpoints[e][3] >> (2*alphaBits - 8));
+    }
+
+    /* Subset and anchor assignment. Anchor pixels have the highest index bit
+       implicitly zero and thus one bit less stored. */
+    UnsignedInt subsets[16];
+    bool anchors[16]{true};
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        if(mode.subsetCount == 1) subsets[i] = 0;
+        else if(mode.subsetCount == 2) subsets[i] = (Bc7Partitions2[partition] >> i) & 1;
+        else subsets[i] = Bc7Partitions3[partition][i];
+    }
+    if(mode.subsetCount == 2)
+        anchors[Bc7Anchors2[partition]] = true;
+    else if(mode.subsetCount == 3) {
+        anchors[Bc7Anchors3Second[partition]] = true;
+        anchors[Bc7Anchors3Third[partition]] = true;
+    }
+
+    UnsignedInt indices[16];
+    for(UnsignedInt i = 0; i != 16; ++i)
+        indices[i] = reader.read(mode.indexBits - anchors[i]);
+    UnsignedInt secondaryIndices[16];
+    if(mode.secondaryIndexBits) for(UnsignedInt i = 0; i != 16; ++i)
+        secondaryIndices[i] = reader.read(mode.secondaryIndexBits - (i == 0));
+
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const UnsignedInt* const e0 = endpoints[2*subsets[i]];
+        const UnsignedInt* const e1 = endpoints[2*subsets[i] + 1];
+
+        /* With two index sets the index selection bit picks which one is
+           used for color and which for alpha */
+        UnsignedInt colorWeight, alphaWeight;
+        if(!mode.secondaryIndexBits)
+            colorWeight = alphaWeight = bc7Weight(mode.indexBits, indices[i]);
+        else if(!indexSelection) {
+            colorWeight = bc7Weight(mode.indexBits, indices[i]);
+            alphaWeight = bc7Weight(mode.secondaryIndexBits, secondaryIndices[i]);
+        } else {
+            colorWeight = bc7Weight(mode.secondaryIndexBits, secondaryIndices[i]);
+            alphaWeight = bc7Weight(mode.indexBits, indices[i]);
+        }
+
+        Vector4ub& pixel = pixels[i];
+        for(UnsignedInt c = 0; c != 3; ++c)
+            pixel[c] = ((64 - colorWeight)*e0[c] + colorWeight*e1[c] + 32) >> 6;
+        pixel[3] = ((64 - alphaWeight)*e0[3] + alphaWeight*e1[3] + 32) >> 6;
+
+        /* Rotation swaps alpha with one of the color channels */
+        if(rotation) std::swap(pixel[3], pixel[rotation - 1]);
+    }
+
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+/* BC6H */
+
+/* Endpoint components and the partition index. W and X are the two endpoints
+   of the first region, Y and Z of the second region. */
+enum Bc6hField: UnsignedByte {
+    Rw, Gw, Bw, Rx, Gx, Bx, Ry, Gy, By, Rz, Gz, Bz, D
+};
+
+/* A range of bits of a field in the order they're stored in a block, lowest
+   bit first. Modes with 12- and 16-bit endpoints store the high endpoint bits
+   reversed, which is expressed with single-bit ranges in a descending
+   order. */
+struct Bc6hBits {
+    UnsignedByte field;
+    UnsignedByte shift;
+    UnsignedByte count;
+};
+
+struct Bc6hMode {
+    UnsignedByte mode;
+    UnsignedByte regionCount;
+    UnsignedByte endpointBits;
+    UnsignedByte deltaBits[3];
+    bool transformed;
+    /* Terminated by an item with zero count if there's less than 24 */
+    Bc6hBits bits[24];
+};
+
+/* Mode bits, which are five for all modes except the first two, are not
+   included in the bit layout */
+constexpr Bc6hMode Bc6hModes[]{
+    {0x00, 2, 10, {5, 5, 5}, true, {
+        {Gy, 4, 1}, {By, 4, 1}, {Bz, 4, 1}, {Rw, 0, 10}, {Gw, 0, 10},
+        {Bw, 0, 10}, {Rx, 0, 5}, {Gz, 4, 1}, {Gy, 0, 4}, {Gx, 0, 5},
+        {Bz, 0, 1}, {Gz, 0, 4}, {Bx, 0, 5}, {Bz, 1, 1}, {By, 0, 4}, {Ry, 0, 5},
+        {Bz, 2, 1}, {Rz, 0, 5}, {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x01, 2, 7, {6, 6, 6}, true, {
+        {Gy, 5, 1}, {Gz, 4, 1}, {Gz, 5, 1}, {Rw, 0, 7}, {Bz, 0, 1}, {Bz, 1, 1},
+        {By, 4, 1}, {Gw, 0, 7}, {By, 5, 1}, {Bz, 2, 1}, {Gy, 4, 1}, {Bw, 0, 7},
+        {Bz, 3, 1}, {Bz, 5, 1}, {Bz, 4, 1}, {Rx, 0, 6}, {Gy, 0, 4}, {Gx, 0, 6},
+        {Gz, 0, 4}, {Bx, 0, 6}, {By, 0, 4}, {Ry, 0, 6}, {Rz, 0, 6}, {D, 0, 5}
+    }},
+    {0x02, 2, 11, {5, 4, 4}, true, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 5}, {Rw, 10, 1},
+        {Gy, 0, 4}, {Gx, 0, 4}, {Gw, 10, 1}, {Bz, 0, 1}, {Gz, 0, 4},
+        {Bx, 0, 4}, {Bw, 10, 1}, {Bz, 1, 1}, {By, 0, 4}, {Ry, 0, 5},
+        {Bz, 2, 1}, {Rz, 0, 5}, {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x06, 2, 11, {4, 5, 4}, true, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 4}, {Rw, 10, 1},
+        {Gz, 4, 1}, {Gy, 0, 4}, {Gx, 0, 5}, {Gw, 10, 1}, {Gz, 0, 4},
+        {Bx, 0, 4}, {Bw, 10, 1}, {Bz, 1, 1}, {By, 0, 4}, {Ry, 0, 4},
+        {Bz, 0, 1}, {Bz, 2, 1}, {Rz, 0, 4}, {Gy, 4, 1}, {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x0a, 2, 11, {4, 4, 5}, true, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 4}, {Rw, 10, 1},
+        {By, 4, 1}, {Gy, 0, 4}, {Gx, 0, 4}, {Gw, 10, 1}, {Bz, 0, 1},
+        {Gz, 0, 4}, {Bx, 0, 5}, {Bw, 10, 1}, {By, 0, 4}, {Ry, 0, 4},
+        {Bz, 1, 1}, {Bz, 2, 1}, {Rz, 0, 4}, {Bz, 4, 1}, {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x0e, 2, 9, {5, 5, 5}, true, {
+        {Rw, 0, 9}, {By, 4, 1}, {Gw, 0, 9}, {Gy, 4, 1}, {Bw, 0, 9}, {Bz, 4, 1},
+        {Rx, 0, 5}, {Gz, 4, 1}, {Gy, 0, 4}, {Gx, 0, 5}, {Bz, 0, 1}, {Gz, 0, 4},
+        {Bx, 0, 5}, {Bz, 1, 1}, {By, 0, 4}, {Ry, 0, 5}, {Bz, 2, 1}, {Rz, 0, 5},
+        {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x12, 2, 8, {6, 5, 5}, true, {
+        {Rw, 0, 8}, {Gz, 4, 1}, {By, 4, 1}, {Gw, 0, 8}, {Bz, 2, 1}, {Gy, 4, 1},
+        {Bw, 0, 8}, {Bz, 3, 1}, {Bz, 4, 1}, {Rx, 0, 6}, {Gy, 0, 4}, {Gx, 0, 5},
+        {Bz, 0, 1}, {Gz, 0, 4}, {Bx, 0, 5}, {Bz, 1, 1}, {By, 0, 4}, {Ry, 0, 6},
+        {Rz, 0, 6}, {D, 0, 5}
+    }},
+    {0x16, 2, 8, {5, 6, 5}, true, {
+        {Rw, 0, 8}, {Bz, 0, 1}, {By, 4, 1}, {Gw, 0, 8}, {Gy, 5, 1}, {Gy, 4, 1},
+        {Bw, 0, 8}, {Gz, 5, 1}, {Bz, 4, 1}, {Rx, 0, 5}, {Gz, 4, 1}, {Gy, 0, 4},
+        {Gx, 0, 6}, {Gz, 0, 4}, {Bx, 0, 5}, {Bz, 1, 1}, {By, 0, 4}, {Ry, 0, 5},
+        {Bz, 2, 1}, {Rz, 0, 5}, {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x1a, 2, 8, {5, 5, 6}, true, {
+        {Rw, 0, 8}, {Bz, 1, 1}, {By, 4, 1}, {Gw, 0, 8}, {By, 5, 1}, {Gy, 4, 1},
+        {Bw, 0, 8}, {Bz, 5, 1}, {Bz, 4, 1}, {Rx, 0, 5}, {Gz, 4, 1}, {Gy, 0, 4},
+        {Gx, 0, 5}, {Bz, 0, 1}, {Gz, 0, 4}, {Bx, 0, 6}, {By, 0, 4}, {Ry, 0, 5},
+        {Bz, 2, 1}, {Rz, 0, 5}, {Bz, 3, 1}, {D, 0, 5}
+    }},
+    {0x1e, 2, 6, {6, 6, 6}, false, {
+        {Rw, 0, 6}, {Gz, 4, 1}, {Bz, 0, 1}, {Bz, 1, 1}, {By, 4, 1}, {Gw, 0, 6},
+        {Gy, 5, 1}, {By, 5, 1}, {Bz, 2, 1}, {Gy, 4, 1}, {Bw, 0, 6}, {Gz, 5, 1},
+        {Bz, 3, 1}, {Bz, 5, 1}, {Bz, 4, 1}, {Rx, 0, 6}, {Gy, 0, 4}, {Gx, 0, 6},
+        {Gz, 0, 4}, {Bx, 0, 6}, {By, 0, 4}, {Ry, 0, 6}, {Rz, 0, 6}, {D, 0, 5}
+    }},
+    {0x03, 1, 10, {10, 10, 10}, false, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 10}, {Gx, 0, 10},
+        {Bx, 0, 10}
+    }},
+    {0x07, 1, 11, {9, 9, 9}, true, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 9}, {Rw, 10, 1},
+        {Gx, 0, 9}, {Gw, 10, 1}, {Bx, 0, 9}, {Bw, 10, 1}
+    }},
+    {0x0b, 1, 12, {8, 8, 8}, true, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 8}, {Rw, 11, 1},
+        {Rw, 10, 1}, {Gx, 0, 8}, {Gw, 11, 1}, {Gw, 10, 1}, {Bx, 0, 8},
+        {Bw, 11, 1}, {Bw, 10, 1}
+    }},
+    {0x0f, 1, 16, {4, 4, 4}, true, {
+        {Rw, 0, 10}, {Gw, 0, 10}, {Bw, 0, 10}, {Rx, 0, 4}, {Rw, 15, 1},
+        {Rw, 14, 1}, {Rw, 13, 1}, {Rw, 12, 1}, {Rw, 11, 1}, {Rw, 10, 1},
+        {Gx, 0, 4}, {Gw, 15, 1}, {Gw, 14, 1}, {Gw, 13, 1}, {Gw, 12, 1},
+        {Gw, 11, 1}, {Gw, 10, 1}, {Bx, 0, 4}, {Bw, 15, 1}, {Bw, 14, 1},
+        {Bw, 13, 1}, {Bw, 12, 1}, {Bw, 11, 1}, {Bw, 10, 1}
+    }},
+};
+
+inline Int signExtend(const Int value, const UnsignedInt bits) {
+    const UnsignedInt shift = 32 - bits;
+    return Int(UnsignedInt(value) << shift) >> shift;
+}
+
+/* Expands an endpoint component to 16 bits */
+template<bool isSigned> Int bc6hUnquantize(Int value, UnsignedInt bits);
+template<> Int bc6hUnquantize<false>(const Int value, const UnsignedInt bits) {
+    if(bits >= 15 || !value) return value;
+    if(value == (1 << bits) - 1) return 0xffff;
+    return ((value << 16) + 0x8000) >> bits;
+}
+template<> Int bc6hUnquantize<true>(const Int value, const UnsignedInt bits) {
+    if(bits >= 16 || !value) return value;
+    const Int magnitude = value < 0 ? -value : value;
+    const Int out = magnitude >= (1 << (bits - 1)) - 1 ? 0x7fff :
+        ((magnitude << 15) + 0x4000) >> (bits - 1);
+    return value < 0 ? -out : out;
+}
+
+/* Scales an interpolated value to a half-float bit pattern, negative values
+   are stored with a sign bit and a magnitude */
+template<bool isSigned> UnsignedShort bc6hFinishUnquantize(Int value);
+template<> UnsignedShort bc6hFinishUnquantize<false>(const Int value) {
+    return UnsignedShort((value*31) >> 6);
+}
+template<> UnsignedShort bc6hFinishUnquantize<true>(const Int value) {
+    /* Negative values that scale to zero become a positive zero */
+    const Int magnitude = ((value < 0 ? -value : value)*31) >> 5;
+    return UnsignedShort(value < 0 && magnitude ? 0x8000|magnitude : magnitude);
+}
+
+template<bool isSigned> void decodeBc6h(const UnsignedByte* const block, char* const out) {
+    Vector3us pixels[16];
+
+    /* The first two modes are identified by two bits, all others by five */
+    Bc7BitReader reader{block, 0};
+    UnsignedInt modeValue = reader.read(2);
+    if(modeValue > 1) modeValue |= reader.read(3) << 2;
+    const Bc6hMode* mode = nullptr;
+    for(const Bc6hMode& i: Bc6hModes) if(i.mode == modeValue) {
+        mode = &i;
+        break;
+    }
+
+    /* Reserved modes decode to black */
+    if(!mode) {
+        std::memset(out, 0, sizeof(pixels));
+        return;
+    }
+
+    Int fields[D + 1]{};
+    for(const Bc6hBits& bits: mode->bits) {
+        if(!bits.count) break;
+        fields[bits.field] |= Int(reader.read(bits.count) << bits.shift);
+    }
+
+    /* In signed formats the endpoints are sign-extended. In transformed
+       modes all endpoints except the first are signed deltas from the first
+       one, wrapping around the endpoint precision. */
+    const UnsignedInt endpointCount = mode->regionCount*2;
+    const UnsignedInt endpointBits = mode->endpointBits;
+    Int endpoints[4][3];
+    for(UnsignedInt c = 0; c != 3; ++c) {
+        endpoints[0][c] = fields[c];
+        if(isSigned)
+            endpoints[0][c] = signExtend(endpoints[0][c], endpointBits);
+        for(UnsignedInt e = 1; e != endpointCount; ++e) {
+            endpoints[e][c] = fields[e*3 + c];
+            if(mode->transformed)
+                endpoints[e][c] = (endpoints[0][c] + signExtend(endpoints[e][c], mode->deltaBits[c])) & ((1 << endpointBits) - 1);
+            if(isSigned)
+                endpoints[e][c] = signExtend(endpoints[e][c], endpointBits);
+        }
+    }
+    for(UnsignedInt e = 0; e != endpointCount; ++e)
+        for(UnsignedInt c = 0; c != 3; ++c)
+            endpoints[e][c] = bc6hUnquantize<isSigned>(endpoints[e][c], endpointBits);
+
+    /* Two-region modes use the first 32 BC7 two-subset partitions. Anchor
+       pixels have the highest index bit implicitly zero. */
+    const UnsignedInt partition = fields[D];
+    const UnsignedInt indexBits = mode->regionCount == 2 ? 3 : 4;
+    UnsignedInt regions[16];
+    UnsignedInt indices[16];
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        regions[i] = mode->regionCount == 2 ? (Bc7Partitions2[partition] >> i) & 1 : 0;
+        const bool anchor = i == 0 || (mode->regionCount == 2 && i == Bc7Anchors2[partition]);
+        indices[i] = reader.read(indexBits - anchor);
+    }
+
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const Int* const e0 = endpoints[2*regions[i]];
+        const Int* const e1 = endpoints[2*regions[i] + 1];
+        const Int weight = bc7Weight(indexBits, indices[i]);
+        for(UnsignedInt c = 0; c != 3; ++c)
+            pixels[i][c] = bc6hFinishUnquantize<isSigned>(((64 - weight)*e0[c] + weight*e1[c] + 32) >> 6);
+    }
+
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+/* ETC2 */
+
+constexpr Int Etc1Modifiers[8][2]{
+    {2, 8}, {5, 17}, {9, 29}, {13, 42},
+    {18, 60}, {24, 80}, {33, 106}, {47, 183}
+};
+
+constexpr Int Etc2Distances[8]{3, 6, 11, 16, 23, 32, 41, 64};
+
+constexpr Int EacModifiers[16][8]{
+    {-3, -6,  -9, -15, 2, 5, 8, 14},
+    {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5,  -8, -13, 1, 4, 7, 12},
+    {-2, -4,  -6, -13, 1, 3, 5, 12},
+    {-3, -6,  -8, -12, 2, 5, 7, 11},
+    {-3, -7,  -9, -11, 2, 6, 8, 10},
+    {-4, -7,  -8, -11, 3, 6, 7, 10},
+    {-3, -5,  -8, -11, 2, 4, 7, 10},
+    {-2, -6,  -8, -10, 1, 5, 7,  9},
+    {-2, -5,  -8, -10, 1, 4, 7,  9},
+    {-2, -4,  -8, -10, 1, 3, 7,  9},
+    {-2, -5,  -7, -10, 1, 4, 6,  9},
+    {-3, -4,  -7, -10, 2, 3, 6,  9},
+    {-1, -2,  -3, -10, 0, 1, 2,  9},
+    {-4, -6,  -8,  -9, 3, 5, 7,  8},
+    {-3, -5,  -7,  -9, 2, 4, 6,  8}
+};
+
+inline Int extend4(const UnsignedLong value) {
+    return Int(value & 0xf)*17;
+}
+
+inline Int extend5(const Int value) {
+    return (value << 3)|(value >> 2);
+}
+
+inline Int extend6(const UnsignedLong value) {
+    const Int v = value & 0x3f;
+    return (v << 2)|(v >> 4);
+}
+
+inline Int extend7(const UnsignedLong value) {
+    const Int v = value & 0x7f;
+    return (v << 1)|(v >> 6);
+}
+
+inline Int signExtend3(const UnsignedLong value) {
+    const Int v = value & 0x7;
+    return v >= 4 ? v - 8 : v;
+}
+
+/* ETC2 RGB block, optionally with punchthrough alpha. Pixel indices are
+   stored in a column-major order, i.e. with pixel (x, y) at bit x*4 + y. */
+void decodeEtc2Colors(const UnsignedLong block, Vector4ub(&out)[16], const bool punchthrough) {
+    /* In the punchthrough variant the differential bit is reused as an
+       opaque bit and the individual mode is not available */
+    const bool differentialBit = (block >> 33) & 1;
+    const bool differential = punchthrough || differentialBit;
+    const bool opaque = !punchthrough || differentialBit;
+
+    auto pixelIndex = [&](const UnsignedInt x, const UnsignedInt y) {
+        const UnsignedInt bit = x*4 + y;
+        return UnsignedInt(((block >> (16 + bit)) & 1) << 1|((block >> bit) & 1));
+    };
+
+    /* Individual or differential mode with two base colors, one for each
+       subblock */
+    auto etc1 = [&](const Int(&color0)[3], const Int(&color1)[3]) {
+        const bool flip = (block >> 32) & 1;
+        const UnsignedInt table0 = (block >> 37) & 0x7;
+        const UnsignedInt table1 = (block >> 34) & 0x7;
+        for(UnsignedInt y = 0; y != 4; ++y) for(UnsignedInt x = 0; x != 4; ++x) {
+            const bool second = flip ? y >= 2 : x >= 2;
+            const UnsignedInt index = pixelIndex(x, y);
+            Vector4ub& pixel = out[y*4 + x];
+            if(!opaque && index == 2) {
+                pixel = {};
+                continue;
+            }
+
+            /* Indices 0 and 1 are positive, 2 and 3 negative. In the
+               punchthrough non-opaque variant index 0 has no modifier. */
+            const Int* const modifiers = Etc1Modifiers[second ? table1 : table0];
+            Int modifier = modifiers[index & 1];
+            if(index & 2) modifier = -modifier;
+            if(!opaque && index == 0) modifier = 0;
+
+            const Int(&color)[3] = second ? color1 : color0;
+            pixel = Vector4ub(clampUnorm8(color[0] + modifier),
+                              clampUnorm8(color[1] + modifier),
+                              clampUnorm8(color[2] + modifier), 255);
+        }
+    };
+
+    /* T and H modes with four paint colors picked by the pixel index */
+    auto paint = [&](const Int(&paintColors)[4][3]) {
+        for(UnsignedInt y = 0; y != 4; ++y) for(UnsignedInt x = 0; x != 4; ++x) {
+            const UnsignedInt index = pixelIndex(x, y);
+            Vector4ub& pixel = out[y*4 + x];
+            if(!opaque && index == 2) {
+                pixel = {};
+                continue;
+            }
+
+            const Int(&color)[3] = paintColors[index];
+            pixel = Vector4ub(clampUnorm8(color[0]),
+                              clampUnorm8(color[1]),
+                              clampUnorm8(color[2]), 255);
+        }
+    };
+
+    if(!differential) {
+        const Int color0[3]{extend4(block >> 60), extend4(block >> 52), extend4(block >> 44)};
+        const Int color1[3]{extend4(block >> 56), extend4(block >> 48), extend4(block >> 40)};
+        etc1(color0, color1);
+        return;
+    }
+
+    const Int r = (block >> 59) & 0x1f;
+    const Int g = (block >> 51) & 0x1f;
+    const Int b = (block >> 43) & 0x1f;
+    const Int dr = signExtend3(block >> 56);
+    const Int dg = signExtend3(block >> 48);
+    const Int db = signExtend3(block >> 40);
+
+    /* T mode, signalled by the red component overflowing */
+    if(r + dr < 0 || r + dr > 31) {
+        const Int color0[3]{
+            extend4(((block >> 57) & 0xc)|((block >> 56) & 0x3)),
+            extend4(block >> 52),
+            extend4(block >> 48)};
+        const Int color1[3]{extend4(block >> 44), extend4(block >> 40), extend4(block >> 36)};
+        const Int distance = Etc2Distances[((block >> 33) & 0x6)|((block >> 32) & 0x1)];
+        const Int paintColors[4][3]{
+            {color0[0], color0[1], color0[2]},
+            {color1[0] + distance, color1[1] + distance, color1[2] + distance},
+            {color1[0], color1[1], color1[2]},
+            {color1[0] - distance, color1[1] - distance, color1[2] - distance}
+        };
+        paint(paintColors);
+
+    /* H mode, signalled by the green component overflowing */
+    } else if(g + dg < 0 || g + dg > 31) {
+        const UnsignedInt r0 = (block >> 59) & 0xf;
+        const UnsignedInt g0 = ((block >> 55) & 0xe)|((block >> 52) & 0x1);
+        const UnsignedInt b0 = ((block >> 48) & 0x8)|((block >> 47) & 0x7);
+        const UnsignedInt r1 = (block >> 43) & 0xf;
+        const UnsignedInt g1 = (block >> 39) & 0xf;
+        const UnsignedInt b1 = (block >> 35) & 0xf;
+        /* The lowest bit of the distance index is given by the order of the
+           two base colors */
+        const UnsignedInt distanceIndex = ((block >> 32) & 0x4)|((block >> 31) & 0x2)|
+            (((r0 << 8)|(g0 << 4)|b0) >= ((r1 << 8)|(g1 << 4)|b1) ? 1 : 0);
+        const Int distance = Etc2Distances[distanceIndex];
+        const Int color0[3]{extend4(r0), extend4(g0), extend4(b0)};
+        const Int color1[3]{extend4(r1), extend4(g1), extend4(b1)};
+        const Int paintColors[4][3]{
+            {color0[0] + distance, color0[1] + distance, color0[2] + distance},
+            {color0[0] - distance, color0[1] - distance, color0[2] - distance},
+            {color1[0] + distance, color1[1] + distance, color1[2] + distance},
+            {color1[0] - distance, color1[1] - distance, color1[2] - distance}
+        };
+        paint(paintColors);
+
+    /* Planar mode, signalled by the blue component overflowing. Always
+       opaque. */
+    } else if(b + db < 0 || b + db > 31) {
+        const Int origin[3]{
+            extend6(block >> 57),
+            extend7(((block >> 50) & 0x40)|((block >> 49) & 0x3f)),
+            extend6(((block >> 43) & 0x20)|((block >> 40) & 0x18)|((block >> 39) & 0x7))};
+        const Int horizontal[3]{
+            extend6(((block >> 33) & 0x3e)|((block >> 32) & 0x1)),
+            extend7(block >> 25),
+            extend6(block >> 19)};
+        const Int vertical[3]{
+            extend6(block >> 13),
+            extend7(block >> 6),
+            extend6(block)};
+        for(Int y = 0; y != 4; ++y) for(Int x = 0; x != 4; ++x) {
+            Vector4ub& pixel = out[y*4 + x];
+            for(UnsignedInt c = 0; c != 3; ++c)
+                pixel[c] = clampUnorm8((x*(horizontal[c] - origin[c]) + y*(vertical[c] - origin[c]) + 4*origin[c] + 2) >> 2);
+            pixel[3] = 255;
+        }
+
+    /* Differential mode */
+    } else {
+        const Int color0[3]{extend5(r), extend5(g), extend5(b)};
+        const Int color1[3]{extend5(r + dr), extend5(g + dg), extend5(b + db)};
+        etc1(color0, color1);
+    }
+}
+
+/* EAC block used for ETC2 alpha, again with column-major pixel order */
+void decodeEacAlpha(const UnsignedLong block, UnsignedByte* const out, const std::size_t stride) {
+    const Int base = (block >> 56) & 0xff;
+    const Int multiplier = (block >> 52) & 0xf;
+    const Int* const modifiers = EacModifiers[(block >> 48) & 0xf];
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const Int modifier = modifiers[(block >> (45 - 3*i)) & 0x7];
+        out[((i%4)*4 + i/4)*stride] = clampUnorm8(base + modifier*multiplier);
+    }
+}
+
+/* EAC R11 blocks, expanded to 16 bits. A zero multiplier means the modifier
+   is used unscaled with an 11-bit precision. */
+void decodeEacR11Unsigned(const UnsignedLong block, UnsignedShort* const out, const std::size_t stride) {
+    const Int base = (block >> 56) & 0xff;
+    const Int multiplier = (block >> 52) & 0xf;
+    const Int* const modifiers = EacModifiers[(block >> 48) & 0xf];
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const Int modifier = modifiers[(block >> (45 - 3*i)) & 0x7];
+        const Int value = Math::clamp(base*8 + 4 + (multiplier ? modifier*multiplier*8 : modifier), 0, 2047);
+        out[((i%4)*4 + i/4)*stride] = UnsignedShort((value << 5)|(value >> 6));
+    }
+}
+
+void decodeEacR11Signed(const UnsignedLong block, Short* const out, const std::size_t stride) {
+    /* -128 is treated the same as -127 */
+    const Int base = Math::max(Int(Byte((block >> 56) & 0xff)), -127);
+    const Int multiplier = (block >> 52) & 0xf;
+    const Int* const modifiers = EacModifiers[(block >> 48) & 0xf];
+    for(UnsignedInt i = 0; i != 16; ++i) {
+        const Int modifier = modifiers[(block >> (45 - 3*i)) & 0x7];
+        const Int value = Math::clamp(base*8 + (multiplier ? modifier*multiplier*8 : modifier), -1023, 1023);
+        const Int magnitude = value >= 0 ? value : -value;
+        const Int expanded = (magnitude << 5)|(magnitude >> 5);
+        out[((i%4)*4 + i/4)*stride] = Short(value >= 0 ? expanded : -expanded);
+    }
+}
+
+void decodeEacR11Unorm(const UnsignedByte* const block, char* const out) {
+    UnsignedShort pixels[16];
+    decodeEacR11Unsigned(readBigEndian64(block), pixels, 1);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeEacR11Snorm(const UnsignedByte* const block, char* const out) {
+    Short pixels[16];
+    decodeEacR11Signed(readBigEndian64(block), pixels, 1);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeEacRG11Unorm(const UnsignedByte* const block, char* const out) {
+    UnsignedShort pixels[32];
+    decodeEacR11Unsigned(readBigEndian64(block), pixels, 2);
+    decodeEacR11Unsigned(readBigEndian64(block + 8), pixels + 1, 2);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeEacRG11Snorm(const UnsignedByte* const block, char* const out) {
+    Short pixels[32];
+    decodeEacR11Signed(readBigEndian64(block), pixels, 2);
+    decodeEacR11Signed(readBigEndian64(block + 8), pixels + 1, 2);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeEtc2RGB8(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeEtc2Colors(readBigEndian64(block), pixels, false);
+    for(UnsignedInt i = 0; i != 16; ++i)
+        std::memcpy(out + i*3, pixels[i].data(), 3);
+}
+
+void decodeEtc2RGB8A1(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeEtc2Colors(readBigEndian64(block), pixels, true);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+void decodeEtc2RGBA8(const UnsignedByte* const block, char* const out) {
+    Vector4ub pixels[16];
+    decodeEtc2Colors(readBigEndian64(block + 8), pixels, false);
+    decodeEacAlpha(readBigEndian64(block), &pixels[0].a(), 4);
+    std::memcpy(out, pixels, sizeof(pixels));
+}
+
+typedef void(*DecodeFunction)(const UnsignedByte*, char*);
+
+struct FormatInfo {
+    DecodeFunction decode;
+    PixelFormat format;
+};
+
+FormatInfo formatInfo(const CompressedPixelFormat format) {
+    if(isCompressedPixelFormatImplementationSpecific(format))
+        return {};
+
+    switch(format) {
+        #define _c(input, function, output)                                 \
+            case CompressedPixelFormat::input:                              \
+                return {function, PixelFormat::output};
+        _c(Bc1RGBUnorm, decodeBc1RGB, RGB8Unorm)
+        _c(Bc1RGBSrgb, decodeBc1RGB, RGB8Srgb)
+        _c(Bc1RGBAUnorm, decodeBc1RGBA, RGBA8Unorm)
+        _c(Bc1RGBASrgb, decodeBc1RGBA, RGBA8Srgb)
+        _c(Bc2RGBAUnorm, decodeBc2, RGBA8Unorm)
+        _c(Bc2RGBASrgb, decodeBc2, RGBA8Srgb)
+        _c(Bc3RGBAUnorm, decodeBc3, RGBA8Unorm)
+        _c(Bc3RGBASrgb, decodeBc3, RGBA8Srgb)
+        _c(Bc4RUnorm, decodeBc4RUnorm, R8Unorm)
+        _c(Bc4RSnorm, decodeBc4RSnorm, R8Snorm)
+        _c(Bc5RGUnorm, decodeBc5RGUnorm, RG8Unorm)
+        _c(Bc5RGSnorm, decodeBc5RGSnorm, RG8Snorm)
+        _c(Bc6hRGBUfloat, decodeBc6h<false>, RGB16F)
+        _c(Bc6hRGBSfloat, decodeBc6h<true>, RGB16F)
+        _c(Bc7RGBAUnorm, decodeBc7, RGBA8Unorm)
+        _c(Bc7RGBASrgb, decodeBc7, RGBA8Srgb)
+        _c(EacR11Unorm, decodeEacR11Unorm, R16Unorm)
+        _c(EacR11Snorm, decodeEacR11Snorm, R16Snorm)
+        _c(EacRG11Unorm, decodeEacRG11Unorm, RG16Unorm)
+        _c(EacRG11Snorm, decodeEacRG11Snorm, RG16Snorm)
+        _c(Etc2RGB8Unorm, decodeEtc2RGB8, RGB8Unorm)
+        _c(Etc2RGB8Srgb, decodeEtc2RGB8, RGB8Srgb)
+        _c(Etc2RGB8A1Unorm, decodeEtc2RGB8A1, RGBA8Unorm)
+        _c(Etc2RGB8A1Srgb, decodeEtc2RGB8A1, RGBA8Srgb)
+        _c(Etc2RGBA8Unorm, decodeEtc2RGBA8, RGBA8Unorm)
+        _c(Etc2RGBA8Srgb, decodeEtc2RGBA8, RGBA8Srgb)
+        #undef _c
+
+        /* LCOV_EXCL_START */
+        default:
+            return {};
+        /* LCOV_EXCL_STOP */
+    }
+}
+
+template<UnsignedInt dimensions> Image<dimensions> decompressImplementation(const CompressedImageView<dimensions, const char>& image) {
+    const FormatInfo info = formatInfo(image.format());
+    CORRADE_ASSERT(info.decode,
+        "TextureTools::decompress(): unsupported format" << image.format(),
+        (Image<dimensions>{PixelFormat::RGBA8Unorm}));
+
+    /* All supported formats have 4x4x1 blocks */
+    const Vector3i size = Vector3i::pad(image.size(), 1);
+    const std::size_t pixelSize = pixelFormatSize(info.format);
+    const std::size_t rowSize = Implementation::defaultPixelStorageRowSize(size.x(), pixelSize);
+    const std::size_t sliceSize = rowSize*size.y();
+    Image<dimensions> out = Implementation::allocateImage<dimensions>(info.format, image.size(), image.flags());
+    if(!size.product()) return out;
+
+    const std::pair<Math::Vector3<std::size_t>, Math::Vector3<std::size_t>> properties = Implementation::compressedDataProperties(image.storage(), image.blockSize(), image.blockDataSize(), size);
+    /* Row length and image height can make the data larger than the actual
+       block count */
+    const Math::Vector3<std::size_t>& dataSize = properties.second;
+    const auto* const data = reinterpret_cast<const UnsignedByte*>(image.data().data()) + properties.first.sum();
+    char* const outData = out.data();
+    const std::size_t blockDataSize = image.blockDataSize();
+    const Int blockCountX = (size.x() + 3)/4;
+    const Int blockCountY = (size.y() + 3)/4;
+
+    ThreadPool::global().parallelFor(std::size_t(blockCountY)*size.z(), Math::max(std::size_t{1}, std::size_t(256/blockCountX)), [&](const std::size_t begin, const std::size_t end) {
+        char pixels[16*8];
+        for(std::size_t row = begin; row != end; ++row) {
+            const std::size_t z = row/blockCountY;
+            const Int blockY = row%blockCountY;
+            const Int height = Math::min(4, size.y() - blockY*4);
+            const UnsignedByte* const rowData = data + (z*dataSize.y() + blockY)*dataSize.x()*blockDataSize;
+            char* const outRowData = outData + z*sliceSize + blockY*4*rowSize;
+
+            for(Int blockX = 0; blockX != blockCountX; ++blockX) {
+                info.decode(rowData + blockX*blockDataSize, pixels);
+
+                /* Edge blocks are copied only partially */
+                const std::size_t width = Math::min(4, size.x() - blockX*4)*pixelSize;
+                for(Int y = 0; y != height; ++y)
+                    std::memcpy(outRowData + y*rowSize + blockX*4*pixelSize, pixels + y*4*pixelSize, width);
+            }
+        }
+    });
+
+    return out;
+}
+
+}
+
+bool isDecompressionSupported(const CompressedPixelFormat format) {
+    return formatInfo(format).decode != nullptr;
+}
+
+PixelFormat decompressedPixelFormat(const CompressedPixelFormat format) {
+    const FormatInfo info = formatInfo(format);
+    CORRADE_ASSERT(info.decode,
+        "TextureTools::decompressedPixelFormat(): unsupported format" << format, {});
+    return info.format;
+}
+
+Image2D decompress(const CompressedImageView2D& image) {
+    return decompressImplementation(image);
+}
+
+Image3D decompress(const CompressedImageView3D& image) {
+    return decompressImplementation(image);
+}
+
+}}
@@ -0,0 +1,129 @@
+#ifndef Magnum_TextureTools_Decompress_h
+#define Magnum_TextureTools_Decompress_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+
+/** @file
+ * @brief Function @ref Magnum::TextureTools::isDecompressionSupported(), @ref Magnum::TextureTools::decompressedPixelFormat(), @ref Magnum::TextureTools::decompress()
+ * @m_since_latest
+ */
+
+#include "Magnum/Image.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Whether a compressed format can be decompressed on the CPU
+@m_since_latest
+
+Returns @cpp true @ce for the following formats, @cpp false @ce otherwise:
+
+-   @ref CompressedPixelFormat::Bc1RGBUnorm,
+    @relativeref{CompressedPixelFormat,Bc1RGBSrgb},
+    @relativeref{CompressedPixelFormat,Bc1RGBAUnorm},
+    @relativeref{CompressedPixelFormat,Bc1RGBASrgb}
+-   @ref CompressedPixelFormat::Bc2RGBAUnorm,
+    @relativeref{CompressedPixelFormat,Bc2RGBASrgb},
+    @relativeref{CompressedPixelFormat,Bc3RGBAUnorm},
+    @relativeref{CompressedPixelFormat,Bc3RGBASrgb}
+-   @ref CompressedPixelFormat::Bc4RUnorm,
+    @relativeref{CompressedPixelFormat,Bc4RSnorm},
+    @relativeref{CompressedPixelFormat,Bc5RGUnorm},
+    @relativeref{CompressedPixelFormat,Bc5RGSnorm}
+-   @ref CompressedPixelFormat::Bc6hRGBUfloat,
+    @relativeref{CompressedPixelFormat,Bc6hRGBSfloat}
+-   @ref CompressedPixelFormat::Bc7RGBAUnorm,
+    @relativeref{CompressedPixelFormat,Bc7RGBASrgb}
+-   @ref CompressedPixelFormat::EacR11Unorm,
+    @relativeref{CompressedPixelFormat,EacR11Snorm},
+    @relativeref{CompressedPixelFormat,EacRG11Unorm},
+    @relativeref{CompressedPixelFormat,EacRG11Snorm}
+-   @ref CompressedPixelFormat::Etc2RGB8Unorm,
+    @relativeref{CompressedPixelFormat,Etc2RGB8Srgb},
+    @relativeref{CompressedPixelFormat,Etc2RGB8A1Unorm},
+    @relativeref{CompressedPixelFormat,Etc2RGB8A1Srgb},
+    @relativeref{CompressedPixelFormat,Etc2RGBA8Unorm},
+    @relativeref{CompressedPixelFormat,Etc2RGBA8Srgb}
+
+Implementation-specific formats are never supported.
+@see @ref decompressedPixelFormat(), @ref decompress(),
+    @ref isCompressedPixelFormatImplementationSpecific()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT bool isDecompressionSupported(CompressedPixelFormat format);
+
+/**
+@brief Pixel format of a decompressed image
+@m_since_latest
+
+Expects that @p format is supported by @ref isDecompressionSupported(). The
+mapping is as follows, sRGB and signed formats map to their sRGB and signed
+counterparts:
+
+-   BC1, ETC2 RGB8 formats without alpha to @ref PixelFormat::RGB8Unorm
+-   BC1, BC2, BC3, BC7, ETC2 RGB8A1 and RGBA8 formats with alpha to
+    @ref PixelFormat::RGBA8Unorm
+-   BC4 to @ref PixelFormat::R8Unorm, BC5 to @ref PixelFormat::RG8Unorm
+-   EAC R11 to @ref PixelFormat::R16Unorm, EAC RG11 to
+    @ref PixelFormat::RG16Unorm in order to preserve the full 11-bit
+    precision
+-   BC6H to @ref PixelFormat::RGB16F, for both the unsigned and signed
+    variant
+*/
+MAGNUM_TEXTURETOOLS_EXPORT PixelFormat decompressedPixelFormat(CompressedPixelFormat format);
+
+/**
+@brief Decompress a 2D image
+@m_since_latest
+
+Returns @p image decoded to a format returned by
+@ref decompressedPixelFormat(), with the same size and @ref ImageFlags2D.
+Edge blocks of images with sizes not divisible by the block size are decoded
+only partially. The output has the default @ref PixelStorage, i.e. with rows
+aligned to four bytes, while the input can have arbitrary
+@ref CompressedPixelStorage parameters.
+
+Expects that the image format is supported by @ref isDecompressionSupported().
+Rows of blocks are decoded in parallel on the @ref ThreadPool::global()
+thread pool.
+
+@snippet TextureTools.cpp decompress
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D decompress(const CompressedImageView2D& image);
+
+/**
+@brief Decompress a 3D image
+@m_since_latest
+
+Like @ref decompress(const CompressedImageView2D&), but for 3D images,
+decoding each slice separately. Useful for 2D array and cube map images.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image3D decompress(const CompressedImageView3D& image);
+
+}}
+
+#endif
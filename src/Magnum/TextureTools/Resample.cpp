@@ -0,0 +1,422 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Resample.h"
+
+#include <cmath>
+#include <cstring>
+#include <new>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Implementation/imageUtilities.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/ThreadPool.h"
+
+namespace Magnum { namespace TextureTools {
+
+Debug& operator<<(Debug& debug, const ResampleFilter value) {
+    debug << "TextureTools::ResampleFilter" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case ResampleFilter::v: return debug << "::" #v;
+        _c(Box)
+        _c(Bilinear)
+        _c(Bicubic)
+        _c(Lanczos)
+        _c(Kaiser)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << "(" << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << ")";
+}
+
+namespace {
+
+/* Pixel data in the original format. Strides are in the X, Y, Z order,
+   unlike in the strided views. */
+template<class T> struct Pixels {
+    T* data;
+    Vector3i size;
+    Math::Vector3<std::ptrdiff_t> stride;
+};
+
+template<class T> Pixels<T> pixels(const Containers::StridedArrayView3D<T>& pixels) {
+    return {static_cast<T*>(pixels.data()),
+        {Int(pixels.size()[1]), Int(pixels.size()[0]), 1},
+        {pixels.stride()[1], pixels.stride()[0], 0}};
+}
+
+template<class T> Pixels<T> pixels(const Containers::StridedArrayView4D<T>& pixels) {
+    return {static_cast<T*>(pixels.data()),
+        {Int(pixels.size()[2]), Int(pixels.size()[1]), Int(pixels.size()[0])},
+        {pixels.stride()[2], pixels.stride()[1], pixels.stride()[0]}};
+}
+
+bool isFormatSupported(const PixelFormat format) {
+    if(isPixelFormatImplementationSpecific(format) ||
+       isPixelFormatDepthOrStencil(format))
+        return false;
+
+    const PixelFormat channelFormat = pixelFormatChannelFormat(format);
+    return channelFormat == PixelFormat::R8Unorm ||
+           channelFormat == PixelFormat::R8Srgb ||
+           channelFormat == PixelFormat::R16Unorm ||
+           channelFormat == PixelFormat::R16F ||
+           channelFormat == PixelFormat::R32F;
+}
+
+/* Unpacks a row of pixels to tightly packed floats. For sRGB formats, only
+   the first three channels are sRGB, alpha is linear. */
+void unpackRow(const PixelFormat channelFormat, const UnsignedInt channelCount, const char* const in, const std::ptrdiff_t stride, const std::size_t count, Float* const out) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const char* const pixel = in + i*stride;
+        Float* const outPixel = out + i*channelCount;
+        switch(channelFormat) {
+            case PixelFormat::R8Unorm:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    outPixel[c] = Math::unpack<Float>(reinterpret_cast<const UnsignedByte*>(pixel)[c]);
+                break;
+            case PixelFormat::R8Srgb:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    outPixel[c] = c < 3 ?
+                        Implementation::srgbToLinear(reinterpret_cast<const UnsignedByte*>(pixel)[c]) :
+                        Math::unpack<Float>(reinterpret_cast<const UnsignedByte*>(pixel)[c]);
+                break;
+            case PixelFormat::R16Unorm:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    outPixel[c] = Math::unpack<Float>(reinterpret_cast<const UnsignedShort*>(pixel)[c]);
+                break;
+            case PixelFormat::R16F:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    outPixel[c] = Math::unpackHalf(reinterpret_cast<const UnsignedShort*>(pixel)[c]);
+                break;
+            case PixelFormat::R32F:
+                std::memcpy(outPixel, pixel, channelCount*4);
+                break;
+            default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+    }
+}
+
+/* Inverse of unpackRow(), values outside of the range of normalized formats
+   get clamped */
+void packRow(const PixelFormat channelFormat, const UnsignedInt channelCount, const Float* const in, char* const out, const std::ptrdiff_t stride, const std::size_t count) {
+    for(std::size_t i = 0; i != count; ++i) {
+        const Float* const pixel = in + i*channelCount;
+        char* const outPixel = out + i*stride;
+        switch(channelFormat) {
+            case PixelFormat::R8Unorm:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    reinterpret_cast<UnsignedByte*>(outPixel)[c] = Math::pack<UnsignedByte>(Math::clamp(pixel[c], 0.0f, 1.0f));
+                break;
+            case PixelFormat::R8Srgb:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    reinterpret_cast<UnsignedByte*>(outPixel)[c] = c < 3 ?
+                        Math::pack<UnsignedByte>(Implementation::linearToSrgb(pixel[c])) :
+                        Math::pack<UnsignedByte>(Math::clamp(pixel[c], 0.0f, 1.0f));
+                break;
+            case PixelFormat::R16Unorm:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    reinterpret_cast<UnsignedShort*>(outPixel)[c] = Math::pack<UnsignedShort>(Math::clamp(pixel[c], 0.0f, 1.0f));
+                break;
+            case PixelFormat::R16F:
+                for(UnsignedInt c = 0; c != channelCount; ++c)
+                    reinterpret_cast<UnsignedShort*>(outPixel)[c] = Math::packHalf(pixel[c]);
+                break;
+            case PixelFormat::R32F:
+                std::memcpy(outPixel, pixel, channelCount*4);
+                break;
+            default: CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        }
+    }
+}
+
+/* Unpacks the whole image into tightly packed floats, ordered Z, Y, X,
+   channel. Rows are processed in parallel. */
+Containers::Array<Float> unpack(const PixelFormat format, const Pixels<const char>& in) {
+    const PixelFormat channelFormat = pixelFormatChannelFormat(format);
+    const UnsignedInt channelCount = pixelFormatChannelCount(format);
+    const std::size_t rowSize = std::size_t(in.size.x())*channelCount;
+    Containers::Array<Float> out{NoInit, std::size_t(in.size.product())*channelCount};
+    ThreadPool::global().parallelFor(in.size.y()*in.size.z(), 16, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const std::size_t y = row % in.size.y();
+            const std::size_t z = row / in.size.y();
+            unpackRow(channelFormat, channelCount, in.data + y*in.stride.y() + z*in.stride.z(), in.stride.x(), in.size.x(), out + row*rowSize);
+        }
+    });
+    return out;
+}
+
+void pack(const PixelFormat format, const Containers::ArrayView<const Float> in, const Pixels<char>& out) {
+    const PixelFormat channelFormat = pixelFormatChannelFormat(format);
+    const UnsignedInt channelCount = pixelFormatChannelCount(format);
+    const std::size_t rowSize = std::size_t(out.size.x())*channelCount;
+    ThreadPool::global().parallelFor(out.size.y()*out.size.z(), 16, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t row = begin; row != end; ++row) {
+            const std::size_t y = row % out.size.y();
+            const std::size_t z = row / out.size.y();
+            packRow(channelFormat, channelCount, in + row*rowSize, out.data + y*out.stride.y() + z*out.stride.z(), out.stride.x(), out.size.x());
+        }
+    });
+}
+
+Float besselI0(const Float x) {
+    /* Power series, converges quickly for the small arguments used here */
+    Float sum = 1.0f;
+    Float term = 1.0f;
+    for(Int k = 1; k != 32; ++k) {
+        const Float a = x/(2.0f*k);
+        term *= a*a;
+        sum += term;
+        if(term < sum*1.0e-7f) break;
+    }
+    return sum;
+}
+
+constexpr Float KaiserAlpha = 4.0f;
+
+Float sinc(const Float x) {
+    return x == 0.0f ? 1.0f : std::sin(Constants::pi()*x)/(Constants::pi()*x);
+}
+
+Float filterRadius(const ResampleFilter filter) {
+    switch(filter) {
+        case ResampleFilter::Box: return 0.5f;
+        case ResampleFilter::Bilinear: return 1.0f;
+        case ResampleFilter::Bicubic: return 2.0f;
+        case ResampleFilter::Lanczos:
+        case ResampleFilter::Kaiser: return 3.0f;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Value of the filter kernel at distance x from the center, in the filter
+   space. Box is handled separately as it needs the whole footprint. */
+Float filterWeight(const ResampleFilter filter, const Float x) {
+    const Float radius = filterRadius(filter);
+    const Float a = std::abs(x);
+    if(a >= radius) return 0.0f;
+
+    switch(filter) {
+        case ResampleFilter::Bilinear:
+            return 1.0f - a;
+        /* Catmull-Rom, i.e. the Mitchell-Netravali filter with B = 0 and
+           C = 0.5 */
+        case ResampleFilter::Bicubic:
+            return a < 1.0f ?
+                (1.5f*a - 2.5f)*a*a + 1.0f :
+                ((-0.5f*a + 2.5f)*a - 4.0f)*a + 2.0f;
+        case ResampleFilter::Lanczos:
+            return sinc(x)*sinc(x/radius);
+        case ResampleFilter::Kaiser: {
+            const Float t = x/radius;
+            return sinc(x)*besselI0(KaiserAlpha*std::sqrt(1.0f - t*t))/besselI0(KaiserAlpha);
+        }
+        case ResampleFilter::Box: break;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+}
+
+/* Filter weights for resampling a single axis. Each output pixel has the same
+   count of taps, with indices clamped to the edge and unused taps having a
+   zero weight, which keeps the inner loops simple. */
+struct Weights {
+    std::size_t taps;
+    Containers::Array<Int> indices;
+    Containers::Array<Float> weights;
+};
+
+Weights calculateWeights(const ResampleFilter filter, const Int sourceSize, const Int targetSize) {
+    const Float scale = Float(sourceSize)/targetSize;
+    /* When upsampling, the filter is evaluated in the source pixel space */
+    const Float filterScale = Math::max(scale, 1.0f);
+    const Float radius = filterRadius(filter)*filterScale;
+
+    Weights out;
+    out.taps = std::size_t(std::ceil(2.0f*radius)) + 1;
+    out.indices = Containers::Array<Int>{NoInit, out.taps*targetSize};
+    out.weights = Containers::Array<Float>{NoInit, out.taps*targetSize};
+    for(Int i = 0; i != targetSize; ++i) {
+        const Float center = (i + 0.5f)*scale;
+        const Int first = Int(std::floor(center - radius));
+        Int* const indices = out.indices + i*out.taps;
+        Float* const weights = out.weights + i*out.taps;
+        Float sum = 0.0f;
+        for(std::size_t t = 0; t != out.taps; ++t) {
+            const Int j = first + Int(t);
+            Float weight;
+            /* For a box filter it's the overlap of the source pixel with the
+               filter footprint */
+            if(filter == ResampleFilter::Box)
+                weight = Math::max(0.0f,
+                    Math::min(j + 1.0f, center + radius) -
+                    Math::max(Float(j), center - radius));
+            else weight = filterWeight(filter, (j + 0.5f - center)/filterScale);
+
+            indices[t] = Math::clamp(j, 0, sourceSize - 1);
+            weights[t] = weight;
+            sum += weight;
+        }
+
+        CORRADE_INTERNAL_ASSERT(sum != 0.0f);
+        for(std::size_t t = 0; t != out.taps; ++t)
+            weights[t] /= sum;
+    }
+
+    return out;
+}
+
+/* Resamples the middle dimension of a tightly packed outer x sourceSize x
+   inner array to outer x targetSize x inner. The innermost loop goes over a
+   contiguous span of floats, which the compiler can vectorize. */
+Containers::Array<Float> resampleAxis(const ResampleFilter filter, const Containers::ArrayView<const Float> in, const std::size_t outer, const Int sourceSize, const Int targetSize, const std::size_t inner) {
+    const Weights weights = calculateWeights(filter, sourceSize, targetSize);
+    Containers::Array<Float> out{NoInit, outer*targetSize*inner};
+
+    /* Aim for each chunk to process roughly 64k values to amortize the
+       scheduling overhead for narrow images */
+    const std::size_t grainSize = Math::max(std::size_t{1}, 65536/(inner*weights.taps));
+    ThreadPool::global().parallelFor(outer*targetSize, grainSize, [&](const std::size_t begin, const std::size_t end) {
+        for(std::size_t item = begin; item != end; ++item) {
+            const Float* const source = in + (item/targetSize)*sourceSize*inner;
+            const std::size_t i = item % targetSize;
+            const Int* const indices = weights.indices + i*weights.taps;
+            const Float* const factors = weights.weights + i*weights.taps;
+            Float* const target = out + item*inner;
+
+            for(std::size_t k = 0; k != inner; ++k)
+                target[k] = 0.0f;
+            for(std::size_t t = 0; t != weights.taps; ++t) {
+                const Float factor = factors[t];
+                if(factor == 0.0f) continue;
+                const Float* const sourceLine = source + std::size_t(indices[t])*inner;
+                for(std::size_t k = 0; k != inner; ++k)
+                    target[k] += factor*sourceLine[k];
+            }
+        }
+    });
+
+    return out;
+}
+
+/* Resamples a tightly packed Z, Y, X, channel array, skipping dimensions that
+   don't change */
+Containers::Array<Float> resample(const ResampleFilter filter, Containers::Array<Float>&& in, const UnsignedInt channelCount, const Vector3i& sourceSize, const Vector3i& targetSize) {
+    Containers::Array<Float> out = Utility::move(in);
+    Vector3i size = sourceSize;
+    if(size.x() != targetSize.x()) {
+        out = resampleAxis(filter, out, std::size_t(size.y())*size.z(), size.x(), targetSize.x(), channelCount);
+        size.x() = targetSize.x();
+    }
+    if(size.y() != targetSize.y()) {
+        out = resampleAxis(filter, out, size.z(), size.y(), targetSize.y(), std::size_t(size.x())*channelCount);
+        size.y() = targetSize.y();
+    }
+    if(size.z() != targetSize.z()) {
+        out = resampleAxis(filter, out, 1, size.z(), targetSize.z(), std::size_t(size.x())*size.y()*channelCount);
+        size.z() = targetSize.z();
+    }
+    return out;
+}
+
+template<UnsignedInt dimensions> Containers::Array<Image<dimensions>> generateMipmapsImplementation(const ImageView<dimensions, const char>& image, const ResampleFilter filter, const Vector3i& downsampledDimensions) {
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::generateMipmaps(): expected a non-empty image", {});
+    CORRADE_ASSERT(isFormatSupported(image.format()),
+        "TextureTools::generateMipmaps(): unsupported format" << image.format(), {});
+
+    const Pixels<const char> input = pixels(image.pixels());
+
+    /* Calculate the level count first to allocate the output array just
+       once */
+    std::size_t levelCount = 0;
+    for(Vector3i size = input.size; (size*downsampledDimensions).max() > 1; ++levelCount)
+        size = Math::max(size/(downsampledDimensions + Vector3i{1}), Vector3i{1});
+
+    Containers::Array<Image<dimensions>> out{NoInit, levelCount};
+    if(!levelCount) return out;
+
+    const UnsignedInt channelCount = pixelFormatChannelCount(image.format());
+    Containers::Array<Float> data = unpack(image.format(), input);
+    Vector3i size = input.size;
+    for(std::size_t i = 0; i != levelCount; ++i) {
+        /* Each level is calculated from the previous one, to not have the
+           cost grow with the source image size */
+        const Vector3i levelSize = Math::max(size/(downsampledDimensions + Vector3i{1}), Vector3i{1});
+        data = resample(filter, Utility::move(data), channelCount, size, levelSize);
+        size = levelSize;
+
+        new(&out[i]) Image<dimensions>{Implementation::allocateImage<dimensions>(image.format(), Math::Vector<dimensions, Int>::pad(size), image.flags())};
+        pack(image.format(), data, pixels(out[i].pixels()));
+    }
+
+    return out;
+}
+
+}
+
+Image2D resize(const ImageView2D& image, const Vector2i& size, const ResampleFilter filter) {
+    CORRADE_ASSERT(image.size().product(),
+        "TextureTools::resize(): expected a non-empty image", (Image2D{image.format()}));
+    CORRADE_ASSERT(size.product(),
+        "TextureTools::resize(): expected a non-empty target size, got" << Debug::packed << size, (Image2D{image.format()}));
+    CORRADE_ASSERT(isFormatSupported(image.format()),
+        "TextureTools::resize(): unsupported format" << image.format(), (Image2D{image.format()}));
+
+    const Pixels<const char> input = pixels(image.pixels());
+    const Vector3i outputSize{size, 1};
+    const Containers::Array<Float> data = resample(filter, unpack(image.format(), input), pixelFormatChannelCount(image.format()), input.size, outputSize);
+
+    Image2D out = Implementation::allocateImage<2>(image.format(), size, image.flags());
+    pack(image.format(), data, pixels(out.pixels()));
+    return out;
+}
+
+Containers::Array<Image2D> generateMipmaps(const ImageView2D& image, const ResampleFilter filter) {
+    return generateMipmapsImplementation(image, filter, {
+        1,
+        image.flags() & ImageFlag2D::Array ? 0 : 1,
+        0});
+}
+
+Containers::Array<Image3D> generateMipmaps(const ImageView3D& image, const ResampleFilter filter) {
+    return generateMipmapsImplementation(image, filter, {
+        1,
+        1,
+        image.flags() & (ImageFlag3D::Array|ImageFlag3D::CubeMap) ? 0 : 1});
+}
+
+}}
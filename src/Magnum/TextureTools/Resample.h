@@ -0,0 +1,161 @@
+#ifndef Magnum_TextureTools_Resample_h
+#define Magnum_TextureTools_Resample_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Enum @ref Magnum::TextureTools::ResampleFilter, function @ref Magnum::TextureTools::resize(), @ref Magnum::TextureTools::generateMipmaps()
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/TextureTools/visibility.h"
+
+namespace Magnum { namespace TextureTools {
+
+/**
+@brief Resampling filter
+@m_since_latest
+
+When downsampling, the filter footprint is scaled to cover the corresponding
+area of input pixels. When upsampling, the footprint is the filter radius in
+input pixels.
+@see @ref resize(), @ref generateMipmaps()
+*/
+enum class ResampleFilter: UnsignedByte {
+    /**
+     * Box filter. Each output pixel is an average of input pixels it covers,
+     * weighted by the covered area. For power-of-two sizes it's an average of
+     * 2x2 input pixels in each mip level. Fast, but causes slight blurring
+     * and aliasing.
+     */
+    Box,
+
+    /**
+     * Bilinear (tent) filter with a radius of one output pixel. When
+     * upsampling, it's equivalent to a bilinear interpolation between
+     * neighboring pixels.
+     */
+    Bilinear,
+
+    /**
+     * Bicubic Catmull-Rom filter with a radius of two output pixels. Sharper
+     * than @ref ResampleFilter::Bilinear, with slight ringing around sharp
+     * edges.
+     */
+    Bicubic,
+
+    /**
+     * Lanczos filter with a radius of three output pixels. Sharper than
+     * @ref ResampleFilter::Bicubic, but with more pronounced ringing around
+     * sharp edges.
+     */
+    Lanczos,
+
+    /**
+     * Kaiser-windowed sinc filter with a radius of three output pixels and
+     * @f$ \alpha = 4 @f$. Gives sharper results with less aliasing than
+     * @ref ResampleFilter::Box, at a cost of more input pixels being
+     * sampled and slight ringing around sharp edges.
+     */
+    Kaiser
+};
+
+/**
+@debugoperatorenum{ResampleFilter}
+@m_since_latest
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Debug& operator<<(Debug& output, ResampleFilter value);
+
+/**
+@brief Resize a 2D image
+@m_since_latest
+
+Returns @p image resampled to @p size in the same format and with the same
+@ref ImageFlags2D. The resampling is separable, first done along the X and
+then along the Y axis, an axis that doesn't change size is skipped. The output
+has the default @ref PixelStorage, i.e. with rows aligned to four bytes,
+while the input can have arbitrary @ref PixelStorage parameters.
+
+Expects that both @p image and @p size are non-empty and that the image has
+one of the formats listed in @ref generateMipmaps(const ImageView2D&, ResampleFilter),
+the same conversion and clamping rules apply. Each filtering pass is executed
+in parallel on the @ref ThreadPool::global() thread pool.
+
+@snippet TextureTools.cpp resize
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Image2D resize(const ImageView2D& image, const Vector2i& size, ResampleFilter filter = ResampleFilter::Box);
+
+/**
+@brief Generate a mip chain for a 2D image
+@m_since_latest
+
+Returns all mip levels of @p image except the first, i.e. with the first
+returned image being half the size of @p image and the last being
+@cpp {1, 1} @ce, in the same format as @p image. If the image is already
+@cpp {1, 1} @ce, returns an empty array. Each next level is calculated from
+the previous one. If @p image has @ref ImageFlag2D::Array set, only the X
+dimension is downsampled and the Y dimension is kept, with the last level
+having a size of @cpp {1, image.size().y()} @ce.
+
+Expects that @p image is non-empty and has one of the following formats, in
+any channel count:
+
+-   @ref PixelFormat::R8Unorm, @ref PixelFormat::R16Unorm
+-   @ref PixelFormat::R8Srgb --- the RGB channels are converted to linear
+    space for filtering and back to sRGB afterwards, the alpha channel is
+    treated as linear
+-   @ref PixelFormat::R16F, @ref PixelFormat::R32F
+
+The data are processed in a 32-bit floating-point representation, values
+outside of the representable range of normalized formats that may result from
+filters with negative lobes such as @ref ResampleFilter::Kaiser are clamped.
+Each filtering pass is executed in parallel on the
+@ref ThreadPool::global() thread pool.
+
+@snippet TextureTools.cpp generateMipmaps
+
+@see @ref resize(), @ref Math::pack(), @ref Math::packHalf(),
+    @ref Color3::fromSrgb()
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<Image2D> generateMipmaps(const ImageView2D& image, ResampleFilter filter = ResampleFilter::Box);
+
+/**
+@brief Generate a mip chain for a 3D image
+@m_since_latest
+
+Like @ref generateMipmaps(const ImageView2D&, ResampleFilter), but for 3D
+images. If @p image has @ref ImageFlag3D::Array or
+@relativeref{ImageFlag3D,CubeMap} set, only the X and Y dimension is
+downsampled and the Z dimension is kept, otherwise all three are downsampled.
+*/
+MAGNUM_TEXTURETOOLS_EXPORT Containers::Array<Image3D> generateMipmaps(const ImageView3D& image, ResampleFilter filter = ResampleFilter::Box);
+
+}}
+
+#endif
@@ -0,0 +1,481 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/TextureTools/Decompress.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct DecompressTest: TestSuite::Tester {
+    explicit DecompressTest();
+
+    void supported();
+    void pixelFormat();
+    void pixelFormatUnsupported();
+
+    void bc1();
+    void bc1ThreeColor();
+    void bc2();
+    void bc3();
+    void bc4Unorm();
+    void bc4Snorm();
+    void bc5();
+    void bc6hUfloat();
+    void bc6hSfloat();
+    void bc6hTwoRegions();
+    void bc6hReserved();
+    void bc7();
+    void bc7Reserved();
+    void eacR11Unorm();
+    void eacR11Snorm();
+    void etc2Individual();
+    void etc2Planar();
+    void etc2Punchthrough();
+    void etc2Alpha();
+
+    void partialBlocks();
+    void pixelStorage();
+    void threeDimensional();
+    void empty();
+    void unsupportedFormat();
+};
+
+using namespace Math::Literals;
+
+/* Red and blue endpoints in a four-color mode, indices 0, 1, 2, 3 in each
+   row */
+constexpr UnsignedByte Bc1RedBlue[]{
+    0x00, 0xf8, 0x1f, 0x00, 0xe4, 0xe4, 0xe4, 0xe4
+};
+
+/* Mode 6, endpoints (255, 1, 129, 255) and (0, 254, 128, 254), first row
+   having indices 0, 15, 8, 0 */
+constexpr UnsignedByte Bc7Mode6[]{
+    0xc0, 0x3f, 0x00, 0xf0, 0x07, 0x02, 0xff, 0xff,
+    0xf0, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/* Individual mode, white left half, black right half with the smallest
+   modifier added */
+constexpr UnsignedByte Etc2Individual[]{
+    0xf0, 0xf0, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+/* Base 128, multiplier 1, modifier table 13, all indices 7 */
+constexpr UnsignedByte Eac[]{
+    0x80, 0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+};
+
+DecompressTest::DecompressTest() {
+    addTests({&DecompressTest::supported,
+              &DecompressTest::pixelFormat,
+              &DecompressTest::pixelFormatUnsupported,
+
+              &DecompressTest::bc1,
+              &DecompressTest::bc1ThreeColor,
+              &DecompressTest::bc2,
+              &DecompressTest::bc3,
+              &DecompressTest::bc4Unorm,
+              &DecompressTest::bc4Snorm,
+              &DecompressTest::bc5,
+              &DecompressTest::bc6hUfloat,
+              &DecompressTest::bc6hSfloat,
+              &DecompressTest::bc6hTwoRegions,
+              &DecompressTest::bc6hReserved,
+              &DecompressTest::bc7,
+              &DecompressTest::bc7Reserved,
+              &DecompressTest::eacR11Unorm,
+              &DecompressTest::eacR11Snorm,
+              &DecompressTest::etc2Individual,
+              &DecompressTest::etc2Planar,
+              &DecompressTest::etc2Punchthrough,
+              &DecompressTest::etc2Alpha,
+
+              &DecompressTest::partialBlocks,
+              &DecompressTest::pixelStorage,
+              &DecompressTest::threeDimensional,
+              &DecompressTest::empty,
+              &DecompressTest::unsupportedFormat});
+}
+
+void DecompressTest::supported() {
+    CORRADE_VERIFY(isDecompressionSupported(CompressedPixelFormat::Bc1RGBUnorm));
+    CORRADE_VERIFY(isDecompressionSupported(CompressedPixelFormat::Bc6hRGBSfloat));
+    CORRADE_VERIFY(isDecompressionSupported(CompressedPixelFormat::Bc7RGBASrgb));
+    CORRADE_VERIFY(isDecompressionSupported(CompressedPixelFormat::Etc2RGBA8Srgb));
+    CORRADE_VERIFY(!isDecompressionSupported(CompressedPixelFormat::Astc4x4RGBAUnorm));
+    CORRADE_VERIFY(!isDecompressionSupported(compressedPixelFormatWrap(0xdead)));
+}
+
+void DecompressTest::pixelFormat() {
+    CORRADE_COMPARE(decompressedPixelFormat(CompressedPixelFormat::Bc1RGBSrgb), PixelFormat::RGB8Srgb);
+    CORRADE_COMPARE(decompressedPixelFormat(CompressedPixelFormat::Bc3RGBAUnorm), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(decompressedPixelFormat(CompressedPixelFormat::Bc5RGSnorm), PixelFormat::RG8Snorm);
+    CORRADE_COMPARE(decompressedPixelFormat(CompressedPixelFormat::Bc6hRGBSfloat), PixelFormat::RGB16F);
+    CORRADE_COMPARE(decompressedPixelFormat(CompressedPixelFormat::EacRG11Unorm), PixelFormat::RG16Unorm);
+    CORRADE_COMPARE(decompressedPixelFormat(CompressedPixelFormat::Etc2RGB8A1Srgb), PixelFormat::RGBA8Srgb);
+}
+
+void DecompressTest::pixelFormatUnsupported() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    decompressedPixelFormat(CompressedPixelFormat::Astc4x4RGBAUnorm);
+    CORRADE_COMPARE(out,
+        "TextureTools::decompressedPixelFormat(): unsupported format CompressedPixelFormat::Astc4x4RGBAUnorm\n");
+}
+
+void DecompressTest::bc1() {
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc1RGBUnorm, {4, 4}, Bc1RedBlue, ImageFlag2D::Array});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 4}));
+    /* Flags are passed through as-is */
+    CORRADE_COMPARE(out.flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE_AS(out.pixels<Color3ub>()[3], Containers::arrayView({
+        0xff0000_rgb, 0x0000ff_rgb, 0xaa0055_rgb, 0x5500aa_rgb
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc1ThreeColor() {
+    /* Endpoints swapped, which switches to the three-color mode with the last
+       color being transparent black */
+    const UnsignedByte data[]{
+        0x1f, 0x00, 0x00, 0xf8, 0xe4, 0xe4, 0xe4, 0xe4
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc1RGBAUnorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[0], Containers::arrayView({
+        0x0000ffff_rgba, 0xff0000ff_rgba, 0x800080ff_rgba, 0x00000000_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc2() {
+    /* Explicit 4-bit alpha, the color block is always in the four-color mode
+       even with the endpoints swapped */
+    const UnsignedByte data[]{
+        0x0f, 0xf0, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+        0x1f, 0x00, 0x00, 0xf8, 0xe4, 0xe4, 0xe4, 0xe4
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc2RGBASrgb, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Srgb);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[0], Containers::arrayView({
+        0x0000ffff_rgba, 0xff000000_rgba, 0x5500aa00_rgba, 0xaa0055ff_rgba
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[1], Containers::arrayView({
+        0x0000ff88_rgba, 0xff000088_rgba, 0x5500aa88_rgba, 0xaa005588_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc3() {
+    /* Alpha endpoints 255 and 0, first row having indices 0, 1, 2, 7 */
+    const UnsignedByte data[]{
+        0xff, 0x00, 0x88, 0x0e, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0xf8, 0x1f, 0x00, 0xe4, 0xe4, 0xe4, 0xe4
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc3RGBAUnorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[0], Containers::arrayView({
+        0xff0000ff_rgba, 0x0000ff00_rgba, 0xaa0055db_rgba, 0x5500aa24_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc4Unorm() {
+    /* Endpoints 0 and 255, which switches to the six-value mode, first row
+       having indices 2, 5, 6, 7 */
+    const UnsignedByte data[]{
+        0x00, 0xff, 0xaa, 0x0f, 0x00, 0x00, 0x00, 0x00
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc4RUnorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<UnsignedByte>()[0], Containers::arrayView<UnsignedByte>({
+        51, 204, 0, 255
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc4Snorm() {
+    /* Endpoints -128 (treated as -127) and 127, first row having indices 0,
+       2, 5, 7 */
+    const UnsignedByte data[]{
+        0x80, 0x7f, 0x50, 0x0f, 0x00, 0x00, 0x00, 0x00
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc4RSnorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::R8Snorm);
+    CORRADE_COMPARE_AS(out.pixels<Byte>()[0], Containers::arrayView<Byte>({
+        -127, -76, 76, 127
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc5() {
+    /* Constant 255 in red and 20 in green */
+    const UnsignedByte data[]{
+        0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x0a, 0x14, 0x49, 0x92, 0x24, 0x49, 0x92, 0x24
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc5RGUnorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Vector2ub>()[2], Containers::arrayView({
+        Vector2ub{255, 20}, Vector2ub{255, 20}, Vector2ub{255, 20}, Vector2ub{255, 20}
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc6hUfloat() {
+    /* Mode 11 with untransformed 10-bit endpoints (1023, 0, 512) and
+       (0, 1023, 512), first row having indices 0, 15, 8, 0. The output is
+       half-float bits, 0x7bff being the largest finite value. */
+    const UnsignedByte data[]{
+        0xe3, 0x7f, 0x00, 0x00, 0x04, 0xe0, 0x7f, 0x00,
+        0xf1, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc6hRGBUfloat, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB16F);
+    CORRADE_COMPARE_AS(out.pixels<Vector3us>()[0], Containers::arrayView({
+        Vector3us{0x7bff, 0x0000, 0x3e0f},
+        Vector3us{0x0000, 0x7bff, 0x3e0f},
+        Vector3us{0x3a20, 0x41df, 0x3e0f},
+        Vector3us{0x7bff, 0x0000, 0x3e0f}
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc6hSfloat() {
+    /* Mode 14 with a 16-bit endpoint (-16384, 15360, 0) and a 4-bit delta
+       (3, -8, 7), first row having indices 0, 15, 8, 4. The first pixel is
+       (-1.5, 0.7656, 0). */
+    const UnsignedByte data[]{
+        0x0f, 0x00, 0x00, 0x00, 0x98, 0x01, 0xf9, 0x03,
+        0xf0, 0x48, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc6hRGBSfloat, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB16F);
+    CORRADE_COMPARE_AS(out.pixels<Vector3us>()[0], Containers::arrayView({
+        Vector3us{0xbe00, 0x3a20, 0x0000},
+        Vector3us{0xbdfd, 0x3a18, 0x0006},
+        Vector3us{0xbdfe, 0x3a1c, 0x0003},
+        Vector3us{0xbdff, 0x3a1e, 0x0001}
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc6hTwoRegions() {
+    /* Mode 10 with untransformed 6-bit endpoints, red in the first region
+       and blue in the second, partition 13 putting the bottom two rows into
+       the second region */
+    const UnsignedByte data[]{
+        0xfe, 0x77, 0xc0, 0x00, 0xff, 0x01, 0x00, 0xe0,
+        0x01, 0xa0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc6hRGBUfloat, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB16F);
+    CORRADE_COMPARE_AS(out.pixels<Vector3us>()[1], Containers::arrayView({
+        Vector3us{0x7bff, 0, 0}, Vector3us{0x7bff, 0, 0},
+        Vector3us{0x7bff, 0, 0}, Vector3us{0x7bff, 0, 0}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.pixels<Vector3us>()[2], Containers::arrayView({
+        Vector3us{0, 0, 0x7bff}, Vector3us{0, 0, 0x7bff},
+        Vector3us{0, 0, 0x7bff}, Vector3us{0, 0, 0x7bff}
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc6hReserved() {
+    /* Five-bit mode 0x13 is reserved and decodes to black */
+    UnsignedByte data[16]{};
+    data[0] = 0x13;
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc6hRGBSfloat, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB16F);
+    CORRADE_COMPARE_AS(out.pixels<Vector3us>()[3], Containers::arrayView({
+        Vector3us{}, Vector3us{}, Vector3us{}, Vector3us{}
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc7() {
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc7RGBAUnorm, {4, 4}, Bc7Mode6});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[0], Containers::arrayView({
+        0xff0181ff_rgba, 0x00fe80fe_rgba, 0x788780fe_rgba, 0xff0181ff_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::bc7Reserved() {
+    /* A block without any mode bit set decodes to transparent black */
+    const UnsignedByte data[16]{};
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc7RGBASrgb, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Srgb);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[3], Containers::arrayView({
+        0x00000000_rgba, 0x00000000_rgba, 0x00000000_rgba, 0x00000000_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::eacR11Unorm() {
+    /* 128*8 + 4 + 9*1*8, expanded from 11 to 16 bits */
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::EacR11Unorm, {4, 4}, Eac});
+    CORRADE_COMPARE(out.format(), PixelFormat::R16Unorm);
+    CORRADE_COMPARE_AS(out.pixels<UnsignedShort>()[1], Containers::arrayView<UnsignedShort>({
+        35217, 35217, 35217, 35217
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::eacR11Snorm() {
+    /* Base -128 (treated as -127), multiplier 0, which means the modifier is
+       applied unscaled, so -127*8 + 9, expanded from 11 to 16 bits */
+    const UnsignedByte data[]{
+        0x80, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::EacR11Snorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::R16Snorm);
+    CORRADE_COMPARE_AS(out.pixels<Short>()[1], Containers::arrayView<Short>({
+        -32255, -32255, -32255, -32255
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::etc2Individual() {
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Etc2RGB8Unorm, {4, 4}, Etc2Individual});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Color3ub>()[2], Containers::arrayView({
+        0xffffff_rgb, 0xffffff_rgb, 0x020202_rgb, 0x020202_rgb
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::etc2Planar() {
+    /* Origin, horizontal and vertical colors (0, 64, 32), (63, 64, 32) and
+       (0, 127, 0), with the blue difference overflowing */
+    const UnsignedByte data[]{
+        0x01, 0x01, 0x04, 0x7f, 0x81, 0x00, 0x1f, 0xc0
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Etc2RGB8Srgb, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGB8Srgb);
+    CORRADE_COMPARE_AS(out.pixels<Color3ub>()[0], Containers::arrayView({
+        0x008182_rgb, 0x408182_rgb, 0x808182_rgb, 0xbf8182_rgb
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.pixels<Color3ub>()[3], Containers::arrayView({
+        0x00e021_rgb, 0x40e021_rgb, 0x80e021_rgb, 0xbfe021_rgb
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::etc2Punchthrough() {
+    /* Differential mode with the opaque bit not set, first row having
+       indices 0, 2, 1, 3, where 0 has no modifier and 2 is transparent */
+    const UnsignedByte data[]{
+        0x80, 0x80, 0x80, 0x00, 0x10, 0x10, 0x11, 0x00
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Etc2RGB8A1Unorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[0], Containers::arrayView({
+        0x848484ff_rgba, 0x00000000_rgba, 0x8c8c8cff_rgba, 0x7c7c7cff_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::etc2Alpha() {
+    UnsignedByte data[16];
+    Utility::copy(Containers::arrayView(Eac), Containers::arrayView(data).prefix(8));
+    Utility::copy(Containers::arrayView(Etc2Individual), Containers::arrayView(data).exceptPrefix(8));
+
+    /* 128 + 9*1 */
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Etc2RGBA8Unorm, {4, 4}, data});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[1], Containers::arrayView({
+        0xffffff89_rgba, 0xffffff89_rgba, 0x02020289_rgba, 0x02020289_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::partialBlocks() {
+    /* Two constant BC4 blocks, the second only partially used */
+    const UnsignedByte data[]{
+        0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc4RUnorm, {5, 3}, data});
+    CORRADE_COMPARE(out.size(), (Vector2i{5, 3}));
+    /* Rows are padded to four bytes */
+    CORRADE_COMPARE(out.data().size(), 8*3);
+    for(Int y = 0; y != 3; ++y) {
+        CORRADE_ITERATION(y);
+        CORRADE_COMPARE_AS(out.pixels<UnsignedByte>()[y], Containers::arrayView<UnsignedByte>({
+            10, 10, 10, 10, 20
+        }), TestSuite::Compare::Container);
+    }
+}
+
+void DecompressTest::pixelStorage() {
+    /* A 3x2 grid of blocks, taking the middle one from the second row */
+    UnsignedByte data[6*8]{};
+    data[4*8 + 0] = data[4*8 + 1] = 0x2a;
+    Image2D out = decompress(CompressedImageView2D{
+        CompressedPixelStorage{}
+            .setRowLength(12)
+            .setSkip({4, 4, 0}),
+        CompressedPixelFormat::Bc4RUnorm, {4, 4}, data});
+    CORRADE_COMPARE_AS(out.pixels<UnsignedByte>()[3], Containers::arrayView<UnsignedByte>({
+        42, 42, 42, 42
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::threeDimensional() {
+    /* Two slices, each with a different constant value */
+    const UnsignedByte data[]{
+        0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x14, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+    };
+    Image3D out = decompress(CompressedImageView3D{CompressedPixelFormat::Bc4RUnorm, {4, 4, 2}, data, ImageFlag3D::Array});
+    CORRADE_COMPARE(out.format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector3i{4, 4, 2}));
+    CORRADE_COMPARE(out.flags(), ImageFlag3D::Array);
+    CORRADE_COMPARE_AS(out.pixels<UnsignedByte>()[0][3], Containers::arrayView<UnsignedByte>({
+        10, 10, 10, 10
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.pixels<UnsignedByte>()[1][0], Containers::arrayView<UnsignedByte>({
+        20, 20, 20, 20
+    }), TestSuite::Compare::Container);
+}
+
+void DecompressTest::empty() {
+    Image2D out = decompress(CompressedImageView2D{CompressedPixelFormat::Bc7RGBAUnorm, {0, 4}, nullptr});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(out.size(), (Vector2i{0, 4}));
+    CORRADE_COMPARE(out.data().size(), 0);
+}
+
+void DecompressTest::unsupportedFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[16]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    decompress(CompressedImageView2D{CompressedPixelFormat::Astc4x4RGBAUnorm, {4, 4}, data});
+    CORRADE_COMPARE(out,
+        "TextureTools::decompress(): unsupported format CompressedPixelFormat::Astc4x4RGBAUnorm\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::DecompressTest)
@@ -0,0 +1,197 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Image.h"
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Packing.h"
+#include "Magnum/Math/Vector4.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct ResampleBenchmark: TestSuite::Tester {
+    explicit ResampleBenchmark();
+
+    void resize();
+    void resizeNaive();
+    void generateMipmaps();
+
+    private:
+        Image2D _input{PixelFormat::RGBA8Unorm};
+};
+
+const struct {
+    const char* name;
+    ResampleFilter filter;
+    Vector2i size;
+} ResizeData[]{
+    {"box, 2x downsample", ResampleFilter::Box, {512, 512}},
+    {"box, 4x downsample", ResampleFilter::Box, {256, 256}},
+    {"bilinear, 2x downsample", ResampleFilter::Bilinear, {512, 512}},
+    {"bilinear, 1.5x upsample", ResampleFilter::Bilinear, {1536, 1536}},
+    {"bicubic, 2x downsample", ResampleFilter::Bicubic, {512, 512}},
+    {"bicubic, 1.5x upsample", ResampleFilter::Bicubic, {1536, 1536}},
+    {"Lanczos, 2x downsample", ResampleFilter::Lanczos, {512, 512}},
+    {"Lanczos, 1.5x upsample", ResampleFilter::Lanczos, {1536, 1536}},
+};
+
+const struct {
+    const char* name;
+    ResampleFilter filter;
+} GenerateMipmapsData[]{
+    {"box", ResampleFilter::Box},
+    {"Kaiser", ResampleFilter::Kaiser},
+};
+
+ResampleBenchmark::ResampleBenchmark() {
+    addInstancedBenchmarks({&ResampleBenchmark::resize,
+                            &ResampleBenchmark::resizeNaive}, 10,
+        Containers::arraySize(ResizeData));
+
+    addInstancedBenchmarks({&ResampleBenchmark::generateMipmaps}, 10,
+        Containers::arraySize(GenerateMipmapsData));
+
+    /* A 1024x1024 image with a pattern that isn't trivially compressible */
+    _input = Image2D{PixelFormat::RGBA8Unorm, {1024, 1024}, Containers::Array<char>{NoInit, 1024*1024*4}};
+    const Containers::StridedArrayView2D<Vector4ub> pixels = _input.mutablePixels<Vector4ub>();
+    for(std::size_t y = 0; y != pixels.size()[0]; ++y)
+        for(std::size_t x = 0; x != pixels.size()[1]; ++x)
+            pixels[y][x] = {UnsignedByte(x*y), UnsignedByte(x ^ y), UnsignedByte(x + 3*y), 255};
+}
+
+/* A straightforward single-threaded implementation that evaluates the 2D
+   filter kernel directly for each output pixel, instead of doing two
+   separable passes with precalculated weights */
+Float naiveRadius(const ResampleFilter filter) {
+    switch(filter) {
+        case ResampleFilter::Box: return 0.5f;
+        case ResampleFilter::Bilinear: return 1.0f;
+        case ResampleFilter::Bicubic: return 2.0f;
+        case ResampleFilter::Lanczos:
+        case ResampleFilter::Kaiser: return 3.0f;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+
+Float naiveSinc(const Float x) {
+    return x == 0.0f ? 1.0f : std::sin(Constants::pi()*x)/(Constants::pi()*x);
+}
+
+Float naiveWeight(const ResampleFilter filter, const Float x) {
+    const Float a = std::abs(x);
+    switch(filter) {
+        case ResampleFilter::Box:
+            return a < 0.5f ? 1.0f : 0.0f;
+        case ResampleFilter::Bilinear:
+            return Math::max(1.0f - a, 0.0f);
+        case ResampleFilter::Bicubic:
+            if(a < 1.0f) return (1.5f*a - 2.5f)*a*a + 1.0f;
+            if(a < 2.0f) return ((-0.5f*a + 2.5f)*a - 4.0f)*a + 2.0f;
+            return 0.0f;
+        case ResampleFilter::Lanczos:
+            return a < 3.0f ? naiveSinc(x)*naiveSinc(x/3.0f) : 0.0f;
+        /* Not benchmarked */
+        case ResampleFilter::Kaiser: break;
+    }
+
+    CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+}
+
+Image2D naiveResize(const ImageView2D& image, const Vector2i& size, const ResampleFilter filter) {
+    const Containers::StridedArrayView2D<const Vector4ub> in = image.pixels<Vector4ub>();
+    Image2D out{PixelFormat::RGBA8Unorm, size, Containers::Array<char>{NoInit, std::size_t(size.product()*4)}};
+    const Containers::StridedArrayView2D<Vector4ub> outPixels = out.mutablePixels<Vector4ub>();
+
+    const Vector2 scale = Vector2{image.size()}/Vector2{size};
+    const Vector2 filterScale = Math::max(scale, Vector2{1.0f});
+    const Vector2 radius = naiveRadius(filter)*filterScale;
+    for(Int y = 0; y != size.y(); ++y) {
+        for(Int x = 0; x != size.x(); ++x) {
+            const Vector2 center = (Vector2{Float(x), Float(y)} + Vector2{0.5f})*scale;
+            const Vector2i min{Math::floor(center - radius)};
+            const Vector2i max{Math::ceil(center + radius)};
+
+            Vector4 sum;
+            Float weightSum = 0.0f;
+            for(Int j = min.y(); j <= max.y(); ++j) {
+                const Float weightY = naiveWeight(filter, (j + 0.5f - center.y())/filterScale.y());
+                for(Int i = min.x(); i <= max.x(); ++i) {
+                    const Float weight = weightY*naiveWeight(filter, (i + 0.5f - center.x())/filterScale.x());
+                    sum += weight*Math::unpack<Vector4>(in[Math::clamp(j, 0, image.size().y() - 1)][Math::clamp(i, 0, image.size().x() - 1)]);
+                    weightSum += weight;
+                }
+            }
+
+            outPixels[y][x] = Math::pack<Vector4ub>(Math::clamp(sum/weightSum, 0.0f, 1.0f));
+        }
+    }
+
+    return out;
+}
+
+void ResampleBenchmark::resize() {
+    auto&& data = ResizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Image2D out{PixelFormat::RGBA8Unorm};
+    CORRADE_BENCHMARK(1)
+        out = TextureTools::resize(_input, data.size, data.filter);
+
+    CORRADE_COMPARE(out.size(), data.size);
+}
+
+void ResampleBenchmark::resizeNaive() {
+    auto&& data = ResizeData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Image2D out{PixelFormat::RGBA8Unorm};
+    CORRADE_BENCHMARK(1)
+        out = naiveResize(_input, data.size, data.filter);
+
+    CORRADE_COMPARE(out.size(), data.size);
+}
+
+void ResampleBenchmark::generateMipmaps() {
+    auto&& data = GenerateMipmapsData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Array<Image2D> out;
+    CORRADE_BENCHMARK(1)
+        out = TextureTools::generateMipmaps(_input, data.filter);
+
+    CORRADE_COMPARE(out.size(), 10);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResampleBenchmark)
@@ -0,0 +1,485 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+
+#include "Magnum/ImageView.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Half.h"
+#include "Magnum/TextureTools/Resample.h"
+
+namespace Magnum { namespace TextureTools { namespace Test { namespace {
+
+struct ResampleTest: TestSuite::Tester {
+    explicit ResampleTest();
+
+    void debugFilter();
+
+    void resizeDownsample();
+    void resizeUpsampleBilinear();
+    void resizeSameSize();
+    void resizePixelStorage();
+    void resizeSrgb();
+    void resizeConstant();
+    void resizeEmpty();
+    void resizeUnsupportedFormat();
+
+    void generateMipmaps2DFloat();
+    void generateMipmaps2DUnorm8();
+    void generateMipmaps2DUnorm16();
+    void generateMipmaps2DHalf();
+    void generateMipmaps2DSrgb();
+    void generateMipmaps2DNonPowerOfTwo();
+    void generateMipmaps2DRowPadding();
+    void generateMipmaps2DArray();
+    void generateMipmaps2DSinglePixel();
+    void generateMipmaps3D();
+    void generateMipmaps3DArray();
+    void generateMipmapsConstant();
+    void generateMipmapsKaiserClamp();
+
+    void generateMipmapsEmpty();
+    void generateMipmapsUnsupportedFormat();
+};
+
+using namespace Math::Literals;
+
+const struct {
+    const char* name;
+    ResampleFilter filter;
+} FilterData[]{
+    {"box", ResampleFilter::Box},
+    {"bilinear", ResampleFilter::Bilinear},
+    {"bicubic", ResampleFilter::Bicubic},
+    {"Lanczos", ResampleFilter::Lanczos},
+    {"Kaiser", ResampleFilter::Kaiser},
+};
+
+ResampleTest::ResampleTest() {
+    addTests({&ResampleTest::debugFilter,
+
+              &ResampleTest::resizeDownsample,
+              &ResampleTest::resizeUpsampleBilinear,
+              &ResampleTest::resizeSameSize,
+              &ResampleTest::resizePixelStorage,
+              &ResampleTest::resizeSrgb});
+
+    addInstancedTests({&ResampleTest::resizeConstant},
+        Containers::arraySize(FilterData));
+
+    addTests({&ResampleTest::resizeEmpty,
+              &ResampleTest::resizeUnsupportedFormat,
+
+              &ResampleTest::generateMipmaps2DFloat,
+              &ResampleTest::generateMipmaps2DUnorm8,
+              &ResampleTest::generateMipmaps2DUnorm16,
+              &ResampleTest::generateMipmaps2DHalf,
+              &ResampleTest::generateMipmaps2DSrgb,
+              &ResampleTest::generateMipmaps2DNonPowerOfTwo,
+              &ResampleTest::generateMipmaps2DRowPadding,
+              &ResampleTest::generateMipmaps2DArray,
+              &ResampleTest::generateMipmaps2DSinglePixel,
+              &ResampleTest::generateMipmaps3D,
+              &ResampleTest::generateMipmaps3DArray});
+
+    addInstancedTests({&ResampleTest::generateMipmapsConstant},
+        Containers::arraySize(FilterData));
+
+    addTests({&ResampleTest::generateMipmapsKaiserClamp,
+
+              &ResampleTest::generateMipmapsEmpty,
+              &ResampleTest::generateMipmapsUnsupportedFormat});
+}
+
+void ResampleTest::debugFilter() {
+    Containers::String out;
+    Debug{&out} << ResampleFilter::Kaiser << ResampleFilter(0xde);
+    CORRADE_COMPARE(out, "TextureTools::ResampleFilter::Kaiser TextureTools::ResampleFilter(0xde)\n");
+}
+
+void ResampleTest::resizeDownsample() {
+    const Float data[]{
+        0.0f, 1.0f, 2.0f, 3.0f,
+        4.0f, 5.0f, 6.0f, 7.0f
+    };
+    Image2D out = resize(ImageView2D{PixelFormat::R32F, {4, 2}, data, ImageFlag2D::Array}, {2, 1});
+    CORRADE_COMPARE(out.format(), PixelFormat::R32F);
+    CORRADE_COMPARE(out.size(), (Vector2i{2, 1}));
+    /* Flags are passed through as-is */
+    CORRADE_COMPARE(out.flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE_AS(out.pixels<Float>()[0], Containers::arrayView({
+        2.5f, 4.5f
+    }), TestSuite::Compare::Container);
+}
+
+void ResampleTest::resizeUpsampleBilinear() {
+    const Float data[]{
+        0.0f, 1.0f
+    };
+    Image2D out = resize(ImageView2D{PixelFormat::R32F, {2, 1}, data}, {4, 2}, ResampleFilter::Bilinear);
+    CORRADE_COMPARE(out.size(), (Vector2i{4, 2}));
+    /* The edge pixels are clamped, the Y axis is just duplicated */
+    CORRADE_COMPARE_AS(out.pixels<Float>()[0], Containers::arrayView({
+        0.0f, 0.25f, 0.75f, 1.0f
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.pixels<Float>()[1], Containers::arrayView({
+        0.0f, 0.25f, 0.75f, 1.0f
+    }), TestSuite::Compare::Container);
+}
+
+void ResampleTest::resizeSameSize() {
+    /* No axis gets resampled, which should result in just a copy */
+    const Color4ub data[]{
+        0x11223344_rgba, 0x55667788_rgba,
+        0x99aabbcc_rgba, 0xddeeff00_rgba
+    };
+    Image2D out = resize(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data}, {2, 2}, ResampleFilter::Lanczos);
+    CORRADE_COMPARE(out.size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[0], Containers::arrayView({
+        0x11223344_rgba, 0x55667788_rgba
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(out.pixels<Color4ub>()[1], Containers::arrayView({
+        0x99aabbcc_rgba, 0xddeeff00_rgba
+    }), TestSuite::Compare::Container);
+}
+
+void ResampleTest::resizePixelStorage() {
+    /* The input is a 2x2 subrectangle with rows padded to 8 bytes, the
+       output has the default storage */
+    const UnsignedByte data[]{
+        0, 0, 0, 0, 0, 0, 0, 0,
+        0, 0, 10, 30, 0, 0, 0, 0,
+        0, 0, 50, 70, 0, 0, 0, 0,
+    };
+    Image2D out = resize(ImageView2D{PixelStorage{}.setAlignment(8).setSkip({2, 1, 0}), PixelFormat::R8Unorm, {2, 2}, data}, {1, 1});
+    CORRADE_COMPARE(out.storage().alignment(), 4);
+    CORRADE_COMPARE(out.storage().skip(), Vector3i{});
+    CORRADE_COMPARE(out.size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(out.pixels<UnsignedByte>()[0][0], 40);
+}
+
+void ResampleTest::resizeSrgb() {
+    /* Same as generateMipmaps2DSrgb(), just verifying the resize() code path
+       does the conversion as well */
+    const Color4ub data[]{
+        0x000000ff_rgba, 0xffffff00_rgba,
+    };
+    Image2D out = resize(ImageView2D{PixelFormat::RGBA8Srgb, {2, 1}, data}, {1, 1});
+    CORRADE_COMPARE(out.format(), PixelFormat::RGBA8Srgb);
+    CORRADE_COMPARE(out.pixels<Color4ub>()[0][0], 0xbcbcbc80_rgba);
+}
+
+void ResampleTest::resizeConstant() {
+    auto&& data = FilterData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Upsampling in one direction and downsampling in the other, all
+       filters should keep a constant image constant including the edges */
+    Vector3h input[5*3];
+    for(Vector3h& i: input) i = {0.25_h, -1.5_h, 8.0_h};
+    Image2D out = resize(ImageView2D{PixelStorage{}.setAlignment(2), PixelFormat::RGB16F, {5, 3}, input}, {2, 7}, data.filter);
+    CORRADE_COMPARE(out.size(), (Vector2i{2, 7}));
+    for(Containers::StridedArrayView1D<const Vector3h> row: out.pixels<Vector3h>())
+        for(Vector3h pixel: row)
+            CORRADE_COMPARE(pixel, (Vector3h{0.25_h, -1.5_h, 8.0_h}));
+}
+
+void ResampleTest::resizeEmpty() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    resize(ImageView2D{PixelFormat::R32F, {0, 1}, data}, {1, 1});
+    resize(ImageView2D{PixelFormat::R32F, {1, 1}, data}, {1, 0});
+    CORRADE_COMPARE(out,
+        "TextureTools::resize(): expected a non-empty image\n"
+        "TextureTools::resize(): expected a non-empty target size, got {1, 0}\n");
+}
+
+void ResampleTest::resizeUnsupportedFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    resize(ImageView2D{PixelFormat::R32UI, {1, 1}, data}, {2, 2});
+    CORRADE_COMPARE(out,
+        "TextureTools::resize(): unsupported format PixelFormat::R32UI\n");
+}
+
+void ResampleTest::generateMipmaps2DFloat() {
+    const Float data[]{
+        0.0f, 1.0f, 2.0f, 3.0f,
+        4.0f, 5.0f, 6.0f, 7.0f
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::R32F, {4, 2}, data});
+    CORRADE_COMPARE(levels.size(), 2);
+
+    CORRADE_COMPARE(levels[0].format(), PixelFormat::R32F);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(levels[0].pixels<Float>()[0], Containers::arrayView({
+        2.5f, 4.5f
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[1].pixels<Float>()[0][0], 3.5f);
+}
+
+void ResampleTest::generateMipmaps2DUnorm8() {
+    const Color4ub data[]{
+        0x00108000_rgba, 0x20308040_rgba,
+        0x40508080_rgba, 0x607080c0_rgba
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {2, 2}, data});
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[0].pixels<Color4ub>()[0][0], 0x30408060_rgba);
+}
+
+void ResampleTest::generateMipmaps2DUnorm16() {
+    const Vector2us data[]{
+        {0, 1000}, {2000, 3000},
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RG16Unorm, {2, 1}, data});
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[0].pixels<Vector2us>()[0][0], (Vector2us{1000, 2000}));
+}
+
+void ResampleTest::generateMipmaps2DHalf() {
+    const Vector3h data[]{
+        {0.0_h, 1.0_h, -2.0_h}, {1.0_h, 3.0_h, 4.0_h},
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RGB16F, {2, 1}, data});
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].format(), PixelFormat::RGB16F);
+    CORRADE_COMPARE(levels[0].pixels<Vector3h>()[0][0], (Vector3h{0.5_h, 2.0_h, 1.0_h}));
+}
+
+void ResampleTest::generateMipmaps2DSrgb() {
+    /* Averaging in the sRGB space would give 0x80, in linear space it's
+       0xbc. Alpha is treated as linear. */
+    const Color4ub data[]{
+        0x000000ff_rgba, 0xffffff00_rgba,
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RGBA8Srgb, {2, 1}, data});
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].format(), PixelFormat::RGBA8Srgb);
+    CORRADE_COMPARE(levels[0].pixels<Color4ub>()[0][0], 0xbcbcbc80_rgba);
+}
+
+void ResampleTest::generateMipmaps2DNonPowerOfTwo() {
+    /* The 3x1 image gets downsampled to 1x1, with each input pixel
+       contributing equally */
+    const Float data[]{
+        0.0f, 3.0f, 9.0f
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::R32F, {3, 1}, data});
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[0].pixels<Float>()[0][0], 4.0f);
+}
+
+void ResampleTest::generateMipmaps2DRowPadding() {
+    /* Both the input and the output has rows padded to four bytes */
+    const UnsignedByte data[]{
+        10, 20, 30, 40, 50, 60, 0, 0,
+        70, 80, 90, 100, 110, 120, 0, 0,
+        130, 140, 150, 160, 170, 180, 0, 0,
+        190, 200, 210, 220, 230, 240, 0, 0,
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RGB8Unorm, {2, 4}, data});
+    CORRADE_COMPARE(levels.size(), 2);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{1, 2}));
+    CORRADE_COMPARE(levels[0].storage().alignment(), 4);
+    CORRADE_COMPARE(levels[0].data().size(), 8);
+    CORRADE_COMPARE_AS(levels[0].pixels<Color3ub>().transposed<0, 1>()[0], Containers::arrayView({
+        Color3ub{55, 65, 75},
+        Color3ub{175, 185, 195}
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{1, 1}));
+    CORRADE_COMPARE(levels[1].pixels<Color3ub>()[0][0], (Color3ub{115, 125, 135}));
+}
+
+void ResampleTest::generateMipmaps2DArray() {
+    /* Only the X dimension gets downsampled */
+    const Float data[]{
+        0.0f, 2.0f, 4.0f, 6.0f,
+        1.0f, 3.0f, 5.0f, 7.0f,
+    };
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::R32F, {4, 2}, data, ImageFlag2D::Array});
+    CORRADE_COMPARE(levels.size(), 2);
+
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{2, 2}));
+    CORRADE_COMPARE(levels[0].flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE_AS(levels[0].pixels<Float>()[1], Containers::arrayView({
+        2.0f, 6.0f
+    }), TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{1, 2}));
+    CORRADE_COMPARE_AS(levels[1].pixels<Float>().transposed<0, 1>()[0], Containers::arrayView({
+        3.0f, 4.0f
+    }), TestSuite::Compare::Container);
+}
+
+void ResampleTest::generateMipmaps2DSinglePixel() {
+    const Float data[]{1.0f};
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::R32F, {1, 1}, data});
+    CORRADE_COMPARE(levels.size(), 0);
+}
+
+void ResampleTest::generateMipmaps3D() {
+    const Float data[]{
+        0.0f, 1.0f,
+        2.0f, 3.0f,
+
+        4.0f, 5.0f,
+        6.0f, 7.0f,
+    };
+    Containers::Array<Image3D> levels = generateMipmaps(ImageView3D{PixelFormat::R32F, {2, 2, 2}, data});
+    CORRADE_COMPARE(levels.size(), 1);
+    CORRADE_COMPARE(levels[0].size(), (Vector3i{1, 1, 1}));
+    CORRADE_COMPARE(levels[0].pixels<Float>()[0][0][0], 3.5f);
+}
+
+void ResampleTest::generateMipmaps3DArray() {
+    /* Only X and Y get downsampled, same for a cube map */
+    const Float data[]{
+        0.0f, 1.0f,
+        2.0f, 3.0f,
+
+        4.0f, 5.0f,
+        6.0f, 7.0f,
+    };
+    for(ImageFlag3D flag: {ImageFlag3D::Array, ImageFlag3D::CubeMap}) {
+        CORRADE_ITERATION(flag);
+        /* Cube maps need six faces */
+        const Float cubeData[6*4]{};
+        Containers::Array<Image3D> levels = flag == ImageFlag3D::Array ?
+            generateMipmaps(ImageView3D{PixelFormat::R32F, {2, 2, 2}, data, flag}) :
+            generateMipmaps(ImageView3D{PixelFormat::R32F, {2, 2, 6}, cubeData, flag});
+        CORRADE_COMPARE(levels.size(), 1);
+        CORRADE_COMPARE(levels[0].flags(), flag);
+        if(flag == ImageFlag3D::Array) {
+            CORRADE_COMPARE(levels[0].size(), (Vector3i{1, 1, 2}));
+            CORRADE_COMPARE(levels[0].pixels<Float>()[0][0][0], 1.5f);
+            CORRADE_COMPARE(levels[0].pixels<Float>()[1][0][0], 5.5f);
+        } else {
+            CORRADE_COMPARE(levels[0].size(), (Vector3i{1, 1, 6}));
+        }
+    }
+}
+
+void ResampleTest::generateMipmapsConstant() {
+    auto&& data = FilterData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Filter weights are normalized, so a constant image should stay
+       constant in all levels, including at the edges */
+    Color4ub input[13*7];
+    for(Color4ub& i: input) i = 0x3366ccff_rgba;
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::RGBA8Unorm, {13, 7}, input}, data.filter);
+    CORRADE_COMPARE(levels.size(), 3);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{6, 3}));
+    CORRADE_COMPARE(levels[1].size(), (Vector2i{3, 1}));
+    CORRADE_COMPARE(levels[2].size(), (Vector2i{1, 1}));
+    for(const Image2D& level: levels) {
+        CORRADE_ITERATION(level.size());
+        for(Containers::StridedArrayView1D<const Color4ub> row: level.pixels<Color4ub>())
+            for(Color4ub pixel: row)
+                CORRADE_COMPARE(pixel, 0x3366ccff_rgba);
+    }
+}
+
+void ResampleTest::generateMipmapsKaiserClamp() {
+    /* A sharp edge causes ringing with the Kaiser filter, which should get
+       clamped for normalized formats but not for floats */
+    UnsignedByte data[16]{};
+    Float floatData[16]{};
+    for(std::size_t i = 8; i != 16; ++i) {
+        data[i] = 255;
+        floatData[i] = 1.0f;
+    }
+
+    Containers::Array<Image2D> levels = generateMipmaps(ImageView2D{PixelFormat::R8Unorm, {16, 1}, data}, ResampleFilter::Kaiser);
+    Containers::Array<Image2D> floatLevels = generateMipmaps(ImageView2D{PixelFormat::R32F, {16, 1}, floatData}, ResampleFilter::Kaiser);
+    CORRADE_COMPARE(levels[0].size(), (Vector2i{8, 1}));
+    CORRADE_COMPARE(floatLevels[0].size(), (Vector2i{8, 1}));
+
+    /* The overshoot is next to the edge, farther away the original values
+       are kept */
+    CORRADE_COMPARE(levels[0].pixels<UnsignedByte>()[0][0], 0);
+    CORRADE_COMPARE(levels[0].pixels<UnsignedByte>()[0][7], 255);
+    CORRADE_COMPARE_AS(floatLevels[0].pixels<Float>()[0][2], 0.0f,
+        TestSuite::Compare::Less);
+    CORRADE_COMPARE_AS(floatLevels[0].pixels<Float>()[0][5], 1.0f,
+        TestSuite::Compare::Greater);
+    CORRADE_COMPARE(levels[0].pixels<UnsignedByte>()[0][2], 0);
+    CORRADE_COMPARE(levels[0].pixels<UnsignedByte>()[0][5], 255);
+}
+
+void ResampleTest::generateMipmapsEmpty() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateMipmaps(ImageView2D{PixelFormat::R32F, {0, 1}, data});
+    generateMipmaps(ImageView3D{PixelFormat::R32F, {1, 1, 0}, data});
+    CORRADE_COMPARE(out,
+        "TextureTools::generateMipmaps(): expected a non-empty image\n"
+        "TextureTools::generateMipmaps(): expected a non-empty image\n");
+}
+
+void ResampleTest::generateMipmapsUnsupportedFormat() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    const char data[4]{};
+
+    Containers::String out;
+    Error redirectError{&out};
+    generateMipmaps(ImageView2D{PixelFormat::RGBA8UI, {1, 1}, data});
+    generateMipmaps(ImageView2D{PixelFormat::Depth32F, {1, 1}, data});
+    generateMipmaps(ImageView2D{PixelStorage{}, 0xdead, 0, 4, {1, 1}, data});
+    CORRADE_COMPARE(out,
+        "TextureTools::generateMipmaps(): unsupported format PixelFormat::RGBA8UI\n"
+        "TextureTools::generateMipmaps(): unsupported format PixelFormat::Depth32F\n"
+        "TextureTools::generateMipmaps(): unsupported format PixelFormat::ImplementationSpecific(0xdead)\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::TextureTools::Test::ResampleTest)
@@ -39,6 +39,8 @@ namespace Magnum { namespace TextureTools {
 
 class AtlasLandfill;
 
+enum class ResampleFilter: UnsignedByte;
+
 }}
 #endif
 
@@ -32,7 +32,7 @@
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 #ifndef MAGNUM_BUILD_STATIC
-    #ifdef MagnumTextureTools_EXPORTS
+    #if defined(MagnumTextureTools_EXPORTS) || defined(MagnumTextureToolsObjects_EXPORTS)
         #define MAGNUM_TEXTURETOOLS_EXPORT CORRADE_VISIBILITY_EXPORT
     #else
         #define MAGNUM_TEXTURETOOLS_EXPORT CORRADE_VISIBILITY_IMPORT
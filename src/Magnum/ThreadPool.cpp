@@ -0,0 +1,225 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ThreadPool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <Corrade/Utility/Macros.h> /* CORRADE_THREAD_LOCAL */
+
+#include "Magnum/Math/Functions.h"
+
+namespace Magnum {
+
+namespace {
+
+/* Emscripten without -pthread has std::thread, but spawning fails at
+   runtime */
+#if !defined(CORRADE_TARGET_EMSCRIPTEN) || defined(__EMSCRIPTEN_PTHREADS__)
+UnsignedInt resolveThreadCount(const UnsignedInt count) {
+    return count ? count : Math::max(std::thread::hardware_concurrency(), 1u);
+}
+#else
+UnsignedInt resolveThreadCount(UnsignedInt) {
+    return 1;
+}
+#endif
+
+/* Chunk range of a single thread. Padded to avoid false sharing between
+   threads taking chunks from neighboring ranges. */
+struct Range {
+    std::atomic<std::size_t> next;
+    std::size_t end;
+    char padding[64 - sizeof(std::atomic<std::size_t>) - sizeof(std::size_t)];
+};
+
+UnsignedInt globalThreadCountValue = 1;
+
+/* Set on worker threads and on the calling thread while it's executing a
+   job of any pool. Parallel calls made from inside a job are then executed
+   serially -- the calling thread already holds the job mutex of the pool, so
+   it can't be even try-locked again. */
+CORRADE_THREAD_LOCAL bool insideJob = false;
+
+}
+
+struct ThreadPool::State {
+    explicit State(UnsignedInt threadCount): ranges{threadCount} {}
+
+    void process(UnsignedInt thread);
+
+    /* Locked for the whole duration of parallelFor(), if it can't be locked
+       the call is executed serially. Never attempted to be locked from inside
+       a job, see insideJob above. */
+    std::mutex jobMutex;
+
+    /* Protects everything below and signals the workers */
+    std::mutex mutex;
+    std::condition_variable workerCondition, doneCondition;
+    UnsignedLong generation{};
+    UnsignedInt participantCount{};
+    UnsignedInt workingCount{};
+    bool quit{};
+
+    /* Current job, set by the calling thread before incrementing
+       generation */
+    void(*function)(void*, std::size_t, std::size_t, UnsignedInt);
+    void* functionState;
+    std::size_t count;
+    std::size_t grainSize;
+    Containers::Array<Range> ranges;
+
+    Containers::Array<std::thread> threads;
+};
+
+void ThreadPool::State::process(const UnsignedInt thread) {
+    /* Go through own range first, then steal from the others */
+    for(UnsignedInt i = 0; i != participantCount; ++i) {
+        Range& range = ranges[(thread + i) % participantCount];
+        for(std::size_t chunk; (chunk = range.next.fetch_add(1, std::memory_order_relaxed)) < range.end; ) {
+            const std::size_t begin = chunk*grainSize;
+            function(functionState, begin, Math::min(begin + grainSize, count), thread);
+        }
+    }
+}
+
+UnsignedInt ThreadPool::globalThreadCount() {
+    return globalThreadCountValue;
+}
+
+void ThreadPool::setGlobalThreadCount(const UnsignedInt count) {
+    globalThreadCountValue = count;
+}
+
+ThreadPool& ThreadPool::global() {
+    static std::mutex mutex;
+    static Containers::Pointer<ThreadPool> pool;
+
+    std::lock_guard<std::mutex> lock{mutex};
+    const UnsignedInt threadCount = resolveThreadCount(globalThreadCountValue);
+    if(!pool || pool->threadCount() != threadCount)
+        pool.emplace(threadCount);
+    return *pool;
+}
+
+ThreadPool::ThreadPool(const UnsignedInt threadCount): _state{InPlaceInit, resolveThreadCount(threadCount)} {
+    State& state = *_state;
+    state.threads = Containers::Array<std::thread>{state.ranges.size() - 1};
+    for(std::size_t i = 0; i != state.threads.size(); ++i) {
+        /* Worker threads have indices starting from 1, the calling thread is
+           always 0 */
+        state.threads[i] = std::thread{[&state](const UnsignedInt thread) {
+            /* Workers execute only jobs, so any parallel call made from here
+               is a nested one */
+            insideJob = true;
+
+            UnsignedLong generation = 0;
+            for(;;) {
+                {
+                    std::unique_lock<std::mutex> lock{state.mutex};
+                    state.workerCondition.wait(lock, [&]{
+                        return state.quit || state.generation != generation;
+                    });
+                    if(state.quit) return;
+                    generation = state.generation;
+
+                    /* Not needed for this job. The calling thread doesn't
+                       wait for this worker, so it's fine if it skips some
+                       generations when it wakes up too late. */
+                    if(thread >= state.participantCount) continue;
+                }
+
+                state.process(thread);
+
+                std::lock_guard<std::mutex> lock{state.mutex};
+                if(!--state.workingCount)
+                    state.doneCondition.notify_one();
+            }
+        }, UnsignedInt(i + 1)};
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+    }
+    _state->workerCondition.notify_all();
+    for(std::thread& thread: _state->threads)
+        thread.join();
+}
+
+UnsignedInt ThreadPool::threadCount() const {
+    return UnsignedInt(_state->ranges.size());
+}
+
+void ThreadPool::parallelForInternal(const std::size_t count, const std::size_t grainSize, void(*const function)(void*, std::size_t, std::size_t, UnsignedInt), void* const functionState) {
+    CORRADE_ASSERT(grainSize,
+        "ThreadPool::parallelFor(): expected a non-zero grain size", );
+
+    State& state = *_state;
+    const std::size_t chunkCount = (count + grainSize - 1)/grainSize;
+
+    /* Execute directly if there's nothing to parallelize, if this is a call
+       nested in a job of this or any other pool, or if the pool is busy with
+       a job from another thread */
+    std::unique_lock<std::mutex> jobLock;
+    if(chunkCount > 1 && !state.threads.isEmpty() && !insideJob)
+        jobLock = std::unique_lock<std::mutex>{state.jobMutex, std::try_to_lock};
+    if(!jobLock.owns_lock()) {
+        for(std::size_t begin = 0; begin < count; begin += grainSize)
+            function(functionState, begin, Math::min(begin + grainSize, count), 0);
+        return;
+    }
+
+    const UnsignedInt participantCount = UnsignedInt(Math::min(state.ranges.size(), chunkCount));
+    {
+        std::lock_guard<std::mutex> lock{state.mutex};
+        state.function = function;
+        state.functionState = functionState;
+        state.count = count;
+        state.grainSize = grainSize;
+        for(UnsignedInt i = 0; i != participantCount; ++i) {
+            state.ranges[i].next.store(chunkCount*i/participantCount, std::memory_order_relaxed);
+            state.ranges[i].end = chunkCount*(i + 1)/participantCount;
+        }
+        state.participantCount = participantCount;
+        state.workingCount = participantCount - 1;
+        ++state.generation;
+    }
+    state.workerCondition.notify_all();
+
+    insideJob = true;
+    state.process(0);
+    insideJob = false;
+
+    std::unique_lock<std::mutex> lock{state.mutex};
+    state.doneCondition.wait(lock, [&]{ return !state.workingCount; });
+}
+
+}
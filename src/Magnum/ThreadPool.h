@@ -0,0 +1,258 @@
+#ifndef Magnum_ThreadPool_h
+#define Magnum_ThreadPool_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::ThreadPool
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <type_traits>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Utility/Assert.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/visibility.h"
+
+namespace Magnum {
+
+namespace Implementation {
+    /* Calls the function with the thread index if it accepts it, or just
+       with the range otherwise */
+    template<class F> auto threadPoolCall(F& function, std::size_t begin, std::size_t end, UnsignedInt thread, int) -> decltype(function(begin, end, thread), void()) {
+        function(begin, end, thread);
+    }
+    template<class F> void threadPoolCall(F& function, std::size_t begin, std::size_t end, UnsignedInt, ...) {
+        function(begin, end);
+    }
+}
+
+/**
+@brief Thread pool
+@m_since_latest
+
+A fixed set of worker threads for parallelizing loops over index ranges. Meant
+to be used by CPU-heavy algorithms in @ref MeshTools, @ref SceneTools,
+@ref TextureTools, @ref Trade and elsewhere, which can then all share the same
+threads instead of each spawning their own.
+
+@section ThreadPool-usage Usage
+
+The @ref parallelFor() function splits the @cpp [0, count) @ce range into
+chunks of @p grainSize items and calls the passed function with each chunk,
+on the calling thread and on all workers in the pool. The grain size should be
+chosen so each chunk does enough work to amortize the scheduling overhead,
+which is in the order of tens of nanoseconds per chunk and a few microseconds
+per @ref parallelFor() call:
+
+@snippet Magnum.cpp ThreadPool-usage
+
+The function can optionally take a third @relativeref{Magnum,UnsignedInt}
+argument, which is an index of the thread the chunk is executed on. It's
+always less than @ref threadCount() and the chunk count, and can be used to
+index per-thread scratch memory or other state that isn't safe to share
+between threads:
+
+@snippet Magnum.cpp ThreadPool-usage-thread
+
+@subsection ThreadPool-usage-reduce Deterministic reductions
+
+The @ref parallelReduce() function calls a @p map function on each chunk and
+then combines the per-chunk results with a @p reduce function in chunk order
+on the calling thread. Because the chunk boundaries depend only on the item
+count and grain size and not on the thread count or scheduling, the result is
+always the same, bit-exact even for floating-point sums:
+
+@snippet Magnum.cpp ThreadPool-usage-reduce
+
+@section ThreadPool-global Global thread pool
+
+Library code uses the pool returned by @ref global(), which has
+@ref globalThreadCount() threads. The global thread count is @cpp 1 @ce by
+default, meaning everything is executed on the calling thread and results are
+reproducible without any extra effort. Applications opt into parallelism by
+calling @ref setGlobalThreadCount() early during startup, for example with
+@cpp 0 @ce to use all available cores.
+
+@section ThreadPool-scheduling Scheduling
+
+Chunks are distributed into contiguous ranges among the participating threads
+upfront for better memory locality. A thread that's done with its own range
+steals the remaining chunks from ranges of the other threads, so
+unevenly-sized work is balanced without any locking. A @ref parallelFor()
+that has just a single chunk, or a pool with just a single thread, executes
+directly on the calling thread without waking any workers.
+
+@section ThreadPool-thread-safety Thread safety and nesting
+
+A single pool executes only one @ref parallelFor() at a time. If
+@ref parallelFor() is called while the pool is busy with a job from another
+thread, it's executed on the calling thread instead. Calls made from inside a
+function that's already running on a pool, be it the same pool or a
+different one, are always executed serially on the thread they're called
+from. Thus parallel algorithms can be nested, only the outermost one gets
+parallelized and the nested ones don't oversubscribe the machine.
+
+The functions are executed concurrently, it's the caller responsibility to
+ensure they don't write to shared state without synchronization. In
+particular, @ref Corrade::Utility::Debug "Debug" output redirection is global
+unless Corrade is built with @ref CORRADE_BUILD_MULTITHREADED.
+
+On @ref CORRADE_TARGET_EMSCRIPTEN "Emscripten" without threading support the
+pool never spawns any workers and everything is executed on the calling
+thread.
+*/
+class MAGNUM_EXPORT ThreadPool {
+    public:
+        /**
+         * @brief Global thread count
+         *
+         * Thread count used by the pool returned from @ref global(). Initial
+         * value is @cpp 1 @ce.
+         * @see @ref setGlobalThreadCount()
+         */
+        static UnsignedInt globalThreadCount();
+
+        /**
+         * @brief Set global thread count
+         *
+         * If @p count is @cpp 0 @ce, @ref std::thread::hardware_concurrency()
+         * is used. The global pool is recreated with the new thread count on
+         * the next @ref global() call. Not thread-safe, expected to be called
+         * only when the global pool isn't being used.
+         */
+        static void setGlobalThreadCount(UnsignedInt count);
+
+        /**
+         * @brief Global thread pool
+         *
+         * Lazily created on first call with @ref globalThreadCount() threads.
+         * Thread-safe, but see @ref setGlobalThreadCount() for restrictions.
+         */
+        static ThreadPool& global();
+
+        /**
+         * @brief Constructor
+         * @param threadCount   Thread count, including the thread calling
+         *      @ref parallelFor(). If @cpp 0 @ce,
+         *      @ref std::thread::hardware_concurrency() is used.
+         *
+         * Spawns @cpp threadCount - 1 @ce worker threads, which sleep until
+         * there's work for them.
+         */
+        explicit ThreadPool(UnsignedInt threadCount);
+
+        /** @brief Copying is not allowed */
+        ThreadPool(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool(ThreadPool&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Waits for the worker threads to exit.
+         */
+        ~ThreadPool();
+
+        /** @brief Copying is not allowed */
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** @brief Moving is not allowed */
+        ThreadPool& operator=(ThreadPool&&) = delete;
+
+        /**
+         * @brief Thread count
+         *
+         * Count of worker threads plus one for the calling thread. Always at
+         * least @cpp 1 @ce.
+         */
+        UnsignedInt threadCount() const;
+
+        /**
+         * @brief Execute a function over an index range in parallel
+         * @param count         Item count
+         * @param grainSize     Count of items in a single chunk
+         * @param function      Function to call on each chunk
+         *
+         * Calls @p function exactly once for each
+         * @cpp [i*grainSize, min((i + 1)*grainSize, count)) @ce range, passing
+         * the range begin and end and optionally also the thread index, and
+         * returns once all chunks are processed. The @p grainSize is expected
+         * to be non-zero. See the @ref ThreadPool-usage "class documentation"
+         * for more information.
+         */
+        template<class F> void parallelFor(std::size_t count, std::size_t grainSize, F&& function);
+
+        /**
+         * @brief Reduce an index range in parallel
+         * @param count         Item count
+         * @param grainSize     Count of items in a single chunk
+         * @param identity      Identity value for @p reduce
+         * @param map           Function returning a value for each chunk
+         * @param reduce        Function combining two values
+         *
+         * Calls @p map with the begin and end of each chunk as in
+         * @ref parallelFor() and then sequentially combines @p identity and
+         * the per-chunk results in chunk order with @p reduce. The result
+         * doesn't depend on @ref threadCount(). The @p grainSize is expected
+         * to be non-zero.
+         */
+        template<class T, class Map, class Reduce> T parallelReduce(std::size_t count, std::size_t grainSize, const T& identity, Map&& map, Reduce&& reduce);
+
+    private:
+        struct State;
+
+        void parallelForInternal(std::size_t count, std::size_t grainSize, void(*function)(void*, std::size_t, std::size_t, UnsignedInt), void* state);
+
+        Containers::Pointer<State> _state;
+};
+
+template<class F> void ThreadPool::parallelFor(const std::size_t count, const std::size_t grainSize, F&& function) {
+    parallelForInternal(count, grainSize, [](void* state, std::size_t begin, std::size_t end, UnsignedInt thread) {
+        Implementation::threadPoolCall(*static_cast<typename std::remove_reference<F>::type*>(state), begin, end, thread, 0);
+    }, const_cast<void*>(static_cast<const void*>(&function)));
+}
+
+template<class T, class Map, class Reduce> T ThreadPool::parallelReduce(const std::size_t count, const std::size_t grainSize, const T& identity, Map&& map, Reduce&& reduce) {
+    CORRADE_ASSERT(grainSize,
+        "ThreadPool::parallelReduce(): expected a non-zero grain size", identity);
+    Containers::Array<T> results{DirectInit, (count + grainSize - 1)/grainSize, identity};
+    parallelFor(count, grainSize, [&](std::size_t begin, std::size_t end) {
+        results[begin/grainSize] = map(begin, end);
+    });
+    T out = identity;
+    for(const T& result: results)
+        out = reduce(out, result);
+    return out;
+}
+
+}
+
+#endif
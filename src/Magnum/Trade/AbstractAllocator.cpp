@@ -0,0 +1,142 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AbstractAllocator.h"
+
+#include <cstdint>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Assert.h>
+#include <Corrade/Utility/Debug.h>
+
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade {
+
+static_assert(AbstractAllocator::HeaderSize >= sizeof(AbstractAllocator*) && AbstractAllocator::HeaderSize % AbstractAllocator::Alignment == 0,
+    "header has to fit a pointer and preserve alignment");
+
+void AbstractAllocator::deleter(char* const data, const std::size_t size) {
+    char* const memory = data - HeaderSize;
+    AbstractAllocator& allocator = **reinterpret_cast<AbstractAllocator**>(memory);
+    --allocator._liveAllocationCount;
+    allocator._allocatedSize -= size;
+    allocator.doDeallocate(memory, size + HeaderSize);
+}
+
+AbstractAllocator::AbstractAllocator() = default;
+
+AbstractAllocator::~AbstractAllocator() = default;
+
+Containers::Array<char> AbstractAllocator::allocate(const std::size_t size) {
+    if(!size) return {};
+
+    char* const memory = static_cast<char*>(doAllocate(size + HeaderSize));
+    if(!memory)
+        Fatal{} << "Trade::AbstractAllocator::allocate(): can't allocate" << size << "bytes";
+    CORRADE_ASSERT(reinterpret_cast<std::uintptr_t>(memory) % Alignment == 0,
+        "Trade::AbstractAllocator::allocate(): implementation returned a pointer not aligned to" << Alignment << "bytes", {});
+
+    *reinterpret_cast<AbstractAllocator**>(memory) = this;
+    ++_allocationCount;
+    ++_liveAllocationCount;
+    _allocatedSize += size;
+    if(_allocatedSize > _peakAllocatedSize)
+        _peakAllocatedSize = _allocatedSize;
+    return Containers::Array<char>{memory + HeaderSize, size, deleter};
+}
+
+bool AbstractAllocator::isOwnedArray(const Containers::Array<char>& data) const {
+    return data.deleter() == deleter && *reinterpret_cast<AbstractAllocator* const*>(data.data() - HeaderSize) == this;
+}
+
+void AbstractAllocator::relocate(MeshData& mesh) {
+    if((mesh._indexDataFlags & DataFlag::Owned) && !mesh._indexData.isEmpty() && !isOwnedArray(mesh._indexData)) {
+        Containers::Array<char> data = allocate(mesh._indexData.size());
+        Utility::copy(mesh._indexData, data);
+        mesh._indices = data.data() + (mesh._indices - mesh._indexData.data());
+        mesh._indexData = Utility::move(data);
+    }
+
+    if((mesh._vertexDataFlags & DataFlag::Owned) && !mesh._vertexData.isEmpty() && !isOwnedArray(mesh._vertexData)) {
+        Containers::Array<char> data = allocate(mesh._vertexData.size());
+        Utility::copy(mesh._vertexData, data);
+
+        /* Attributes that are not offset-only point into the original vertex
+           data, rebase them. The attribute array itself may be non-owned, so
+           make a new one instead of modifying it in-place. */
+        bool hasAbsoluteAttributes = false;
+        for(const MeshAttributeData& attribute: mesh._attributes) {
+            if(!attribute.isOffsetOnly()) {
+                hasAbsoluteAttributes = true;
+                break;
+            }
+        }
+        if(hasAbsoluteAttributes) {
+            Containers::Array<MeshAttributeData> attributes{mesh._attributes.size()};
+            for(std::size_t i = 0; i != attributes.size(); ++i) {
+                const MeshAttributeData& attribute = mesh._attributes[i];
+                if(attribute.isOffsetOnly()) {
+                    attributes[i] = attribute;
+                    continue;
+                }
+
+                const Containers::StridedArrayView1D<const void> view = attribute.data();
+                attributes[i] = MeshAttributeData{attribute.name(), attribute.format(),
+                    Containers::StridedArrayView1D<const void>{data,
+                        data.data() + (static_cast<const char*>(view.data()) - mesh._vertexData.data()),
+                        view.size(), view.stride()},
+                    attribute.arraySize(), attribute.morphTargetId()};
+            }
+            mesh._attributes = Utility::move(attributes);
+        }
+
+        mesh._vertexData = Utility::move(data);
+    }
+}
+
+template<UnsignedInt dimensions> void AbstractAllocator::relocateInternal(ImageData<dimensions>& image) {
+    if(!(image._dataFlags & DataFlag::Owned) || image._data.isEmpty() || isOwnedArray(image._data))
+        return;
+
+    Containers::Array<char> data = allocate(image._data.size());
+    Utility::copy(image._data, data);
+    image._data = Utility::move(data);
+}
+
+void AbstractAllocator::relocate(ImageData1D& image) {
+    relocateInternal(image);
+}
+
+void AbstractAllocator::relocate(ImageData2D& image) {
+    relocateInternal(image);
+}
+
+void AbstractAllocator::relocate(ImageData3D& image) {
+    relocateInternal(image);
+}
+
+}}
@@ -0,0 +1,211 @@
+#ifndef Magnum_Trade_AbstractAllocator_h
+#define Magnum_Trade_AbstractAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AbstractAllocator
+ * @m_since_latest
+ */
+
+#include <cstddef>
+#include <Corrade/Containers/Array.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Base for data allocators
+@m_since_latest
+
+Provides storage for data arrays produced by importers and other code, so an
+application can route them into an arena or a pool instead of the global heap.
+Set an allocator on an importer with @ref AbstractImporter::setAllocator(), or
+move the data into it explicitly with @ref relocate(), for example for meshes
+produced by @ref MeshTools algorithms:
+
+@snippet Trade.cpp AbstractAllocator-usage
+
+Arrays returned from @ref allocate() have a deleter that's defined in the
+@ref Trade library and returns the memory back to the allocator, so they can
+be safely used even after the plugin that created them got unloaded. All
+arrays are expected to be destroyed before the allocator itself.
+
+The allocator keeps track of the allocation count and allocated size, see
+@ref allocationCount(), @ref liveAllocationCount(), @ref allocatedSize() and
+@ref peakAllocatedSize().
+
+@section Trade-AbstractAllocator-subclassing Subclassing
+
+The subclass implements @ref doAllocate() and @ref doDeallocate(). Each
+allocation is prefixed with a @ref HeaderSize bytes large header that points
+back to the allocator, the memory returned from @ref doAllocate() is expected
+to be aligned to at least @ref Alignment bytes. See @ref ArenaAllocator for an
+example implementation.
+
+@section Trade-AbstractAllocator-thread-safety Thread safety
+
+The allocator is not thread-safe. When importing on multiple threads, for
+example with @ref AsyncImporter, use a dedicated allocator for each importer.
+*/
+class MAGNUM_TRADE_EXPORT AbstractAllocator {
+    public:
+        enum: std::size_t {
+            /**
+             * Alignment of allocated memory. Sufficient for all types used
+             * in vertex, index and pixel data.
+             */
+            Alignment = 16,
+
+            /** Size of the header stored before each allocation */
+            HeaderSize = 16
+        };
+
+        /**
+         * @brief Deleter for allocated arrays
+         *
+         * Returns the memory back to the allocator it came from. Can be used
+         * to check whether an array was allocated by any allocator.
+         */
+        static void deleter(char* data, std::size_t size);
+
+        explicit AbstractAllocator();
+
+        /** @brief Copying is not allowed */
+        AbstractAllocator(const AbstractAllocator&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * Allocated arrays reference the allocator instance.
+         */
+        AbstractAllocator(AbstractAllocator&&) = delete;
+
+        virtual ~AbstractAllocator();
+
+        /** @brief Copying is not allowed */
+        AbstractAllocator& operator=(const AbstractAllocator&) = delete;
+
+        /** @brief Moving is not allowed */
+        AbstractAllocator& operator=(AbstractAllocator&&) = delete;
+
+        /**
+         * @brief Total allocation count
+         *
+         * Count of all @ref allocate() calls with a non-zero size, including
+         * allocations that were already freed.
+         */
+        std::size_t allocationCount() const { return _allocationCount; }
+
+        /**
+         * @brief Live allocation count
+         *
+         * Count of allocated arrays that weren't destroyed yet.
+         */
+        std::size_t liveAllocationCount() const { return _liveAllocationCount; }
+
+        /**
+         * @brief Allocated size
+         *
+         * Sum of sizes of allocated arrays that weren't destroyed yet, in
+         * bytes. Doesn't include the header or any internal overhead of the
+         * implementation.
+         */
+        std::size_t allocatedSize() const { return _allocatedSize; }
+
+        /**
+         * @brief Peak allocated size
+         *
+         * Maximum value @ref allocatedSize() had during the lifetime of the
+         * allocator, in bytes.
+         */
+        std::size_t peakAllocatedSize() const { return _peakAllocatedSize; }
+
+        /**
+         * @brief Allocate an array
+         *
+         * The contents are uninitialized. If @p size is @cpp 0 @ce, returns
+         * an empty array without calling into the implementation. If the
+         * implementation fails to allocate, the function exits with a fatal
+         * error, same as a failed heap allocation would.
+         */
+        Containers::Array<char> allocate(std::size_t size);
+
+        /**
+         * @brief Move mesh data into the allocator
+         *
+         * Copies owned index and vertex data into arrays from
+         * @ref allocate() and updates index and attribute views to point to
+         * them. Non-owned data are left untouched, as are the attribute
+         * metadata, which stay on the heap. Data already allocated by this
+         * allocator aren't copied again.
+         */
+        void relocate(MeshData& mesh);
+
+        /**
+         * @brief Move image data into the allocator
+         *
+         * Copies owned image data into an array from @ref allocate().
+         * Non-owned data are left untouched, and data already allocated by
+         * this allocator aren't copied again.
+         */
+        void relocate(ImageData1D& image);
+        void relocate(ImageData2D& image); /**< @overload */
+        void relocate(ImageData3D& image); /**< @overload */
+
+    private:
+        /**
+         * @brief Implementation for @ref allocate()
+         *
+         * The @p size includes the @ref HeaderSize. Expected to return memory
+         * aligned to at least @ref Alignment bytes or @cpp nullptr @ce on
+         * failure.
+         */
+        virtual void* doAllocate(std::size_t size) = 0;
+
+        /**
+         * @brief Deallocate memory
+         *
+         * Called when an array from @ref allocate() is destroyed, with the
+         * pointer and size that @ref doAllocate() was called with.
+         */
+        virtual void doDeallocate(void* data, std::size_t size) = 0;
+
+        MAGNUM_TRADE_LOCAL bool isOwnedArray(const Containers::Array<char>& data) const;
+        template<UnsignedInt dimensions> MAGNUM_TRADE_LOCAL void relocateInternal(ImageData<dimensions>& image);
+
+        std::size_t _allocationCount{},
+            _liveAllocationCount{},
+            _allocatedSize{},
+            _peakAllocatedSize{};
+};
+
+}}
+
+#endif
@@ -425,10 +425,15 @@ checked by the implementation:
     As @ref Trade-AbstractImporter-data-dependency "mentioned above",
     @relativeref{Corrade,Containers::Array} instances returned from plugin
     implementations are not allowed to use anything else than the default
-    deleter or the deleter used by @ref Trade::ArrayAllocator, otherwise this
-    could cause dangling function pointer call on array destruction if the
-    plugin gets unloaded before the array is destroyed. This is asserted by the
-    base implementation on return.
+    deleter, the deleter used by @ref Trade::ArrayAllocator or arrays from
+    @ref Trade::AbstractAllocator::allocate(), otherwise this could cause
+    dangling function pointer call on array destruction if the plugin gets
+    unloaded before the array is destroyed. This is asserted by the base
+    implementation on return.
+@par
+    If @ref allocator() is set, mesh index and vertex data and image data
+    should be allocated from it, if possible. Data allocated on the heap get
+    copied into the allocator by the base implementation on return.
 @par
     Similarly for interpolator functions passed through
     @ref Animation::TrackView instances to @ref AnimationData --- to avoid
@@ -547,6 +552,37 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
          */
         void clearFlags(ImporterFlags flags);
 
+        /**
+         * @brief Data allocator
+         * @m_since_latest
+         *
+         * @see @ref setAllocator()
+         */
+        AbstractAllocator* allocator() const { return _allocator; }
+
+        /**
+         * @brief Set data allocator
+         * @m_since_latest
+         *
+         * If set, owned index and vertex data of meshes returned from
+         * @ref mesh() and owned data of images returned from @ref image1D(),
+         * @ref image2D() and @ref image3D() end up in memory from
+         * @p allocator. Plugin implementations that support it allocate the
+         * data from @ref allocator() directly. Data from other plugins are
+         * allocated on the heap and then copied into the allocator with
+         * @ref AbstractAllocator::relocate(), which makes the import slower
+         * than without an allocator --- in that case the allocator is only
+         * useful for keeping the data together and tracking their size. Data
+         * that aren't owned, such as from importers that import directly from
+         * memory-mapped files, are left untouched. Other data such as scenes
+         * or materials are not affected either.
+         *
+         * The allocator is expected to stay alive for as long as any data
+         * allocated from it. Pass @cpp nullptr @ce to use the heap again. By
+         * default no allocator is set.
+         */
+        void setAllocator(AbstractAllocator* allocator);
+
         /**
          * @brief File opening callback function
          *
@@ -2630,6 +2666,7 @@ class MAGNUM_TRADE_EXPORT AbstractImporter: public PluginManager::AbstractManagi
 
         Containers::Optional<Containers::ArrayView<const char>>(*_fileCallback)(const std::string&, InputFileCallbackPolicy, void*){};
         void* _fileCallbackUserData{};
+        AbstractAllocator* _allocator{};
 
         /* clang-cl on Windows complains about this field being unused if the
            templated setFileCallback() isn't called. Well, sure, it isn't used
@@ -2673,7 +2710,7 @@ updated interface string.
 */
 /* Silly indentation to make the string appear in pluginInterface() docs */
 #define MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE /* [interface] */ \
-"cz.mosra.magnum.Trade.AbstractImporter/0.5.3"
+"cz.mosra.magnum.Trade.AbstractImporter/0.5.4"
 /* [interface] */
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
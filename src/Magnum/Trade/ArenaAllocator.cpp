@@ -0,0 +1,99 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ArenaAllocator.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Utility/Assert.h>
+
+namespace Magnum { namespace Trade {
+
+struct ArenaAllocator::Block {
+    /* Pointer returned from malloc(), memory is the same aligned to
+       Alignment */
+    void* allocation;
+    char* memory;
+    std::size_t size;
+    std::size_t used;
+};
+
+ArenaAllocator::ArenaAllocator(const std::size_t blockSize): _blockSize{blockSize} {
+    CORRADE_ASSERT(blockSize,
+        "Trade::ArenaAllocator: expected a non-zero block size", );
+}
+
+ArenaAllocator::~ArenaAllocator() {
+    for(const Block& block: _blocks)
+        std::free(block.allocation);
+}
+
+std::size_t ArenaAllocator::blockCount() const {
+    return _blocks.size();
+}
+
+std::size_t ArenaAllocator::capacity() const {
+    std::size_t capacity = 0;
+    for(const Block& block: _blocks)
+        capacity += block.size;
+    return capacity;
+}
+
+void ArenaAllocator::reset() {
+    CORRADE_ASSERT(!liveAllocationCount(),
+        "Trade::ArenaAllocator::reset():" << liveAllocationCount() << "allocations are still alive", );
+
+    if(_blocks.isEmpty()) return;
+    for(std::size_t i = 1; i != _blocks.size(); ++i)
+        std::free(_blocks[i].allocation);
+    arrayResize(_blocks, 1);
+    _blocks[0].used = 0;
+}
+
+void* ArenaAllocator::doAllocate(std::size_t size) {
+    /* Keep all allocations aligned */
+    size = (size + Alignment - 1)/Alignment*Alignment;
+
+    if(_blocks.isEmpty() || _blocks.back().size - _blocks.back().used < size) {
+        const std::size_t blockSize = size > _blockSize ? size : _blockSize;
+        void* const allocation = std::malloc(blockSize + Alignment - 1);
+        if(!allocation) return nullptr;
+        char* const memory = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(allocation) + Alignment - 1)/Alignment*Alignment);
+        arrayAppend(_blocks, Block{allocation, memory, blockSize, 0});
+    }
+
+    Block& block = _blocks.back();
+    char* const out = block.memory + block.used;
+    block.used += size;
+    return out;
+}
+
+void ArenaAllocator::doDeallocate(void*, std::size_t) {
+    /* Memory is released all at once in reset() or in the destructor */
+}
+
+}}
@@ -0,0 +1,109 @@
+#ifndef Magnum_Trade_ArenaAllocator_h
+#define Magnum_Trade_ArenaAllocator_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ArenaAllocator
+ * @m_since_latest
+ */
+
+#include "Magnum/Trade/AbstractAllocator.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Arena allocator
+@m_since_latest
+
+Allocates from large memory blocks by just advancing a pointer. Destroying
+an allocated array only updates the counters, the memory is released all at
+once with @ref reset() or when the allocator is destroyed. Useful for example
+for data of a whole scene that get uploaded to the GPU and then discarded,
+avoiding heap fragmentation from many short-lived allocations of varying size:
+
+@snippet Trade.cpp ArenaAllocator-usage
+
+If an allocation doesn't fit into the remaining space of the current block, a
+new block of @ref blockSize() bytes, or larger if the allocation itself is
+larger, is allocated from the heap. See @ref AbstractAllocator for more
+information.
+*/
+class MAGNUM_TRADE_EXPORT ArenaAllocator: public AbstractAllocator {
+    public:
+        /**
+         * @brief Constructor
+         * @param blockSize     Size of a single memory block in bytes
+         *
+         * Doesn't allocate anything, the first block is allocated on the
+         * first @ref allocate() call. Expects that @p blockSize is non-zero.
+         */
+        explicit ArenaAllocator(std::size_t blockSize = 16*1024*1024);
+
+        /**
+         * @brief Destructor
+         *
+         * Frees all memory blocks. All arrays allocated from the arena are
+         * expected to be destroyed at this point.
+         */
+        ~ArenaAllocator();
+
+        /** @brief Block size */
+        std::size_t blockSize() const { return _blockSize; }
+
+        /** @brief Count of allocated memory blocks */
+        std::size_t blockCount() const;
+
+        /**
+         * @brief Capacity
+         *
+         * Sum of sizes of all allocated memory blocks, in bytes.
+         */
+        std::size_t capacity() const;
+
+        /**
+         * @brief Release all memory
+         *
+         * Frees all memory blocks except the first one, which is reused for
+         * subsequent allocations. Expects that all arrays allocated from the
+         * arena were destroyed, i.e. @ref liveAllocationCount() is
+         * @cpp 0 @ce.
+         */
+        void reset();
+
+    private:
+        struct Block;
+
+        MAGNUM_TRADE_LOCAL void* doAllocate(std::size_t size) override;
+        MAGNUM_TRADE_LOCAL void doDeallocate(void* data, std::size_t size) override;
+
+        std::size_t _blockSize;
+        Containers::Array<Block> _blocks;
+};
+
+}}
+
+#endif
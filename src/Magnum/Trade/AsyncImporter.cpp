@@ -0,0 +1,548 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "AsyncImporter.h"
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Utility/Move.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace Trade {
+
+Debug& operator<<(Debug& debug, const AsyncImportStatus value) {
+    const bool packed = debug.immediateFlags() >= Debug::Flag::Packed;
+
+    if(!packed)
+        debug << "Trade::AsyncImportStatus" << Debug::nospace;
+
+    switch(value) {
+        /* LCOV_EXCL_START */
+        #define _c(v) case AsyncImportStatus::v: return debug << (packed ? "" : "::") << Debug::nospace << #v;
+        _c(Pending)
+        _c(Running)
+        _c(Finished)
+        _c(Failed)
+        _c(Cancelled)
+        #undef _c
+        /* LCOV_EXCL_STOP */
+    }
+
+    return debug << (packed ? "" : "(") << Debug::nospace << Debug::hex << UnsignedByte(value) << Debug::nospace << (packed ? "" : ")");
+}
+
+namespace {
+
+enum class RequestType: UnsignedByte {
+    Scene,
+    Mesh,
+    Material,
+    Image1D,
+    Image2D,
+    Image3D
+};
+
+#ifndef CORRADE_NO_ASSERT
+constexpr const char* RequestTypeName[]{
+    "scene",
+    "mesh",
+    "material",
+    "1D image",
+    "2D image",
+    "3D image"
+};
+#endif
+
+struct Result {
+    Containers::Optional<SceneData> scene;
+    Containers::Optional<MeshData> mesh;
+    Containers::Optional<MaterialData> material;
+    Containers::Optional<ImageData1D> image1D;
+    Containers::Optional<ImageData2D> image2D;
+    Containers::Optional<ImageData3D> image3D;
+};
+
+struct Request {
+    /* Incremented every time the slot is freed, so stale tickets pointing to
+       a reused slot are detected. Never zero, so a zero ticket is never
+       valid. */
+    UnsignedInt generation{1};
+    bool used{};
+    /* Released while running, the worker frees the slot once done */
+    bool released{};
+    RequestType type{};
+    AsyncImportStatus status{};
+    UnsignedInt id{}, level{};
+    Int priority{};
+    UnsignedLong sequence{};
+    Result result;
+};
+
+constexpr UnsignedInt InvalidSlot = ~UnsignedInt{};
+
+}
+
+struct AsyncImporter::State {
+    UnsignedInt slot(Ticket ticket) const;
+    Ticket request(RequestType type, UnsignedInt id, UnsignedInt level, Int priority);
+    void wait(std::unique_lock<std::mutex>& lock, UnsignedInt slot) const;
+    void free(UnsignedInt slot);
+
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    Containers::Array<std::thread> threads;
+    UnsignedInt sceneCount{},
+        meshCount{},
+        materialCount{},
+        image1DCount{},
+        image2DCount{},
+        image3DCount{};
+
+    /* Everything below is guarded by the mutex */
+    mutable std::mutex mutex;
+    /* Notified when a request gets submitted and on destruction */
+    std::condition_variable workerCondition;
+    /* Notified when a request finishes or gets cancelled */
+    mutable std::condition_variable doneCondition;
+    Containers::Array<Request> requests;
+    Containers::Array<UnsignedInt> freeSlots;
+    /* Pending requests, and pending + running requests */
+    std::size_t pendingCount{}, activeCount{};
+    UnsignedLong sequence{};
+    bool quit{};
+};
+
+UnsignedInt AsyncImporter::State::slot(const Ticket ticket) const {
+    const UnsignedInt slot = ticket & 0xffffffffu;
+    if(slot >= requests.size() || !requests[slot].used || requests[slot].generation != ticket >> 32)
+        return InvalidSlot;
+    return slot;
+}
+
+AsyncImporter::Ticket AsyncImporter::State::request(const RequestType type, const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    std::lock_guard<std::mutex> lock{mutex};
+
+    UnsignedInt slot;
+    if(!freeSlots.isEmpty()) {
+        slot = freeSlots.back();
+        arrayRemoveSuffix(freeSlots);
+    } else {
+        slot = requests.size();
+        arrayAppend(requests, InPlaceInit);
+    }
+
+    Request& request = requests[slot];
+    request.used = true;
+    request.released = false;
+    request.type = type;
+    request.status = AsyncImportStatus::Pending;
+    request.id = id;
+    request.level = level;
+    request.priority = priority;
+    request.sequence = sequence++;
+    ++pendingCount;
+    ++activeCount;
+
+    workerCondition.notify_one();
+    return UnsignedLong(request.generation) << 32 | slot;
+}
+
+void AsyncImporter::State::wait(std::unique_lock<std::mutex>& lock, const UnsignedInt slot) const {
+    doneCondition.wait(lock, [&]{
+        const AsyncImportStatus status = requests[slot].status;
+        return status != AsyncImportStatus::Pending &&
+               status != AsyncImportStatus::Running;
+    });
+}
+
+void AsyncImporter::State::free(const UnsignedInt slot) {
+    Request& request = requests[slot];
+    request.used = false;
+    if(!++request.generation)
+        request.generation = 1;
+    request.result = Result{};
+    arrayAppend(freeSlots, slot);
+}
+
+namespace {
+
+Containers::Array<Containers::Pointer<AbstractImporter>> singleImporter(Containers::Pointer<AbstractImporter>&& importer) {
+    Containers::Array<Containers::Pointer<AbstractImporter>> out{1};
+    out[0] = Utility::move(importer);
+    return out;
+}
+
+}
+
+AsyncImporter::AsyncImporter(Containers::Pointer<AbstractImporter>&& importer): AsyncImporter{singleImporter(Utility::move(importer))} {}
+
+AsyncImporter::AsyncImporter(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers): _state{InPlaceInit} {
+    CORRADE_ASSERT(!importers.isEmpty(),
+        "Trade::AsyncImporter: expected at least one importer", );
+    #ifndef CORRADE_NO_ASSERT
+    for(std::size_t i = 0; i != importers.size(); ++i)
+        CORRADE_ASSERT(importers[i] && importers[i]->isOpened(),
+            "Trade::AsyncImporter: importer" << i << "is not opened", );
+    #endif
+
+    /* Query the counts upfront so the requests can be checked without having
+       to synchronize with the workers */
+    AbstractImporter& importer = *importers[0];
+    _state->sceneCount = importer.sceneCount();
+    _state->meshCount = importer.meshCount();
+    _state->materialCount = importer.materialCount();
+    _state->image1DCount = importer.image1DCount();
+    _state->image2DCount = importer.image2DCount();
+    _state->image3DCount = importer.image3DCount();
+
+    _state->importers = Utility::move(importers);
+    _state->threads = Containers::Array<std::thread>{_state->importers.size()};
+    for(UnsignedInt i = 0; i != _state->threads.size(); ++i)
+        _state->threads[i] = std::thread{&AsyncImporter::worker, this, i};
+}
+
+AsyncImporter::~AsyncImporter() {
+    {
+        std::lock_guard<std::mutex> lock{_state->mutex};
+        _state->quit = true;
+        for(Request& request: _state->requests) {
+            if(!request.used || request.status != AsyncImportStatus::Pending)
+                continue;
+            request.status = AsyncImportStatus::Cancelled;
+            --_state->activeCount;
+        }
+        _state->pendingCount = 0;
+    }
+
+    _state->workerCondition.notify_all();
+    _state->doneCondition.notify_all();
+    for(std::thread& thread: _state->threads)
+        thread.join();
+}
+
+void AsyncImporter::worker(const UnsignedInt workerId) {
+    State& state = *_state;
+    AbstractImporter& importer = *state.importers[workerId];
+
+    std::unique_lock<std::mutex> lock{state.mutex};
+    for(;;) {
+        state.workerCondition.wait(lock, [&]{
+            return state.quit || state.pendingCount;
+        });
+        if(state.quit) return;
+
+        /* Pick the pending request with the highest priority, or the oldest
+           one if there's more with the same priority. The queue is expected
+           to be short compared to the time an import takes, so a linear scan
+           is fine. */
+        UnsignedInt slot = InvalidSlot;
+        for(UnsignedInt i = 0; i != state.requests.size(); ++i) {
+            const Request& request = state.requests[i];
+            if(!request.used || request.status != AsyncImportStatus::Pending)
+                continue;
+            if(slot == InvalidSlot ||
+               request.priority > state.requests[slot].priority ||
+              (request.priority == state.requests[slot].priority &&
+               request.sequence < state.requests[slot].sequence))
+                slot = i;
+        }
+        CORRADE_INTERNAL_ASSERT(slot != InvalidSlot);
+
+        /* The requests array may get reallocated while unlocked, so copy
+           everything needed and don't keep any references */
+        state.requests[slot].status = AsyncImportStatus::Running;
+        --state.pendingCount;
+        const RequestType type = state.requests[slot].type;
+        const UnsignedInt id = state.requests[slot].id;
+        const UnsignedInt level = state.requests[slot].level;
+        lock.unlock();
+
+        Result result;
+        bool succeeded = false;
+        switch(type) {
+            case RequestType::Scene:
+                result.scene = importer.scene(id);
+                succeeded = !!result.scene;
+                break;
+            case RequestType::Mesh: {
+                const UnsignedInt levelCount = importer.meshLevelCount(id);
+                if(level >= levelCount) {
+                    Error{} << "Trade::AsyncImporter: level" << level << "out of range for" << levelCount << "entries of mesh" << id;
+                    break;
+                }
+                result.mesh = importer.mesh(id, level);
+                succeeded = !!result.mesh;
+            } break;
+            case RequestType::Material:
+                result.material = importer.material(id);
+                succeeded = !!result.material;
+                break;
+            case RequestType::Image1D: {
+                const UnsignedInt levelCount = importer.image1DLevelCount(id);
+                if(level >= levelCount) {
+                    Error{} << "Trade::AsyncImporter: level" << level << "out of range for" << levelCount << "entries of 1D image" << id;
+                    break;
+                }
+                result.image1D = importer.image1D(id, level);
+                succeeded = !!result.image1D;
+            } break;
+            case RequestType::Image2D: {
+                const UnsignedInt levelCount = importer.image2DLevelCount(id);
+                if(level >= levelCount) {
+                    Error{} << "Trade::AsyncImporter: level" << level << "out of range for" << levelCount << "entries of 2D image" << id;
+                    break;
+                }
+                result.image2D = importer.image2D(id, level);
+                succeeded = !!result.image2D;
+            } break;
+            case RequestType::Image3D: {
+                const UnsignedInt levelCount = importer.image3DLevelCount(id);
+                if(level >= levelCount) {
+                    Error{} << "Trade::AsyncImporter: level" << level << "out of range for" << levelCount << "entries of 3D image" << id;
+                    break;
+                }
+                result.image3D = importer.image3D(id, level);
+                succeeded = !!result.image3D;
+            } break;
+        }
+
+        lock.lock();
+        Request& request = state.requests[slot];
+        if(request.released) {
+            state.free(slot);
+        } else {
+            request.result = Utility::move(result);
+            request.status = succeeded ?
+                AsyncImportStatus::Finished : AsyncImportStatus::Failed;
+        }
+        --state.activeCount;
+        state.doneCondition.notify_all();
+    }
+}
+
+UnsignedInt AsyncImporter::workerCount() const {
+    return _state->threads.size();
+}
+
+std::size_t AsyncImporter::activeCount() const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    return _state->activeCount;
+}
+
+AsyncImporter::Ticket AsyncImporter::requestScene(const UnsignedInt id, const Int priority) {
+    CORRADE_ASSERT(id < _state->sceneCount,
+        "Trade::AsyncImporter::requestScene(): index" << id << "out of range for" << _state->sceneCount << "entries", {});
+    return _state->request(RequestType::Scene, id, 0, priority);
+}
+
+AsyncImporter::Ticket AsyncImporter::requestMesh(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(id < _state->meshCount,
+        "Trade::AsyncImporter::requestMesh(): index" << id << "out of range for" << _state->meshCount << "entries", {});
+    return _state->request(RequestType::Mesh, id, level, priority);
+}
+
+AsyncImporter::Ticket AsyncImporter::requestMaterial(const UnsignedInt id, const Int priority) {
+    CORRADE_ASSERT(id < _state->materialCount,
+        "Trade::AsyncImporter::requestMaterial(): index" << id << "out of range for" << _state->materialCount << "entries", {});
+    return _state->request(RequestType::Material, id, 0, priority);
+}
+
+AsyncImporter::Ticket AsyncImporter::requestImage1D(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(id < _state->image1DCount,
+        "Trade::AsyncImporter::requestImage1D(): index" << id << "out of range for" << _state->image1DCount << "entries", {});
+    return _state->request(RequestType::Image1D, id, level, priority);
+}
+
+AsyncImporter::Ticket AsyncImporter::requestImage2D(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(id < _state->image2DCount,
+        "Trade::AsyncImporter::requestImage2D(): index" << id << "out of range for" << _state->image2DCount << "entries", {});
+    return _state->request(RequestType::Image2D, id, level, priority);
+}
+
+AsyncImporter::Ticket AsyncImporter::requestImage3D(const UnsignedInt id, const UnsignedInt level, const Int priority) {
+    CORRADE_ASSERT(id < _state->image3DCount,
+        "Trade::AsyncImporter::requestImage3D(): index" << id << "out of range for" << _state->image3DCount << "entries", {});
+    return _state->request(RequestType::Image3D, id, level, priority);
+}
+
+AsyncImportStatus AsyncImporter::status(const Ticket ticket) const {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::status(): invalid ticket" << Debug::hex << ticket, {});
+    return _state->requests[slot].status;
+}
+
+AsyncImportStatus AsyncImporter::wait(const Ticket ticket) const {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::wait(): invalid ticket" << Debug::hex << ticket, {});
+    _state->wait(lock, slot);
+    return _state->requests[slot].status;
+}
+
+void AsyncImporter::waitAll() const {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    _state->doneCondition.wait(lock, [&]{
+        return !_state->activeCount;
+    });
+}
+
+bool AsyncImporter::setPriority(const Ticket ticket, const Int priority) {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::setPriority(): invalid ticket" << Debug::hex << ticket, {});
+    Request& request = _state->requests[slot];
+    if(request.status != AsyncImportStatus::Pending)
+        return false;
+    request.priority = priority;
+    return true;
+}
+
+bool AsyncImporter::cancel(const Ticket ticket) {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::cancel(): invalid ticket" << Debug::hex << ticket, {});
+    Request& request = _state->requests[slot];
+    if(request.status != AsyncImportStatus::Pending)
+        return false;
+    request.status = AsyncImportStatus::Cancelled;
+    --_state->pendingCount;
+    --_state->activeCount;
+    _state->doneCondition.notify_all();
+    return true;
+}
+
+void AsyncImporter::release(const Ticket ticket) {
+    std::lock_guard<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::release(): invalid ticket" << Debug::hex << ticket, );
+    Request& request = _state->requests[slot];
+
+    /* Can't free a running request, the worker does that once it finishes */
+    if(request.status == AsyncImportStatus::Running) {
+        request.released = true;
+        return;
+    }
+
+    if(request.status == AsyncImportStatus::Pending) {
+        --_state->pendingCount;
+        --_state->activeCount;
+        _state->doneCondition.notify_all();
+    }
+    _state->free(slot);
+}
+
+Containers::Optional<SceneData> AsyncImporter::takeScene(const Ticket ticket) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::takeScene(): invalid ticket" << Debug::hex << ticket, {});
+    CORRADE_ASSERT(_state->requests[slot].type == RequestType::Scene,
+        "Trade::AsyncImporter::takeScene(): ticket" << Debug::hex << ticket << "is a" << RequestTypeName[UnsignedInt(_state->requests[slot].type)] << "request", {});
+    _state->wait(lock, slot);
+    Containers::Optional<SceneData> out = Utility::move(_state->requests[slot].result.scene);
+    _state->free(slot);
+    return out;
+}
+
+Containers::Optional<MeshData> AsyncImporter::takeMesh(const Ticket ticket) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::takeMesh(): invalid ticket" << Debug::hex << ticket, {});
+    CORRADE_ASSERT(_state->requests[slot].type == RequestType::Mesh,
+        "Trade::AsyncImporter::takeMesh(): ticket" << Debug::hex << ticket << "is a" << RequestTypeName[UnsignedInt(_state->requests[slot].type)] << "request", {});
+    _state->wait(lock, slot);
+    Containers::Optional<MeshData> out = Utility::move(_state->requests[slot].result.mesh);
+    _state->free(slot);
+    return out;
+}
+
+Containers::Optional<MaterialData> AsyncImporter::takeMaterial(const Ticket ticket) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::takeMaterial(): invalid ticket" << Debug::hex << ticket, {});
+    CORRADE_ASSERT(_state->requests[slot].type == RequestType::Material,
+        "Trade::AsyncImporter::takeMaterial(): ticket" << Debug::hex << ticket << "is a" << RequestTypeName[UnsignedInt(_state->requests[slot].type)] << "request", {});
+    _state->wait(lock, slot);
+    Containers::Optional<MaterialData> out = Utility::move(_state->requests[slot].result.material);
+    _state->free(slot);
+    return out;
+}
+
+Containers::Optional<ImageData1D> AsyncImporter::takeImage1D(const Ticket ticket) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::takeImage1D(): invalid ticket" << Debug::hex << ticket, {});
+    CORRADE_ASSERT(_state->requests[slot].type == RequestType::Image1D,
+        "Trade::AsyncImporter::takeImage1D(): ticket" << Debug::hex << ticket << "is a" << RequestTypeName[UnsignedInt(_state->requests[slot].type)] << "request", {});
+    _state->wait(lock, slot);
+    Containers::Optional<ImageData1D> out = Utility::move(_state->requests[slot].result.image1D);
+    _state->free(slot);
+    return out;
+}
+
+Containers::Optional<ImageData2D> AsyncImporter::takeImage2D(const Ticket ticket) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::takeImage2D(): invalid ticket" << Debug::hex << ticket, {});
+    CORRADE_ASSERT(_state->requests[slot].type == RequestType::Image2D,
+        "Trade::AsyncImporter::takeImage2D(): ticket" << Debug::hex << ticket << "is a" << RequestTypeName[UnsignedInt(_state->requests[slot].type)] << "request", {});
+    _state->wait(lock, slot);
+    Containers::Optional<ImageData2D> out = Utility::move(_state->requests[slot].result.image2D);
+    _state->free(slot);
+    return out;
+}
+
+Containers::Optional<ImageData3D> AsyncImporter::takeImage3D(const Ticket ticket) {
+    std::unique_lock<std::mutex> lock{_state->mutex};
+    const UnsignedInt slot = _state->slot(ticket);
+    CORRADE_ASSERT(slot != InvalidSlot,
+        "Trade::AsyncImporter::takeImage3D(): invalid ticket" << Debug::hex << ticket, {});
+    CORRADE_ASSERT(_state->requests[slot].type == RequestType::Image3D,
+        "Trade::AsyncImporter::takeImage3D(): ticket" << Debug::hex << ticket << "is a" << RequestTypeName[UnsignedInt(_state->requests[slot].type)] << "request", {});
+    _state->wait(lock, slot);
+    Containers::Optional<ImageData3D> out = Utility::move(_state->requests[slot].result.image3D);
+    _state->free(slot);
+    return out;
+}
+
+}}
@@ -0,0 +1,383 @@
+#ifndef Magnum_Trade_AsyncImporter_h
+#define Magnum_Trade_AsyncImporter_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::AsyncImporter, enum @ref Magnum::Trade::AsyncImportStatus
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief Asynchronous import status
+@m_since_latest
+
+@see @ref AsyncImporter::status(), @ref AsyncImporter::wait()
+*/
+enum class AsyncImportStatus: UnsignedByte {
+    /** The request is queued and waits for a free worker */
+    Pending,
+
+    /** The request is being processed by a worker */
+    Running,
+
+    /** The request finished successfully, the result can be taken */
+    Finished,
+
+    /**
+     * The request failed. The reason is printed by the importer to the
+     * error output.
+     */
+    Failed,
+
+    /** The request was cancelled with @ref AsyncImporter::cancel() */
+    Cancelled
+};
+
+/**
+@debugoperatorenum{AsyncImportStatus}
+@m_since_latest
+*/
+MAGNUM_TRADE_EXPORT Debug& operator<<(Debug& debug, AsyncImportStatus value);
+
+/**
+@brief Asynchronous importer
+@m_since_latest
+
+Wraps one or more opened @ref AbstractImporter instances and imports data on
+background worker threads, so the calling thread doesn't block on import.
+Each worker exclusively owns one importer instance, so the importers don't
+need to be thread-safe --- the only requirement is that all of them have the
+same file opened.
+
+@section Trade-AsyncImporter-usage Usage
+
+Each request function such as @ref requestMesh() returns a @ref Ticket
+immediately. The ticket can be then polled with @ref status() or waited on
+with @ref wait(), and the result is retrieved with a corresponding take
+function such as @ref takeMesh(), which also releases the ticket:
+
+@snippet Trade.cpp AsyncImporter-usage
+
+Pending requests are processed in an order of descending priority, requests
+with the same priority in the order they were submitted. The priority can be
+changed with @ref setPriority() as long as the request is still pending, and a
+pending request can be cancelled with @ref cancel(). Requests that are already
+being processed can't be interrupted.
+
+Using more than one importer allows multiple requests to be processed in
+parallel. As each worker has its own importer, the file gets opened and parsed
+once per worker, which is a tradeoff between the added parallelism and the
+extra memory and startup time:
+
+@snippet Trade.cpp AsyncImporter-multiple
+
+@section Trade-AsyncImporter-lifetime Lifetime and thread safety
+
+The importers are owned by the instance and shouldn't be accessed from outside
+while it's alive. All public functions can be called from any thread. The
+destructor cancels all pending requests, waits until running requests finish
+and then destroys the importers. Results that weren't taken are discarded.
+
+Note that if importers are created by a @ref PluginManager::Manager, the
+manager has to outlive the @ref AsyncImporter instance.
+@experimental
+*/
+class MAGNUM_TRADE_EXPORT AsyncImporter {
+    public:
+        /**
+         * @brief Ticket
+         *
+         * Identifies a request. Tickets of released requests aren't reused
+         * until all 2<sup>32</sup> - 1 tickets of given internal slot get
+         * exhausted. A zero ticket is never valid and is returned from the
+         * request functions if they fail.
+         */
+        typedef UnsignedLong Ticket;
+
+        /**
+         * @brief Construct with a single worker
+         *
+         * Equivalent to calling @ref AsyncImporter(Containers::Array<Containers::Pointer<AbstractImporter>>&&)
+         * with a single importer.
+         */
+        explicit AsyncImporter(Containers::Pointer<AbstractImporter>&& importer);
+
+        /**
+         * @brief Construct with a worker for each importer
+         *
+         * Expects that there's at least one importer and that all of them are
+         * opened. Data counts are queried from the first importer, the other
+         * importers are expected to have the same file opened. Spawns a
+         * worker thread for each importer.
+         */
+        explicit AsyncImporter(Containers::Array<Containers::Pointer<AbstractImporter>>&& importers);
+
+        /** @brief Copying is not allowed */
+        AsyncImporter(const AsyncImporter&) = delete;
+
+        /**
+         * @brief Moving is not allowed
+         *
+         * The worker threads reference the instance.
+         */
+        AsyncImporter(AsyncImporter&&) = delete;
+
+        /**
+         * @brief Destructor
+         *
+         * Cancels all pending requests, waits until all running requests
+         * finish and destroys the importers.
+         */
+        ~AsyncImporter();
+
+        /** @brief Copying is not allowed */
+        AsyncImporter& operator=(const AsyncImporter&) = delete;
+
+        /** @brief Moving is not allowed */
+        AsyncImporter& operator=(AsyncImporter&&) = delete;
+
+        /** @brief Worker count */
+        UnsignedInt workerCount() const;
+
+        /**
+         * @brief Count of requests that are pending or running
+         *
+         * Doesn't include finished, failed or cancelled requests that weren't
+         * taken or released yet.
+         */
+        std::size_t activeCount() const;
+
+        /**
+         * @brief Request a scene
+         * @param id        Scene ID, from range [0, @ref AbstractImporter::sceneCount())
+         * @param priority  Request priority. Requests with a higher priority
+         *      are processed first.
+         *
+         * Returns a ticket that can be passed to @ref takeScene().
+         * @see @ref AbstractImporter::scene()
+         */
+        Ticket requestScene(UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Request a mesh
+         * @param id        Mesh ID, from range [0, @ref AbstractImporter::meshCount())
+         * @param level     Mesh level. If it's out of range for given mesh,
+         *      the request fails.
+         * @param priority  Request priority. Requests with a higher priority
+         *      are processed first.
+         *
+         * Returns a ticket that can be passed to @ref takeMesh().
+         * @see @ref AbstractImporter::mesh()
+         */
+        Ticket requestMesh(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Request a material
+         * @param id        Material ID, from range [0, @ref AbstractImporter::materialCount())
+         * @param priority  Request priority. Requests with a higher priority
+         *      are processed first.
+         *
+         * Returns a ticket that can be passed to @ref takeMaterial().
+         * @see @ref AbstractImporter::material()
+         */
+        Ticket requestMaterial(UnsignedInt id, Int priority = 0);
+
+        /**
+         * @brief Request a 1D image
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image1DCount())
+         * @param level     Image level. If it's out of range for given image,
+         *      the request fails.
+         * @param priority  Request priority. Requests with a higher priority
+         *      are processed first.
+         *
+         * Returns a ticket that can be passed to @ref takeImage1D().
+         * @see @ref AbstractImporter::image1D()
+         */
+        Ticket requestImage1D(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Request a 2D image
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image2DCount())
+         * @param level     Image level. If it's out of range for given image,
+         *      the request fails.
+         * @param priority  Request priority. Requests with a higher priority
+         *      are processed first.
+         *
+         * Returns a ticket that can be passed to @ref takeImage2D().
+         * @see @ref AbstractImporter::image2D()
+         */
+        Ticket requestImage2D(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Request a 3D image
+         * @param id        Image ID, from range [0, @ref AbstractImporter::image3DCount())
+         * @param level     Image level. If it's out of range for given image,
+         *      the request fails.
+         * @param priority  Request priority. Requests with a higher priority
+         *      are processed first.
+         *
+         * Returns a ticket that can be passed to @ref takeImage3D().
+         * @see @ref AbstractImporter::image3D()
+         */
+        Ticket requestImage3D(UnsignedInt id, UnsignedInt level = 0, Int priority = 0);
+
+        /**
+         * @brief Request status
+         *
+         * Doesn't block. Expects that @p ticket is valid, i.e. not taken or
+         * released yet.
+         */
+        AsyncImportStatus status(Ticket ticket) const;
+
+        /**
+         * @brief Wait for a request to finish
+         *
+         * Blocks until the request is @ref AsyncImportStatus::Finished,
+         * @relativeref{AsyncImportStatus,Failed} or
+         * @relativeref{AsyncImportStatus,Cancelled} and returns the status.
+         * Expects that @p ticket is valid.
+         */
+        AsyncImportStatus wait(Ticket ticket) const;
+
+        /**
+         * @brief Wait for all requests to finish
+         *
+         * Blocks until there are no pending or running requests.
+         * @see @ref activeCount()
+         */
+        void waitAll() const;
+
+        /**
+         * @brief Change request priority
+         *
+         * If the request is still @ref AsyncImportStatus::Pending, changes
+         * its priority and returns @cpp true @ce, otherwise returns
+         * @cpp false @ce. Expects that @p ticket is valid.
+         */
+        bool setPriority(Ticket ticket, Int priority);
+
+        /**
+         * @brief Cancel a request
+         *
+         * If the request is still @ref AsyncImportStatus::Pending, removes
+         * it from the queue, changes its status to
+         * @ref AsyncImportStatus::Cancelled and returns @cpp true @ce. If it's
+         * running or already done, returns @cpp false @ce. In both cases the
+         * ticket stays valid and has to be taken or released. Expects that
+         * @p ticket is valid.
+         */
+        bool cancel(Ticket ticket);
+
+        /**
+         * @brief Release a request
+         *
+         * Cancels the request if it's pending and discards its result if
+         * it's finished, without waiting. A running request is discarded
+         * once it finishes. The @p ticket becomes invalid after. Expects that
+         * @p ticket is valid.
+         */
+        void release(Ticket ticket);
+
+        /**
+         * @brief Take a scene
+         *
+         * Waits for the request to finish, releases the ticket and returns
+         * the scene. If the request failed or was cancelled, returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that @p ticket
+         * is valid and comes from @ref requestScene().
+         */
+        Containers::Optional<SceneData> takeScene(Ticket ticket);
+
+        /**
+         * @brief Take a mesh
+         *
+         * Waits for the request to finish, releases the ticket and returns
+         * the mesh. If the request failed or was cancelled, returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that @p ticket
+         * is valid and comes from @ref requestMesh().
+         */
+        Containers::Optional<MeshData> takeMesh(Ticket ticket);
+
+        /**
+         * @brief Take a material
+         *
+         * Waits for the request to finish, releases the ticket and returns
+         * the material. If the request failed or was cancelled, returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that @p ticket
+         * is valid and comes from @ref requestMaterial().
+         */
+        Containers::Optional<MaterialData> takeMaterial(Ticket ticket);
+
+        /**
+         * @brief Take a 1D image
+         *
+         * Waits for the request to finish, releases the ticket and returns
+         * the image. If the request failed or was cancelled, returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that @p ticket
+         * is valid and comes from @ref requestImage1D().
+         */
+        Containers::Optional<ImageData1D> takeImage1D(Ticket ticket);
+
+        /**
+         * @brief Take a 2D image
+         *
+         * Waits for the request to finish, releases the ticket and returns
+         * the image. If the request failed or was cancelled, returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that @p ticket
+         * is valid and comes from @ref requestImage2D().
+         */
+        Containers::Optional<ImageData2D> takeImage2D(Ticket ticket);
+
+        /**
+         * @brief Take a 3D image
+         *
+         * Waits for the request to finish, releases the ticket and returns
+         * the image. If the request failed or was cancelled, returns
+         * @relativeref{Corrade,Containers::NullOpt}. Expects that @p ticket
+         * is valid and comes from @ref requestImage3D().
+         */
+        Containers::Optional<ImageData3D> takeImage3D(Ticket ticket);
+
+    private:
+        struct State;
+
+        MAGNUM_TRADE_LOCAL void worker(UnsignedInt workerId);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -1024,6 +1024,8 @@ template<UnsignedInt dimensions> class ImageData {
            implementations. */
         friend AbstractImporter;
         friend AbstractImageConverter;
+        /* For replacing the data array in relocate() */
+        friend AbstractAllocator;
 
         DataFlags _dataFlags;
         bool _compressed;
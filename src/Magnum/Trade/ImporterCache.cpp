@@ -0,0 +1,392 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "ImporterCache.h"
+
+#include <atomic>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Reference.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+#include <Corrade/Utility/Sha1.h>
+
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+#ifdef CORRADE_TARGET_WINDOWS
+#define WIN32_LEAN_AND_MEAN 1
+#define VC_EXTRALEAN
+#include <windows.h>
+#elif defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+#include <unistd.h>
+#endif
+
+/* Memory-mapping is available only on some platforms, elsewhere the hashed
+   files are read into memory instead */
+#if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+#define _MAGNUM_IMPORTERCACHE_USE_MAP
+#endif
+
+namespace Magnum { namespace Trade {
+
+using namespace Containers::Literals;
+
+namespace {
+
+#ifdef _MAGNUM_IMPORTERCACHE_USE_MAP
+typedef Containers::Array<const char, Utility::Path::MapDeleter> MappedFile;
+#else
+typedef Containers::Array<char> MappedFile;
+#endif
+
+Containers::Optional<MappedFile> mapFile(const Containers::StringView filename) {
+    #ifdef _MAGNUM_IMPORTERCACHE_USE_MAP
+    return Utility::Path::mapRead(filename);
+    #else
+    return Utility::Path::read(filename);
+    #endif
+}
+
+UnsignedLong processId() {
+    #ifdef CORRADE_TARGET_WINDOWS
+    return GetCurrentProcessId();
+    #elif defined(CORRADE_TARGET_UNIX) || defined(CORRADE_TARGET_EMSCRIPTEN)
+    return getpid();
+    #else
+    return 0;
+    #endif
+}
+
+/* Distinguishes temporary files written from multiple threads or multiple
+   ImporterCache instances in the same process */
+std::atomic<UnsignedLong> temporaryFileCounter{};
+
+}
+
+struct ImporterCache::State {
+    explicit State(PluginManager::Manager<AbstractImporter>& importerManager, PluginManager::Manager<AbstractSceneConverter>& converterManager, Containers::StringView directory): importerManager(importerManager), converterManager(converterManager), directory{directory} {}
+
+    Containers::Pointer<AbstractImporter> openCached(Containers::StringView path, ImporterFlags flags);
+
+    PluginManager::Manager<AbstractImporter>& importerManager;
+    PluginManager::Manager<AbstractSceneConverter>& converterManager;
+    Containers::String directory;
+    std::size_t hitCount{}, missCount{};
+};
+
+Containers::Pointer<AbstractImporter> ImporterCache::State::openCached(const Containers::StringView path, const ImporterFlags flags) {
+    Containers::Pointer<AbstractImporter> importer = importerManager.loadAndInstantiate("MagnumImporter");
+    if(!importer)
+        return {};
+
+    /* MagnumImporter memory-maps the file and keeps the mapping for as long
+       as it's open, so it gets released together with the importer */
+    importer->setFlags(flags);
+    if(!importer->openFile(path))
+        return {};
+
+    return importer;
+}
+
+ImporterCache::ImporterCache(PluginManager::Manager<AbstractImporter>& importerManager, PluginManager::Manager<AbstractSceneConverter>& converterManager, const Containers::StringView directory): _state{InPlaceInit, importerManager, converterManager, directory} {}
+
+ImporterCache::ImporterCache(ImporterCache&&) noexcept = default;
+
+ImporterCache::~ImporterCache() = default;
+
+ImporterCache& ImporterCache::operator=(ImporterCache&&) noexcept = default;
+
+Containers::StringView ImporterCache::directory() const {
+    return _state->directory;
+}
+
+std::size_t ImporterCache::hitCount() const {
+    return _state->hitCount;
+}
+
+std::size_t ImporterCache::missCount() const {
+    return _state->missCount;
+}
+
+namespace {
+
+void hashString(Utility::Sha1& sha1, const Containers::StringView string) {
+    sha1 << Containers::ArrayView<const char>{string.data(), string.size()};
+}
+
+void hashConfiguration(Utility::Sha1& sha1, const Utility::ConfigurationGroup& group) {
+    for(Containers::Pair<Containers::StringView, Containers::StringView> value: group.values()) {
+        hashString(sha1, value.first());
+        hashString(sha1, "="_s);
+        hashString(sha1, value.second());
+        hashString(sha1, "\n"_s);
+    }
+
+    for(Containers::Pair<Containers::StringView, Containers::Reference<const Utility::ConfigurationGroup>> subgroup: group.groups()) {
+        hashString(sha1, "["_s);
+        hashString(sha1, subgroup.first());
+        hashString(sha1, "]\n"_s);
+        hashConfiguration(sha1, subgroup.second());
+        /* So values after a subgroup can't be confused with values inside */
+        hashString(sha1, "[/]\n"_s);
+    }
+}
+
+/* Returns a description of data that MagnumSceneConverter can't represent,
+   or an empty view if everything can be cached. Custom scene field, mesh
+   attribute and animation track target names are checked in convert(), as
+   they can be only discovered from the imported data. */
+Containers::StringView unsupportedData(AbstractImporter& importer) {
+    if(importer.textureCount())
+        return "textures"_s;
+    if(importer.lightCount())
+        return "lights"_s;
+    if(importer.cameraCount())
+        return "cameras"_s;
+    if(importer.skin2DCount() || importer.skin3DCount())
+        return "skins"_s;
+    for(UnsignedInt i = 0; i != importer.meshCount(); ++i)
+        if(importer.meshLevelCount(i) != 1)
+            return "multi-level meshes"_s;
+    for(UnsignedInt i = 0; i != importer.image1DCount(); ++i)
+        if(importer.image1DLevelCount(i) != 1)
+            return "multi-level images"_s;
+    for(UnsignedInt i = 0; i != importer.image2DCount(); ++i)
+        if(importer.image2DLevelCount(i) != 1)
+            return "multi-level images"_s;
+    for(UnsignedInt i = 0; i != importer.image3DCount(); ++i)
+        if(importer.image3DLevelCount(i) != 1)
+            return "multi-level images"_s;
+    for(UnsignedLong i = 0; i != importer.objectCount(); ++i)
+        if(!importer.objectName(i).isEmpty())
+            return "object names"_s;
+    return {};
+}
+
+/* If the data contain something that can't be cached, sets `unsupported` to
+   its description and returns an empty Optional */
+Containers::Optional<Containers::Array<char>> convert(AbstractSceneConverter& converter, AbstractImporter& importer, Containers::StringView& unsupported) {
+    if(!converter.beginData())
+        return {};
+
+    for(UnsignedInt i = 0; i != importer.sceneCount(); ++i) {
+        Containers::Optional<SceneData> scene = importer.scene(i);
+        if(!scene)
+            return {};
+        for(UnsignedInt j = 0; j != scene->fieldCount(); ++j) {
+            const SceneField name = scene->fieldName(j);
+            if(isSceneFieldCustom(name) && !importer.sceneFieldName(name).isEmpty()) {
+                unsupported = "custom scene field names"_s;
+                return {};
+            }
+        }
+        if(!converter.add(*scene, importer.sceneName(i)))
+            return {};
+    }
+    if(importer.defaultScene() != -1)
+        converter.setDefaultScene(importer.defaultScene());
+
+    for(UnsignedInt i = 0; i != importer.animationCount(); ++i) {
+        Containers::Optional<AnimationData> animation = importer.animation(i);
+        if(!animation)
+            return {};
+        for(UnsignedInt j = 0; j != animation->trackCount(); ++j) {
+            const AnimationTrackTarget name = animation->trackTargetName(j);
+            if(isAnimationTrackTargetCustom(name) && !importer.animationTrackTargetName(name).isEmpty()) {
+                unsupported = "custom animation track target names"_s;
+                return {};
+            }
+        }
+        if(!converter.add(*animation, importer.animationName(i)))
+            return {};
+    }
+
+    for(UnsignedInt i = 0; i != importer.meshCount(); ++i) {
+        Containers::Optional<MeshData> mesh = importer.mesh(i);
+        if(!mesh)
+            return {};
+        for(UnsignedInt j = 0; j != mesh->attributeCount(); ++j) {
+            const MeshAttribute name = mesh->attributeName(j);
+            if(isMeshAttributeCustom(name) && !importer.meshAttributeName(name).isEmpty()) {
+                unsupported = "custom mesh attribute names"_s;
+                return {};
+            }
+        }
+        if(!converter.add(*mesh, importer.meshName(i)))
+            return {};
+    }
+
+    for(UnsignedInt i = 0; i != importer.materialCount(); ++i) {
+        Containers::Optional<MaterialData> material = importer.material(i);
+        if(!material || !converter.add(*material, importer.materialName(i)))
+            return {};
+    }
+
+    for(UnsignedInt i = 0; i != importer.image1DCount(); ++i) {
+        Containers::Optional<ImageData1D> image = importer.image1D(i);
+        if(!image || !converter.add(*image, importer.image1DName(i)))
+            return {};
+    }
+
+    for(UnsignedInt i = 0; i != importer.image2DCount(); ++i) {
+        Containers::Optional<ImageData2D> image = importer.image2D(i);
+        if(!image || !converter.add(*image, importer.image2DName(i)))
+            return {};
+    }
+
+    for(UnsignedInt i = 0; i != importer.image3DCount(); ++i) {
+        Containers::Optional<ImageData3D> image = importer.image3D(i);
+        if(!image || !converter.add(*image, importer.image3DName(i)))
+            return {};
+    }
+
+    return converter.endData();
+}
+
+}
+
+Containers::String ImporterCache::key(const AbstractImporter& importer, const Containers::ArrayView<const void> data) const {
+    Utility::Sha1 sha1;
+
+    /* Version of the key layout, bump when it changes or when the cached
+       files become incompatible in some other way */
+    hashString(sha1, "ImporterCache 1\n"_s);
+    hashString(sha1, importer.plugin());
+    hashString(sha1, "\n"_s);
+    hashConfiguration(sha1, importer.configuration());
+    hashString(sha1, "\n"_s);
+    sha1 << Containers::ArrayView<const char>{static_cast<const char*>(data.data()), data.size()};
+
+    const Utility::Sha1::Digest digest = sha1.digest();
+    const char* const bytes = digest.byteArray();
+    constexpr const char Hex[]{"0123456789abcdef"};
+    Containers::String out{NoInit, 2*Utility::Sha1::DigestSize};
+    for(std::size_t i = 0; i != Utility::Sha1::DigestSize; ++i) {
+        out[2*i + 0] = Hex[UnsignedByte(bytes[i]) >> 4];
+        out[2*i + 1] = Hex[UnsignedByte(bytes[i]) & 0x0f];
+    }
+    return out;
+}
+
+Containers::Pointer<AbstractImporter> ImporterCache::openFile(Containers::Pointer<AbstractImporter>&& importer, const Containers::StringView filename) {
+    CORRADE_ASSERT(importer,
+        "Trade::ImporterCache::openFile(): importer is null", {});
+
+    Containers::Optional<MappedFile> data = mapFile(filename);
+    if(!data) {
+        Error{} << "Trade::ImporterCache::openFile(): cannot open file" << filename;
+        return {};
+    }
+
+    return open(Utility::move(importer), "Trade::ImporterCache::openFile():", filename, *data);
+}
+
+Containers::Pointer<AbstractImporter> ImporterCache::openData(Containers::Pointer<AbstractImporter>&& importer, const Containers::ArrayView<const void> data) {
+    CORRADE_ASSERT(importer,
+        "Trade::ImporterCache::openData(): importer is null", {});
+
+    return open(Utility::move(importer), "Trade::ImporterCache::openData():", {}, data);
+}
+
+Containers::Pointer<AbstractImporter> ImporterCache::open(Containers::Pointer<AbstractImporter>&& importer, const char* const prefix, const Containers::StringView filename, const Containers::ArrayView<const void> data) {
+    const ImporterFlags flags = importer->flags();
+    const Containers::String path = Utility::Path::join(_state->directory, key(*importer, data) + ".blob"_s);
+
+    /* If there's a cache file already, try to use it. If it's not usable for
+       some reason, such as being corrupted or truncated, import again and
+       overwrite it. */
+    if(Utility::Path::exists(path)) {
+        if(Containers::Pointer<AbstractImporter> cached = _state->openCached(path, flags)) {
+            ++_state->hitCount;
+            if(flags & ImporterFlag::Verbose)
+                Debug{} << prefix << "using cached" << path;
+            return cached;
+        }
+
+        if(!(flags & ImporterFlag::Quiet))
+            Warning{} << prefix << "cannot use" << path << Debug::nospace << ", importing again";
+    }
+
+    ++_state->missCount;
+    if(filename.isEmpty() ? !importer->openData(data) : !importer->openFile(filename))
+        return {};
+
+    Containers::StringView unsupported = unsupportedData(*importer);
+    if(!unsupported.isEmpty()) {
+        if(!(flags & ImporterFlag::Quiet))
+            Warning{} << prefix << unsupported << "can't be cached, using the importer directly";
+        return Utility::move(importer);
+    }
+
+    Containers::Pointer<AbstractSceneConverter> converter = _state->converterManager.loadAndInstantiate("MagnumSceneConverter");
+    Containers::Optional<Containers::Array<char>> converted;
+    if(!converter || !(converted = convert(*converter, *importer, unsupported))) {
+        if(!(flags & ImporterFlag::Quiet)) {
+            if(!unsupported.isEmpty())
+                Warning{} << prefix << unsupported << "can't be cached, using the importer directly";
+            else
+                Warning{} << prefix << "cannot convert the data for caching, using the importer directly";
+        }
+        return Utility::move(importer);
+    }
+
+    /* Write to a temporary file first and then move it over, so a partially
+       written file is never picked up by another process. The temporary name
+       is unique for each process and write, so concurrent writers of the same
+       cache file don't overwrite each other's partial output. */
+    const Containers::String temporaryPath = Utility::format("{}.{}.{}.tmp", path, processId(), temporaryFileCounter++);
+    if(!Utility::Path::make(_state->directory) ||
+       !Utility::Path::write(temporaryPath, *converted) ||
+       !Utility::Path::move(temporaryPath, path)) {
+        if(Utility::Path::exists(temporaryPath))
+            Utility::Path::remove(temporaryPath);
+        if(!(flags & ImporterFlag::Quiet))
+            Warning{} << prefix << "cannot write" << path << Debug::nospace << ", using the importer directly";
+        return Utility::move(importer);
+    }
+
+    Containers::Pointer<AbstractImporter> cached = _state->openCached(path, flags);
+    if(!cached) {
+        if(!(flags & ImporterFlag::Quiet))
+            Warning{} << prefix << "cannot open" << path << Debug::nospace << ", using the importer directly";
+        return Utility::move(importer);
+    }
+
+    if(flags & ImporterFlag::Verbose)
+        Debug{} << prefix << "cached as" << path;
+    return cached;
+}
+
+}}
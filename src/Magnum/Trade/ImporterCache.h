@@ -0,0 +1,209 @@
+#ifndef Magnum_Trade_ImporterCache_h
+#define Magnum_Trade_ImporterCache_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+/** @file
+ * @brief Class @ref Magnum::Trade::ImporterCache
+ * @m_since_latest
+ */
+
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/PluginManager/PluginManager.h>
+
+#include "Magnum/Magnum.h"
+#include "Magnum/Trade/Trade.h"
+#include "Magnum/Trade/visibility.h"
+
+namespace Magnum { namespace Trade {
+
+/**
+@brief On-disk import cache
+@m_since_latest
+
+Caches data imported by an @ref AbstractImporter in a directory on disk, so
+subsequent imports of the same unchanged input can be done by memory-mapping
+the cached file instead of parsing the original again.
+
+The cached data are written using the @relativeref{Trade,MagnumSceneConverter}
+plugin into a file named after a SHA-1 hash of the input data, the importer
+plugin name and all its configuration options. The file is then opened with
+the @relativeref{Trade,MagnumImporter} plugin through
+@ref AbstractImporter::openFile(), which memory-maps it on platforms that
+support it, and all returned data reference the mapped file directly without
+any copies.
+
+@section Trade-ImporterCache-usage Usage
+
+Pass an importer instance together with a file or data to @ref openFile() or
+@ref openData(). It returns an importer that gives back the same data as the
+original would:
+
+@snippet Trade.cpp ImporterCache-usage
+
+On a cache hit, the original importer isn't used for anything except
+calculating the cache key, and the returned importer is a
+@relativeref{Trade,MagnumImporter} instance opened on the cached file. On a
+cache miss, the original importer opens the input, all its data get imported
+and written to the cache, and the returned importer is again a
+@relativeref{Trade,MagnumImporter} instance opened on the newly written file,
+so the returned data look the same both times.
+
+If the input contains data that the @relativeref{Trade,MagnumSceneConverter}
+plugin can't represent, such as textures, lights, cameras, skins, multi-level
+meshes or images, object names, or names of custom scene fields, mesh
+attributes or animation track targets, or if the plugins can't be loaded or the cache file can't be
+written, a warning is printed and the original importer is returned, opened on
+the input directly. The warning can be suppressed by setting
+@ref ImporterFlag::Quiet on the importer, @ref ImporterFlag::Verbose
+additionally prints whether the cache was used.
+
+@section Trade-ImporterCache-limitations Limitations
+
+-   Only the top-level file or data is hashed. If the importer loads
+    additional external files such as glTF buffers or OBJ material libraries
+    and those change, the cache doesn't detect that and the cache directory
+    has to be cleared manually.
+-   @ref AbstractImporter::importerState() of the original importer isn't
+    available from the cached importer.
+-   Inputs with object names or with names of custom scene fields, mesh
+    attributes or animation track targets aren't cached at all, as the
+    @relativeref{Trade,MagnumSceneConverter} plugin doesn't store them.
+-   Old cache files are never removed.
+
+@section Trade-ImporterCache-lifetime Lifetime
+
+Each returned @relativeref{Trade,MagnumImporter} instance owns the mapping of
+its cache file and releases it when it's closed or destroyed. Data imported
+from it reference the mapping, so the importer has to stay open for as long as
+the imported data are in use. The @ref ImporterCache instance itself can be
+destroyed independently of the importers returned from it.
+@experimental
+*/
+class MAGNUM_TRADE_EXPORT ImporterCache {
+    public:
+        /**
+         * @brief Constructor
+         * @param importerManager   Manager to load the
+         *      @relativeref{Trade,MagnumImporter} plugin from
+         * @param converterManager  Manager to load the
+         *      @relativeref{Trade,MagnumSceneConverter} plugin from
+         * @param directory         Cache directory. Created on first write
+         *      if it doesn't exist.
+         *
+         * The managers are expected to outlive the instance.
+         */
+        explicit ImporterCache(PluginManager::Manager<AbstractImporter>& importerManager, PluginManager::Manager<AbstractSceneConverter>& converterManager, Containers::StringView directory);
+
+        /** @brief Copying is not allowed */
+        ImporterCache(const ImporterCache&) = delete;
+
+        /** @brief Move constructor */
+        ImporterCache(ImporterCache&&) noexcept;
+
+        /**
+         * @brief Destructor
+         *
+         * Importers returned from @ref openFile() and @ref openData() own
+         * their cache files and stay valid after.
+         */
+        ~ImporterCache();
+
+        /** @brief Copying is not allowed */
+        ImporterCache& operator=(const ImporterCache&) = delete;
+
+        /** @brief Move assignment */
+        ImporterCache& operator=(ImporterCache&&) noexcept;
+
+        /** @brief Cache directory */
+        Containers::StringView directory() const;
+
+        /**
+         * @brief Count of cache hits
+         *
+         * Count of @ref openFile() and @ref openData() calls that opened an
+         * already existing cache file.
+         */
+        std::size_t hitCount() const;
+
+        /**
+         * @brief Count of cache misses
+         *
+         * Count of @ref openFile() and @ref openData() calls that had to
+         * import the data with the original importer, independently of
+         * whether the data were then successfully written to the cache or
+         * not.
+         */
+        std::size_t missCount() const;
+
+        /**
+         * @brief Cache key for given importer and data
+         *
+         * Returns a lowercase hexadecimal SHA-1 hash of @p data, the
+         * @ref AbstractImporter::plugin() name of @p importer and all its
+         * @ref AbstractImporter::configuration() values. The cache file is
+         * named after it.
+         */
+        Containers::String key(const AbstractImporter& importer, Containers::ArrayView<const void> data) const;
+
+        /**
+         * @brief Open a file through the cache
+         *
+         * If a cache file matching the file contents and the importer
+         * exists, returns a @relativeref{Trade,MagnumImporter} instance opened
+         * on it. Otherwise opens @p filename with @p importer, writes its
+         * contents to the cache and returns a
+         * @relativeref{Trade,MagnumImporter} instance opened on the written
+         * file. If the contents can't be cached, returns @p importer opened
+         * on @p filename. If the file can't be opened, prints a message to
+         * @relativeref{Magnum,Error} and returns @cpp nullptr @ce. See the
+         * @ref Trade-ImporterCache-usage "class documentation" for more
+         * information.
+         *
+         * Expects that @p importer is not @cpp nullptr @ce.
+         */
+        Containers::Pointer<AbstractImporter> openFile(Containers::Pointer<AbstractImporter>&& importer, Containers::StringView filename);
+
+        /**
+         * @brief Open data through the cache
+         *
+         * Like @ref openFile(), but opens @p data with
+         * @ref AbstractImporter::openData() on a cache miss. The @p data
+         * don't need to stay in scope after the function returns.
+         */
+        Containers::Pointer<AbstractImporter> openData(Containers::Pointer<AbstractImporter>&& importer, Containers::ArrayView<const void> data);
+
+    private:
+        struct State;
+
+        MAGNUM_TRADE_LOCAL Containers::Pointer<AbstractImporter> open(Containers::Pointer<AbstractImporter>&& importer, const char* prefix, Containers::StringView filename, Containers::ArrayView<const void> data);
+
+        Containers::Pointer<State> _state;
+};
+
+}}
+
+#endif
@@ -30,6 +30,7 @@
 #include <algorithm> /* std::sort() */
 #include <Corrade/Containers/EnumSet.hpp>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
 
 #include "Magnum/Math/Vector4.h"
 #include "Magnum/Math/Matrix3.h"
@@ -326,6 +327,8 @@ MaterialData::MaterialData(const MaterialTypes types, Containers::Array<Material
 
     CORRADE_ASSERT(layerOffsets.back() == _data.size(),
         "Trade::MaterialData: last layer offset" << layerOffsets.back() << "too short for" << _data.size() << "attributes in total", );
+
+    createAttributeLookup();
 }
 
 MaterialData::MaterialData(const MaterialTypes types, const std::initializer_list<MaterialAttributeData> attributeData, const std::initializer_list<UnsignedInt> layerData, const void* const importerState): MaterialData{types, Implementation::initializerListToArrayWithDefaultDeleter(attributeData), Implementation::initializerListToArrayWithDefaultDeleter(layerData), importerState} {}
@@ -367,6 +370,52 @@ MaterialData::MaterialData(const MaterialTypes types, const DataFlags attributeD
     CORRADE_ASSERT(layerOffsets.back() == _data.size(),
         "Trade::MaterialData: last layer offset" << layerOffsets.back() << "too short for" << _data.size() << "attributes in total", );
     #endif
+
+    createAttributeLookup();
+}
+
+void MaterialData::createAttributeLookup() {
+    /* Names of all known attributes, sorted the same way as attributes in
+       each layer are, so the table can be filled by merging the two sorted
+       ranges instead of doing a binary search for each attribute */
+    static const struct SortedAttributeNames {
+        explicit SortedAttributeNames() {
+            for(UnsignedByte i = 0; i != Containers::arraySize(AttributeMap); ++i)
+                names[i] = {AttributeMap[i].name, i};
+            std::sort(names, names + Containers::arraySize(AttributeMap), [](const Containers::Pair<Containers::StringView, UnsignedByte>& a, const Containers::Pair<Containers::StringView, UnsignedByte>& b) {
+                return a.first() < b.first();
+            });
+        }
+
+        Containers::Pair<Containers::StringView, UnsignedByte> names[Containers::arraySize(AttributeMap)];
+    } sortedAttributeNames;
+    static_assert(Containers::arraySize(AttributeMap) < 256,
+        "attribute indices don't fit into a byte");
+
+    /* IDs are stored offset by one in a byte, if there's a layer that has
+       more attributes than that, don't create the table at all */
+    const UnsignedInt layerCount = this->layerCount();
+    for(UnsignedInt layer = 0; layer != layerCount; ++layer)
+        if(attributeCount(layer) > 255) return;
+
+    _attributeLookup = Containers::Array<UnsignedByte>{ValueInit, layerCount*Containers::arraySize(AttributeMap)};
+    for(UnsignedInt layer = 0; layer != layerCount; ++layer) {
+        const UnsignedInt begin = layerOffset(layer);
+        const UnsignedInt end = begin + attributeCount(layer);
+        UnsignedByte* const lookup = _attributeLookup.data() + layer*Containers::arraySize(AttributeMap);
+        const Containers::Pair<Containers::StringView, UnsignedByte>* names = sortedAttributeNames.names;
+        const Containers::Pair<Containers::StringView, UnsignedByte>* const namesEnd = names + Containers::arraySize(AttributeMap);
+        for(UnsignedInt i = begin; i != end && names != namesEnd; ) {
+            const Containers::StringView name = _data[i].name();
+            if(name < names->first()) ++i;
+            else if(names->first() < name) ++names;
+            else {
+                lookup[names->second()] = i - begin + 1;
+                ++i;
+                ++names;
+            }
+        }
+    }
 }
 
 MaterialData::MaterialData(MaterialData&&) noexcept = default;
@@ -640,6 +689,13 @@ UnsignedInt MaterialData::findAttributeIdInternal(const UnsignedInt layer, const
     return found - begin;
 }
 
+UnsignedInt MaterialData::findAttributeIdInternal(const UnsignedInt layer, const MaterialAttribute name) const {
+    if(_attributeLookup)
+        /* A zero, meaning not found, wraps around to ~UnsignedInt{} */
+        return UnsignedInt(_attributeLookup[layer*Containers::arraySize(AttributeMap) + UnsignedInt(name) - 1]) - 1;
+    return findAttributeIdInternal(layer, Implementation::materialAttributeNameInternal(name));
+}
+
 bool MaterialData::hasAttribute(const UnsignedInt layer, const Containers::StringView name) const {
     CORRADE_ASSERT(layer < layerCount(),
         "Trade::MaterialData::hasAttribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
@@ -647,9 +703,11 @@ bool MaterialData::hasAttribute(const UnsignedInt layer, const Containers::Strin
 }
 
 bool MaterialData::hasAttribute(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::hasAttribute(): invalid name" << name, {});
-    return hasAttribute(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::hasAttribute(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::hasAttribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    return findAttributeIdInternal(layer, name) != ~UnsignedInt{};
 }
 
 bool MaterialData::hasAttribute(const Containers::StringView layer, const Containers::StringView name) const {
@@ -685,9 +743,12 @@ Containers::Optional<UnsignedInt> MaterialData::findAttributeId(const UnsignedIn
 }
 
 Containers::Optional<UnsignedInt> MaterialData::findAttributeId(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::findAttributeId(): invalid name" << name, {});
-    return findAttributeId(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::findAttributeId(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::findAttributeId(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    return id == ~UnsignedInt{} ? Containers::Optional<UnsignedInt>{} : id;
 }
 
 Containers::Optional<UnsignedInt> MaterialData::findAttributeId(const Containers::StringView layer, const Containers::StringView name) const {
@@ -734,9 +795,14 @@ UnsignedInt MaterialData::attributeId(const UnsignedInt layer, const Containers:
 }
 
 UnsignedInt MaterialData::attributeId(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::attributeId(): invalid name" << name, {});
-    return attributeId(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::attributeId(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::attributeId(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::MaterialData::attributeId(): attribute" << Implementation::materialAttributeNameInternal(name) << "not found in layer" << layer, {});
+    return id;
 }
 
 UnsignedInt MaterialData::attributeId(const Containers::StringView layer, const Containers::StringView name) const {
@@ -816,9 +882,14 @@ MaterialAttributeType MaterialData::attributeType(const UnsignedInt layer, const
 }
 
 MaterialAttributeType MaterialData::attributeType(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::attributeType(): invalid name" << name, {});
-    return attributeType(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::attributeType(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::attributeType(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::MaterialData::attributeType(): attribute" << Implementation::materialAttributeNameInternal(name) << "not found in layer" << layer, {});
+    return _data[layerOffset(layer) + id]._data.type;
 }
 
 MaterialAttributeType MaterialData::attributeType(const Containers::StringView layer, const UnsignedInt id) const {
@@ -903,15 +974,27 @@ void* MaterialData::mutableAttribute(const UnsignedInt layer, const Containers::
 }
 
 const void* MaterialData::attribute(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::attribute(): invalid name" << name, {});
-    return attribute(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::attribute(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::attribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::MaterialData::attribute(): attribute" << Implementation::materialAttributeNameInternal(name) << "not found in layer" << layer, {});
+    return _data[layerOffset(layer) + id].value();
 }
 
 void* MaterialData::mutableAttribute(const UnsignedInt layer, const MaterialAttribute name) {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::mutableAttribute(): invalid name" << name, {});
-    return mutableAttribute(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::mutableAttribute(): invalid name" << name, {});
+    CORRADE_ASSERT(_attributeDataFlags & DataFlag::Mutable,
+        "Trade::MaterialData::mutableAttribute(): attribute data not mutable", {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::mutableAttribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::MaterialData::mutableAttribute(): attribute" << Implementation::materialAttributeNameInternal(name) << "not found in layer" << layer, {});
+    return const_cast<void*>(_data[layerOffset(layer) + id].value());
 }
 
 const void* MaterialData::attribute(const Containers::StringView layer, const UnsignedInt id) const {
@@ -1084,9 +1167,14 @@ const void* MaterialData::findAttribute(const UnsignedInt layer, const Container
 }
 
 const void* MaterialData::findAttribute(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string, "Trade::MaterialData::findAttribute(): invalid name" << name, {});
-    return findAttribute(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name),
+        "Trade::MaterialData::findAttribute(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::findAttribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    if(id == ~UnsignedInt{})
+        return nullptr;
+    return _data[layerOffset(layer) + id].value();
 }
 
 const void* MaterialData::findAttribute(const Containers::StringView layer, const Containers::StringView name) const {
@@ -1145,10 +1233,12 @@ Float MaterialData::alphaMask() const {
 }
 
 Containers::Array<UnsignedInt> MaterialData::releaseLayerData() {
+    _attributeLookup = nullptr;
     return Utility::move(_layerOffsets);
 }
 
 Containers::Array<MaterialAttributeData> MaterialData::releaseAttributeData() {
+    _attributeLookup = nullptr;
     return Utility::move(_data);
 }
 
@@ -2006,6 +2006,16 @@ half-float types. Conversely, @ref Magnum::Double "Double" types are currently
 not supported either as there isn't currently seen any need for extended
 precision.
 
+Lookup of attributes by a string name is a binary search in the sorted array.
+Additionally, on construction the class creates a lookup table mapping each
+@ref MaterialAttribute to its ID in every layer, which makes queries by a
+@ref MaterialAttribute with a numeric layer ID or on the base material a
+constant-time operation without any string comparisons. The table takes a byte
+per @ref MaterialAttribute per layer. It's not created for layers with more
+than 255 attributes, and it's discarded by @ref releaseLayerData() and
+@ref releaseAttributeData(), in which case the queries fall back to a binary
+search.
+
 @m_class{m-block m-warning}
 
 @par Max representable data size
@@ -3466,9 +3476,17 @@ class MAGNUM_TRADE_EXPORT MaterialData {
             return layer && _layerOffsets ? _layerOffsets[layer - 1] : 0;
         }
         UnsignedInt findAttributeIdInternal(UnsignedInt layer, Containers::StringView name) const;
+        /* Uses _attributeLookup if present, the name is expected to be
+           valid */
+        UnsignedInt findAttributeIdInternal(UnsignedInt layer, MaterialAttribute name) const;
+        MAGNUM_TRADE_LOCAL void createAttributeLookup();
 
         Containers::Array<MaterialAttributeData> _data;
         Containers::Array<UnsignedInt> _layerOffsets;
+        /* For each layer and each MaterialAttribute, the attribute ID plus
+           one, or 0 if not present. Empty if not created, in which case
+           lookups fall back to a binary search by name. */
+        Containers::Array<UnsignedByte> _attributeLookup;
         MaterialTypes _types;
         DataFlags _attributeDataFlags, _layerDataFlags;
         /* 2 bytes free */
@@ -3661,15 +3679,25 @@ template<class T> typename std::conditional<std::is_same<T, Containers::MutableS
 }
 
 template<class T> T MaterialData::attribute(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string.data(), "Trade::MaterialData::attribute(): invalid name" << name, {});
-    return attribute<T>(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name).data(),
+        "Trade::MaterialData::attribute(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::attribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::MaterialData::attribute(): attribute" << Implementation::materialAttributeNameInternal(name) << "not found in layer" << layer, {});
+    return attribute<T>(layer, id);
 }
 
 template<class T> typename std::conditional<std::is_same<T, Containers::MutableStringView>::value || std::is_same<T, Containers::ArrayView<void>>::value, T, T&>::type MaterialData::mutableAttribute(const UnsignedInt layer, const MaterialAttribute name) {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string.data(), "Trade::MaterialData::mutableAttribute(): invalid name" << name, *reinterpret_cast<T*>(this));
-    return mutableAttribute<T>(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name).data(),
+        "Trade::MaterialData::mutableAttribute(): invalid name" << name, *reinterpret_cast<T*>(this));
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::mutableAttribute(): index" << layer << "out of range for" << layerCount() << "layers", *reinterpret_cast<T*>(this));
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    CORRADE_ASSERT(id != ~UnsignedInt{},
+        "Trade::MaterialData::mutableAttribute(): attribute" << Implementation::materialAttributeNameInternal(name) << "not found in layer" << layer, *reinterpret_cast<T*>(this));
+    return mutableAttribute<T>(layer, id);
 }
 
 template<class T> T MaterialData::attribute(const Containers::StringView layer, const UnsignedInt id) const {
@@ -3768,9 +3796,14 @@ template<class T> Containers::Optional<T> MaterialData::findAttribute(const Unsi
 }
 
 template<class T> Containers::Optional<T> MaterialData::findAttribute(const UnsignedInt layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string.data(), "Trade::MaterialData::findAttribute(): invalid name" << name, {});
-    return findAttribute<T>(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name).data(),
+        "Trade::MaterialData::findAttribute(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::findAttribute(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    if(id == ~UnsignedInt{})
+        return {};
+    return attribute<T>(layer, id);
 }
 
 template<class T> Containers::Optional<T> MaterialData::findAttribute(const Containers::StringView layer, const Containers::StringView name) const {
@@ -3781,9 +3814,12 @@ template<class T> Containers::Optional<T> MaterialData::findAttribute(const Cont
 }
 
 template<class T> Containers::Optional<T> MaterialData::findAttribute(const Containers::StringView layer, const MaterialAttribute name) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string.data(), "Trade::MaterialData::findAttribute(): invalid name" << name, {});
-    return findAttribute<T>(layer, string);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name).data(),
+        "Trade::MaterialData::findAttribute(): invalid name" << name, {});
+    const UnsignedInt layerId = findLayerIdInternal(layer);
+    CORRADE_ASSERT(layerId != ~UnsignedInt{},
+        "Trade::MaterialData::findAttribute(): layer" << layer << "not found", {});
+    return findAttribute<T>(layerId, name);
 }
 
 template<class T> Containers::Optional<T> MaterialData::findAttribute(const MaterialLayer layer, const Containers::StringView name) const {
@@ -3808,9 +3844,14 @@ template<class T> T MaterialData::attributeOr(const UnsignedInt layer, const Con
 }
 
 template<class T> T MaterialData::attributeOr(const UnsignedInt layer, const MaterialAttribute name, const T& defaultValue) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string.data(), "Trade::MaterialData::attributeOr(): invalid name" << name, {});
-    return attributeOr<T>(layer, string, defaultValue);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name).data(),
+        "Trade::MaterialData::attributeOr(): invalid name" << name, {});
+    CORRADE_ASSERT(layer < layerCount(),
+        "Trade::MaterialData::attributeOr(): index" << layer << "out of range for" << layerCount() << "layers", {});
+    const UnsignedInt id = findAttributeIdInternal(layer, name);
+    if(id == ~UnsignedInt{})
+        return defaultValue;
+    return attribute<T>(layer, id);
 }
 
 template<class T> T MaterialData::attributeOr(const Containers::StringView layer, const Containers::StringView name, const T& defaultValue) const {
@@ -3821,9 +3862,12 @@ template<class T> T MaterialData::attributeOr(const Containers::StringView layer
 }
 
 template<class T> T MaterialData::attributeOr(const Containers::StringView layer, const MaterialAttribute name, const T& defaultValue) const {
-    const Containers::StringView string = Implementation::materialAttributeNameInternal(name);
-    CORRADE_ASSERT(string.data(), "Trade::MaterialData::attributeOr(): invalid name" << name, {});
-    return attributeOr<T>(layer, string, defaultValue);
+    CORRADE_ASSERT(Implementation::materialAttributeNameInternal(name).data(),
+        "Trade::MaterialData::attributeOr(): invalid name" << name, {});
+    const UnsignedInt layerId = findLayerIdInternal(layer);
+    CORRADE_ASSERT(layerId != ~UnsignedInt{},
+        "Trade::MaterialData::attributeOr(): layer" << layer << "not found", {});
+    return attributeOr<T>(layerId, name, defaultValue);
 }
 
 template<class T> T MaterialData::attributeOr(const MaterialLayer layer, const Containers::StringView name, const T& defaultValue) const {
@@ -2322,6 +2322,8 @@ class MAGNUM_TRADE_EXPORT MeshData {
            implementations. */
         friend AbstractImporter;
         friend AbstractSceneConverter;
+        /* For replacing the data arrays in relocate() */
+        friend AbstractAllocator;
 
         /* Internal helper without the extra overhead from Optional, returns
            ~UnsignedInt{} on failure */
@@ -0,0 +1,329 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <cstdlib>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractAllocator.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MeshData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct AbstractAllocatorTest: TestSuite::Tester {
+    explicit AbstractAllocatorTest();
+
+    void constructCopy();
+    void constructMove();
+
+    void allocate();
+    void allocateEmpty();
+    void allocateMisaligned();
+
+    void relocateMesh();
+    void relocateMeshOffsetOnly();
+    void relocateMeshNonOwned();
+    void relocateMeshAlreadyRelocated();
+    void relocateImage();
+    void relocateImageNonOwned();
+};
+
+/* Heap allocator that records what it was called with */
+struct Allocator: AbstractAllocator {
+    void* doAllocate(std::size_t size) override {
+        ++allocated;
+        lastSize = size;
+        /* Over-allocate to be able to test misaligned output */
+        char* out = static_cast<char*>(std::malloc(size + Alignment*2));
+        memory = out;
+        out = reinterpret_cast<char*>((reinterpret_cast<std::uintptr_t>(out) + Alignment - 1)/Alignment*Alignment);
+        return misaligned ? out + 1 : out;
+    }
+
+    void doDeallocate(void* data, std::size_t size) override {
+        ++deallocated;
+        CORRADE_COMPARE(size, lastSize);
+        CORRADE_VERIFY(data);
+        std::free(memory);
+    }
+
+    bool misaligned = false;
+    std::size_t allocated = 0, deallocated = 0, lastSize = 0;
+    /* Supports just one live allocation at a time, enough for the tests */
+    char* memory = nullptr;
+};
+
+AbstractAllocatorTest::AbstractAllocatorTest() {
+    addTests({&AbstractAllocatorTest::constructCopy,
+              &AbstractAllocatorTest::constructMove,
+
+              &AbstractAllocatorTest::allocate,
+              &AbstractAllocatorTest::allocateEmpty,
+              &AbstractAllocatorTest::allocateMisaligned,
+
+              &AbstractAllocatorTest::relocateMesh,
+              &AbstractAllocatorTest::relocateMeshOffsetOnly,
+              &AbstractAllocatorTest::relocateMeshNonOwned,
+              &AbstractAllocatorTest::relocateMeshAlreadyRelocated,
+              &AbstractAllocatorTest::relocateImage,
+              &AbstractAllocatorTest::relocateImageNonOwned});
+}
+
+void AbstractAllocatorTest::constructCopy() {
+    CORRADE_VERIFY(!std::is_copy_constructible<AbstractAllocator>{});
+    CORRADE_VERIFY(!std::is_copy_assignable<AbstractAllocator>{});
+}
+
+void AbstractAllocatorTest::constructMove() {
+    CORRADE_VERIFY(!std::is_move_constructible<AbstractAllocator>{});
+    CORRADE_VERIFY(!std::is_move_assignable<AbstractAllocator>{});
+}
+
+void AbstractAllocatorTest::allocate() {
+    Allocator allocator;
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 0);
+    CORRADE_COMPARE(allocator.allocatedSize(), 0);
+    CORRADE_COMPARE(allocator.peakAllocatedSize(), 0);
+
+    {
+        Containers::Array<char> a = allocator.allocate(37);
+        CORRADE_COMPARE(a.size(), 37);
+        CORRADE_VERIFY(a.deleter() == AbstractAllocator::deleter);
+        CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a.data()) % AbstractAllocator::Alignment, 0);
+        CORRADE_COMPARE(allocator.allocated, 1);
+        CORRADE_COMPARE(allocator.lastSize, 37 + AbstractAllocator::HeaderSize);
+        CORRADE_COMPARE(allocator.allocationCount(), 1);
+        CORRADE_COMPARE(allocator.liveAllocationCount(), 1);
+        CORRADE_COMPARE(allocator.allocatedSize(), 37);
+        CORRADE_COMPARE(allocator.peakAllocatedSize(), 37);
+
+        /* The memory is usable */
+        for(char& i: a) i = 'x';
+    }
+
+    CORRADE_COMPARE(allocator.deallocated, 1);
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 0);
+    CORRADE_COMPARE(allocator.allocatedSize(), 0);
+    CORRADE_COMPARE(allocator.peakAllocatedSize(), 37);
+
+    {
+        Containers::Array<char> a = allocator.allocate(12);
+        CORRADE_COMPARE(allocator.allocationCount(), 2);
+        CORRADE_COMPARE(allocator.liveAllocationCount(), 1);
+        CORRADE_COMPARE(allocator.allocatedSize(), 12);
+        CORRADE_COMPARE(allocator.peakAllocatedSize(), 37);
+    }
+}
+
+void AbstractAllocatorTest::allocateEmpty() {
+    Allocator allocator;
+
+    Containers::Array<char> a = allocator.allocate(0);
+    CORRADE_VERIFY(!a.data());
+    CORRADE_COMPARE(a.size(), 0);
+    CORRADE_COMPARE(allocator.allocated, 0);
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+}
+
+void AbstractAllocatorTest::allocateMisaligned() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Allocator allocator;
+    allocator.misaligned = true;
+
+    Containers::String out;
+    Error redirectError{&out};
+    allocator.allocate(16);
+    CORRADE_COMPARE(out, "Trade::AbstractAllocator::allocate(): implementation returned a pointer not aligned to 16 bytes\n");
+
+    /* The returned pointer wasn't wrapped in an array, so free it here */
+    std::free(allocator.memory);
+}
+
+struct Vertex {
+    Vector3 position;
+    UnsignedInt id;
+};
+
+void AbstractAllocatorTest::relocateMesh() {
+    Containers::Array<char> indexData{NoInit, 3*sizeof(UnsignedShort)};
+    Containers::ArrayView<UnsignedShort> indices = Containers::arrayCast<UnsignedShort>(indexData);
+    Utility::copy({2, 0, 1}, indices);
+
+    Containers::Array<char> vertexData{NoInit, 3*sizeof(Vertex)};
+    Containers::StridedArrayView1D<Vertex> vertices = Containers::arrayCast<Vertex>(vertexData);
+    Utility::copy({
+        {{1.0f, 2.0f, 3.0f}, 15},
+        {{4.0f, 5.0f, 6.0f}, 26},
+        {{7.0f, 8.0f, 9.0f}, 37},
+    }, vertices);
+
+    int state;
+    MeshData mesh{MeshPrimitive::Triangles,
+        Utility::move(indexData), MeshIndexData{indices},
+        Utility::move(vertexData), {
+            MeshAttributeData{MeshAttribute::Position, vertices.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::ObjectId, vertices.slice(&Vertex::id)},
+        }, MeshData::ImplicitVertexCount, &state};
+    const void* originalVertexData = mesh.vertexData().data();
+
+    Allocator allocator;
+    allocator.relocate(mesh);
+    CORRADE_COMPARE(allocator.allocationCount(), 2);
+    CORRADE_COMPARE(allocator.allocatedSize(), 3*sizeof(UnsignedShort) + 3*sizeof(Vertex));
+
+    /* Everything stays the same except for the data location */
+    CORRADE_COMPARE(mesh.primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(mesh.importerState(), &state);
+    CORRADE_COMPARE(mesh.indexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE(mesh.vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_VERIFY(mesh.vertexData().data() != originalVertexData);
+    CORRADE_COMPARE(mesh.indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(mesh.indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({2, 0, 1}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh.attributeCount(), 2);
+    CORRADE_COMPARE(mesh.attributeStride(MeshAttribute::Position), sizeof(Vertex));
+    CORRADE_COMPARE(mesh.attributeOffset(MeshAttribute::ObjectId), sizeof(Vector3));
+    CORRADE_COMPARE_AS(mesh.attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f},
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh.attribute<UnsignedInt>(MeshAttribute::ObjectId),
+        Containers::arrayView<UnsignedInt>({15, 26, 37}),
+        TestSuite::Compare::Container);
+
+    /* Both arrays come from the allocator now */
+    Containers::Array<char> releasedIndexData = mesh.releaseIndexData();
+    Containers::Array<char> releasedVertexData = mesh.releaseVertexData();
+    CORRADE_VERIFY(releasedIndexData.deleter() == AbstractAllocator::deleter);
+    CORRADE_VERIFY(releasedVertexData.deleter() == AbstractAllocator::deleter);
+}
+
+void AbstractAllocatorTest::relocateMeshOffsetOnly() {
+    Containers::Array<char> vertexData{NoInit, 2*sizeof(Vertex)};
+    Utility::copy(Containers::arrayCast<const char>(Containers::arrayView<Vertex>({
+        {{1.0f, 2.0f, 3.0f}, 15},
+        {{4.0f, 5.0f, 6.0f}, 26},
+    })), vertexData);
+
+    MeshData mesh{MeshPrimitive::Points, Utility::move(vertexData), {
+        MeshAttributeData{MeshAttribute::ObjectId, VertexFormat::UnsignedInt, offsetof(Vertex, id), 2, sizeof(Vertex)},
+    }};
+
+    Allocator allocator;
+    allocator.relocate(mesh);
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_VERIFY(mesh.attributeData()[0].isOffsetOnly());
+    CORRADE_COMPARE_AS(mesh.attribute<UnsignedInt>(MeshAttribute::ObjectId),
+        Containers::arrayView<UnsignedInt>({15, 26}),
+        TestSuite::Compare::Container);
+}
+
+void AbstractAllocatorTest::relocateMeshNonOwned() {
+    const UnsignedShort indices[]{2, 0, 1};
+    const Vector3 positions[]{
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, 6.0f},
+        {7.0f, 8.0f, 9.0f},
+    };
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{indices},
+        {}, positions, {
+            MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+        }};
+
+    Allocator allocator;
+    allocator.relocate(mesh);
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(mesh.indexData().data(), static_cast<const void*>(indices));
+    CORRADE_COMPARE(mesh.vertexData().data(), static_cast<const void*>(positions));
+    CORRADE_COMPARE(mesh.indexDataFlags(), DataFlags{});
+    CORRADE_COMPARE(mesh.vertexDataFlags(), DataFlags{});
+}
+
+void AbstractAllocatorTest::relocateMeshAlreadyRelocated() {
+    Allocator allocator;
+
+    Containers::Array<char> vertexData = allocator.allocate(sizeof(Vector3));
+    Containers::ArrayView<Vector3> positions = Containers::arrayCast<Vector3>(vertexData);
+    positions[0] = {1.0f, 2.0f, 3.0f};
+    MeshData mesh{MeshPrimitive::Points, Utility::move(vertexData), {
+        MeshAttributeData{MeshAttribute::Position, positions}
+    }};
+
+    /* The data are already from this allocator, so no new allocation */
+    allocator.relocate(mesh);
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_COMPARE(mesh.vertexData().data(), static_cast<const void*>(positions.data()));
+}
+
+void AbstractAllocatorTest::relocateImage() {
+    Containers::Array<char> data{NoInit, 8};
+    Utility::copy(Containers::arrayView("abcdefgh").exceptSuffix(1), data);
+
+    int state;
+    ImageData2D image{PixelStorage{}.setAlignment(1), PixelFormat::RG8Unorm, {1, 4}, Utility::move(data), ImageFlag2D::Array, &state};
+
+    Allocator allocator;
+    allocator.relocate(image);
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_COMPARE(allocator.allocatedSize(), 8);
+    CORRADE_COMPARE(image.storage().alignment(), 1);
+    CORRADE_COMPARE(image.format(), PixelFormat::RG8Unorm);
+    CORRADE_COMPARE(image.size(), (Vector2i{1, 4}));
+    CORRADE_COMPARE(image.flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE(image.importerState(), &state);
+    CORRADE_COMPARE(image.dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE_AS(Containers::arrayCast<const char>(image.data()),
+        Containers::arrayView("abcdefgh").exceptSuffix(1),
+        TestSuite::Compare::Container);
+    CORRADE_VERIFY(image.release().deleter() == AbstractAllocator::deleter);
+}
+
+void AbstractAllocatorTest::relocateImageNonOwned() {
+    const char data[8]{};
+    ImageData2D image{PixelFormat::RG8Unorm, {2, 2}, DataFlags{}, data};
+
+    Allocator allocator;
+    allocator.relocate(image);
+    CORRADE_COMPARE(allocator.allocationCount(), 0);
+    CORRADE_COMPARE(image.data().data(), static_cast<const void*>(data));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AbstractAllocatorTest)
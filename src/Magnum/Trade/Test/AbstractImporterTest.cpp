@@ -33,6 +33,7 @@
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/Numeric.h>
 #include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/PixelFormat.h"
@@ -41,6 +42,7 @@
 #include "Magnum/Math/Matrix4.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ArenaAllocator.h"
 #include "Magnum/Trade/ArrayAllocator.h"
 #include "Magnum/Trade/CameraData.h"
 #include "Magnum/Trade/ImageData.h"
@@ -264,6 +266,7 @@ struct AbstractImporterTest: TestSuite::Tester {
     void skin3DCustomInverseBindMatrixDataDeleter();
 
     void mesh();
+    void meshAllocator();
     void meshFailed();
     #ifdef MAGNUM_BUILD_DEPRECATED
     void meshDeprecatedFallback();
@@ -356,6 +359,8 @@ struct AbstractImporterTest: TestSuite::Tester {
     void image1DCustomDeleter();
 
     void image2D();
+    void image2DAllocator();
+    void image2DAllocatorFromImplementation();
     void image2DFailed();
     void image2DLevelCountNotImplemented();
     void image2DLevelCountOutOfRange();
@@ -641,6 +646,7 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::skin3DCustomInverseBindMatrixDataDeleter,
 
               &AbstractImporterTest::mesh,
+              &AbstractImporterTest::meshAllocator,
               &AbstractImporterTest::meshFailed,
               #ifdef MAGNUM_BUILD_DEPRECATED
               &AbstractImporterTest::meshDeprecatedFallback,
@@ -733,6 +739,8 @@ AbstractImporterTest::AbstractImporterTest() {
               &AbstractImporterTest::image1DCustomDeleter,
 
               &AbstractImporterTest::image2D,
+              &AbstractImporterTest::image2DAllocator,
+              &AbstractImporterTest::image2DAllocatorFromImplementation,
               &AbstractImporterTest::image2DFailed,
               &AbstractImporterTest::image2DLevelCountNotImplemented,
               &AbstractImporterTest::image2DLevelCountOutOfRange,
@@ -5929,6 +5937,66 @@ void AbstractImporterTest::mesh() {
     }
 }
 
+void AbstractImporterTest::meshAllocator() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doMeshCount() const override { return 2; }
+        Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt) override {
+            /* Second mesh is non-owned, which should be left untouched */
+            if(id == 1)
+                return MeshData{MeshPrimitive::Points, {}, positions, {
+                    MeshAttributeData{MeshAttribute::Position, Containers::arrayView(positions)}
+                }};
+
+            Containers::Array<char> vertexData{NoInit, sizeof(positions)};
+            Utility::copy(Containers::arrayCast<const char>(Containers::arrayView(positions)), vertexData);
+            Containers::StridedArrayView1D<const Vector3> view = Containers::arrayCast<const Vector3>(vertexData);
+            return MeshData{MeshPrimitive::Points, Utility::move(vertexData), {
+                MeshAttributeData{MeshAttribute::Position, view}
+            }};
+        }
+
+        Vector3 positions[2]{{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}};
+    } importer;
+
+    ArenaAllocator allocator;
+    CORRADE_COMPARE(importer.allocator(), nullptr);
+    importer.setAllocator(&allocator);
+    CORRADE_COMPARE(importer.allocator(), &allocator);
+
+    {
+        Containers::Optional<MeshData> data = importer.mesh(0);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(allocator.liveAllocationCount(), 1);
+        CORRADE_COMPARE(allocator.allocatedSize(), 24);
+        CORRADE_COMPARE(data->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+        CORRADE_COMPARE_AS(data->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+            {1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}
+        }), TestSuite::Compare::Container);
+        CORRADE_VERIFY(data->releaseVertexData().deleter() == AbstractAllocator::deleter);
+    }
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 0);
+
+    {
+        Containers::Optional<MeshData> data = importer.mesh(1);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(allocator.allocationCount(), 1);
+        CORRADE_COMPARE(data->vertexData().data(), static_cast<const void*>(importer.positions));
+    }
+
+    /* Resetting goes back to the heap */
+    importer.setAllocator(nullptr);
+    CORRADE_COMPARE(importer.allocator(), nullptr);
+    {
+        Containers::Optional<MeshData> data = importer.mesh(0);
+        CORRADE_VERIFY(data);
+        CORRADE_COMPARE(allocator.allocationCount(), 1);
+    }
+}
+
 void AbstractImporterTest::meshFailed() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -7610,6 +7678,66 @@ void AbstractImporterTest::image2D() {
     }
 }
 
+void AbstractImporterTest::image2DAllocator() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            Containers::Array<char> data{NoInit, 8};
+            Utility::copy(Containers::arrayView("abcdefgh").exceptSuffix(1), data);
+            return ImageData2D{PixelFormat::RG8Unorm, {2, 2}, Utility::move(data)};
+        }
+    } importer;
+
+    ArenaAllocator allocator;
+    importer.setAllocator(&allocator);
+
+    {
+        Containers::Optional<ImageData2D> image = importer.image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(allocator.liveAllocationCount(), 1);
+        CORRADE_COMPARE(allocator.allocatedSize(), 8);
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+        CORRADE_COMPARE(image->size(), (Vector2i{2, 2}));
+        CORRADE_COMPARE_AS(Containers::StringView{image->data()}, "abcdefgh",
+            TestSuite::Compare::String);
+    }
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 0);
+}
+
+void AbstractImporterTest::image2DAllocatorFromImplementation() {
+    struct: AbstractImporter {
+        ImporterFeatures doFeatures() const override { return {}; }
+        bool doIsOpened() const override { return true; }
+        void doClose() override {}
+
+        UnsignedInt doImage2DCount() const override { return 1; }
+        Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+            Containers::Array<char> data = allocator()->allocate(8);
+            Utility::copy(Containers::arrayView("abcdefgh").exceptSuffix(1), data);
+            allocated = data.data();
+            return ImageData2D{PixelFormat::RG8Unorm, {2, 2}, Utility::move(data)};
+        }
+
+        const char* allocated{};
+    } importer;
+
+    ArenaAllocator allocator;
+    importer.setAllocator(&allocator);
+
+    /* The data is already from the allocator, so it shouldn't be copied again */
+    Containers::Optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(allocator.allocationCount(), 1);
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 1);
+    CORRADE_COMPARE(static_cast<const void*>(image->data().data()), importer.allocated);
+    CORRADE_COMPARE_AS(Containers::StringView{image->data()}, "abcdefgh",
+        TestSuite::Compare::String);
+}
+
 void AbstractImporterTest::image2DFailed() {
     struct: AbstractImporter {
         ImporterFeatures doFeatures() const override { return {}; }
@@ -0,0 +1,161 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstdint>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+
+#include "Magnum/Trade/ArenaAllocator.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ArenaAllocatorTest: TestSuite::Tester {
+    explicit ArenaAllocatorTest();
+
+    void construct();
+    void constructZeroBlockSize();
+
+    void allocate();
+    void allocateLargerThanBlock();
+    void reset();
+    void resetEmpty();
+    void resetLiveAllocations();
+};
+
+ArenaAllocatorTest::ArenaAllocatorTest() {
+    addTests({&ArenaAllocatorTest::construct,
+              &ArenaAllocatorTest::constructZeroBlockSize,
+
+              &ArenaAllocatorTest::allocate,
+              &ArenaAllocatorTest::allocateLargerThanBlock,
+              &ArenaAllocatorTest::reset,
+              &ArenaAllocatorTest::resetEmpty,
+              &ArenaAllocatorTest::resetLiveAllocations});
+}
+
+void ArenaAllocatorTest::construct() {
+    ArenaAllocator allocator{1024};
+    CORRADE_COMPARE(allocator.blockSize(), 1024);
+    CORRADE_COMPARE(allocator.blockCount(), 0);
+    CORRADE_COMPARE(allocator.capacity(), 0);
+}
+
+void ArenaAllocatorTest::constructZeroBlockSize() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    ArenaAllocator{0};
+    CORRADE_COMPARE(out, "Trade::ArenaAllocator: expected a non-zero block size\n");
+}
+
+void ArenaAllocatorTest::allocate() {
+    ArenaAllocator allocator{1024};
+
+    /* Header is 16 bytes, the sizes get rounded up to 16 bytes, so this is
+       48 bytes of the block */
+    Containers::Array<char> a = allocator.allocate(17);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+    CORRADE_COMPARE(allocator.capacity(), 1024);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(a.data()) % ArenaAllocator::Alignment, 0);
+
+    /* Next one goes right after */
+    Containers::Array<char> b = allocator.allocate(32);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+    CORRADE_COMPARE(b.data(), a.data() + 48);
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 2);
+    CORRADE_COMPARE(allocator.allocatedSize(), 49);
+
+    /* Destroying just updates the counters */
+    a = nullptr;
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 1);
+    CORRADE_COMPARE(allocator.allocatedSize(), 32);
+
+    /* This one doesn't fit anymore, so a new block is allocated */
+    Containers::Array<char> c = allocator.allocate(1000);
+    CORRADE_COMPARE(allocator.blockCount(), 2);
+    CORRADE_COMPARE(allocator.capacity(), 2048);
+    CORRADE_COMPARE(reinterpret_cast<std::uintptr_t>(c.data()) % ArenaAllocator::Alignment, 0);
+    CORRADE_COMPARE(allocator.allocationCount(), 3);
+}
+
+void ArenaAllocatorTest::allocateLargerThanBlock() {
+    ArenaAllocator allocator{64};
+
+    Containers::Array<char> a = allocator.allocate(200);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+    CORRADE_COMPARE(allocator.capacity(), 224);
+
+    /* The memory is usable */
+    for(char& i: a) i = 'x';
+}
+
+void ArenaAllocatorTest::reset() {
+    ArenaAllocator allocator{64};
+
+    const char* first;
+    {
+        Containers::Array<char> a = allocator.allocate(16);
+        Containers::Array<char> b = allocator.allocate(100);
+        Containers::Array<char> c = allocator.allocate(16);
+        first = a.data();
+        CORRADE_COMPARE(allocator.blockCount(), 3);
+    }
+
+    /* The first block is kept and reused */
+    allocator.reset();
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+    CORRADE_COMPARE(allocator.capacity(), 64);
+    CORRADE_COMPARE(allocator.allocationCount(), 3);
+    CORRADE_COMPARE(allocator.peakAllocatedSize(), 132);
+
+    Containers::Array<char> a = allocator.allocate(16);
+    CORRADE_COMPARE(a.data(), first);
+    CORRADE_COMPARE(allocator.blockCount(), 1);
+}
+
+void ArenaAllocatorTest::resetEmpty() {
+    ArenaAllocator allocator;
+    allocator.reset();
+    CORRADE_COMPARE(allocator.blockCount(), 0);
+}
+
+void ArenaAllocatorTest::resetLiveAllocations() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ArenaAllocator allocator;
+    Containers::Array<char> a = allocator.allocate(16);
+    Containers::Array<char> b = allocator.allocate(16);
+
+    Containers::String out;
+    Error redirectError{&out};
+    allocator.reset();
+    CORRADE_COMPARE(out, "Trade::ArenaAllocator::reset(): 2 allocations are still alive\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ArenaAllocatorTest)
@@ -0,0 +1,606 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/Numeric.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AsyncImporter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct AsyncImporterTest: TestSuite::Tester {
+    explicit AsyncImporterTest();
+
+    void construct();
+    void constructMultiple();
+    void constructNoImporters();
+    void constructNotOpened();
+
+    void take();
+    void takeMultipleWorkers();
+    void takeFailed();
+    void takeLevelOutOfRange();
+
+    void priority();
+    void setPriorityNotPending();
+    void cancel();
+    void cancelNotPending();
+    void release();
+    void releaseRunning();
+    void destructPending();
+
+    void requestOutOfRange();
+    void invalidTicket();
+    void takeWrongType();
+
+    void debugStatus();
+    void debugStatusPacked();
+};
+
+AsyncImporterTest::AsyncImporterTest() {
+    addTests({&AsyncImporterTest::construct,
+              &AsyncImporterTest::constructMultiple,
+              &AsyncImporterTest::constructNoImporters,
+              &AsyncImporterTest::constructNotOpened,
+
+              &AsyncImporterTest::take,
+              &AsyncImporterTest::takeMultipleWorkers,
+              &AsyncImporterTest::takeFailed,
+              &AsyncImporterTest::takeLevelOutOfRange,
+
+              &AsyncImporterTest::priority,
+              &AsyncImporterTest::setPriorityNotPending,
+              &AsyncImporterTest::cancel,
+              &AsyncImporterTest::cancelNotPending,
+              &AsyncImporterTest::release,
+              &AsyncImporterTest::releaseRunning,
+              &AsyncImporterTest::destructPending,
+
+              &AsyncImporterTest::requestOutOfRange,
+              &AsyncImporterTest::invalidTicket,
+              &AsyncImporterTest::takeWrongType,
+
+              &AsyncImporterTest::debugStatus,
+              &AsyncImporterTest::debugStatusPacked});
+}
+
+/* Shared between the test and the importers running on worker threads. While
+   the gate is closed, mesh imports block, which allows the tests to have
+   deterministic control over what's running and what's pending. */
+struct Shared {
+    void wait() {
+        std::unique_lock<std::mutex> lock{mutex};
+        condition.wait(lock, [&]{ return open; });
+    }
+
+    void setOpen(bool open) {
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            this->open = open;
+        }
+        condition.notify_all();
+    }
+
+    Containers::Array<UnsignedInt> log() {
+        std::lock_guard<std::mutex> lock{mutex};
+        Containers::Array<UnsignedInt> out{NoInit, meshes.size()};
+        Utility::copy(meshes, out);
+        return out;
+    }
+
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool open = true;
+    Containers::Array<UnsignedInt> meshes;
+};
+
+struct Importer: AbstractImporter {
+    explicit Importer(Shared& shared, bool opened = true): _shared(shared), _opened{opened} {}
+
+    ImporterFeatures doFeatures() const override { return {}; }
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+
+    UnsignedInt doSceneCount() const override { return 3; }
+    Containers::Optional<SceneData> doScene(UnsignedInt id) override {
+        return SceneData{SceneMappingType::UnsignedInt, id, nullptr, {}};
+    }
+
+    /* Mesh 3 fails to import, mesh 4 has two levels */
+    UnsignedInt doMeshCount() const override { return 5; }
+    UnsignedInt doMeshLevelCount(UnsignedInt id) override {
+        return id == 4 ? 2 : 1;
+    }
+    Containers::Optional<MeshData> doMesh(UnsignedInt id, UnsignedInt level) override {
+        {
+            std::lock_guard<std::mutex> lock{_shared.mutex};
+            arrayAppend(_shared.meshes, id);
+        }
+        _shared.wait();
+        if(id == 3) return {};
+        return MeshData{MeshPrimitive::Points, id*10 + level};
+    }
+
+    UnsignedInt doMaterialCount() const override { return 2; }
+    Containers::Optional<MaterialData> doMaterial(UnsignedInt) override {
+        return MaterialData{MaterialType::Phong, nullptr};
+    }
+
+    UnsignedInt doImage1DCount() const override { return 1; }
+    Containers::Optional<ImageData1D> doImage1D(UnsignedInt, UnsignedInt) override {
+        return ImageData1D{PixelFormat::RGBA8Unorm, Math::Vector<1, Int>{3}, Containers::Array<char>{ValueInit, 3*4}};
+    }
+
+    UnsignedInt doImage2DCount() const override { return 1; }
+    UnsignedInt doImage2DLevelCount(UnsignedInt) override { return 2; }
+    Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt level) override {
+        return ImageData2D{PixelFormat::RGBA8Unorm, {2 - Int(level), 1}, Containers::Array<char>{ValueInit, std::size_t(2 - level)*4}};
+    }
+
+    UnsignedInt doImage3DCount() const override { return 1; }
+    Containers::Optional<ImageData3D> doImage3D(UnsignedInt, UnsignedInt) override {
+        return ImageData3D{PixelFormat::RGBA8Unorm, {1, 1, 2}, Containers::Array<char>{ValueInit, 2*4}};
+    }
+
+    private:
+        Shared& _shared;
+        bool _opened;
+};
+
+void waitUntilNotPending(const AsyncImporter& importer, AsyncImporter::Ticket ticket) {
+    while(importer.status(ticket) == AsyncImportStatus::Pending)
+        std::this_thread::yield();
+}
+
+void AsyncImporterTest::construct() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+    CORRADE_COMPARE(importer.workerCount(), 1);
+    CORRADE_COMPARE(importer.activeCount(), 0);
+}
+
+void AsyncImporterTest::constructMultiple() {
+    Shared shared;
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    arrayAppend(importers, Containers::pointer<Importer>(shared));
+    arrayAppend(importers, Containers::pointer<Importer>(shared));
+    arrayAppend(importers, Containers::pointer<Importer>(shared));
+
+    AsyncImporter importer{Utility::move(importers)};
+    CORRADE_COMPARE(importer.workerCount(), 3);
+    CORRADE_COMPARE(importer.activeCount(), 0);
+}
+
+void AsyncImporterTest::constructNoImporters() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Containers::String out;
+    Error redirectError{&out};
+    AsyncImporter{Containers::Array<Containers::Pointer<AbstractImporter>>{}};
+    CORRADE_COMPARE(out, "Trade::AsyncImporter: expected at least one importer\n");
+}
+
+void AsyncImporterTest::constructNotOpened() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Shared shared;
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    arrayAppend(importers, Containers::pointer<Importer>(shared));
+    arrayAppend(importers, Containers::pointer<Importer>(shared, false));
+
+    Containers::String out;
+    Error redirectError{&out};
+    AsyncImporter{Utility::move(importers)};
+    CORRADE_COMPARE(out, "Trade::AsyncImporter: importer 1 is not opened\n");
+}
+
+void AsyncImporterTest::take() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    AsyncImporter::Ticket scene = importer.requestScene(2);
+    AsyncImporter::Ticket mesh = importer.requestMesh(4, 1);
+    AsyncImporter::Ticket material = importer.requestMaterial(1);
+    AsyncImporter::Ticket image1D = importer.requestImage1D(0);
+    AsyncImporter::Ticket image2D = importer.requestImage2D(0, 1);
+    AsyncImporter::Ticket image3D = importer.requestImage3D(0);
+
+    /* The first ticket isn't zero, as that's reserved for failed requests */
+    CORRADE_VERIFY(scene);
+
+    /* All tickets are different */
+    CORRADE_VERIFY(scene != mesh);
+    CORRADE_VERIFY(mesh != material);
+    CORRADE_VERIFY(material != image1D);
+    CORRADE_VERIFY(image1D != image2D);
+    CORRADE_VERIFY(image2D != image3D);
+
+    CORRADE_COMPARE(importer.wait(image3D), AsyncImportStatus::Finished);
+    CORRADE_COMPARE(importer.status(image3D), AsyncImportStatus::Finished);
+
+    Containers::Optional<SceneData> sceneData = importer.takeScene(scene);
+    CORRADE_VERIFY(sceneData);
+    CORRADE_COMPARE(sceneData->mappingBound(), 2);
+
+    Containers::Optional<MeshData> meshData = importer.takeMesh(mesh);
+    CORRADE_VERIFY(meshData);
+    CORRADE_COMPARE(meshData->vertexCount(), 41);
+
+    Containers::Optional<MaterialData> materialData = importer.takeMaterial(material);
+    CORRADE_VERIFY(materialData);
+    CORRADE_COMPARE(materialData->types(), MaterialTypes{MaterialType::Phong});
+
+    Containers::Optional<ImageData1D> image1DData = importer.takeImage1D(image1D);
+    CORRADE_VERIFY(image1DData);
+    CORRADE_COMPARE(image1DData->size(), Math::Vector<1, Int>{3});
+
+    Containers::Optional<ImageData2D> image2DData = importer.takeImage2D(image2D);
+    CORRADE_VERIFY(image2DData);
+    CORRADE_COMPARE(image2DData->size(), (Vector2i{1, 1}));
+
+    Containers::Optional<ImageData3D> image3DData = importer.takeImage3D(image3D);
+    CORRADE_VERIFY(image3DData);
+    CORRADE_COMPARE(image3DData->size(), (Vector3i{1, 1, 2}));
+
+    CORRADE_COMPARE(importer.activeCount(), 0);
+}
+
+void AsyncImporterTest::takeMultipleWorkers() {
+    Shared shared;
+    Containers::Array<Containers::Pointer<AbstractImporter>> importers;
+    for(std::size_t i = 0; i != 4; ++i)
+        arrayAppend(importers, Containers::pointer<Importer>(shared));
+    AsyncImporter importer{Utility::move(importers)};
+
+    /* Meshes 0, 1, 2, 4 repeated a few times */
+    Containers::Array<AsyncImporter::Ticket> tickets;
+    for(std::size_t i = 0; i != 32; ++i)
+        arrayAppend(tickets, importer.requestMesh(i % 4 == 3 ? 4 : i % 4));
+
+    for(std::size_t i = 0; i != tickets.size(); ++i) {
+        CORRADE_ITERATION(i);
+        Containers::Optional<MeshData> mesh = importer.takeMesh(tickets[i]);
+        CORRADE_VERIFY(mesh);
+        CORRADE_COMPARE(mesh->vertexCount(), i % 4 == 3 ? 40 : UnsignedInt(i % 4)*10);
+    }
+
+    CORRADE_COMPARE(shared.log().size(), 32);
+    CORRADE_COMPARE(importer.activeCount(), 0);
+}
+
+void AsyncImporterTest::takeFailed() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    AsyncImporter::Ticket ticket = importer.requestMesh(3);
+    CORRADE_COMPARE(importer.wait(ticket), AsyncImportStatus::Failed);
+    CORRADE_VERIFY(!importer.takeMesh(ticket));
+}
+
+void AsyncImporterTest::takeLevelOutOfRange() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    /* The message is printed from the worker thread, which has its own error
+       output, so it's not checked here */
+    AsyncImporter::Ticket mesh = importer.requestMesh(2, 1);
+    AsyncImporter::Ticket image = importer.requestImage2D(0, 2);
+    CORRADE_VERIFY(!importer.takeMesh(mesh));
+    CORRADE_VERIFY(!importer.takeImage2D(image));
+
+    /* The mesh wasn't even attempted to be imported */
+    CORRADE_COMPARE(shared.log().size(), 0);
+}
+
+void AsyncImporterTest::priority() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    /* Block the only worker on the first request so the rest is queued */
+    shared.setOpen(false);
+    AsyncImporter::Ticket first = importer.requestMesh(0);
+    waitUntilNotPending(importer, first);
+    CORRADE_COMPARE(importer.status(first), AsyncImportStatus::Running);
+
+    AsyncImporter::Ticket low = importer.requestMesh(1, 0, -5);
+    AsyncImporter::Ticket a = importer.requestMesh(2, 0, 3);
+    AsyncImporter::Ticket b = importer.requestMesh(4, 0, 3);
+    AsyncImporter::Ticket bumped = importer.requestMesh(4, 1);
+    CORRADE_COMPARE(importer.activeCount(), 5);
+    CORRADE_COMPARE(importer.status(bumped), AsyncImportStatus::Pending);
+    CORRADE_VERIFY(importer.setPriority(bumped, 10));
+
+    shared.setOpen(true);
+    importer.waitAll();
+    CORRADE_COMPARE(importer.activeCount(), 0);
+
+    /* Highest priority first, same priority in submission order */
+    CORRADE_COMPARE_AS(shared.log(), Containers::arrayView<UnsignedInt>({
+        0, 4, 2, 4, 1
+    }), TestSuite::Compare::Container);
+    CORRADE_COMPARE(importer.takeMesh(bumped)->vertexCount(), 41);
+    CORRADE_COMPARE(importer.takeMesh(b)->vertexCount(), 40);
+    CORRADE_COMPARE(importer.takeMesh(a)->vertexCount(), 20);
+    CORRADE_COMPARE(importer.takeMesh(low)->vertexCount(), 10);
+    CORRADE_COMPARE(importer.takeMesh(first)->vertexCount(), 0);
+}
+
+void AsyncImporterTest::setPriorityNotPending() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    shared.setOpen(false);
+    AsyncImporter::Ticket ticket = importer.requestMesh(0);
+    waitUntilNotPending(importer, ticket);
+    CORRADE_VERIFY(!importer.setPriority(ticket, 10));
+
+    shared.setOpen(true);
+    CORRADE_COMPARE(importer.wait(ticket), AsyncImportStatus::Finished);
+    CORRADE_VERIFY(!importer.setPriority(ticket, 10));
+    importer.release(ticket);
+}
+
+void AsyncImporterTest::cancel() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    shared.setOpen(false);
+    AsyncImporter::Ticket first = importer.requestMesh(0);
+    waitUntilNotPending(importer, first);
+
+    AsyncImporter::Ticket cancelled = importer.requestMesh(1);
+    AsyncImporter::Ticket second = importer.requestMesh(2);
+    CORRADE_COMPARE(importer.activeCount(), 3);
+    CORRADE_VERIFY(importer.cancel(cancelled));
+    CORRADE_COMPARE(importer.status(cancelled), AsyncImportStatus::Cancelled);
+    CORRADE_COMPARE(importer.activeCount(), 2);
+
+    /* Cancelling again does nothing */
+    CORRADE_VERIFY(!importer.cancel(cancelled));
+
+    shared.setOpen(true);
+    CORRADE_COMPARE(importer.wait(cancelled), AsyncImportStatus::Cancelled);
+    CORRADE_VERIFY(!importer.takeMesh(cancelled));
+    CORRADE_VERIFY(importer.takeMesh(second));
+    CORRADE_VERIFY(importer.takeMesh(first));
+
+    /* The cancelled mesh was never imported */
+    CORRADE_COMPARE_AS(shared.log(), Containers::arrayView<UnsignedInt>({
+        0, 2
+    }), TestSuite::Compare::Container);
+}
+
+void AsyncImporterTest::cancelNotPending() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    shared.setOpen(false);
+    AsyncImporter::Ticket ticket = importer.requestMesh(0);
+    waitUntilNotPending(importer, ticket);
+    CORRADE_VERIFY(!importer.cancel(ticket));
+    CORRADE_COMPARE(importer.status(ticket), AsyncImportStatus::Running);
+
+    shared.setOpen(true);
+    CORRADE_COMPARE(importer.wait(ticket), AsyncImportStatus::Finished);
+    CORRADE_VERIFY(!importer.cancel(ticket));
+    CORRADE_VERIFY(importer.takeMesh(ticket));
+}
+
+void AsyncImporterTest::release() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    shared.setOpen(false);
+    AsyncImporter::Ticket first = importer.requestMesh(0);
+    waitUntilNotPending(importer, first);
+    AsyncImporter::Ticket pending = importer.requestMesh(1);
+    importer.release(pending);
+    CORRADE_COMPARE(importer.activeCount(), 1);
+
+    shared.setOpen(true);
+    CORRADE_COMPARE(importer.wait(first), AsyncImportStatus::Finished);
+    importer.release(first);
+    CORRADE_COMPARE(importer.activeCount(), 0);
+
+    /* The slots get reused for new requests, but the tickets are different */
+    AsyncImporter::Ticket reused = importer.requestMesh(2);
+    CORRADE_VERIFY(reused != first);
+    CORRADE_VERIFY(reused != pending);
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.status(first);
+    importer.status(pending);
+    CORRADE_COMPARE_AS(out, Utility::format(
+        "Trade::AsyncImporter::status(): invalid ticket 0x{:x}\n"
+        "Trade::AsyncImporter::status(): invalid ticket 0x{:x}\n", first, pending),
+        TestSuite::Compare::String);
+
+    CORRADE_VERIFY(importer.takeMesh(reused));
+    CORRADE_COMPARE_AS(shared.log(), Containers::arrayView<UnsignedInt>({
+        0, 2
+    }), TestSuite::Compare::Container);
+}
+
+void AsyncImporterTest::releaseRunning() {
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    shared.setOpen(false);
+    AsyncImporter::Ticket ticket = importer.requestMesh(0);
+    waitUntilNotPending(importer, ticket);
+    importer.release(ticket);
+    CORRADE_COMPARE(importer.activeCount(), 1);
+
+    /* The slot is freed only once the worker finishes */
+    shared.setOpen(true);
+    importer.waitAll();
+    CORRADE_COMPARE(importer.activeCount(), 0);
+}
+
+void AsyncImporterTest::destructPending() {
+    Shared shared;
+    {
+        AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+        shared.setOpen(false);
+        AsyncImporter::Ticket first = importer.requestMesh(0);
+        waitUntilNotPending(importer, first);
+        importer.requestMesh(1);
+        importer.requestMesh(2);
+
+        /* Opening the gate lets the running request finish while the
+           destructor waits for it, the pending ones get cancelled. As the
+           opening races with the destructor, the pending requests may
+           however get picked by the worker in the meantime. */
+        shared.setOpen(true);
+    }
+
+    CORRADE_COMPARE_AS(shared.log().size(), 1,
+        TestSuite::Compare::GreaterOrEqual);
+    CORRADE_COMPARE(shared.log()[0], 0);
+}
+
+void AsyncImporterTest::requestOutOfRange() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    Containers::String out;
+    Error redirectError{&out};
+    /* A failed request returns a zero ticket, which is never valid */
+    CORRADE_COMPARE(importer.requestScene(3), 0);
+    CORRADE_COMPARE(importer.requestMesh(5), 0);
+    CORRADE_COMPARE(importer.requestMaterial(2), 0);
+    CORRADE_COMPARE(importer.requestImage1D(1), 0);
+    CORRADE_COMPARE(importer.requestImage2D(1), 0);
+    CORRADE_COMPARE(importer.requestImage3D(1), 0);
+    CORRADE_COMPARE_AS(out,
+        "Trade::AsyncImporter::requestScene(): index 3 out of range for 3 entries\n"
+        "Trade::AsyncImporter::requestMesh(): index 5 out of range for 5 entries\n"
+        "Trade::AsyncImporter::requestMaterial(): index 2 out of range for 2 entries\n"
+        "Trade::AsyncImporter::requestImage1D(): index 1 out of range for 1 entries\n"
+        "Trade::AsyncImporter::requestImage2D(): index 1 out of range for 1 entries\n"
+        "Trade::AsyncImporter::requestImage3D(): index 1 out of range for 1 entries\n",
+        TestSuite::Compare::String);
+    CORRADE_COMPARE(importer.activeCount(), 0);
+}
+
+void AsyncImporterTest::invalidTicket() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.status(0);
+    importer.status(0x100000003);
+    importer.wait(0x100000003);
+    importer.setPriority(0x100000003, 1);
+    importer.cancel(0x100000003);
+    importer.release(0x100000003);
+    importer.takeScene(0x100000003);
+    importer.takeMesh(0x100000003);
+    importer.takeMaterial(0x100000003);
+    importer.takeImage1D(0x100000003);
+    importer.takeImage2D(0x100000003);
+    importer.takeImage3D(0x100000003);
+    CORRADE_COMPARE_AS(out,
+        "Trade::AsyncImporter::status(): invalid ticket 0x0\n"
+        "Trade::AsyncImporter::status(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::wait(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::setPriority(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::cancel(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::release(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::takeScene(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::takeMesh(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::takeMaterial(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::takeImage1D(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::takeImage2D(): invalid ticket 0x100000003\n"
+        "Trade::AsyncImporter::takeImage3D(): invalid ticket 0x100000003\n",
+        TestSuite::Compare::String);
+}
+
+void AsyncImporterTest::takeWrongType() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    Shared shared;
+    AsyncImporter importer{Containers::pointer<Importer>(shared)};
+
+    AsyncImporter::Ticket scene = importer.requestScene(0);
+    AsyncImporter::Ticket image = importer.requestImage2D(0);
+    importer.waitAll();
+
+    Containers::String out;
+    Error redirectError{&out};
+    importer.takeMesh(scene);
+    importer.takeImage3D(image);
+    CORRADE_COMPARE_AS(out, Utility::format(
+        "Trade::AsyncImporter::takeMesh(): ticket 0x{:x} is a scene request\n"
+        "Trade::AsyncImporter::takeImage3D(): ticket 0x{:x} is a 2D image request\n", scene, image),
+        TestSuite::Compare::String);
+
+    /* The tickets stay valid */
+    CORRADE_VERIFY(importer.takeScene(scene));
+    CORRADE_VERIFY(importer.takeImage2D(image));
+}
+
+void AsyncImporterTest::debugStatus() {
+    Containers::String out;
+    Debug{&out} << AsyncImportStatus::Cancelled << AsyncImportStatus(0xde);
+    CORRADE_COMPARE(out, "Trade::AsyncImportStatus::Cancelled Trade::AsyncImportStatus(0xde)\n");
+}
+
+void AsyncImporterTest::debugStatusPacked() {
+    Containers::String out;
+    /* Last is not packed, ones before should not make any flags persistent */
+    Debug{&out} << Debug::packed << AsyncImportStatus::Running << Debug::packed << AsyncImportStatus(0xde) << AsyncImportStatus::Finished;
+    CORRADE_COMPARE(out, "Running 0xde Trade::AsyncImportStatus::Finished\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::AsyncImporterTest)
@@ -25,18 +25,24 @@
 */
 
 #include <cstdlib>
-#include <Corrade/Containers/Array.h>
+#include <sys/wait.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringIterable.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/FileToString.h>
+#include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/TestSuite/Compare/StringToFile.h>
 #include <Corrade/Utility/Format.h>
 #include <Corrade/Utility/Path.h>
 
+#include "Magnum/PixelFormat.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
+#include "Magnum/Trade/ImageData.h"
 
 #include "configure.h"
 
@@ -46,6 +52,12 @@ struct ImageConverterTest: TestSuite::Tester {
     explicit ImageConverterTest();
 
     void info();
+    void convert();
+
+    void batch();
+    void batchFailed();
+    void batchProfile();
+    void batchInvalid();
 };
 
 using namespace Containers::Literals;
@@ -96,10 +108,229 @@ const struct {
         "info-data-ignored-output.txt"}
 };
 
+/* The input is always ImageConverterTestFiles/file.tga, a 2x3 R8Unorm image
+   with values from 1 to 6, imported with TgaImporter. The {0} placeholder in
+   the message is replaced with the output file, {1} with the input file. If
+   the output is a *.tga file, it's imported back with TgaImporter and its
+   format and pixel data compared, otherwise the raw file contents are
+   compared. */
+const struct {
+    TestSuite::TestCaseDescriptionSourceLocation name;
+    Containers::Array<Containers::String> args;
+    const char* requiresConverter;
+    const char* output;
+    bool success;
+    const char* message;
+    PixelFormat expectedFormat;
+    Containers::StringView expectedData;
+} ConvertData[]{
+    {"resize", {InPlaceInit, {
+            "-v", "--resize", "\"1 3\"", "-C", "raw"
+        }},
+        nullptr, "output.raw", true,
+        "Writing raw image data of size {{1, 3}} and format R8Unorm...\n",
+        {}, {}},
+    {"resize, filter", {InPlaceInit, {
+            "-v", "--resize", "\"4 6\"", "--resize-filter", "lanczos", "-C", "raw"
+        }},
+        nullptr, "output.raw", true,
+        "Writing raw image data of size {{4, 6}} and format R8Unorm...\n",
+        {}, {}},
+    {"resize, zero size", {InPlaceInit, {
+            "--resize", "\"0 3\""
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --resize size 0 3\n",
+        {}, {}},
+    {"resize, negative size", {InPlaceInit, {
+            "--resize", "\"-2 -2\""
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --resize size -2 -2\n",
+        {}, {}},
+    {"resize, invalid filter", {InPlaceInit, {
+            "--resize", "\"1 1\"", "--resize-filter", "nearest"
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --resize-filter filter nearest, expected box, bilinear, bicubic, lanczos or kaiser\n",
+        {}, {}},
+    /* There's no converter capable of saving multi-level images in this
+       repository, so it's verified just via the verbose output */
+    {"generate mipmaps", {InPlaceInit, {
+            "-v", "--generate-mipmaps", "box"
+        }},
+        "AnyImageConverter", "output.tga", false,
+        "Saving output of size {{2, 3}} (and 1 more levels) and format R8Unorm with AnyImageConverter...\n"
+        "Trade::AnyImageConverter::convertToFile(): cannot determine the format of {0} for a multi-level 2D image\n"
+        "Cannot save file {0}\n",
+        {}, {}},
+    {"generate mipmaps, invalid filter", {InPlaceInit, {
+            "--generate-mipmaps", "nearest"
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --generate-mipmaps filter nearest, expected box, bilinear, bicubic, lanczos or kaiser\n",
+        {}, {}},
+    {"generate mipmaps, raw output", {InPlaceInit, {
+            "--generate-mipmaps", "box", "-C", "raw"
+        }},
+        nullptr, "output.raw", false,
+        "The --generate-mipmaps option can't be combined with raw data output\n",
+        {}, {}},
+    {"pixel format", {InPlaceInit, {
+            "--pixel-format", "RGBA8Unorm", "-C", "TgaImageConverter"
+        }},
+        "TgaImageConverter", "output.tga", true,
+        "",
+        PixelFormat::RGBA8Unorm,
+        "\x01\x00\x00\xff\x02\x00\x00\xff"
+        "\x03\x00\x00\xff\x04\x00\x00\xff"
+        "\x05\x00\x00\xff\x06\x00\x00\xff"_s},
+    {"pixel format, swizzle", {InPlaceInit, {
+            "--pixel-format", "RGB8Unorm", "--swizzle", "rrr", "-C", "TgaImageConverter"
+        }},
+        "TgaImageConverter", "output.tga", true,
+        "",
+        PixelFormat::RGB8Unorm,
+        "\x01\x01\x01\x02\x02\x02"
+        "\x03\x03\x03\x04\x04\x04"
+        "\x05\x05\x05\x06\x06\x06"_s},
+    {"pixel format, unknown", {InPlaceInit, {
+            "--pixel-format", "RGB9Unorm"
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --pixel-format RGB9Unorm\n",
+        {}, {}},
+    {"pixel format, unsupported conversion", {InPlaceInit, {
+            "--pixel-format", "RGB8I"
+        }},
+        nullptr, "output.tga", false,
+        "Conversion from PixelFormat::R8Unorm to PixelFormat::RGB8I is not supported\n",
+        {}, {}},
+    {"pixel format, raw output", {InPlaceInit, {
+            "--pixel-format", "RGB8Unorm", "-C", "raw"
+        }},
+        nullptr, "output.raw", false,
+        "The --pixel-format / --swizzle option can't be combined with raw data output\n",
+        {}, {}},
+    {"swizzle, invalid", {InPlaceInit, {
+            "--swizzle", "rgbx"
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --swizzle rgbx, expected a combination of r, g, b and a\n",
+        {}, {}},
+    {"swizzle, too many channels", {InPlaceInit, {
+            "--swizzle", "rgbar"
+        }},
+        nullptr, "output.tga", false,
+        "Invalid --swizzle rgbar, expected at most four channels\n",
+        {}, {}},
+    /* There's no importer for compressed formats in this repository, so it's
+       verified just that the option is a no-op for uncompressed images */
+    {"decompress, uncompressed input", {InPlaceInit, {
+            "-v", "--decompress", "-C", "raw"
+        }},
+        nullptr, "output.raw", true,
+        "Writing raw image data of size {{2, 3}} and format R8Unorm...\n",
+        {}, "\x01\x02\x03\x04\x05\x06"_s},
+    /* The layer is referenced from the input without a copy, the output
+       should contain just the one row and not the rows after */
+    {"layer", {InPlaceInit, {
+            "-v", "--layer", "1", "-C", "raw"
+        }},
+        nullptr, "output.raw", true,
+        "Writing raw image data of size 2 and format R8Unorm...\n",
+        {}, "\x03\x04"_s},
+    {"layer, last", {InPlaceInit, {
+            "--layer", "2", "-C", "raw"
+        }},
+        nullptr, "output.raw", true,
+        "",
+        {}, "\x05\x06"_s},
+    {"layer, out of range", {InPlaceInit, {
+            "--layer", "3", "-C", "raw"
+        }},
+        nullptr, "output.raw", false,
+        "2D image 0:0 in {1} doesn't have a layer number 3, only 3 layers\n",
+        {}, {}},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt jobs;
+    const char* resize;
+    const char* message;
+    Containers::StringView expectedData;
+} BatchData[]{
+    {"", 1, nullptr,
+        "Writing raw image data of size {2, 3} and format R8Unorm...\n"
+        "Writing raw image data of size {2, 3} and format R8Unorm...\n",
+        "\x01\x02\x03\x04\x05\x06"_s},
+    {"two jobs", 2, nullptr,
+        "Writing raw image data of size {2, 3} and format R8Unorm...\n"
+        "Writing raw image data of size {2, 3} and format R8Unorm...\n",
+        "\x01\x02\x03\x04\x05\x06"_s},
+    /* TextureTools use the global thread pool, which shouldn't clash with
+       the pool the jobs are executed on */
+    {"two jobs, resize", 2, "\"1 3\"",
+        "Writing raw image data of size {1, 3} and format R8Unorm...\n"
+        "Writing raw image data of size {1, 3} and format R8Unorm...\n",
+        {}},
+};
+
+/* The {0} placeholder in the manifest, arguments and the message is replaced
+   with the manifest file, {1} with the test file directory and {2} with the
+   output directory */
+const struct {
+    TestSuite::TestCaseDescriptionSourceLocation name;
+    Containers::Array<Containers::String> args;
+    const char* manifest;
+    const char* message;
+} BatchInvalidData[]{
+    {"invalid manifest line", {InPlaceInit, {
+            "--batch", "{0}"
+        }},
+        "{1}/file.tga\t{2}/batch-a.raw\n"
+        "# a comment\n"
+        "{1}/file.tga {2}/batch-b.raw\n",
+        "Invalid --batch manifest line 3, expected an input and an output file separated by a tab\n"},
+    {"manifest line without an output", {InPlaceInit, {
+            "--batch", "{0}"
+        }},
+        "{1}/file.tga\t\n",
+        "Invalid --batch manifest line 1, expected an input and an output file separated by a tab\n"},
+    {"input and output set", {InPlaceInit, {
+            "--batch", "{0}", "{1}/file.tga", "{2}/batch-a.raw"
+        }},
+        "",
+        "Input and output files shouldn't be set for --batch\n"},
+    {"combined with --in-place", {InPlaceInit, {
+            "--batch", "{0}", "--in-place"
+        }},
+        "",
+        "The --batch option can't be combined with --in-place, --layers, --levels or --info\n"},
+    {"--jobs without --batch", {InPlaceInit, {
+            "-j", "2", "{1}/file.tga", "{2}/batch-a.raw"
+        }},
+        nullptr,
+        "The --jobs option can be used only with --batch\n"},
+};
+
 ImageConverterTest::ImageConverterTest() {
     addInstancedTests({&ImageConverterTest::info},
         Containers::arraySize(InfoData));
 
+    addInstancedTests({&ImageConverterTest::convert},
+        Containers::arraySize(ConvertData));
+
+    addInstancedTests({&ImageConverterTest::batch},
+        Containers::arraySize(BatchData));
+
+    addTests({&ImageConverterTest::batchFailed,
+              &ImageConverterTest::batchProfile});
+
+    addInstancedTests({&ImageConverterTest::batchInvalid},
+        Containers::arraySize(BatchInvalidData));
+
     /* Create output dir, if doesn't already exist */
     Utility::Path::make(Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles"));
 }
@@ -107,22 +338,27 @@ ImageConverterTest::ImageConverterTest() {
 namespace {
 
 #ifdef IMAGECONVERTER_EXECUTABLE_FILENAME
-Containers::Pair<bool, Containers::String> call(const Containers::StringIterable& arguments) {
+/* Returns the exit code and the combined standard and error output */
+Containers::Pair<int, Containers::String> call(const Containers::StringIterable& arguments) {
     const Containers::String outputFilename = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles/output.txt");
     /** @todo clean up once Utility::System::execute() with output redirection
         exists */
     /* Implicitly pass the plugin directory override */
-    const bool success = std::system(Utility::format("{} --plugin-dir {} {} > {} 2>&1",
+    const int status = std::system(Utility::format("{} --plugin-dir {} {} > {} 2>&1",
         IMAGECONVERTER_EXECUTABLE_FILENAME,
         MAGNUM_PLUGINS_INSTALL_DIR,
         " "_s.join(arguments), /** @todo handle space escaping here? */
         outputFilename
-    ).data()) == 0;
+    ).data());
 
     const Containers::Optional<Containers::String> output = Utility::Path::readString(outputFilename);
     CORRADE_VERIFY(output);
 
-    return {success, Utility::move(*output)};
+    return {WIFEXITED(status) ? WEXITSTATUS(status) : -1, Utility::move(*output)};
+}
+
+bool writeManifest(const Containers::StringView filename, const Containers::StringView contents) {
+    return Utility::Path::write(filename, Containers::arrayView(contents.data(), contents.size()));
 }
 #endif
 
@@ -146,11 +382,242 @@ void ImageConverterTest::info() {
 
     CORRADE_VERIFY(true); /* capture correct function name */
 
-    Containers::Pair<bool, Containers::String> output = call(data.args);
+    Containers::Pair<int, Containers::String> output = call(data.args);
     CORRADE_COMPARE_AS(output.second(),
         Utility::Path::join({TRADE_TEST_DIR, "ImageConverterTestFiles", data.expected}),
         TestSuite::Compare::StringToFile);
-    CORRADE_VERIFY(output.first());
+    CORRADE_COMPARE(output.first(), 0);
+    #endif
+}
+
+void ImageConverterTest::convert() {
+    auto&& data = ConvertData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    /* Check if required plugins can be loaded. Catches also ABI and interface
+       mismatch errors. */
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{MAGNUM_PLUGINS_IMAGECONVERTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+    if(data.requiresConverter && !(converterManager.load(data.requiresConverter) & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP(data.requiresConverter << "plugin can't be loaded.");
+
+    const Containers::String input = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga");
+    const Containers::String output = Utility::Path::join({TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles", data.output});
+    if(Utility::Path::exists(output))
+        CORRADE_VERIFY(Utility::Path::remove(output));
+
+    Containers::Array<Containers::String> args;
+    arrayAppend(args, InPlaceInit, "-I");
+    arrayAppend(args, InPlaceInit, "TgaImporter");
+    for(const Containers::String& arg: data.args)
+        arrayAppend(args, InPlaceInit, arg);
+    arrayAppend(args, InPlaceInit, input);
+    arrayAppend(args, InPlaceInit, output);
+
+    Containers::Pair<int, Containers::String> out = call(args);
+    CORRADE_COMPARE_AS(out.second(),
+        Utility::format(data.message, output, input),
+        TestSuite::Compare::String);
+    CORRADE_COMPARE(out.first() == 0, data.success);
+    if(!data.success)
+        return;
+
+    /* Some outputs aren't deterministic enough to be compared, such as
+       resampling */
+    CORRADE_VERIFY(Utility::Path::exists(output));
+    if(!data.expectedData)
+        return;
+
+    if(Containers::StringView{data.output}.hasSuffix(".tga"_s)) {
+        Containers::Pointer<Trade::AbstractImporter> importer = importerManager.instantiate("TgaImporter");
+        CORRADE_VERIFY(importer->openFile(output));
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(image->size(), (Vector2i{2, 3}));
+        CORRADE_COMPARE(image->format(), data.expectedFormat);
+        CORRADE_COMPARE(Containers::StringView{image->data()}, data.expectedData);
+    } else {
+        const Containers::Optional<Containers::String> outputData = Utility::Path::readString(output);
+        CORRADE_VERIFY(outputData);
+        CORRADE_COMPARE(*outputData, data.expectedData);
+    }
+    #endif
+}
+
+void ImageConverterTest::batch() {
+    auto&& data = BatchData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    #ifndef CORRADE_BUILD_MULTITHREADED
+    if(data.jobs != 1)
+        CORRADE_SKIP("CORRADE_BUILD_MULTITHREADED not enabled, can't test");
+    #endif
+
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+
+    const Containers::String outputDir = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles");
+    const Containers::String manifest = Utility::Path::join(outputDir, "batch.txt");
+    const Containers::String outputA = Utility::Path::join(outputDir, "batch-a.raw");
+    const Containers::String outputB = Utility::Path::join(outputDir, "batch-b.raw");
+    for(const Containers::String& file: {outputA, outputB})
+        if(Utility::Path::exists(file))
+            CORRADE_VERIFY(Utility::Path::remove(file));
+
+    /* Comments and empty lines should be skipped, surrounding whitespace
+       ignored */
+    CORRADE_VERIFY(writeManifest(manifest, Utility::format(
+        "# A comment\n"
+        "{0}/file.tga\t{1}\n"
+        "\n"
+        "  {0}/file.tga\t{2}  \n",
+        Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles"),
+        outputA, outputB)));
+
+    /* The output from each file should be printed in order even if they're
+       processed in parallel */
+    Containers::Array<Containers::String> args;
+    for(Containers::StringView arg: {"--batch"_s, Containers::StringView{manifest}, "-I"_s, "TgaImporter"_s, "-C"_s, "raw"_s, "-v"_s, "-j"_s})
+        arrayAppend(args, InPlaceInit, arg);
+    arrayAppend(args, InPlaceInit, Utility::format("{}", data.jobs));
+    if(data.resize) {
+        arrayAppend(args, InPlaceInit, "--resize");
+        arrayAppend(args, InPlaceInit, data.resize);
+    }
+    Containers::Pair<int, Containers::String> out = call(args);
+    CORRADE_COMPARE_AS(out.second(),
+        data.message,
+        TestSuite::Compare::String);
+    CORRADE_COMPARE(out.first(), 0);
+
+    /* The resized output isn't checked, the resampling is tested in
+       TextureTools already */
+    if(data.expectedData.isEmpty()) {
+        CORRADE_VERIFY(Utility::Path::exists(outputA));
+        CORRADE_VERIFY(Utility::Path::exists(outputB));
+    } else {
+        CORRADE_COMPARE_AS(outputA, data.expectedData,
+            TestSuite::Compare::FileToString);
+        CORRADE_COMPARE_AS(outputB, data.expectedData,
+            TestSuite::Compare::FileToString);
+    }
+    #endif
+}
+
+void ImageConverterTest::batchFailed() {
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+
+    const Containers::String inputDir = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles");
+    const Containers::String outputDir = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles");
+    const Containers::String manifest = Utility::Path::join(outputDir, "batch.txt");
+    const Containers::String outputA = Utility::Path::join(outputDir, "batch-a.raw");
+    const Containers::String outputB = Utility::Path::join(outputDir, "batch-b.raw");
+    const Containers::String outputC = Utility::Path::join(outputDir, "batch-c.raw");
+    for(const Containers::String& file: {outputA, outputB, outputC})
+        if(Utility::Path::exists(file))
+            CORRADE_VERIFY(Utility::Path::remove(file));
+
+    /* The second file isn't a TGA and its import fails, the others should
+       still get converted */
+    CORRADE_VERIFY(writeManifest(manifest, Utility::format(
+        "{0}/file.tga\t{1}\n"
+        "{0}/info-data.txt\t{2}\n"
+        "{0}/file.tga\t{3}\n",
+        inputDir, outputA, outputB, outputC)));
+
+    Containers::Pair<int, Containers::String> out = call({
+        "--batch", manifest, "-I", "TgaImporter", "-C", "raw", "-v"});
+    /* The exact message about the failed import includes a printed
+       Optional, check just the parts around */
+    CORRADE_COMPARE_AS(out.second(),
+        "Writing raw image data of size {2, 3} and format R8Unorm...\n"
+        "Trade::TgaImporter::image2D(): paletted files are not supported\n"
+        "Cannot import image 0:",
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(out.second(),
+        Utility::format("from {}/info-data.txt\n"
+            "Writing raw image data of size {{2, 3}} and format R8Unorm...\n"
+            "1 out of 3 files failed to convert\n", inputDir),
+        TestSuite::Compare::StringHasSuffix);
+    /* Exit code of the failed file */
+    CORRADE_COMPARE(out.first(), 4);
+
+    CORRADE_VERIFY(Utility::Path::exists(outputA));
+    CORRADE_VERIFY(!Utility::Path::exists(outputB));
+    CORRADE_VERIFY(Utility::Path::exists(outputC));
+    #endif
+}
+
+void ImageConverterTest::batchProfile() {
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    PluginManager::Manager<Trade::AbstractImporter> importerManager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
+    if(!(importerManager.load("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin can't be loaded.");
+
+    const Containers::String input = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles/file.tga");
+    const Containers::String outputDir = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles");
+    const Containers::String manifest = Utility::Path::join(outputDir, "batch.txt");
+    CORRADE_VERIFY(writeManifest(manifest, Utility::format(
+        "{0}\t{1}/batch-a.raw\n"
+        "{0}\t{1}/batch-b.raw\n",
+        input, outputDir)));
+
+    Containers::Pair<int, Containers::String> out = call({
+        "--batch", manifest, "-I", "TgaImporter", "-C", "raw", "--profile"});
+    CORRADE_COMPARE(out.first(), 0);
+
+    /* The times are not deterministic, check just the structure -- a line for
+       each file and a total at the end */
+    const Containers::Array<Containers::StringView> lines = Containers::StringView{out.second()}.splitWithoutEmptyParts('\n');
+    CORRADE_COMPARE(lines.size(), 3);
+    CORRADE_COMPARE_AS(lines[0], Utility::format("{}: import took ", input),
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(lines[1], Utility::format("{}: import took ", input),
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(lines[2], "Converted 2 files with 1 jobs in ",
+        TestSuite::Compare::StringHasPrefix);
+    CORRADE_COMPARE_AS(lines[2], " seconds in total",
+        TestSuite::Compare::StringHasSuffix);
+    #endif
+}
+
+void ImageConverterTest::batchInvalid() {
+    auto&& data = BatchInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    #ifndef IMAGECONVERTER_EXECUTABLE_FILENAME
+    CORRADE_SKIP("magnum-imageconverter not built, can't test");
+    #else
+    const Containers::String inputDir = Utility::Path::join(TRADE_TEST_DIR, "ImageConverterTestFiles");
+    const Containers::String outputDir = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImageConverterTestFiles");
+    const Containers::String manifest = Utility::Path::join(outputDir, "batch.txt");
+    if(data.manifest)
+        CORRADE_VERIFY(writeManifest(manifest, Utility::format(data.manifest, manifest, inputDir, outputDir)));
+
+    Containers::Array<Containers::String> args;
+    for(const Containers::String& arg: data.args)
+        arrayAppend(args, Utility::format(arg.data(), manifest, inputDir, outputDir));
+
+    Containers::Pair<int, Containers::String> out = call(args);
+    CORRADE_COMPARE_AS(out.second(), data.message,
+        TestSuite::Compare::String);
+    CORRADE_COMPARE(out.first(), 1);
     #endif
 }
 
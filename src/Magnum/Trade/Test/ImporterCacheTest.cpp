@@ -0,0 +1,514 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/ImporterCache.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ImporterCacheTest: TestSuite::Tester {
+    explicit ImporterCacheTest();
+
+    void key();
+
+    void openFile();
+    void openData();
+    void configurationChanged();
+    void corruptedCacheFile();
+    void importerOutlivesCache();
+
+    void unsupported();
+    void unsupportedQuiet();
+    void openFailed();
+    void openFileNotFound();
+    void nullImporter();
+
+    PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
+    PluginManager::Manager<AbstractSceneConverter> _converterManager{"nonexistent"};
+};
+
+enum class Unsupported {
+    None,
+    Texture,
+    ObjectName,
+    CustomMeshAttributeName
+};
+
+const struct {
+    const char* name;
+    Unsupported unsupported;
+    bool needsConverter;
+    const char* message;
+} UnsupportedTestData[]{
+    {"texture", Unsupported::Texture, false,
+        "textures can't be cached"},
+    {"object name", Unsupported::ObjectName, false,
+        "object names can't be cached"},
+    {"custom mesh attribute name", Unsupported::CustomMeshAttributeName, true,
+        "custom mesh attribute names can't be cached"},
+};
+
+ImporterCacheTest::ImporterCacheTest() {
+    addTests({&ImporterCacheTest::key,
+
+              &ImporterCacheTest::openFile,
+              &ImporterCacheTest::openData,
+              &ImporterCacheTest::configurationChanged,
+              &ImporterCacheTest::corruptedCacheFile,
+              &ImporterCacheTest::importerOutlivesCache});
+
+    addInstancedTests({&ImporterCacheTest::unsupported},
+        Containers::arraySize(UnsupportedTestData));
+
+    addTests({&ImporterCacheTest::unsupportedQuiet,
+              &ImporterCacheTest::openFailed,
+              &ImporterCacheTest::openFileNotFound,
+              &ImporterCacheTest::nullImporter});
+
+    /* Load the plugins directly from the build tree. Otherwise they're static
+       and already loaded. */
+    #ifdef MAGNUMIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(MAGNUMIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    #ifdef MAGNUMSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_converterManager.load(MAGNUMSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    Utility::Path::make(Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles"));
+}
+
+using namespace Containers::Literals;
+
+/* Each test case uses different input data so the cache files don't clash */
+const char FileData[]{'F'};
+const char DataData[]{'D'};
+const char ConfigurationData[]{'C'};
+const char CorruptedData[]{'X'};
+const char OutlivesData[]{'O'};
+const char UnsupportedData[]{'U'};
+
+/* Imports a single mesh and a single image, with the contents derived from
+   the first byte of the input. Fails to open if the input is empty. */
+struct Importer: AbstractImporter {
+    explicit Importer(std::size_t& openCount, Unsupported unsupported = Unsupported::None): _openCount(openCount), _unsupported{unsupported} {
+        configuration().setValue("option", 3);
+    }
+
+    ImporterFeatures doFeatures() const override { return ImporterFeature::OpenData; }
+    bool doIsOpened() const override { return _opened; }
+    void doClose() override { _opened = false; }
+
+    void doOpenData(Containers::Array<char>&& data, DataFlags) override {
+        ++_openCount;
+        if(data.isEmpty()) {
+            Error{} << "Importer::openData(): empty";
+            return;
+        }
+        _value = data[0];
+        _opened = true;
+    }
+
+    UnsignedInt doMeshCount() const override { return 1; }
+    Containers::String doMeshName(UnsignedInt) override { return "a mesh"; }
+    Containers::Optional<MeshData> doMesh(UnsignedInt, UnsignedInt) override {
+        Containers::Array<char> vertexData{NoInit, 2*sizeof(Vector3)};
+        Containers::ArrayView<Vector3> positions = Containers::arrayCast<Vector3>(vertexData);
+        positions[0] = {1.0f, 2.0f, 3.0f};
+        positions[1] = {4.0f, 5.0f, Float(_value)};
+        return MeshData{MeshPrimitive::Lines, Utility::move(vertexData), {
+            MeshAttributeData{_unsupported == Unsupported::CustomMeshAttributeName ? meshAttributeCustom(0) : MeshAttribute::Position, positions}
+        }};
+    }
+    Containers::String doMeshAttributeName(MeshAttribute) override {
+        return "customPosition";
+    }
+
+    UnsignedInt doImage2DCount() const override { return 1; }
+    Containers::Optional<ImageData2D> doImage2D(UnsignedInt, UnsignedInt) override {
+        return ImageData2D{PixelFormat::RGBA8Unorm, {2, 1}, Containers::Array<char>{InPlaceInit, {
+            'a', 'b', 'c', 'd', _value, 'f', 'g', 'h'
+        }}};
+    }
+
+    /* Textures and object names can't be cached */
+    UnsignedInt doTextureCount() const override {
+        return _unsupported == Unsupported::Texture;
+    }
+    UnsignedLong doObjectCount() const override {
+        return _unsupported == Unsupported::ObjectName;
+    }
+    Containers::String doObjectName(UnsignedLong) override {
+        return "an object";
+    }
+
+    private:
+        std::size_t& _openCount;
+        Unsupported _unsupported;
+        bool _opened = false;
+        char _value;
+};
+
+void verifyImported(AbstractImporter& importer, char value) {
+    CORRADE_COMPARE(importer.meshCount(), 1);
+    CORRADE_COMPARE(importer.meshName(0), "a mesh");
+    Containers::Optional<MeshData> mesh = importer.mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Lines);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position), Containers::arrayView<Vector3>({
+        {1.0f, 2.0f, 3.0f},
+        {4.0f, 5.0f, Float(value)}
+    }), TestSuite::Compare::Container);
+    /* The data should reference the cache file directly, if it's
+       memory-mapped */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::ExternallyOwned);
+    #else
+    CORRADE_COMPARE(mesh->vertexDataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    #endif
+
+    CORRADE_COMPARE(importer.image2DCount(), 1);
+    Containers::Optional<ImageData2D> image = importer.image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+        'a', 'b', 'c', 'd', value, 'f', 'g', 'h'
+    }), TestSuite::Compare::Container);
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned);
+    #else
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    #endif
+}
+
+void ImporterCacheTest::key() {
+    ImporterCache cache{_importerManager, _converterManager, "nonexistent"};
+    CORRADE_COMPARE(cache.directory(), "nonexistent");
+
+    std::size_t openCount{};
+    Importer importer{openCount};
+
+    const char a[]{'a', 'b'};
+    const char b[]{'a', 'c'};
+    const Containers::String keyA = cache.key(importer, a);
+    CORRADE_COMPARE(keyA.size(), 40);
+    for(char c: keyA) {
+        CORRADE_ITERATION(keyA);
+        CORRADE_VERIFY((c >= '0' && c <= '9') || (c >= 'a' && c <= 'f'));
+    }
+
+    /* Same input gives the same key, different input a different one */
+    CORRADE_COMPARE(cache.key(importer, a), keyA);
+    CORRADE_VERIFY(cache.key(importer, b) != keyA);
+
+    /* Changing a configuration value changes the key, also if the value is in
+       a subgroup */
+    importer.configuration().setValue("option", 4);
+    const Containers::String keyOption = cache.key(importer, a);
+    CORRADE_VERIFY(keyOption != keyA);
+    importer.configuration().addGroup("group")->setValue("option", 4);
+    CORRADE_VERIFY(cache.key(importer, a) != keyOption);
+
+    /* The importer was never opened */
+    CORRADE_COMPARE(openCount, 0);
+}
+
+void ImporterCacheTest::openFile() {
+    if(!(_importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(_converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    const Containers::String directory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles");
+    const Containers::String input = Utility::Path::join(directory, "file.bin");
+    CORRADE_VERIFY(Utility::Path::write(input, FileData));
+
+    ImporterCache cache{_importerManager, _converterManager, directory};
+
+    std::size_t openCount{};
+    const Containers::String cached = Utility::Path::join(directory, cache.key(Importer{openCount}, FileData) + ".blob"_s);
+    if(Utility::Path::exists(cached))
+        CORRADE_VERIFY(Utility::Path::remove(cached));
+
+    /* First time it's imported by the importer and cached */
+    {
+        Containers::Pointer<AbstractImporter> importer = cache.openFile(Containers::pointer<Importer>(openCount), input);
+        CORRADE_VERIFY(importer);
+        CORRADE_COMPARE(openCount, 1);
+        CORRADE_COMPARE(cache.hitCount(), 0);
+        CORRADE_COMPARE(cache.missCount(), 1);
+        CORRADE_VERIFY(Utility::Path::exists(cached));
+        /* No temporary file is left behind */
+        Containers::Optional<Containers::Array<Containers::String>> files = Utility::Path::list(directory, Utility::Path::ListFlag::SkipDirectories);
+        CORRADE_VERIFY(files);
+        for(const Containers::String& file: *files) {
+            CORRADE_ITERATION(file);
+            CORRADE_VERIFY(!file.hasSuffix(".tmp"_s));
+        }
+        verifyImported(*importer, 'F');
+    }
+
+    /* Second time it's taken from the cache, without opening the importer */
+    {
+        Containers::Pointer<AbstractImporter> importer = cache.openFile(Containers::pointer<Importer>(openCount), input);
+        CORRADE_VERIFY(importer);
+        CORRADE_COMPARE(openCount, 1);
+        CORRADE_COMPARE(cache.hitCount(), 1);
+        CORRADE_COMPARE(cache.missCount(), 1);
+        verifyImported(*importer, 'F');
+    }
+}
+
+void ImporterCacheTest::openData() {
+    if(!(_importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(_converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    const Containers::String directory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles");
+    ImporterCache cache{_importerManager, _converterManager, directory};
+
+    std::size_t openCount{};
+    const Containers::String cached = Utility::Path::join(directory, cache.key(Importer{openCount}, DataData) + ".blob"_s);
+    if(Utility::Path::exists(cached))
+        CORRADE_VERIFY(Utility::Path::remove(cached));
+
+    {
+        Containers::Pointer<AbstractImporter> importer = cache.openData(Containers::pointer<Importer>(openCount), DataData);
+        CORRADE_VERIFY(importer);
+        CORRADE_COMPARE(openCount, 1);
+        CORRADE_COMPARE(cache.missCount(), 1);
+        verifyImported(*importer, 'D');
+    } {
+        Containers::Pointer<AbstractImporter> importer = cache.openData(Containers::pointer<Importer>(openCount), DataData);
+        CORRADE_VERIFY(importer);
+        CORRADE_COMPARE(openCount, 1);
+        CORRADE_COMPARE(cache.hitCount(), 1);
+        verifyImported(*importer, 'D');
+    }
+}
+
+void ImporterCacheTest::configurationChanged() {
+    if(!(_importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(_converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    const Containers::String directory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles");
+    ImporterCache cache{_importerManager, _converterManager, directory};
+
+    std::size_t openCount{};
+    Containers::Pointer<Importer> a = Containers::pointer<Importer>(openCount);
+    Containers::Pointer<Importer> b = Containers::pointer<Importer>(openCount);
+    b->configuration().setValue("option", 5);
+    for(const Importer* importer: {a.get(), b.get()}) {
+        const Containers::String cached = Utility::Path::join(directory, cache.key(*importer, ConfigurationData) + ".blob"_s);
+        if(Utility::Path::exists(cached))
+            CORRADE_VERIFY(Utility::Path::remove(cached));
+    }
+
+    CORRADE_VERIFY(cache.openData(Utility::move(a), ConfigurationData));
+    CORRADE_VERIFY(cache.openData(Utility::move(b), ConfigurationData));
+
+    /* Both got imported as the configuration differs */
+    CORRADE_COMPARE(openCount, 2);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 2);
+}
+
+void ImporterCacheTest::corruptedCacheFile() {
+    if(!(_importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(_converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    const Containers::String directory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles");
+    ImporterCache cache{_importerManager, _converterManager, directory};
+
+    std::size_t openCount{};
+    const Containers::String cached = Utility::Path::join(directory, cache.key(Importer{openCount}, CorruptedData) + ".blob"_s);
+    CORRADE_VERIFY(Utility::Path::write(cached, Containers::arrayView("this is not a blob")));
+
+    Containers::Pointer<AbstractImporter> importer;
+    Containers::String out;
+    {
+        /* MagnumImporter prints an error as well, which isn't checked */
+        Error silenceError{nullptr};
+        Warning redirectWarning{&out};
+        importer = cache.openData(Containers::pointer<Importer>(openCount), CorruptedData);
+    }
+    CORRADE_VERIFY(importer);
+    CORRADE_COMPARE(out, Utility::format("Trade::ImporterCache::openData(): cannot use {}, importing again\n", cached));
+    CORRADE_COMPARE(openCount, 1);
+    CORRADE_COMPARE(cache.hitCount(), 0);
+    CORRADE_COMPARE(cache.missCount(), 1);
+
+    /* The file got overwritten with a valid one */
+    verifyImported(*importer, 'X');
+}
+
+void ImporterCacheTest::importerOutlivesCache() {
+    if(!(_importerManager.load("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin can't be loaded.");
+    if(!(_converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    const Containers::String directory = Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles");
+
+    /* Both on a miss and on a hit the returned importer owns the cache file
+       mapping, so it stays usable after the cache is gone */
+    std::size_t openCount{};
+    for(std::size_t hitCount: {0, 1}) {
+        CORRADE_ITERATION(hitCount);
+
+        Containers::Pointer<AbstractImporter> importer;
+        {
+            ImporterCache cache{_importerManager, _converterManager, directory};
+            if(!hitCount) {
+                const Containers::String cached = Utility::Path::join(directory, cache.key(Importer{openCount}, OutlivesData) + ".blob"_s);
+                if(Utility::Path::exists(cached))
+                    CORRADE_VERIFY(Utility::Path::remove(cached));
+            }
+
+            importer = cache.openData(Containers::pointer<Importer>(openCount), OutlivesData);
+            CORRADE_VERIFY(importer);
+            CORRADE_COMPARE(cache.hitCount(), hitCount);
+        }
+
+        verifyImported(*importer, 'O');
+    }
+
+    CORRADE_COMPARE(openCount, 1);
+}
+
+void ImporterCacheTest::unsupported() {
+    auto&& data = UnsupportedTestData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Custom names are discovered only during the conversion */
+    if(data.needsConverter && !(_converterManager.load("MagnumSceneConverter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumSceneConverter plugin can't be loaded.");
+
+    ImporterCache cache{_importerManager, _converterManager, Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles")};
+
+    std::size_t openCount{};
+    Containers::Pointer<Importer> importer = Containers::pointer<Importer>(openCount, data.unsupported);
+    Importer* pointer = importer.get();
+
+    Containers::Pointer<AbstractImporter> out;
+    Containers::String warning;
+    {
+        Warning redirectWarning{&warning};
+        out = cache.openData(Utility::move(importer), UnsupportedData);
+    }
+
+    /* The original importer is returned, opened */
+    CORRADE_COMPARE(out.get(), pointer);
+    CORRADE_VERIFY(out->isOpened());
+    CORRADE_COMPARE(openCount, 1);
+    CORRADE_COMPARE(cache.missCount(), 1);
+    CORRADE_COMPARE(warning, Utility::format("Trade::ImporterCache::openData(): {}, using the importer directly\n", data.message));
+}
+
+void ImporterCacheTest::unsupportedQuiet() {
+    ImporterCache cache{_importerManager, _converterManager, Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles")};
+
+    std::size_t openCount{};
+    Containers::Pointer<Importer> importer = Containers::pointer<Importer>(openCount, Unsupported::Texture);
+    importer->addFlags(ImporterFlag::Quiet);
+
+    Containers::Pointer<AbstractImporter> out;
+    Containers::String warning;
+    {
+        Warning redirectWarning{&warning};
+        out = cache.openData(Utility::move(importer), UnsupportedData);
+    }
+    CORRADE_VERIFY(out);
+    CORRADE_COMPARE(warning, "");
+}
+
+void ImporterCacheTest::openFailed() {
+    ImporterCache cache{_importerManager, _converterManager, Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles")};
+
+    std::size_t openCount{};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!cache.openData(Containers::pointer<Importer>(openCount), {}));
+    CORRADE_COMPARE(openCount, 1);
+    CORRADE_COMPARE(cache.missCount(), 1);
+    CORRADE_COMPARE(out, "Importer::openData(): empty\n");
+}
+
+void ImporterCacheTest::openFileNotFound() {
+    ImporterCache cache{_importerManager, _converterManager, Utility::Path::join(TRADE_TEST_OUTPUT_DIR, "ImporterCacheTestFiles")};
+
+    std::size_t openCount{};
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!cache.openFile(Containers::pointer<Importer>(openCount), "nonexistent.bin"));
+    CORRADE_COMPARE(openCount, 0);
+    CORRADE_COMPARE(cache.missCount(), 0);
+    /* There's an error from Path::mapRead() before */
+    CORRADE_COMPARE_AS(out,
+        "\nTrade::ImporterCache::openFile(): cannot open file nonexistent.bin\n",
+        TestSuite::Compare::StringHasSuffix);
+}
+
+void ImporterCacheTest::nullImporter() {
+    CORRADE_SKIP_IF_NO_ASSERT();
+
+    ImporterCache cache{_importerManager, _converterManager, "nonexistent"};
+
+    Containers::String out;
+    Error redirectError{&out};
+    cache.openFile(nullptr, "file.bin");
+    cache.openData(nullptr, nullptr);
+    CORRADE_COMPARE(out,
+        "Trade::ImporterCache::openFile(): importer is null\n"
+        "Trade::ImporterCache::openData(): importer is null\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ImporterCacheTest)
@@ -0,0 +1,188 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Matrix3.h"
+#include "Magnum/Trade/MaterialData.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+/* Measures the per-query cost of attribute lookup on a material resembling
+   what a glTF importer produces, with 20 queries per material like a
+   renderer would do when filling a uniform buffer */
+
+struct MaterialDataBenchmark: TestSuite::Tester {
+    explicit MaterialDataBenchmark();
+
+    void construct();
+    void queryEnum();
+    void queryString();
+    void queryEnumLayer();
+    void queryStringLayer();
+};
+
+using namespace Containers::Literals;
+using namespace Math::Literals;
+
+enum: std::size_t {
+    Repeats = 1000
+};
+
+constexpr MaterialAttribute QueriedAttributes[]{
+    MaterialAttribute::BaseColor,
+    MaterialAttribute::BaseColorTexture,
+    MaterialAttribute::BaseColorTextureMatrix,
+    MaterialAttribute::BaseColorTextureCoordinates,
+    MaterialAttribute::Metalness,
+    MaterialAttribute::Roughness,
+    MaterialAttribute::NoneRoughnessMetallicTexture,
+    MaterialAttribute::MetalnessTexture,
+    MaterialAttribute::MetalnessTextureCoordinates,
+    MaterialAttribute::NormalTexture,
+    MaterialAttribute::NormalTextureScale,
+    MaterialAttribute::NormalTextureCoordinates,
+    MaterialAttribute::OcclusionTexture,
+    MaterialAttribute::OcclusionTextureStrength,
+    MaterialAttribute::EmissiveColor,
+    MaterialAttribute::EmissiveTexture,
+    MaterialAttribute::AlphaMask,
+    MaterialAttribute::AlphaBlend,
+    MaterialAttribute::DoubleSided,
+    /* Not present */
+    MaterialAttribute::SpecularColor,
+};
+
+Containers::Array<MaterialAttributeData> attributes() {
+    return Containers::array<MaterialAttributeData>({
+        {MaterialAttribute::BaseColor, 0xffcc33ff_rgbaf},
+        {MaterialAttribute::BaseColorTexture, 0u},
+        {MaterialAttribute::BaseColorTextureMatrix, Matrix3::scaling({0.5f, 0.5f})},
+        {MaterialAttribute::Metalness, 0.5f},
+        {MaterialAttribute::Roughness, 0.25f},
+        {MaterialAttribute::NoneRoughnessMetallicTexture, 1u},
+        {MaterialAttribute::NormalTexture, 2u},
+        {MaterialAttribute::NormalTextureScale, 0.75f},
+        {MaterialAttribute::OcclusionTexture, 1u},
+        {MaterialAttribute::OcclusionTextureStrength, 0.5f},
+        {MaterialAttribute::EmissiveColor, 0x111111_rgbf},
+        {MaterialAttribute::EmissiveTexture, 3u},
+        {MaterialAttribute::AlphaMask, 0.5f},
+        {MaterialAttribute::DoubleSided, true},
+        {"name", "Material.001"_s},
+
+        {MaterialLayer::ClearCoat},
+        {MaterialAttribute::LayerFactor, 0.5f},
+        {MaterialAttribute::Roughness, 0.1f},
+        {MaterialAttribute::NormalTexture, 4u},
+    });
+}
+
+MaterialDataBenchmark::MaterialDataBenchmark() {
+    addBenchmarks({&MaterialDataBenchmark::construct,
+                   &MaterialDataBenchmark::queryEnum,
+                   &MaterialDataBenchmark::queryString,
+                   &MaterialDataBenchmark::queryEnumLayer,
+                   &MaterialDataBenchmark::queryStringLayer}, 10);
+}
+
+void MaterialDataBenchmark::construct() {
+    /* Includes sorting the attributes and creating the lookup table */
+    const Containers::Array<MaterialAttributeData> source = attributes();
+    std::size_t count = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        Containers::Array<MaterialAttributeData> data{NoInit, source.size()};
+        Utility::copy(source, data);
+        MaterialData material{MaterialType::PbrMetallicRoughness, Utility::move(data), {15, 19}};
+        count += material.attributeCount();
+    }
+
+    CORRADE_COMPARE(count, Repeats*15);
+}
+
+void MaterialDataBenchmark::queryEnum() {
+    const MaterialData material{MaterialType::PbrMetallicRoughness, attributes(), {15, 19}};
+
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(const MaterialAttribute attribute: QueriedAttributes)
+            if(material.findAttribute(attribute)) ++found;
+    }
+
+    CORRADE_COMPARE(found, Repeats*14);
+}
+
+void MaterialDataBenchmark::queryString() {
+    const MaterialData material{MaterialType::PbrMetallicRoughness, attributes(), {15, 19}};
+
+    Containers::StringView names[Containers::arraySize(QueriedAttributes)];
+    for(std::size_t i = 0; i != Containers::arraySize(QueriedAttributes); ++i)
+        names[i] = materialAttributeName(QueriedAttributes[i]);
+
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(const Containers::StringView name: names)
+            if(material.findAttribute(name)) ++found;
+    }
+
+    CORRADE_COMPARE(found, Repeats*14);
+}
+
+void MaterialDataBenchmark::queryEnumLayer() {
+    const MaterialData material{MaterialType::PbrMetallicRoughness, attributes(), {15, 19}};
+
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(const MaterialAttribute attribute: QueriedAttributes)
+            if(material.findAttribute(1, attribute)) ++found;
+    }
+
+    CORRADE_COMPARE(found, Repeats*2);
+}
+
+void MaterialDataBenchmark::queryStringLayer() {
+    const MaterialData material{MaterialType::PbrMetallicRoughness, attributes(), {15, 19}};
+
+    Containers::StringView names[Containers::arraySize(QueriedAttributes)];
+    for(std::size_t i = 0; i != Containers::arraySize(QueriedAttributes); ++i)
+        names[i] = materialAttributeName(QueriedAttributes[i]);
+
+    std::size_t found = 0;
+    CORRADE_BENCHMARK(Repeats) {
+        for(const Containers::StringView name: names)
+            if(material.findAttribute(1, name)) ++found;
+    }
+
+    CORRADE_COMPARE(found, Repeats*2);
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MaterialDataBenchmark)
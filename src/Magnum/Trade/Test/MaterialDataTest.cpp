@@ -168,6 +168,8 @@ struct MaterialDataTest: TestSuite::Tester {
     void accessNotFoundInLayerIndex();
     void accessNotFoundInLayerString();
     void accessMutableNotAllowed();
+    void accessAttributeLookup();
+    void accessAttributeLookupTooManyAttributes();
 
     void releaseAttributes();
     void releaseLayers();
@@ -352,6 +354,8 @@ MaterialDataTest::MaterialDataTest() {
               &MaterialDataTest::accessNotFoundInLayerIndex,
               &MaterialDataTest::accessNotFoundInLayerString,
               &MaterialDataTest::accessMutableNotAllowed,
+              &MaterialDataTest::accessAttributeLookup,
+              &MaterialDataTest::accessAttributeLookupTooManyAttributes,
 
               &MaterialDataTest::releaseAttributes,
               &MaterialDataTest::releaseLayers,
@@ -3323,6 +3327,67 @@ void MaterialDataTest::accessMutableNotAllowed() {
         "Trade::MaterialData::mutableAttribute(): attribute data not mutable\n");
 }
 
+void MaterialDataTest::accessAttributeLookup() {
+    /* Custom attributes sorted before, in between and after the builtin
+       ones */
+    MaterialData data{{}, {
+        {MaterialAttribute::DiffuseColor, 0xff3366aa_rgbaf},
+        {"aCustom", 1.0f},
+        {MaterialAttribute::NormalTexture, 3u},
+        {"NormalTextureHighlight", true},
+        {MaterialAttribute::NormalTextureScale, 0.5f},
+        {MaterialAttribute::Shininess, 32.0f},
+        {"zzz", 2u},
+
+        {MaterialAttribute::LayerName, "ClearCoat"},
+        {MaterialAttribute::LayerFactor, 0.5f},
+        {MaterialAttribute::Roughness, 0.25f},
+
+        /* Empty layer */
+    }, {7, 10, 10}};
+
+    /* Queries with the enum go through the lookup table, queries with a
+       string through a binary search, both should agree for all attributes
+       in all layers. TextureLayer is the last attribute. */
+    for(UnsignedInt layer = 0; layer != data.layerCount(); ++layer) {
+        for(UnsignedInt i = 1; i <= UnsignedInt(MaterialAttribute::TextureLayer); ++i) {
+            const MaterialAttribute attribute = MaterialAttribute(i);
+            CORRADE_ITERATION(layer << attribute);
+            const Containers::StringView name = materialAttributeName(attribute);
+            CORRADE_COMPARE(data.hasAttribute(layer, attribute), data.hasAttribute(layer, name));
+            CORRADE_COMPARE(data.findAttributeId(layer, attribute), data.findAttributeId(layer, name));
+        }
+    }
+
+    CORRADE_COMPARE(data.attributeId(MaterialAttribute::Shininess), 5);
+    CORRADE_COMPARE(data.attribute<Float>(MaterialAttribute::NormalTextureScale), 0.5f);
+    CORRADE_COMPARE(data.attributeType(1, MaterialAttribute::LayerName), MaterialAttributeType::String);
+    CORRADE_COMPARE(data.attribute<Float>(1, MaterialAttribute::Roughness), 0.25f);
+    CORRADE_COMPARE(data.findAttribute<Float>("ClearCoat", MaterialAttribute::LayerFactor), 0.5f);
+    CORRADE_COMPARE(data.attributeOr(1, MaterialAttribute::Metalness, 1.0f), 1.0f);
+    CORRADE_VERIFY(!data.hasAttribute(2, MaterialAttribute::Roughness));
+}
+
+void MaterialDataTest::accessAttributeLookupTooManyAttributes() {
+    /* The lookup table isn't created if there's more than 255 attributes in
+       a layer, the lookup should still work */
+    Containers::Array<MaterialAttributeData> attributes{300};
+    for(std::size_t i = 0; i != attributes.size() - 1; ++i) {
+        char name[]{'a', char('a' + i/26/26), char('a' + i/26%26), char('a' + i%26), '\0'};
+        attributes[i] = MaterialAttributeData{name, Float(i)};
+    }
+    attributes.back() = MaterialAttributeData{MaterialAttribute::Shininess, 32.0f};
+
+    MaterialData data{{}, Utility::move(attributes)};
+    CORRADE_COMPARE(data.attributeCount(), 300);
+    /* Uppercase letters are sorted before lowercase */
+    CORRADE_COMPARE(data.attributeId(MaterialAttribute::Shininess), 0);
+    CORRADE_COMPARE(data.attributeId("aabc"), 29);
+    CORRADE_COMPARE(data.attribute<Float>(MaterialAttribute::Shininess), 32.0f);
+    CORRADE_COMPARE(data.attribute<Float>("aabc"), 28.0f);
+    CORRADE_VERIFY(!data.hasAttribute(MaterialAttribute::Roughness));
+}
+
 void MaterialDataTest::releaseAttributes() {
     MaterialData data{{}, {
         {"DiffuseColor", 0xff3366aa_rgbaf},
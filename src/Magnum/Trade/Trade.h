@@ -41,9 +41,15 @@
 #ifndef DOXYGEN_GENERATING_OUTPUT
 namespace Magnum { namespace Trade {
 
+class AbstractAllocator;
 class AbstractImageConverter;
 class AbstractImporter;
 class AbstractSceneConverter;
+class ArenaAllocator;
+
+enum class AsyncImportStatus: UnsignedByte;
+class AsyncImporter;
+class ImporterCache;
 
 enum class MaterialAttribute: UnsignedInt;
 enum class MaterialTextureSwizzle: UnsignedInt;
@@ -24,8 +24,14 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <sstream>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/ScopeGuard.h>
 #include <Corrade/Containers/StaticArray.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/PluginManager/Manager.h>
@@ -38,7 +44,13 @@
 
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
+#include "Magnum/PixelFormatConversion.h"
 #include "Magnum/Implementation/converterUtilities.h"
+#include "Magnum/Math/ConfigurationValue.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/TextureTools/Decompress.h"
+#include "Magnum/TextureTools/Resample.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/AbstractImageConverter.h"
 #include "Magnum/Trade/ImageData.h"
@@ -207,6 +219,36 @@ file again:
 magnum-imageconverter cube-mips.exr --layer 2 --level 1 +x-128.exr
 @endcode
 
+Resizing a PNG file to 512x512 with a Lanczos filter using
+@ref TextureTools::resize(), generating a full mip chain for it with a Kaiser
+filter using @ref TextureTools::generateMipmaps() and saving it to a KTX2
+file:
+
+@code{.sh}
+magnum-imageconverter --resize "512 512" --resize-filter lanczos \
+    --generate-mipmaps kaiser image.png image-mips.ktx2
+@endcode
+
+Decompressing a BC7 DDS file using @ref TextureTools::decompress() and
+saving it to a PNG:
+
+@code{.sh}
+magnum-imageconverter --decompress image.dds image.png
+@endcode
+
+@subsection magnum-imageconverter-example-batch Converting many files at once
+
+Instead of launching the utility for each file, which means loading and
+instantiating the plugins again every time, a manifest listing tab-separated
+input and output file pairs can be passed to `--batch`. Here converting all
+PNG files in a directory to KTX2 using all available cores, reading the
+manifest from the standard input and printing the time spent on each file:
+
+@code{.sh}
+for i in *.png; do printf '%s\t%s\n' "$i" "${i%.png}.ktx2"; done | \
+    magnum-imageconverter --batch - -j0 --profile
+@endcode
+
 @section magnum-imageconverter-usage Full usage documentation
 
 @code{.sh}
@@ -214,7 +256,10 @@ magnum-imageconverter [-h|--help] [-I|--importer PLUGIN]
     [-C|--converter PLUGIN]... [--plugin-dir DIR] [--map]
     [-i|--importer-options key=val,key2=val2,…]
     [-c|--converter-options key=val,key2=val2,…]... [-D|--dimensions N]
-    [--image N] [--level N] [--layer N] [--layers] [--levels] [--in-place]
+    [--image N] [--level N] [--layer N] [--layers] [--levels]
+    [--decompress] [--pixel-format FORMAT] [--swizzle rgba] [--resize "X Y"]
+    [--resize-filter FILTER] [--generate-mipmaps FILTER]
+    [--in-place] [--batch FILE] [-j|--jobs N]
     [--info-importer] [--info-converter] [--info] [--color on|off|auto]
     [-v|--verbose] [--profile] [--] input output
 @endcode
@@ -244,7 +289,25 @@ Arguments:
 -   `--layers` --- combine multiple layers into an image with one dimension
     more
 -   `--levels` --- combine multiple image levels into a single file
+-   `--decompress` --- decompress the output image if it's in a compressed
+    format, implied by `--pixel-format`, `--swizzle`, `--resize` and
+    `--generate-mipmaps`
+-   `--pixel-format FORMAT` --- convert the output image to given
+    @ref PixelFormat using @ref convertPixelFormat()
+-   `--swizzle rgba` --- reorder channels of the output image, see
+    @ref convertPixelFormat() for details
+-   `--resize "X Y"` --- resize the output image to given size
+-   `--resize-filter FILTER` --- filter to use for `--resize`, one of `box`,
+    `bilinear`, `bicubic`, `lanczos` or `kaiser` (default: `box`)
+-   `--generate-mipmaps FILTER` --- generate a full mip chain for the
+    output image using given filter, one of `box`, `bilinear`, `bicubic`,
+    `lanczos` or `kaiser`
 -   `--in-place` --- overwrite the input image with the output
+-   `--batch FILE` --- convert input and output file pairs listed in a
+    manifest, `-` to read it from standard input
+-   `-j`, `--jobs N` --- process `--batch` files in given count of parallel
+    jobs, `0` to use all available cores (default: `1`). Can be used only
+    with `--batch`.
 -   `--info-importer` --- print info about the importer plugin and exit
 -   `--info-converter` --- print info about the image converter plugin and exit
 -   `--info` --- print info about the input file and exit
@@ -283,6 +346,22 @@ image-to-image or image-to-file conversion. If the last converter doesn't
 support conversion to a file, @relativeref{Trade,AnyImageConverter} is used to
 save its output; if no `-C` / `--converter` is specified,
 @relativeref{Trade,AnyImageConverter} is used.
+
+If `--batch` is given, the input and output files are taken from given manifest
+instead of the command line, with `-` reading it from the standard input. Each
+line contains an input and an output file separated by a tab, empty lines and
+lines starting with `#` are ignored. All other options are applied to each file
+and the importer and converter plugin instances are reused across files. The
+option can't be combined with `--in-place`, `--layers`, `--levels` or `--info`.
+The files are converted in given count of `--jobs` in parallel on a
+@ref ThreadPool, with each job having its own plugin manager and plugin
+instances. Operations such as `--resize` or `--generate-mipmaps` then process
+each image serially on the job that converts it. Order of the diagnostic
+output is preserved, with the output of each file printed as soon as it and all
+files before it are converted. A failure to convert one file doesn't abort the
+others, the exit code is the one of the first file that failed. With
+`--profile`, the import and conversion time is printed for each file and in
+total.
 */
 
 }
@@ -297,7 +376,7 @@ bool isPluginInfoRequested(const Utility::Arguments& args) {
            args.isSet("info-converter");
 }
 
-template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Arguments& args, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Containers::ArrayView<const Containers::StringView> inputs, const Containers::Array<Trade::ImageData<dimensions>>& images) {
     CORRADE_INTERNAL_ASSERT(!images.isEmpty());
     const bool compressed = images.front().isCompressed();
     PixelFormat format{};
@@ -312,7 +391,7 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
            (compressed && images[i].compressedFormat() != compressedFormat))
         {
             Error e;
-            e << "Images have different formats," << args.arrayValue("input", i) << "has";
+            e << "Images have different formats," << inputs[i] << "has";
             if(images[i].isCompressed())
                 e << images[i].compressedFormat();
             else
@@ -325,7 +404,7 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
             return false;
         }
         if(images[i].flags() != flags) {
-            Error{} << "Images have different flags," << args.arrayValue("input", i) << "has" << images[i].flags() << Debug::nospace << ", expected" << flags;
+            Error{} << "Images have different flags," << inputs[i] << "has" << images[i].flags() << Debug::nospace << ", expected" << flags;
             return false;
         }
     }
@@ -333,17 +412,129 @@ template<UnsignedInt dimensions> bool checkCommonFormatFlags(const Utility::Argu
     return true;
 }
 
-template<UnsignedInt dimensions> bool checkCommonFormatAndSize(const Utility::Arguments& args, const Containers::Array<Trade::ImageData<dimensions>>& images) {
-    if(!checkCommonFormatFlags(args, images))
+template<UnsignedInt dimensions> bool checkCommonFormatAndSize(const Containers::ArrayView<const Containers::StringView> inputs, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+    if(!checkCommonFormatFlags(inputs, images))
         return false;
 
     CORRADE_INTERNAL_ASSERT(!images.isEmpty());
     Math::Vector<dimensions, Int> size = images.front().size();
     for(std::size_t i = 1; i != images.size(); ++i) {
         if(images[i].size() != size) {
-            Error{} << "Images have different sizes," << args.arrayValue("input", i) << "has a size of" << images[i].size() << Debug::nospace << ", expected" << size;
+            Error{} << "Images have different sizes," << inputs[i] << "has a size of" << images[i].size() << Debug::nospace << ", expected" << size;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template<UnsignedInt dimensions> bool decompress(Containers::Array<Trade::ImageData<dimensions>>& images) {
+    for(Trade::ImageData<dimensions>& image: images) {
+        if(!image.isCompressed())
+            continue;
+
+        if(!TextureTools::isDecompressionSupported(image.compressedFormat())) {
+            Error{} << "Decompression of" << image.compressedFormat() << "is not supported";
+            return false;
+        }
+
+        const CompressedImageView<dimensions, const char> view = image;
+        Image<dimensions> decompressed = TextureTools::decompress(view);
+        /* Can't do this inline as the order in which the release() gets
+           called relative to the other getters is unspecified */
+        const PixelStorage storage = decompressed.storage();
+        const VectorTypeFor<dimensions, Int> size = decompressed.size();
+        const ImageFlags<dimensions> flags = decompressed.flags();
+        image = Trade::ImageData<dimensions>{storage, decompressed.format(), size, decompressed.release(), flags};
+    }
+
+    return true;
+}
+
+template<UnsignedInt dimensions> bool convertOutputPixelFormat(const Containers::Optional<PixelFormat>& format, const Vector4ub& swizzle, Containers::Array<Trade::ImageData<dimensions>>& images) {
+    for(Trade::ImageData<dimensions>& image: images) {
+        if(image.isCompressed()) {
+            Error{} << "The --pixel-format / --swizzle option isn't implemented for compressed images";
+            return false;
+        }
+
+        const PixelFormat targetFormat = format ? *format : image.format();
+        if(!isPixelFormatConversionSupported(image.format(), targetFormat)) {
+            Error{} << "Conversion from" << image.format() << "to" << targetFormat << "is not supported";
             return false;
         }
+
+        Image<dimensions> converted = Magnum::convertPixelFormat(image, targetFormat, swizzle);
+        /* Can't do this inline as the order in which the release() gets
+           called relative to the other getters is unspecified */
+        const PixelStorage storage = converted.storage();
+        const VectorTypeFor<dimensions, Int> size = converted.size();
+        const ImageFlags<dimensions> flags = converted.flags();
+        image = Trade::ImageData<dimensions>{storage, targetFormat, size, converted.release(), flags};
+    }
+
+    return true;
+}
+
+Containers::Optional<TextureTools::ResampleFilter> resampleFilter(const Containers::StringView option, const Containers::StringView name) {
+    if(name == "box"_s)
+        return TextureTools::ResampleFilter::Box;
+    if(name == "bilinear"_s)
+        return TextureTools::ResampleFilter::Bilinear;
+    if(name == "bicubic"_s)
+        return TextureTools::ResampleFilter::Bicubic;
+    if(name == "lanczos"_s)
+        return TextureTools::ResampleFilter::Lanczos;
+    if(name == "kaiser"_s)
+        return TextureTools::ResampleFilter::Kaiser;
+
+    Error{} << "Invalid" << option << "filter" << name << Debug::nospace << ", expected box, bilinear, bicubic, lanczos or kaiser";
+    return {};
+}
+
+/* Checks that the (single-level) image can be passed to TextureTools::resize()
+   or generateMipmaps(), which would assert otherwise */
+template<UnsignedInt dimensions> bool checkResampleable(const Containers::StringView option, const Containers::Array<Trade::ImageData<dimensions>>& images) {
+    CORRADE_INTERNAL_ASSERT(!images.isEmpty());
+    if(images.size() != 1) {
+        Error{} << "The" << option << "option can't be used with multi-level images";
+        return false;
+    }
+    if(images.front().isCompressed()) {
+        Error{} << "The" << option << "option isn't implemented for compressed images";
+        return false;
+    }
+
+    /* Mirrors the set of formats supported by TextureTools */
+    const PixelFormat format = images.front().format();
+    if(isPixelFormatImplementationSpecific(format) ||
+       isPixelFormatDepthOrStencil(format) ||
+       (pixelFormatChannelFormat(format) != PixelFormat::R8Unorm &&
+        pixelFormatChannelFormat(format) != PixelFormat::R8Srgb &&
+        pixelFormatChannelFormat(format) != PixelFormat::R16Unorm &&
+        pixelFormatChannelFormat(format) != PixelFormat::R16F &&
+        pixelFormatChannelFormat(format) != PixelFormat::R32F))
+    {
+        Error{} << "The" << option << "option isn't implemented for" << format;
+        return false;
+    }
+
+    return true;
+}
+
+template<UnsignedInt dimensions> bool generateMipmaps(const TextureTools::ResampleFilter filter, Containers::Array<Trade::ImageData<dimensions>>& images) {
+    if(!checkResampleable("--generate-mipmaps", images))
+        return false;
+
+    Containers::Array<Image<dimensions>> levels = TextureTools::generateMipmaps(images.front(), filter);
+    arrayReserve(images, levels.size() + 1);
+    for(Image<dimensions>& level: levels) {
+        /* Can't do this inline as the order in which the release() gets
+           called relative to the other getters is unspecified */
+        const PixelStorage storage = level.storage();
+        const VectorTypeFor<dimensions, Int> size = level.size();
+        const ImageFlags<dimensions> flags = level.flags();
+        arrayAppend(images, InPlaceInit, storage, level.format(), size, level.release(), flags);
     }
 
     return true;
@@ -383,189 +574,85 @@ template<UnsignedInt dimensions> bool convertImages(Trade::AbstractImageConverte
     return true;
 }
 
+Float seconds(const std::chrono::high_resolution_clock::duration time) {
+    return UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(time).count())/1.0e3f;
 }
 
-int main(int argc, char** argv) {
-    Utility::Arguments args;
-    args.addArrayArgument("input").setHelp("input", "input image(s)")
-        .addArgument("output").setHelp("output", "output image; ignored if --info is present, disallowed for --in-place")
-        .addOption('I', "importer", "AnyImageImporter").setHelp("importer", "image importer plugin", "PLUGIN")
-        .addArrayOption('C', "converter").setHelp("converter", "image converter plugin(s)", "PLUGIN")
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
-        #endif
-        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
-        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
-        #endif
-        .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
-        .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
-        .addOption('D', "dimensions", "2").setHelp("dimensions", "import and convert image of given dimensions", "N")
-        .addOption("image", "0").setHelp("image", "image to import", "N")
-        .addOption("level").setHelp("level", "import given image level instead of all", "N")
-        .addOption("layer").setHelp("layer", "extract a layer into an image with one dimension less", "N")
-        .addBooleanOption("layers").setHelp("layers", "combine multiple layers into an image with one dimension more")
-        .addBooleanOption("levels").setHelp("layers", "combine multiple image levels into a single file")
-        .addBooleanOption("in-place").setHelp("in-place", "overwrite the input image with the output")
-        .addBooleanOption("info-importer").setHelp("info-importer", "print info about the importer plugin and exit")
-        .addBooleanOption("info-converter").setHelp("info-converter", "print info about the image converter plugin and exit")
-        .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
-        .addOption("color", "auto").setHelp("color", "colored output for --info", "on|off|auto")
-        .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
-        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
-        .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
-            /* If --info for plugins is passed, we don't need the input */
-            if(error == Utility::Arguments::ParseError::MissingArgument &&
-               key == "input" && isPluginInfoRequested(args))
-                return true;
-            /* If --in-place or --info for plugins or data is passed, we don't
-               need the output argument */
-            if(error == Utility::Arguments::ParseError::MissingArgument &&
-               key == "output" && (args.isSet("in-place") || isPluginInfoRequested(args) || args.isSet("info")))
-                return true;
-
-            /* Handle all other errors as usual */
-            return false;
-        })
-        .setGlobalHelp(R"(Converts images of different formats.
-
-Specifying --importer raw:<format> will treat the input as a raw tightly-packed
-square of pixels in given pixel format. Specifying -C / --converter raw will
-save raw imported data instead of using a converter plugin.
-
-If the --info-importer or --info-converter option is given, the utility will
-print information about given plugin specified via the -I or -C option,
-including its configuration options potentially overriden with -i or -c. In
-this case no file is read and no conversion is done and neither the input nor
-the output file needs to be specified.
-
-If --info is given, the utility will print information about given data, independently of the -D / --dimensions option. In this case the input file is
-read but no conversion is done and output file doesn't need to be specified.
-
-The -i / --importer-options and -c / --converter-options arguments accept a
-comma-separated list of key/value pairs to set in the importer / converter
-plugin configuration. If the = character is omitted, it's equivalent to saying
-key=true; configuration subgroups are delimited with /. Prefix the key with +
-to add new options or multiple options of the same name.
-
-It's possible to specify the -C / --converter option (and correspondingly also
--c / --converter-options) multiple times in order to chain more converters
-together. All converters in the chain have to support image-to-image
-conversion, the last converter has to be either raw or support either
-image-to-image or image-to-file conversion. If the last converter doesn't
-support conversion to a file, AnyImageConverter is used to save its output; if
-no -C / --converter is specified, AnyImageConverter is used.)")
-        .parse(argc, argv);
-
-    /* Colored output. Enable only if a TTY. */
+/* Options parsed from the command line upfront */
+struct Options {
     Debug::Flags useColor;
-    if(args.value("color") == "on")
-        useColor = Debug::Flags{};
-    else if(args.value("color") == "off")
-        useColor = Debug::Flag::DisableColors;
-    else
-        useColor = Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors;
-
-    /* Generic checks */
-    if(const std::size_t inputCount = args.arrayValueCount("input")) {
-        /* Not an error in this case, it should be possible to just append
-           --info* to existing command line without having to remove anything.
-           But print a warning at least, it could also be a mistyped option. */
-        if(isPluginInfoRequested(args)) {
-            Warning w;
-            w << "Ignoring input files for --info:";
-            for(std::size_t i = 0; i != inputCount; ++i)
-                w << args.arrayValue<Containers::StringView>("input", i);
-        }
-    }
-    if(args.value<Containers::StringView>("output")) {
-        if(args.isSet("in-place")) {
-            Error{} << "Output file shouldn't be set for --in-place:" << args.value<Containers::StringView>("output");
-            return 1;
-        }
-
-        /* Same as above, it should be possible to just append --info* to
-           existing command line */
-        if(isPluginInfoRequested(args) || args.isSet("info"))
-            Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
-    }
-
-    /* Mutually incompatible options */
-    if(args.isSet("layers") && args.isSet("levels")) {
-        Error{} << "The --layers and --levels options can't be used together. First combine layers of each level and then all levels in a second step.";
-        return 1;
-    }
-    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("in-place")) {
-        Error{} << "The --layers / --levels option can't be combined with --in-place";
-        return 1;
-    }
-    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("info")) {
-        Error{} << "The --layers / --levels option can't be combined with --info";
-        return 1;
-    }
-    /* It can be combined with --levels though. This could potentially be
-       possible to implement, but I don't see a reason, all it would do is
-       picking Nth image from the input set and recompress it. OTOH, combining
-       --levels and --level "works", the --level picks Nth level from each
-       input image, although the usefulness of that is also doubtful. Why
-       create multi-level images from images that are already multi-level? */
-    if(args.isSet("layers") && !args.value("layer").empty()) {
-        Error{} << "The --layers option can't be combined with --layer.";
-        return 1;
-    }
-    if(args.isSet("levels") && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
-        Error{} << "The --levels option can't be combined with raw data output";
-        return 1;
-    }
-    if(!args.isSet("layers") && !args.isSet("levels") && args.arrayValueCount("input") > 1 && !isPluginInfoRequested(args)) {
-        Error{} << "Multiple input files require the --layers / --levels option to be set";
-        return 1;
+    Containers::Optional<PixelFormat> pixelFormat;
+    Vector4ub swizzle;
+    Containers::Optional<TextureTools::ResampleFilter> resizeFilter;
+    Containers::Optional<TextureTools::ResampleFilter> mipmapFilter;
+};
+
+/* Plugin managers and plugin instances used for a conversion. Plugin loading
+   and instantiation isn't thread-safe and the Any* plugins load and
+   instantiate the concrete plugin on every opened file, so in the --batch
+   mode each job has its own set, including the managers. */
+struct Plugins {
+    explicit Plugins(const Utility::Arguments& args):
+        importerManager{
+            #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+            args.value("plugin-dir").empty() ? Containers::String{} :
+            Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImporter::pluginSearchPaths().back()))
+            #endif
+        },
+        converterManager{
+            #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+            args.value("plugin-dir").empty() ? Containers::String{} :
+            Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImageConverter::pluginSearchPaths().back()))
+            #endif
+        },
+        /* One for each --converter and one for the implicit
+           AnyImageConverter at the end, stays null for raw output */
+        converters{args.arrayValueCount("converter") + 1} {}
+
+    PluginManager::Manager<Trade::AbstractImporter> importerManager;
+    PluginManager::Manager<Trade::AbstractImageConverter> converterManager;
+    Containers::Pointer<Trade::AbstractImporter> importer;
+    Containers::Array<Containers::Pointer<Trade::AbstractImageConverter>> converters;
+};
+
+Containers::Pointer<Trade::AbstractImporter> instantiateImporter(const Utility::Arguments& args, PluginManager::Manager<Trade::AbstractImporter>& manager) {
+    Containers::Pointer<Trade::AbstractImporter> importer = manager.loadAndInstantiate(args.value("importer"));
+    if(!importer) {
+        Debug{} << "Available importer plugins:" << ", "_s.join(manager.aliasList());
+        return {};
     }
 
-    /* Importer and converter manager */
-    PluginManager::Manager<Trade::AbstractImporter> importerManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImporter::pluginSearchPaths().back()))
-        #endif
-    };
-    PluginManager::Manager<Trade::AbstractImageConverter> converterManager{
-        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
-        args.value("plugin-dir").empty() ? Containers::String{} :
-        Utility::Path::join(args.value("plugin-dir"), Utility::Path::filename(Trade::AbstractImageConverter::pluginSearchPaths().back()))
-        #endif
-    };
-
-    /* Print plugin info, if requested */
-    if(args.isSet("info-importer")) {
-        Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
-        if(!importer) {
-            Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
-            return 1;
-        }
+    /* Set options, if passed */
+    if(args.isSet("verbose"))
+        importer->addFlags(Trade::ImporterFlag::Verbose);
+    Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
+    return importer;
+}
 
-        /* Set options, if passed */
-        if(args.isSet("verbose"))
-            importer->addFlags(Trade::ImporterFlag::Verbose);
-        Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
-        Trade::Implementation::printImporterInfo(useColor, *importer);
-        return 0;
+/* The index is equal to the --converter count for the implicit
+   AnyImageConverter at the end */
+Containers::Pointer<Trade::AbstractImageConverter> instantiateConverter(const Utility::Arguments& args, PluginManager::Manager<Trade::AbstractImageConverter>& manager, const std::size_t i) {
+    const Containers::StringView name = i == args.arrayValueCount("converter") ?
+        "AnyImageConverter"_s : args.arrayValue<Containers::StringView>("converter", i);
+    Containers::Pointer<Trade::AbstractImageConverter> converter = manager.loadAndInstantiate(name);
+    if(!converter) {
+        Debug{} << "Available converter plugins:" << ", "_s.join(manager.aliasList());
+        return {};
     }
-    if(args.isSet("info-converter")) {
-        Containers::Pointer<Trade::AbstractImageConverter> converter = converterManager.loadAndInstantiate(args.arrayValueCount("converter") ? args.arrayValue("converter", 0) : "AnyImageConverter");
-        if(!converter) {
-            Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
-            return 1;
-        }
 
-        /* Set options, if passed */
-        if(args.isSet("verbose"))
-            converter->addFlags(Trade::ImageConverterFlag::Verbose);
-        if(args.arrayValueCount("converter-options"))
-            Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", 0));
-        Trade::Implementation::printImageConverterInfo(useColor, *converter);
-        return 0;
-    }
+    /* Set options, if passed */
+    if(args.isSet("verbose"))
+        converter->addFlags(Trade::ImageConverterFlag::Verbose);
+    if(i < args.arrayValueCount("converter-options"))
+        Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", i));
+    return converter;
+}
 
+/* Imports given input(s), processes them and converts to given output. Used
+   for both a single conversion and for each entry in the --batch mode.
+   Returns the process exit code, the import and conversion time is added to
+   the passed durations. */
+int convert(const Utility::Arguments& args, const Options& options, Plugins& plugins, const Containers::ArrayView<const Containers::StringView> inputs, const Containers::StringView output, std::chrono::high_resolution_clock::duration& importTime, std::chrono::high_resolution_clock::duration& conversionTime) {
     const Int dimensions = args.value<Int>("dimensions");
     /** @todo make them array options as well? */
     const UnsignedInt image = args.value<UnsignedInt>("image");
@@ -575,15 +662,19 @@ no -C / --converter is specified, AnyImageConverter is used.)")
     #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
     Containers::Array<Containers::Array<const char, Utility::Path::MapDeleter>> mapped;
     #endif
+    /* The importer is reused for the next conversion, close it on every
+       return path so it doesn't keep the last file open (and, with --map,
+       referencing memory that gets unmapped at the end of this scope). The
+       guard is destroyed after the images but before the mappings. */
+    Containers::ScopeGuard closeImporter{&plugins, [](Plugins* plugins) {
+        if(plugins->importer)
+            plugins->importer->close();
+    }};
     Containers::Array<Trade::ImageData1D> images1D;
     Containers::Array<Trade::ImageData2D> images2D;
     Containers::Array<Trade::ImageData3D> images3D;
 
-    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
-    std::chrono::high_resolution_clock::duration importTime{};
-
-    for(std::size_t i = 0, max = args.arrayValueCount("input"); i != max; ++i) {
-        const Containers::StringView input = args.arrayValue<Containers::StringView>("input", i);
+    for(const Containers::StringView input: inputs) {
 
         /* Load raw data, if requested; assume it's a tightly-packed square of
            given format */
@@ -645,7 +736,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                 Debug{} << "Image 0:" << format << Vector2i{side};
 
                 if(args.isSet("profile")) {
-                    Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds";
+                    Debug{} << "Import took" << seconds(importTime) << "seconds";
                 }
 
                 return 0;
@@ -655,16 +746,11 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
         /* Otherwise load it using an importer plugin */
         } else {
-            Containers::Pointer<Trade::AbstractImporter> importer = importerManager.loadAndInstantiate(args.value("importer"));
-            if(!importer) {
-                Debug{} << "Available importer plugins:" << ", "_s.join(importerManager.aliasList());
+            /* Instantiate the importer on first use, it's then reused for
+               all other inputs */
+            if(!plugins.importer && !(plugins.importer = instantiateImporter(args, plugins.importerManager)))
                 return 1;
-            }
-
-            /* Set options, if passed */
-            if(args.isSet("verbose"))
-                importer->addFlags(Trade::ImporterFlag::Verbose);
-            Implementation::setOptions(*importer, "AnyImageImporter", args.value("importer-options"));
+            Trade::AbstractImporter* const importer = plugins.importer.get();
 
             /* Open the file or map it if requested */
             #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
@@ -705,10 +791,10 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                 Containers::Array<Trade::Implementation::ImageInfo> infos =
                     Trade::Implementation::imageInfo(*importer, error, importTime);
 
-                Trade::Implementation::printImageInfo(useColor, infos, nullptr, nullptr, nullptr);
+                Trade::Implementation::printImageInfo(options.useColor, infos, nullptr, nullptr, nullptr);
 
                 if(args.isSet("profile")) {
-                    Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds";
+                    Debug{} << "Import took" << seconds(importTime) << "seconds";
                 }
 
                 return error ? 1 : 0;
@@ -853,16 +939,6 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         }
     }
 
-    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
-    std::chrono::high_resolution_clock::duration conversionTime{};
-
-    Containers::StringView output;
-    if(args.isSet("in-place")) {
-        /* Should have been checked in a graceful way above */
-        CORRADE_INTERNAL_ASSERT(args.arrayValueCount("input") == 1);
-        output = args.arrayValue<Containers::StringView>("input", 0);
-    } else output = args.value<Containers::StringView>("output");
-
     Int outputDimensions;
     Containers::Array<Trade::ImageData1D> outputImages1D;
     Containers::Array<Trade::ImageData2D> outputImages2D;
@@ -874,7 +950,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         Trade::Implementation::Duration d{conversionTime};
 
         if(dimensions == 1) {
-            if(!checkCommonFormatAndSize(args, images1D))
+            if(!checkCommonFormatAndSize(inputs, images1D))
                 return 1;
 
             outputDimensions = 2;
@@ -903,7 +979,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             }
 
         } else if(dimensions == 2) {
-            if(!checkCommonFormatAndSize(args, images2D))
+            if(!checkCommonFormatAndSize(inputs, images2D))
                 return 1;
 
             outputDimensions = 3;
@@ -950,7 +1026,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
             /* There can be multiple input levels, and a layer should get
                extracted from each level, forming a multi-level image again */
-            if(!checkCommonFormatFlags(args, images2D))
+            if(!checkCommonFormatFlags(inputs, images2D))
                 return 1;
             if(!images2D.front().isCompressed()) {
                 for(std::size_t i = 0; i != images2D.size(); ++i) {
@@ -958,17 +1034,20 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                        don't have the filename etc. anymore */
                     CORRADE_INTERNAL_ASSERT(layer < images2D[i].size().y());
 
-                    /* Copy the layer to a newly alllocated image */
-                    /** @todo if the GL-inspired PixelStorage API wasn't CRAP,
-                        we could just reuse the original memory and slice it.
-                        But because Y skip is ignored for 1D images, it just
-                        won't work. Rework once it's in a better shape. */
-                    Trade::ImageData1D copy{PixelStorage{}.setAlignment(1),
+                    /* Reference the layer in the original memory instead
+                       of copying it. As Y skip is ignored for 1D images,
+                       the data are sliced to contain directly just the
+                       pixels of the row, so raw output doesn't include the
+                       following rows. The images2D array stays in scope
+                       for as long as outputImages1D. */
+                    const std::pair<Math::Vector2<std::size_t>, Math::Vector2<std::size_t>> dataProperties = images2D[i].dataProperties();
+                    const std::size_t offset = dataProperties.first.sum() + layer*dataProperties.second.x();
+                    arrayAppend(outputImages1D, InPlaceInit,
+                        PixelStorage{}.setAlignment(1),
                         images2D[i].format(), images2D[i].formatExtra(),
                         images2D[i].pixelSize(), images2D[i].size().x(),
-                        Containers::Array<char>{NoInit, std::size_t(images2D[i].size().x()*images2D[i].pixelSize())}};
-                    Utility::copy(images2D[i].pixels()[layer], copy.mutablePixels());
-                    arrayAppend(outputImages1D, Utility::move(copy));
+                        Trade::DataFlags{},
+                        images2D[i].data().slice(offset, offset + images2D[i].pixelSize()*images2D[i].size().x()));
                 }
 
             } else {
@@ -981,7 +1060,7 @@ no -C / --converter is specified, AnyImageConverter is used.)")
 
             /* There can be multiple input levels, and a layer should get
                extracted from each level, forming a multi-level image again */
-            if(!checkCommonFormatFlags(args, images3D))
+            if(!checkCommonFormatFlags(inputs, images3D))
                 return 1;
             if(!images3D.front().isCompressed()) {
                 for(std::size_t i = 0; i != images3D.size(); ++i) {
@@ -989,17 +1068,25 @@ no -C / --converter is specified, AnyImageConverter is used.)")
                        don't have the filename etc. anymore */
                     CORRADE_INTERNAL_ASSERT(layer < images3D[i].size().z());
 
-                    /* Copy the layer to a newly alllocated image */
-                    /** @todo if the GL-inspired PixelStorage API wasn't CRAP,
-                        we could just reuse the original memory and slice it.
-                        But because Y skip is ignored for 1D images, it just
-                        won't work. Rework once it's in a better shape. */
-                    Trade::ImageData2D copy{PixelStorage{}.setAlignment(1),
+                    /* Reference the layer in the original memory instead
+                       of copying it. The data are sliced to contain just
+                       the layer, so raw output doesn't include the
+                       following layers. The X and Y skip, row length and
+                       alignment stay the same. The images3D array stays in
+                       scope for as long as outputImages2D. */
+                    const PixelStorage storage = images3D[i].storage();
+                    const std::pair<Math::Vector3<std::size_t>, Math::Vector3<std::size_t>> dataProperties = images3D[i].dataProperties();
+                    const std::size_t offset = dataProperties.first.z() + layer*dataProperties.second.xy().product();
+                    const std::size_t size = dataProperties.first.xy().sum() + dataProperties.second.xy().product();
+                    arrayAppend(outputImages2D, InPlaceInit,
+                        PixelStorage{}
+                            .setAlignment(storage.alignment())
+                            .setRowLength(storage.rowLength())
+                            .setSkip({storage.skip().xy(), 0}),
                         images3D[i].format(), images3D[i].formatExtra(),
                         images3D[i].pixelSize(), images3D[i].size().xy(),
-                        Containers::Array<char>{NoInit, std::size_t(images3D[i].size().xy().product()*images3D[i].pixelSize())}};
-                    Utility::copy(images3D[i].pixels()[layer], copy.mutablePixels());
-                    arrayAppend(outputImages2D, Utility::move(copy));
+                        Trade::DataFlags{},
+                        images3D[i].data().slice(offset, Math::min(offset + size, images3D[i].data().size())));
                 }
 
             } else {
@@ -1014,23 +1101,103 @@ no -C / --converter is specified, AnyImageConverter is used.)")
        --levels is set or if the (single) input image is multi-level. */
     } else {
         if(dimensions == 1) {
-            if(!checkCommonFormatFlags(args, images1D))
+            if(!checkCommonFormatFlags(inputs, images1D))
                 return 1;
             outputDimensions = 1;
             outputImages1D = Utility::move(images1D);
         } else if(dimensions == 2) {
-            if(!checkCommonFormatFlags(args, images2D))
+            if(!checkCommonFormatFlags(inputs, images2D))
                 return 1;
             outputDimensions = 2;
             outputImages2D = Utility::move(images2D);
         } else if(dimensions == 3) {
-            if(!checkCommonFormatFlags(args, images3D))
+            if(!checkCommonFormatFlags(inputs, images3D))
                 return 1;
             outputDimensions = 3;
             outputImages3D = Utility::move(images3D);
         } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
     }
 
+    /* Decompress all output levels, if requested or if any of the operations
+       below need uncompressed data. Uncompressed levels are kept as-is. */
+    if(args.isSet("decompress") || options.pixelFormat || !args.value("swizzle").empty() || options.resizeFilter || options.mipmapFilter) {
+        Trade::Implementation::Duration d{conversionTime};
+
+        if(outputDimensions == 1) {
+            /* Let the operations below fail on compressed 1D images instead,
+               with a more specific message */
+            if(args.isSet("decompress")) {
+                Error{} << "The --decompress option can be only used with 2D and 3D images, not 1D";
+                return 1;
+            }
+        } else if(outputDimensions == 2) {
+            if(!decompress(outputImages2D))
+                return 1;
+        } else if(outputDimensions == 3) {
+            if(!decompress(outputImages3D))
+                return 1;
+        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+    }
+
+    /* Convert the pixel format of all output levels, if requested. Done
+       before resizing and mip generation so it's possible to for example
+       turn an 8-bit sRGB image to a half-float one first and have those
+       operations done in a higher precision. */
+    if(options.pixelFormat || !args.value("swizzle").empty()) {
+        Trade::Implementation::Duration d{conversionTime};
+
+        if(outputDimensions == 1) {
+            if(!convertOutputPixelFormat(options.pixelFormat, options.swizzle, outputImages1D))
+                return 1;
+        } else if(outputDimensions == 2) {
+            if(!convertOutputPixelFormat(options.pixelFormat, options.swizzle, outputImages2D))
+                return 1;
+        } else if(outputDimensions == 3) {
+            if(!convertOutputPixelFormat(options.pixelFormat, options.swizzle, outputImages3D))
+                return 1;
+        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+    }
+
+    /* Resize the (single-level) output, if requested. Done after --layers
+       and --layer so it's possible to for example extract a layer and resize
+       it in one go. */
+    if(options.resizeFilter) {
+        Trade::Implementation::Duration d{conversionTime};
+
+        if(outputDimensions != 2) {
+            Error{} << "The --resize option can be only used with 2D images, not" << Debug::nospace << outputDimensions << Debug::nospace << "D";
+            return 1;
+        }
+        if(!checkResampleable("--resize", outputImages2D))
+            return 1;
+
+        Image2D resized = TextureTools::resize(outputImages2D.front(), args.value<Vector2i>("resize"), *options.resizeFilter);
+        /* Can't do this inline as the order in which the release() gets
+           called relative to the other getters is unspecified */
+        const PixelStorage storage = resized.storage();
+        const Vector2i size = resized.size();
+        const ImageFlags2D flags = resized.flags();
+        outputImages2D.front() = Trade::ImageData2D{storage, resized.format(), size, resized.release(), flags};
+    }
+
+    /* Generate a mip chain for the (single-level) output, if requested. Done
+       after --layers and --layer so it's possible to for example combine
+       multiple images into a 2D array and generate mips for it in one go. */
+    if(options.mipmapFilter) {
+        Trade::Implementation::Duration d{conversionTime};
+
+        if(outputDimensions == 1) {
+            Error{} << "The --generate-mipmaps option can be only used with 2D and 3D images, not 1D";
+            return 1;
+        } else if(outputDimensions == 2) {
+            if(!generateMipmaps(*options.mipmapFilter, outputImages2D))
+                return 1;
+        } else if(outputDimensions == 3) {
+            if(!generateMipmaps(*options.mipmapFilter, outputImages3D))
+                return 1;
+        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE();
+    }
+
     const bool outputIsMultiLevel =
         outputImages1D.size() > 1 ||
         outputImages2D.size() > 1 ||
@@ -1050,19 +1217,13 @@ no -C / --converter is specified, AnyImageConverter is used.)")
             (outputDimensions == 2 && outputImages2D.front().isCompressed()) ||
             (outputDimensions == 3 && outputImages3D.front().isCompressed());
 
-        /* Load converter plugin if a raw conversion is not requested */
-        Containers::Pointer<Trade::AbstractImageConverter> converter;
+        /* Load converter plugin on first use if a raw conversion is not
+           requested */
+        Trade::AbstractImageConverter* converter = nullptr;
         if(converterName != "raw"_s) {
-            if(!(converter = converterManager.loadAndInstantiate(converterName))) {
-                Debug{} << "Available converter plugins:" << ", "_s.join(converterManager.aliasList());
+            if(!plugins.converters[i] && !(plugins.converters[i] = instantiateConverter(args, plugins.converterManager, i)))
                 return 2;
-            }
-
-            /* Set options, if passed */
-            if(args.isSet("verbose"))
-                converter->addFlags(Trade::ImageConverterFlag::Verbose);
-            if(i < args.arrayValueCount("converter-options"))
-                Implementation::setOptions(*converter, "AnyImageConverter", args.arrayValue("converter-options", i));
+            converter = plugins.converters[i].get();
         }
 
         /* This is the last --converter (a raw output, a file-capable converter
@@ -1245,8 +1406,458 @@ no -C / --converter is specified, AnyImageConverter is used.)")
         }
     }
 
+    return 0;
+}
+}
+
+int main(int argc, char** argv) {
+    Utility::Arguments args;
+    args.addArrayArgument("input").setHelp("input", "input image(s)")
+        .addArgument("output").setHelp("output", "output image; ignored if --info is present, disallowed for --in-place")
+        .addOption('I', "importer", "AnyImageImporter").setHelp("importer", "image importer plugin", "PLUGIN")
+        .addArrayOption('C', "converter").setHelp("converter", "image converter plugin(s)", "PLUGIN")
+        #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+        .addOption("plugin-dir").setHelp("plugin-dir", "override base plugin dir", "DIR")
+        #endif
+        #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+        .addBooleanOption("map").setHelp("map", "memory-map the input for zero-copy import (works only for standalone files)")
+        #endif
+        .addOption('i', "importer-options").setHelp("importer-options", "configuration options to pass to the importer", "key=val,key2=val2,…")
+        .addArrayOption('c', "converter-options").setHelp("converter-options", "configuration options to pass to the converter(s)", "key=val,key2=val2,…")
+        .addOption('D', "dimensions", "2").setHelp("dimensions", "import and convert image of given dimensions", "N")
+        .addOption("image", "0").setHelp("image", "image to import", "N")
+        .addOption("level").setHelp("level", "import given image level instead of all", "N")
+        .addOption("layer").setHelp("layer", "extract a layer into an image with one dimension less", "N")
+        .addBooleanOption("layers").setHelp("layers", "combine multiple layers into an image with one dimension more")
+        .addBooleanOption("levels").setHelp("layers", "combine multiple image levels into a single file")
+        .addBooleanOption("decompress").setHelp("decompress", "decompress the output image if it's in a compressed format")
+        .addOption("pixel-format").setHelp("pixel-format", "convert the output image to given pixel format", "FORMAT")
+        .addOption("swizzle").setHelp("swizzle", "reorder channels of the output image", "rgba")
+        .addOption("resize").setHelp("resize", "resize the output image to given size", "\"X Y\"")
+        .addOption("resize-filter", "box").setHelp("resize-filter", "filter to use for --resize", "box|bilinear|bicubic|lanczos|kaiser")
+        .addOption("generate-mipmaps").setHelp("generate-mipmaps", "generate a full mip chain for the output image using given filter", "box|bilinear|bicubic|lanczos|kaiser")
+        .addBooleanOption("in-place").setHelp("in-place", "overwrite the input image with the output")
+        .addOption("batch").setHelp("batch", "convert input and output file pairs listed in a manifest, - to read it from standard input", "FILE")
+        .addOption('j', "jobs", "1").setHelp("jobs", "process --batch files in given count of parallel jobs, 0 to use all available cores, can be used only with --batch", "N")
+        .addBooleanOption("info-importer").setHelp("info-importer", "print info about the importer plugin and exit")
+        .addBooleanOption("info-converter").setHelp("info-converter", "print info about the image converter plugin and exit")
+        .addBooleanOption("info").setHelp("info", "print info about the input file and exit")
+        .addOption("color", "auto").setHelp("color", "colored output for --info", "on|off|auto")
+        .addBooleanOption('v', "verbose").setHelp("verbose", "verbose output from importer and converter plugins")
+        .addBooleanOption("profile").setHelp("profile", "measure import and conversion time")
+        .setParseErrorCallback([](const Utility::Arguments& args, Utility::Arguments::ParseError error, const std::string& key) {
+            /* If --info for plugins or --batch is passed, we don't need the
+               input */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               key == "input" && (isPluginInfoRequested(args) || args.value<Containers::StringView>("batch")))
+                return true;
+            /* If --in-place, --info for plugins or data or --batch is passed,
+               we don't need the output argument */
+            if(error == Utility::Arguments::ParseError::MissingArgument &&
+               key == "output" && (args.isSet("in-place") || isPluginInfoRequested(args) || args.isSet("info") || args.value<Containers::StringView>("batch")))
+                return true;
+
+            /* Handle all other errors as usual */
+            return false;
+        })
+        .setGlobalHelp(R"(Converts images of different formats.
+
+Specifying --importer raw:<format> will treat the input as a raw tightly-packed
+square of pixels in given pixel format. Specifying -C / --converter raw will
+save raw imported data instead of using a converter plugin.
+
+If the --info-importer or --info-converter option is given, the utility will
+print information about given plugin specified via the -I or -C option,
+including its configuration options potentially overriden with -i or -c. In
+this case no file is read and no conversion is done and neither the input nor
+the output file needs to be specified.
+
+If --info is given, the utility will print information about given data, independently of the -D / --dimensions option. In this case the input file is
+read but no conversion is done and output file doesn't need to be specified.
+
+The -i / --importer-options and -c / --converter-options arguments accept a
+comma-separated list of key/value pairs to set in the importer / converter
+plugin configuration. If the = character is omitted, it's equivalent to saying
+key=true; configuration subgroups are delimited with /. Prefix the key with +
+to add new options or multiple options of the same name.
+
+It's possible to specify the -C / --converter option (and correspondingly also
+-c / --converter-options) multiple times in order to chain more converters
+together. All converters in the chain have to support image-to-image
+conversion, the last converter has to be either raw or support either
+image-to-image or image-to-file conversion. If the last converter doesn't
+support conversion to a file, AnyImageConverter is used to save its output; if
+no -C / --converter is specified, AnyImageConverter is used.
+
+If --batch is given, the input and output files are taken from given manifest
+instead of the command line, with - reading it from the standard input. Each
+line contains an input and an output file separated by a tab, empty lines and
+lines starting with # are ignored. All other options are applied to each file
+and the importer and converter plugin instances are reused across files. The
+files are converted in given count of --jobs in parallel, with each job having
+its own plugin instances. Order of the diagnostic output is preserved, with the
+output of each file printed as soon as it and all files before it are
+converted. A failure to convert one file doesn't abort the others. With
+--profile, the import and conversion time is printed for each file and in
+total.)")
+        .parse(argc, argv);
+
+    /* Colored output. Enable only if a TTY. */
+    Debug::Flags useColor;
+    if(args.value("color") == "on")
+        useColor = Debug::Flags{};
+    else if(args.value("color") == "off")
+        useColor = Debug::Flag::DisableColors;
+    else
+        useColor = Debug::isTty() ? Debug::Flags{} : Debug::Flag::DisableColors;
+
+    /* Generic checks */
+    if(const std::size_t inputCount = args.arrayValueCount("input")) {
+        /* Not an error in this case, it should be possible to just append
+           --info* to existing command line without having to remove anything.
+           But print a warning at least, it could also be a mistyped option. */
+        if(isPluginInfoRequested(args)) {
+            Warning w;
+            w << "Ignoring input files for --info:";
+            for(std::size_t i = 0; i != inputCount; ++i)
+                w << args.arrayValue<Containers::StringView>("input", i);
+        }
+    }
+    if(args.value<Containers::StringView>("output")) {
+        if(args.isSet("in-place")) {
+            Error{} << "Output file shouldn't be set for --in-place:" << args.value<Containers::StringView>("output");
+            return 1;
+        }
+
+        /* Same as above, it should be possible to just append --info* to
+           existing command line */
+        if(isPluginInfoRequested(args) || args.isSet("info"))
+            Warning{} << "Ignoring output file for --info:" << args.value<Containers::StringView>("output");
+    }
+
+    if(args.value<Containers::StringView>("batch")) {
+        if(args.arrayValueCount("input") || args.value<Containers::StringView>("output")) {
+            Error{} << "Input and output files shouldn't be set for --batch";
+            return 1;
+        }
+        if(args.isSet("in-place") || args.isSet("layers") || args.isSet("levels") || args.isSet("info")) {
+            Error{} << "The --batch option can't be combined with --in-place, --layers, --levels or --info";
+            return 1;
+        }
+    }
+    if(args.value<UnsignedInt>("jobs") != 1 && !args.value<Containers::StringView>("batch")) {
+        Error{} << "The --jobs option can be used only with --batch";
+        return 1;
+    }
+
+    /* Mutually incompatible options */
+    if(args.isSet("layers") && args.isSet("levels")) {
+        Error{} << "The --layers and --levels options can't be used together. First combine layers of each level and then all levels in a second step.";
+        return 1;
+    }
+    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("in-place")) {
+        Error{} << "The --layers / --levels option can't be combined with --in-place";
+        return 1;
+    }
+    if((args.isSet("layers") || args.isSet("levels")) && args.isSet("info")) {
+        Error{} << "The --layers / --levels option can't be combined with --info";
+        return 1;
+    }
+    Containers::Optional<PixelFormat> pixelFormat;
+    if(!args.value("pixel-format").empty()) {
+        const PixelFormat format = Utility::ConfigurationValue<PixelFormat>::fromString(args.value("pixel-format"), {});
+        if(format == PixelFormat{}) {
+            Error{} << "Invalid --pixel-format" << args.value("pixel-format");
+            return 1;
+        }
+        pixelFormat = format;
+    }
+    Vector4ub swizzle{0, 1, 2, 3};
+    if(!args.value("swizzle").empty()) {
+        const Containers::StringView value = args.value<Containers::StringView>("swizzle");
+        if(value.size() > 4) {
+            Error{} << "Invalid --swizzle" << value << Debug::nospace << ", expected at most four channels";
+            return 1;
+        }
+        for(std::size_t i = 0; i != value.size(); ++i) {
+            switch(value[i]) {
+                case 'r': swizzle[i] = 0; break;
+                case 'g': swizzle[i] = 1; break;
+                case 'b': swizzle[i] = 2; break;
+                case 'a': swizzle[i] = 3; break;
+                default:
+                    Error{} << "Invalid --swizzle" << value << Debug::nospace << ", expected a combination of r, g, b and a";
+                    return 1;
+            }
+        }
+    }
+    if((pixelFormat || !args.value("swizzle").empty()) && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
+        Error{} << "The --pixel-format / --swizzle option can't be combined with raw data output";
+        return 1;
+    }
+    Containers::Optional<TextureTools::ResampleFilter> resizeFilter;
+    if(!args.value("resize").empty()) {
+        if(!(resizeFilter = resampleFilter("--resize-filter", args.value<Containers::StringView>("resize-filter"))))
+            return 1;
+        if(args.value<Vector2i>("resize").min() <= 0) {
+            Error{} << "Invalid --resize size" << args.value("resize");
+            return 1;
+        }
+        if(args.isSet("levels")) {
+            Error{} << "The --resize option can't be combined with --levels";
+            return 1;
+        }
+    }
+    Containers::Optional<TextureTools::ResampleFilter> mipmapFilter;
+    if(!args.value("generate-mipmaps").empty()) {
+        if(!(mipmapFilter = resampleFilter("--generate-mipmaps", args.value<Containers::StringView>("generate-mipmaps"))))
+            return 1;
+        if(args.isSet("levels")) {
+            Error{} << "The --generate-mipmaps option can't be combined with --levels";
+            return 1;
+        }
+        if(args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
+            Error{} << "The --generate-mipmaps option can't be combined with raw data output";
+            return 1;
+        }
+    }
+    /* It can be combined with --levels though. This could potentially be
+       possible to implement, but I don't see a reason, all it would do is
+       picking Nth image from the input set and recompress it. OTOH, combining
+       --levels and --level "works", the --level picks Nth level from each
+       input image, although the usefulness of that is also doubtful. Why
+       create multi-level images from images that are already multi-level? */
+    if(args.isSet("layers") && !args.value("layer").empty()) {
+        Error{} << "The --layers option can't be combined with --layer.";
+        return 1;
+    }
+    if(args.isSet("levels") && args.arrayValueCount("converter") && args.arrayValue("converter", args.arrayValueCount("converter") - 1) == "raw") {
+        Error{} << "The --levels option can't be combined with raw data output";
+        return 1;
+    }
+    if(!args.isSet("layers") && !args.isSet("levels") && args.arrayValueCount("input") > 1 && !isPluginInfoRequested(args)) {
+        Error{} << "Multiple input files require the --layers / --levels option to be set";
+        return 1;
+    }
+
+    /* Print plugin info, if requested */
+    if(args.isSet("info-importer")) {
+        Plugins plugins{args};
+        Containers::Pointer<Trade::AbstractImporter> importer = instantiateImporter(args, plugins.importerManager);
+        if(!importer)
+            return 1;
+
+        Trade::Implementation::printImporterInfo(useColor, *importer);
+        return 0;
+    }
+    if(args.isSet("info-converter")) {
+        Plugins plugins{args};
+        /* Picks the first --converter or AnyImageConverter if there's none */
+        Containers::Pointer<Trade::AbstractImageConverter> converter = instantiateConverter(args, plugins.converterManager, 0);
+        if(!converter)
+            return 1;
+
+        Trade::Implementation::printImageConverterInfo(useColor, *converter);
+        return 0;
+    }
+
+    Options options;
+    options.useColor = useColor;
+    options.pixelFormat = pixelFormat;
+    options.swizzle = swizzle;
+    options.resizeFilter = resizeFilter;
+    options.mipmapFilter = mipmapFilter;
+
+    /* Wow, C++, you suck. This implicitly initializes to random shit?! */
+    std::chrono::high_resolution_clock::duration importTime{};
+    std::chrono::high_resolution_clock::duration conversionTime{};
+
+    /* Single conversion */
+    if(!args.value<Containers::StringView>("batch")) {
+        Containers::Array<Containers::StringView> inputs{NoInit, args.arrayValueCount("input")};
+        for(std::size_t i = 0; i != inputs.size(); ++i)
+            inputs[i] = args.arrayValue<Containers::StringView>("input", i);
+
+        Containers::StringView output;
+        if(args.isSet("in-place")) {
+            /* Should have been checked in a graceful way above */
+            CORRADE_INTERNAL_ASSERT(inputs.size() == 1);
+            output = inputs[0];
+        } else output = args.value<Containers::StringView>("output");
+
+        Plugins plugins{args};
+        if(const int result = convert(args, options, plugins, inputs, output, importTime, conversionTime))
+            return result;
+
+        if(args.isSet("profile")) {
+            Debug{} << "Import took" << seconds(importTime) << "seconds, conversion"
+                << seconds(conversionTime) << "seconds";
+        }
+
+        return 0;
+    }
+
+    /* Batch conversion, read the manifest either from a file or from the
+       standard input */
+    Containers::Array<char> manifest;
+    if(args.value<Containers::StringView>("batch") == "-"_s) {
+        char buffer[4096];
+        while(const std::size_t size = std::fread(buffer, 1, sizeof(buffer), stdin))
+            arrayAppend(manifest, Containers::arrayView(buffer, size));
+    } else {
+        Containers::Optional<Containers::Array<char>> manifestMaybe = Utility::Path::read(args.value<Containers::StringView>("batch"));
+        if(!manifestMaybe) {
+            Error{} << "Cannot read the --batch manifest" << args.value<Containers::StringView>("batch");
+            return 1;
+        }
+        manifest = *Utility::move(manifestMaybe);
+    }
+
+    /* Each non-empty line that's not a comment is an input and output file
+       separated by a tab */
+    Containers::Array<Containers::Pair<Containers::StringView, Containers::StringView>> entries;
+    {
+        const Containers::Array<Containers::StringView> lines = Containers::StringView{manifest.data(), manifest.size()}.split('\n');
+        for(std::size_t i = 0; i != lines.size(); ++i) {
+            const Containers::StringView line = lines[i].trimmed();
+            if(!line || line.hasPrefix("#"_s))
+                continue;
+
+            const Containers::Array3<Containers::StringView> inputOutput = line.partition('\t');
+            const Containers::StringView input = inputOutput[0].trimmed();
+            const Containers::StringView output = inputOutput[2].trimmed();
+            if(!input || !output) {
+                Error{} << "Invalid --batch manifest line" << i + 1 << Debug::nospace << ", expected an input and an output file separated by a tab";
+                return 1;
+            }
+
+            arrayAppend(entries, InPlaceInit, input, output);
+        }
+    }
+
+    /* The jobs run on a dedicated pool, a single conversion doesn't spawn any
+       threads. The global pool used by TextureTools and other algorithms
+       called from each job is kept single-threaded, as the jobs already
+       saturate the cores and each image is processed serially by the job that
+       converts it. */
+    ThreadPool pool{args.value<UnsignedInt>("jobs")};
+    const UnsignedInt jobs = pool.threadCount();
+    #ifndef CORRADE_BUILD_MULTITHREADED
+    /* Debug output redirection isn't thread-local in this case, which would
+       make the per-file output capturing clash */
+    if(jobs != 1) {
+        Error{} << "The --jobs option requires Corrade built with CORRADE_BUILD_MULTITHREADED";
+        return 1;
+    }
+    #endif
+
+    /* Plugin loading and instantiation isn't thread-safe, so create a
+       dedicated set of plugin managers and plugin instances for each job
+       here. The importer and all converters are instantiated upfront so
+       they're reused for all entries processed by the job. Unrecognized
+       option warnings get printed only for the first job, the others would
+       be just duplicates. */
+    const UnsignedInt jobCount = Math::max(1u, Math::min(jobs, UnsignedInt(entries.size())));
+    Containers::Array<Plugins> plugins{DirectInit, jobCount, args};
+    const std::size_t converterCount = args.arrayValueCount("converter");
+    for(UnsignedInt job = 0; job != jobCount; ++job) {
+        Warning redirectWarning{job ? nullptr : Warning::output()};
+
+        if(!args.value<Containers::StringView>("importer").hasPrefix("raw:"_s) &&
+           !(plugins[job].importer = instantiateImporter(args, plugins[job].importerManager)))
+            return 1;
+
+        for(std::size_t i = 0; i <= converterCount; ++i) {
+            /* The implicit AnyImageConverter is needed only if the last
+               --converter isn't capable of saving to a file */
+            if(i == converterCount && converterCount &&
+               (args.arrayValue<Containers::StringView>("converter", i - 1) == "raw"_s ||
+                plugins[job].converters[i - 1]->features() & (
+                    Trade::ImageConverterFeature::Convert1DToFile|
+                    Trade::ImageConverterFeature::Convert2DToFile|
+                    Trade::ImageConverterFeature::Convert3DToFile|
+                    Trade::ImageConverterFeature::ConvertCompressed1DToFile|
+                    Trade::ImageConverterFeature::ConvertCompressed2DToFile|
+                    Trade::ImageConverterFeature::ConvertCompressed3DToFile)))
+                break;
+
+            if(i != converterCount && args.arrayValue<Containers::StringView>("converter", i) == "raw"_s)
+                continue;
+
+            if(!(plugins[job].converters[i] = instantiateConverter(args, plugins[job].converterManager, i)))
+                return 2;
+        }
+    }
+
+    /* Each entry is a separate chunk for the thread pool, the thread index is
+       less than jobCount and picks the plugin set. All output, including the
+       output from the plugins, is captured per entry. Once an entry finishes,
+       it and all finished entries after it are printed, so the output is in
+       order but not held back until the whole batch is done. Unlike with a
+       single conversion, failures don't abort the whole batch, the exit code
+       is the one of the first failed entry. */
+    struct BatchOutput {
+        std::ostringstream out;
+        std::ostringstream err;
+        int result;
+        bool done;
+        std::chrono::high_resolution_clock::duration importTime;
+        std::chrono::high_resolution_clock::duration conversionTime;
+    };
+    Containers::Array<BatchOutput> outputs{ValueInit, entries.size()};
+    std::mutex printMutex;
+    std::size_t printed = 0;
+    int result = 0;
+    std::size_t failedCount = 0;
+    std::chrono::high_resolution_clock::duration batchTime{};
+    {
+        Trade::Implementation::Duration d{batchTime};
+        pool.parallelFor(entries.size(), 1, [&](const std::size_t begin, const std::size_t end, const UnsignedInt job) {
+            for(std::size_t i = begin; i != end; ++i) {
+                {
+                    BatchOutput& output = outputs[i];
+                    Debug redirectOutput{&output.out};
+                    Warning redirectWarning{&output.err};
+                    Error redirectError{&output.err};
+                    output.result = convert(args, options, plugins[job], Containers::arrayView(&entries[i].first(), 1), entries[i].second(), output.importTime, output.conversionTime);
+                }
+
+                /* Outside of the redirection scope, so the profile output
+                   goes to the standard output again */
+                std::lock_guard<std::mutex> lock{printMutex};
+                outputs[i].done = true;
+                for(; printed != outputs.size() && outputs[printed].done; ++printed) {
+                    BatchOutput& output = outputs[printed];
+                    std::cout << output.out.str() << std::flush;
+                    std::cerr << output.err.str() << std::flush;
+                    /* Not needed anymore, free the memory */
+                    output.out.str({});
+                    output.err.str({});
+                    if(output.result) {
+                        if(!result)
+                            result = output.result;
+                        ++failedCount;
+                    }
+
+                    importTime += output.importTime;
+                    conversionTime += output.conversionTime;
+                    if(args.isSet("profile")) {
+                        Debug{} << entries[printed].first() << Debug::nospace << ": import took" << seconds(output.importTime) << "seconds, conversion"
+                            << seconds(output.conversionTime) << "seconds";
+                    }
+                }
+            }
+        });
+    }
+    CORRADE_INTERNAL_ASSERT(printed == outputs.size());
+
+    if(failedCount)
+        Error{} << failedCount << "out of" << entries.size() << "files failed to convert";
+
     if(args.isSet("profile")) {
-        Debug{} << "Import took" << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(importTime).count())/1.0e3f << "seconds, conversion"
-            << UnsignedInt(std::chrono::duration_cast<std::chrono::milliseconds>(conversionTime).count())/1.0e3f << "seconds";
+        Debug{} << "Converted" << entries.size() << "files with" << jobCount << "jobs in" << seconds(batchTime) << "seconds, import took" << seconds(importTime) << "seconds, conversion"
+            << seconds(conversionTime) << "seconds in total";
     }
+
+    return result;
 }
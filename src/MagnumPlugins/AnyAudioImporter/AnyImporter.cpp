@@ -46,7 +46,11 @@ AnyImporter::AnyImporter(PluginManager::AbstractManager& manager, const Containe
 
 AnyImporter::~AnyImporter() = default;
 
-ImporterFeatures AnyImporter::doFeatures() const { return {}; }
+ImporterFeatures AnyImporter::doFeatures() const {
+    /* Streaming is available only if the concrete implementation supports it,
+       which is known only once a file is opened */
+    return _in ? _in->features() & ImporterFeature::Streaming : ImporterFeatures{};
+}
 
 bool AnyImporter::doIsOpened() const { return !!_in; }
 
@@ -106,6 +110,10 @@ UnsignedInt AnyImporter::doFrequency() const { return _in->frequency(); }
 
 Containers::Array<char> AnyImporter::doData() { return _in->data(); }
 
+std::size_t AnyImporter::doFrameCount() const { return _in->frameCount(); }
+
+Containers::Array<char> AnyImporter::doFrames(const std::size_t offset, const std::size_t count) { return _in->frames(offset, count); }
+
 }}
 
 CORRADE_PLUGIN_REGISTER(AnyAudioImporter, Magnum::Audio::AnyImporter,
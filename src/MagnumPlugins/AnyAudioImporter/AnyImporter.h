@@ -117,7 +117,10 @@ warning emitted in case given option is not present in the default
 configuration of the target plugin.
 
 Calls to the @ref format(), @ref frequency() and @ref data() functions are then
-proxied to the concrete implementation. The @ref close() function closes and
+proxied to the concrete implementation. If the concrete implementation
+supports @ref ImporterFeature::Streaming, it's advertised in @ref features()
+while the file is opened and @ref frameCount() and @ref frames() are proxied
+as well. The @ref close() function closes and
 discards the internally instantiated plugin; @ref isOpened() works as usual.
 */
 class MAGNUM_ANYAUDIOIMPORTER_EXPORT AnyImporter: public AbstractImporter {
@@ -139,6 +142,8 @@ class MAGNUM_ANYAUDIOIMPORTER_EXPORT AnyImporter: public AbstractImporter {
         MAGNUM_ANYAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_ANYAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL std::size_t doFrameCount() const override;
+        MAGNUM_ANYAUDIOIMPORTER_LOCAL Containers::Array<char> doFrames(std::size_t offset, std::size_t count) override;
 
         Containers::Pointer<AbstractImporter> _in;
 };
@@ -107,6 +107,11 @@ void AnyImporterTest::load() {
     CORRADE_COMPARE(importer->frequency(), 96000);
     CORRADE_COMPARE(importer->data().size(), 4);
 
+    /* Streaming is proxied as well */
+    CORRADE_VERIFY(importer->features() & ImporterFeature::Streaming);
+    CORRADE_COMPARE(importer->frameCount(), 2);
+    CORRADE_COMPARE(importer->frames(1, 1).size(), 2);
+
     importer->close();
     CORRADE_VERIFY(!importer->isOpened());
 }
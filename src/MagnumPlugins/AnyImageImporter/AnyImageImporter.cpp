@@ -28,6 +28,7 @@
 #include "AnyImageImporter.h"
 
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
 #include <Corrade/Containers/StringView.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/PluginManager/PluginMetadata.h>
@@ -37,12 +38,138 @@
 #include <Corrade/Utility/String.h> /* lowercase() */
 
 #include "Magnum/Trade/ImageData.h"
+#include "MagnumPlugins/Implementation/peekFileHeader.h"
 #include "MagnumPlugins/Implementation/propagateConfiguration.h"
 
 namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
+namespace {
+
+/* Shared between doOpenData() and the doOpenFile() fallback for unrecognized
+   extensions. Returns an empty view if the signature isn't recognized. */
+Containers::StringView pluginForSignature(const Containers::ArrayView<const char> dataView) {
+    /* So we can use the convenient hasPrefix() API */
+    const Containers::StringView dataString = dataView;
+
+    Containers::StringView plugin;
+    /* https://stackoverflow.com/questions/22600678/determine-internal-format-of-given-astc-compressed-image-through-its-header
+       unfortunately it being in LE means it's SCALABLE in reverse :) */
+    if(dataString.hasPrefix("\x13\xAB\xA1\x5C"_s))
+        plugin = "AstcImporter"_s;
+    /* Total guesswork. AVIF is an image format inside a HEIF container, which
+       itself is a ISOBMFF format, for which the spec isn't open (yay haha):
+        https://en.wikipedia.org/wiki/ISO_base_media_file_format
+       According to https://github.com/strukturag/libheif/issues/83 what
+       matters is a FourCC after the `ftyp` "box", which starts at the fourth
+       bytes, with the initial four bytes not specified anywhere. It *seems*
+       that for AVIF it's `ftypavif`, so let's check for that. In case of HEIF
+       there can be many other "brands" in a "box", whatever that is, but
+       that's suffering for another day. */
+    /** @todo https://github.com/file/file/blob/9ed4d8c65854d9d28519291f21dd92c44c4abc18/magic/Magdir/animation#L298
+        lists `avis` for image sequences, maybe detect that also? */
+    else if(dataString.size() >= 12 && dataString.slice(4, 12) == "ftypavif"_s)
+        plugin = "AvifImporter"_s;
+    /* https://github.com/BinomialLLC/basis_universal/blob/7d784c728844c007d8c95d63231f7adcc0f65364/transcoder/basisu_file_headers.h#L78 */
+    else if(dataString.hasPrefix("sB"_s))
+        plugin = "BasisImporter"_s;
+    /* https://en.wikipedia.org/wiki/BMP_file_format#Bitmap_file_header */
+    else if(dataString.hasPrefix("BM"_s))
+        plugin = "BmpImporter"_s;
+    /* https://docs.microsoft.com/cs-cz/windows/desktop/direct3ddds/dx-graphics-dds-pguide */
+    else if(dataString.hasPrefix("DDS "_s))
+        plugin = "DdsImporter"_s;
+    /* https://openexr.com/en/latest/OpenEXRFileLayout.html#magic-number */
+    else if(dataString.hasPrefix("\x76\x2f\x31\x01"_s))
+        plugin = "OpenExrImporter"_s;
+    /* https://en.wikipedia.org/wiki/Radiance_(software)#HDR_image_format and
+       https://en.wikipedia.org/wiki/RGBE_image_format which lists also the \n
+       at the end. There's also a RGBE signature that isn't mentioned on
+       Wikipedia, at https://paulbourke.net/dataformats/pic/ or used by the
+       file utility https://github.com/file/file/blob/0fa2c8c3e64c372d038d46969bafaaa09a13a87b/magic/Magdir/images#L2755-L2759
+       but is used by https://www.graphics.cornell.edu/~bjw/rgbe/rgbe.c which
+       is subsequently derived from in e.g. https://github.com/kopaka1822/ImageViewer/blob/5ec358cf5c3f818c0cc4c363f5ec0c61aa99d372/dependencies/hdr/rgbe.h#L210
+       and stb_image recognizes that as well. */
+    else if(dataString.hasPrefix("#?RADIANCE\n"_s) ||
+            dataString.hasPrefix("#?RGBE\n"_s))
+        plugin = "HdrImporter"_s;
+    /* https://en.wikipedia.org/wiki/JPEG#Syntax_and_structure */
+    else if(dataString.hasPrefix("\xff\xd8\xff"_s))
+        plugin = "JpegImporter"_s;
+    /* https://github.khronos.org/KTX-Specification/#_identifier */
+    else if(dataString.hasPrefix("\xabKTX 20\xbb\r\n\x1a\n"_s))
+        plugin = "KtxImporter"_s;
+    /* https://en.wikipedia.org/wiki/Portable_Network_Graphics#File_header */
+    else if(dataString.hasPrefix("\x89PNG\x0d\x0a\x1a\x0a"_s))
+        plugin = "PngImporter"_s;
+    /* https://paulbourke.net/dataformats/tiff/,
+       https://paulbourke.net/dataformats/tiff/tiff_summary.pdf */
+    else if(dataString.hasPrefix("II\x2a\x00"_s) ||
+            dataString.hasPrefix("MM\x00\x2a"_s))
+        plugin = "TiffImporter"_s;
+    /* https://developers.google.com/speed/webp/docs/riff_container#webp_file_header */
+    else if(dataString.size() >= 12 &&
+            dataString.slice(0,  4) == "RIFF"_s &&
+            dataString.slice(8, 12) == "WEBP"_s)
+        plugin = "WebPImporter"_s;
+    /* https://github.com/file/file/blob/d04de269e0b06ccd0a7d1bf4974fed1d75be7d9e/magic/Magdir/images#L18-L22
+       TGAs are a complete guesswork, so try after everything else fails. */
+    else if([dataView]() {
+            /* TGA header is 18 bytes */
+            if(dataView.size() < 18)
+                return false;
+
+            /* Third byte (image type) must be one of these */
+            if(dataView[2] != 1 && dataView[2] != 2  && dataView[2] != 3 &&
+               dataView[2] != 9 && dataView[2] != 10 && dataView[2] != 11)
+                return false;
+
+            /* If image type is 1 or 9, second byte (colormap type) must be 1 */
+            if((dataView[2] == 1 || dataView[2] == 9) && dataView[1] != 1)
+                return false;
+
+            /* ... and 0 otherwise */
+            if(dataView[2] != 1 && dataView[2] != 9 && dataView[1] != 0)
+                return false;
+
+            /* Colormap index (unsigned short, byte 3+4) should be 0 */
+            if(dataView[3] != 0 && dataView[4] != 0)
+                return false;
+
+            /* Probably TGA, heh. Or random memory. */
+            return true;
+        }()) plugin = "TgaImporter"_s;
+
+    return plugin;
+}
+
+/* KtxImporter delegates to BasisImporter in case the file is Basis-compressed,
+   so that's a good default choice. However, if it isn't available, we should
+   try delegating to BasisImporter instead, so people that have just
+   Basis-compressed KTX files don't need to have KtxImporter as well.
+
+   BasisImporter unfortunately can't handle non-Basis-compressed KTX files, so
+   in case people have just BasisImporter and not KtxImporter, it'll fail, but
+   with a clear message suggesting to use KtxImporter. If neither BasisImporter
+   would be available, it'd fail too (complaining that KtxImporter isn't
+   available), so the behavior is roughly the same.
+
+   Further discussion and reasoning here:
+   https://github.com/mosra/magnum-plugins/pull/112#discussion_r734976174 */
+Containers::StringView ktxImporterOrFallback(PluginManager::AbstractManager& manager, const ImporterFlags flags, const char* const messagePrefix) {
+    if(manager.loadState("KtxImporter"_s) == PluginManager::LoadState::NotFound &&
+       manager.loadState("BasisImporter"_s) != PluginManager::LoadState::NotFound) {
+        if(flags & ImporterFlag::Verbose)
+            Debug{} << messagePrefix << "KtxImporter not found, trying a fallback";
+        return "BasisImporter"_s;
+    }
+
+    return "KtxImporter"_s;
+}
+
+}
+
 AnyImageImporter::AnyImageImporter(PluginManager::Manager<AbstractImporter>& manager): AbstractImporter{manager} {}
 
 AnyImageImporter::AnyImageImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
@@ -59,6 +186,7 @@ bool AnyImageImporter::doIsOpened() const { return !!_in; }
 
 void AnyImageImporter::doClose() {
     _in = nullptr;
+    _peekedFile = nullptr;
 }
 
 void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
@@ -69,6 +197,11 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
        to save at least by normalizing just the filename and not the path. */
     const Containers::String normalizedExtension = Utility::String::lowercase(Utility::Path::splitExtension(filename).second());
 
+    /* Set if the file gets fetched through the file callback for signature
+       detection below. Declared before the concrete plugin instance so it's
+       destroyed after it on failure. */
+    Containers::Pointer<Magnum::Implementation::PeekedFile> peeked;
+
     /* Detect the plugin from extension */
     Containers::StringView plugin;
     if(normalizedExtension == ".astc"_s)
@@ -96,31 +229,9 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
         plugin = "JpegImporter"_s;
     else if(normalizedExtension == ".jp2"_s)
         plugin = "Jpeg2000Importer"_s;
-    else if(normalizedExtension == ".ktx2"_s) {
+    else if(normalizedExtension == ".ktx2"_s)
         plugin = "KtxImporter"_s;
-
-        /* KtxImporter delegates to BasisImporter in case the file is
-           Basis-compressed, so that's a good default choice. However, if it
-           isn't available, we should try delegating to BasisImporter instead,
-           so people that have just Basis-compressed KTX files don't need to
-           have KtxImporter as well.
-
-           BasisImporter unfortunately can't handle non-Basis-compressed KTX
-           files, so in case people have just BasisImporter and not
-           KtxImporter, it'll fail, but with a clear message suggesting to use
-           KtxImporter. If neither BasisImporter would be available, it'd fail
-           too (complaining that KtxImporter isn't available), so the behavior
-           is roughly the same.
-
-           Further discussion and reasoning here:
-           https://github.com/mosra/magnum-plugins/pull/112#discussion_r734976174 */
-        if(manager()->loadState("KtxImporter"_s) == PluginManager::LoadState::NotFound &&
-           manager()->loadState("BasisImporter"_s) != PluginManager::LoadState::NotFound) {
-            if(flags() & ImporterFlag::Verbose)
-                Debug{} << "Trade::AnyImageImporter::openFile(): KtxImporter not found, trying a fallback";
-            plugin = "BasisImporter"_s;
-        }
-    } else if(normalizedExtension == ".mng"_s)
+    else if(normalizedExtension == ".mng"_s)
         plugin = "MngImporter"_s;
     else if(normalizedExtension == ".pbm"_s)
         plugin = "PbmImporter"_s;
@@ -158,11 +269,22 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
         plugin = "OpenVdbImporter"_s;
     else if(normalizedExtension == ".webp"_s)
         plugin = "WebPImporter"_s;
+    /* Unknown extension, try to detect the format from the file signature
+       instead. Compared to the user going through openData(), this fetches
+       only the header instead of the whole file before dispatching and the
+       concrete plugin then opens the file on its own. */
     else {
-        Error{} << "Trade::AnyImageImporter::openFile(): cannot determine the format of" << filename;
-        return;
+        peeked.emplace(fileCallback(), fileCallbackUserData());
+        if(!(plugin = pluginForSignature(Magnum::Implementation::peekFileHeader(filename, *peeked, 32)))) {
+            Error{} << "Trade::AnyImageImporter::openFile(): cannot determine the format of" << filename;
+            return;
+        }
     }
 
+    /* Fall back to BasisImporter if KtxImporter isn't available, see above */
+    if(plugin == "KtxImporter"_s)
+        plugin = ktxImporterOrFallback(*manager(), flags(), "Trade::AnyImageImporter::openFile():");
+
     /* Try to load the plugin */
     if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
         Error{} << "Trade::AnyImageImporter::openFile(): cannot load the" << plugin << "plugin";
@@ -178,10 +300,15 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
             d << "(provided by" << metadata->name() << Debug::nospace << ")";
     }
 
-    /* Instantiate the plugin, propagate flags and the file callback, if set */
+    /* Instantiate the plugin, propagate flags and the file callback, if set.
+       If the file was already fetched through the callback for signature
+       detection, the concrete plugin gets the fetched data instead of calling
+       the callback again. */
     Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
     importer->setFlags(flags());
-    if(fileCallback())
+    if(peeked && peeked->data)
+        importer->setFileCallback(Magnum::Implementation::peekedFileCallback, peeked.get());
+    else if(fileCallback())
         importer->setFileCallback(fileCallback(), fileCallbackUserData());
 
     /* Propagate configuration */
@@ -192,8 +319,10 @@ void AnyImageImporter::doOpenFile(const Containers::StringView filename) {
     if(!importer->openFile(filename))
         return;
 
-    /* Success, save the instance */
+    /* Success, save the instance. The peeked file, if any, has to stay
+       alive for as long as the instance can call the file callback. */
     _in = Utility::move(importer);
+    _peekedFile = Utility::move(peeked);
 }
 
 void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
@@ -201,110 +330,13 @@ void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
 
     CORRADE_INTERNAL_ASSERT(manager());
 
-    /* So we can use the convenient hasPrefix() API */
-    const Containers::ArrayView<const char> dataView = data;
-    const Containers::StringView dataString = dataView;
-
-    Containers::StringView plugin;
-    /* https://stackoverflow.com/questions/22600678/determine-internal-format-of-given-astc-compressed-image-through-its-header
-       unfortunately it being in LE means it's SCALABLE in reverse :) */
-    if(dataString.hasPrefix("\x13\xAB\xA1\x5C"_s))
-        plugin = "AstcImporter"_s;
-    /* Total guesswork. AVIF is an image format inside a HEIF container, which
-       itself is a ISOBMFF format, for which the spec isn't open (yay haha):
-        https://en.wikipedia.org/wiki/ISO_base_media_file_format
-       According to https://github.com/strukturag/libheif/issues/83 what
-       matters is a FourCC after the `ftyp` "box", which starts at the fourth
-       bytes, with the initial four bytes not specified anywhere. It *seems*
-       that for AVIF it's `ftypavif`, so let's check for that. In case of HEIF
-       there can be many other "brands" in a "box", whatever that is, but
-       that's suffering for another day. */
-    /** @todo https://github.com/file/file/blob/9ed4d8c65854d9d28519291f21dd92c44c4abc18/magic/Magdir/animation#L298
-        lists `avis` for image sequences, maybe detect that also? */
-    else if(dataString.size() >= 12 && dataString.slice(4, 12) == "ftypavif"_s)
-        plugin = "AvifImporter"_s;
-    /* https://github.com/BinomialLLC/basis_universal/blob/7d784c728844c007d8c95d63231f7adcc0f65364/transcoder/basisu_file_headers.h#L78 */
-    else if(dataString.hasPrefix("sB"_s))
-        plugin = "BasisImporter"_s;
-    /* https://en.wikipedia.org/wiki/BMP_file_format#Bitmap_file_header */
-    else if(dataString.hasPrefix("BM"_s))
-        plugin = "BmpImporter"_s;
-    /* https://docs.microsoft.com/cs-cz/windows/desktop/direct3ddds/dx-graphics-dds-pguide */
-    else if(dataString.hasPrefix("DDS "_s))
-        plugin = "DdsImporter"_s;
-    /* https://openexr.com/en/latest/OpenEXRFileLayout.html#magic-number */
-    else if(dataString.hasPrefix("\x76\x2f\x31\x01"_s))
-        plugin = "OpenExrImporter"_s;
-    /* https://en.wikipedia.org/wiki/Radiance_(software)#HDR_image_format and
-       https://en.wikipedia.org/wiki/RGBE_image_format which lists also the \n
-       at the end. There's also a RGBE signature that isn't mentioned on
-       Wikipedia, at https://paulbourke.net/dataformats/pic/ or used by the
-       file utility https://github.com/file/file/blob/0fa2c8c3e64c372d038d46969bafaaa09a13a87b/magic/Magdir/images#L2755-L2759
-       but is used by https://www.graphics.cornell.edu/~bjw/rgbe/rgbe.c which
-       is subsequently derived from in e.g. https://github.com/kopaka1822/ImageViewer/blob/5ec358cf5c3f818c0cc4c363f5ec0c61aa99d372/dependencies/hdr/rgbe.h#L210
-       and stb_image recognizes that as well. */
-    else if(dataString.hasPrefix("#?RADIANCE\n"_s) ||
-            dataString.hasPrefix("#?RGBE\n"_s))
-        plugin = "HdrImporter"_s;
-    /* https://en.wikipedia.org/wiki/JPEG#Syntax_and_structure */
-    else if(dataString.hasPrefix("\xff\xd8\xff"_s))
-        plugin = "JpegImporter"_s;
-    /* https://github.khronos.org/KTX-Specification/#_identifier */
-    else if(dataString.hasPrefix("\xabKTX 20\xbb\r\n\x1a\n"_s)) {
-        plugin = "KtxImporter"_s;
-
-        /* Same logic as in doOpenFile() for *.ktx2 files, see above for more
-           information */
-        if(manager()->loadState("KtxImporter"_s) == PluginManager::LoadState::NotFound &&
-           manager()->loadState("BasisImporter"_s) != PluginManager::LoadState::NotFound) {
-            if(flags() & ImporterFlag::Verbose)
-                Debug{} << "Trade::AnyImageImporter::openData(): KtxImporter not found, trying a fallback";
-            plugin = "BasisImporter"_s;
+    Containers::StringView plugin = pluginForSignature(data);
+    if(!plugin) {
+        if(!data.size()) {
+            Error{} << "Trade::AnyImageImporter::openData(): file is empty";
+            return;
         }
-    /* https://en.wikipedia.org/wiki/Portable_Network_Graphics#File_header */
-    } else if(dataString.hasPrefix("\x89PNG\x0d\x0a\x1a\x0a"_s))
-        plugin = "PngImporter"_s;
-    /* https://paulbourke.net/dataformats/tiff/,
-       https://paulbourke.net/dataformats/tiff/tiff_summary.pdf */
-    else if(dataString.hasPrefix("II\x2a\x00"_s) ||
-            dataString.hasPrefix("MM\x00\x2a"_s))
-        plugin = "TiffImporter"_s;
-    /* https://developers.google.com/speed/webp/docs/riff_container#webp_file_header */
-    else if(dataString.size() >= 12 &&
-            dataString.slice(0,  4) == "RIFF"_s &&
-            dataString.slice(8, 12) == "WEBP"_s)
-        plugin = "WebPImporter"_s;
-    /* https://github.com/file/file/blob/d04de269e0b06ccd0a7d1bf4974fed1d75be7d9e/magic/Magdir/images#L18-L22
-       TGAs are a complete guesswork, so try after everything else fails. */
-    else if([dataView]() {
-            /* TGA header is 18 bytes */
-            if(dataView.size() < 18)
-                return false;
-
-            /* Third byte (image type) must be one of these */
-            if(dataView[2] != 1 && dataView[2] != 2  && dataView[2] != 3 &&
-               dataView[2] != 9 && dataView[2] != 10 && dataView[2] != 11)
-                return false;
-
-            /* If image type is 1 or 9, second byte (colormap type) must be 1 */
-            if((dataView[2] == 1 || dataView[2] == 9) && dataView[1] != 1)
-                return false;
-
-            /* ... and 0 otherwise */
-            if(dataView[2] != 1 && dataView[2] != 9 && dataView[1] != 0)
-                return false;
-
-            /* Colormap index (unsigned short, byte 3+4) should be 0 */
-            if(dataView[3] != 0 && dataView[4] != 0)
-                return false;
 
-            /* Probably TGA, heh. Or random memory. */
-            return true;
-        }()) plugin = "TgaImporter"_s;
-    else if(!data.size()) {
-        Error{} << "Trade::AnyImageImporter::openData(): file is empty";
-        return;
-    } else {
         /* FFS so much casting to avoid implicit sign extension ruining
            everything */
         UnsignedInt signature = UnsignedInt(UnsignedByte(data[0])) << 24;
@@ -319,6 +351,10 @@ void AnyImageImporter::doOpenData(Containers::Array<char>&& data, DataFlags) {
         return;
     }
 
+    /* Fall back to BasisImporter if KtxImporter isn't available, see above */
+    if(plugin == "KtxImporter"_s)
+        plugin = ktxImporterOrFallback(*manager(), flags(), "Trade::AnyImageImporter::openData():");
+
     /* Try to load the plugin */
     if(!(manager()->load(plugin) & PluginManager::LoadState::Loaded)) {
         Error{} << "Trade::AnyImageImporter::openData(): cannot load the" << plugin << "plugin";
@@ -49,7 +49,11 @@
 #define MAGNUM_ANYIMAGEIMPORTER_LOCAL
 #endif
 
-namespace Magnum { namespace Trade {
+namespace Magnum {
+
+namespace Implementation { struct PeekedFile; }
+
+namespace Trade {
 
 /**
 @brief Any image importer plugin
@@ -108,9 +112,24 @@ Supported formats:
     @ref WebPImporter or any other plugin that provides it
 
 Detecting file type through @ref openData() is supported only for a subset of
-formats that are marked as such in the list above.
+formats that are marked as such in the list above. The same signature
+detection is used by @ref openFile() if the extension isn't recognized.
 @ref ImporterFeature::FileCallback is supported as well.
 
+@section Trade-AnyImageImporter-signature Detection from file signature
+
+If @ref openFile() gets a file with an unrecognized or no extension, the
+format is detected from the first few bytes of it. If no file callback is set,
+they're read by memory-mapping the file on platforms that support it, and the
+file is then opened by the concrete plugin with its own @ref openFile(), so a
+plugin capable of streaming or memory-mapping can make use of that. If a file
+callback is set, the file is fetched through it with
+@ref InputFileCallbackPolicy::LoadTemporary and the concrete plugin then gets
+the already fetched data when it requests the same file through the callback,
+so the file callback is called only once for it. The
+@ref InputFileCallbackPolicy::Close is passed to the file callback once the
+concrete plugin is done with the data.
+
 @section Trade-AnyImageImporter-usage Usage
 
 @m_class{m-note m-success}
@@ -218,6 +237,8 @@ class MAGNUM_ANYIMAGEIMPORTER_EXPORT AnyImageImporter: public AbstractImporter {
 
         MAGNUM_ANYIMAGEIMPORTER_LOCAL const void* doImporterState() const override;
 
+        /* Destroyed after the _in instance that references it */
+        Containers::Pointer<Magnum::Implementation::PeekedFile> _peekedFile;
         Containers::Pointer<AbstractImporter> _in;
 };
 
@@ -25,6 +25,7 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/Containers/StringView.h>
@@ -54,6 +55,10 @@ struct AnyImageImporterTest: TestSuite::Tester {
     void ktxBasisFallbackFile();
     void ktxBasisFallbackData();
 
+    void detectFileSignature();
+    void detectFileSignatureFileCallback();
+    void detectFileSignatureUnknown();
+
     void unknownExtension();
     void unknownSignature();
     void emptyData();
@@ -85,7 +90,8 @@ constexpr struct {
     const char* messageFunctionName;
 } LoadData[]{
     {"TGA", "rgb.tga", false, "openFile"},
-    {"TGA data", "rgb.tga", true, "openData"}
+    {"TGA data", "rgb.tga", true, "openData"},
+    {"TGA without an extension", "rgb-tga", false, "openFile"}
 };
 
 constexpr struct {
@@ -230,7 +236,11 @@ AnyImageImporterTest::AnyImageImporterTest() {
                        &AnyImageImporterTest::ktxBasisFallbackData},
         Containers::arraySize(KtxBasisFallbackData));
 
-    addTests({&AnyImageImporterTest::unknownExtension});
+    addTests({&AnyImageImporterTest::detectFileSignature,
+              &AnyImageImporterTest::detectFileSignatureFileCallback,
+              &AnyImageImporterTest::detectFileSignatureUnknown,
+
+              &AnyImageImporterTest::unknownExtension});
 
     addInstancedTests({&AnyImageImporterTest::unknownSignature},
         Containers::arraySize(DetectUnknownData));
@@ -399,6 +409,99 @@ void AnyImageImporterTest::ktxBasisFallbackData() {
     else CORRADE_COMPARE(out, "");
 }
 
+void AnyImageImporterTest::detectFileSignature() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+
+    /* The file has no extension, so it should be only peeked at through the
+       callback and then closed again */
+    struct State {
+        Containers::Array<char> data;
+        Containers::Array<InputFileCallbackPolicy> policies;
+    } state;
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        arrayAppend(state.policies, policy);
+        if(policy == InputFileCallbackPolicy::Close)
+            return {};
+
+        Containers::Optional<Containers::Array<char>> data = Utility::Path::read(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb.png"));
+        CORRADE_VERIFY(data);
+        state.data = *Utility::move(data);
+        return Containers::ArrayView<const char>{state.data};
+    }, state);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile("image"));
+    /* PngImporter isn't available, so the file gets requested only once */
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_COMPARE(out,
+        "PluginManager::Manager::load(): plugin PngImporter is not static and was not found in nonexistent\n"
+        "Trade::AnyImageImporter::openFile(): cannot load the PngImporter plugin\n");
+    #else
+    CORRADE_COMPARE(out,
+        "PluginManager::Manager::load(): plugin PngImporter was not found\n"
+        "Trade::AnyImageImporter::openFile(): cannot load the PngImporter plugin\n");
+    #endif
+    CORRADE_COMPARE_AS(state.policies, Containers::arrayView({
+        InputFileCallbackPolicy::LoadTemporary,
+        InputFileCallbackPolicy::Close
+    }), TestSuite::Compare::Container);
+}
+
+void AnyImageImporterTest::detectFileSignatureFileCallback() {
+    if(!(_manager.loadState("TgaImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("TgaImporter plugin not enabled, cannot test");
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+
+    /* The file has no extension, so it's fetched for signature detection and
+       the concrete plugin then gets the same data without the callback being
+       called again */
+    struct State {
+        Containers::Array<char> data;
+        Containers::Array<InputFileCallbackPolicy> policies;
+    } state;
+    importer->setFileCallback([](const std::string& filename, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        CORRADE_COMPARE(filename, "image");
+        arrayAppend(state.policies, policy);
+        if(policy == InputFileCallbackPolicy::Close) {
+            state.data = {};
+            return {};
+        }
+
+        Containers::Optional<Containers::Array<char>> data = Utility::Path::read(Utility::Path::join(ANYIMAGEIMPORTER_TEST_DIR, "rgb-tga"));
+        CORRADE_VERIFY(data);
+        state.data = *Utility::move(data);
+        return Containers::ArrayView<const char>{state.data};
+    }, state);
+
+    CORRADE_VERIFY(importer->openFile("image"));
+    Containers::Optional<ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->size(), Vector2i(3, 2));
+
+    importer->close();
+    CORRADE_COMPARE_AS(state.policies, Containers::arrayView({
+        InputFileCallbackPolicy::LoadTemporary,
+        InputFileCallbackPolicy::Close
+    }), TestSuite::Compare::Container);
+}
+
+void AnyImageImporterTest::detectFileSignatureUnknown() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
+
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy, void*) -> Containers::Optional<Containers::ArrayView<const char>> {
+        return Containers::arrayView("gimp xcf v011");
+    });
+
+    /* The message should be the same as when the file isn't accessible at
+       all, i.e. in the unknownExtension() case */
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile("image.xcf"));
+    CORRADE_COMPARE(out, "Trade::AnyImageImporter::openFile(): cannot determine the format of image.xcf\n");
+}
+
 void AnyImageImporterTest::unknownExtension() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnyImageImporter");
 
@@ -27,6 +27,8 @@
 #include "AnySceneImporter.h"
 
 #include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/PluginManager/PluginMetadata.h>
 #include <Corrade/Utility/Assert.h>
@@ -42,6 +44,7 @@
 #include "Magnum/Trade/SceneData.h"
 #include "Magnum/Trade/SkinData.h"
 #include "Magnum/Trade/TextureData.h"
+#include "MagnumPlugins/Implementation/peekFileHeader.h"
 #include "MagnumPlugins/Implementation/propagateConfiguration.h"
 
 #ifdef MAGNUM_BUILD_DEPRECATED
@@ -58,6 +61,42 @@ namespace Magnum { namespace Trade {
 
 using namespace Containers::Literals;
 
+namespace {
+
+/* Used by doOpenFile() for files with an unrecognized extension. Only formats
+   with an unambiguous binary or text signature are detected, returns an empty
+   view otherwise. */
+Containers::StringView pluginForSignature(const Containers::ArrayView<const char> dataView) {
+    /* So we can use the convenient hasPrefix() API */
+    const Containers::StringView data = dataView;
+
+    /* https://registry.khronos.org/glTF/specs/2.0/glTF-2.0.html#binary-header */
+    if(data.hasPrefix("glTF"_s))
+        return "GltfImporter"_s;
+    /* https://en.wikipedia.org/wiki/PLY_(file_format)#ASCII_or_binary_format */
+    if(data.hasPrefix("ply\n"_s) ||
+       data.hasPrefix("ply\r\n"_s))
+        return "StanfordImporter"_s;
+    /* https://code.blender.org/2013/08/fbx-binary-file-format-specification/ */
+    if(data.hasPrefix("Kaydara FBX Binary"_s))
+        return "FbxImporter"_s;
+    /* https://archive.blender.org/wiki/index.php/Dev:Source/Architecture/File_Format/ */
+    if(data.hasPrefix("BLENDER"_s))
+        return "BlenderImporter"_s;
+    /* https://openusd.org/release/glossary.html#usd-file-formats, the binary
+       crate signature is from the OpenUSD sources */
+    if(data.hasPrefix("#usda "_s) ||
+       data.hasPrefix("PXR-USDC"_s))
+        return "UsdImporter"_s;
+    /* https://en.wikipedia.org/wiki/ISO_10303-21 */
+    if(data.hasPrefix("ISO-10303-21;"_s))
+        return "IfcImporter"_s;
+
+    return {};
+}
+
+}
+
 AnySceneImporter::AnySceneImporter(PluginManager::Manager<AbstractImporter>& manager): AbstractImporter{manager} {}
 
 AnySceneImporter::AnySceneImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
@@ -72,6 +111,7 @@ bool AnySceneImporter::doIsOpened() const { return !!_in; }
 
 void AnySceneImporter::doClose() {
     _in = nullptr;
+    _peekedFile = nullptr;
 }
 
 void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
@@ -109,6 +149,11 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
        The conflicting extensions are explicitly tested in AnySceneImporterTest
        to ensure they're not added by accident. */
 
+    /* Set if the file gets fetched through the file callback for signature
+       detection below. Declared before the concrete plugin instance so it's
+       destroyed after it on failure. */
+    Containers::Pointer<Magnum::Implementation::PeekedFile> peeked;
+
     /* Detect the plugin from extension */
     Containers::StringView plugin;
     if(normalized.hasSuffix(".3ds"_s) ||
@@ -180,9 +225,15 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
     else if(normalized.hasSuffix(".xgl"_s) ||
             normalized.hasSuffix(".zgl"_s))
         plugin = "XglImporter"_s;
+    /* Unknown extension, try to detect the format from the file signature
+       instead. Only the header is fetched for that, the concrete plugin then
+       opens the file on its own. */
     else {
-        Error{} << "Trade::AnySceneImporter::openFile(): cannot determine the format of" << filename;
-        return;
+        peeked.emplace(fileCallback(), fileCallbackUserData());
+        if(!(plugin = pluginForSignature(Magnum::Implementation::peekFileHeader(filename, *peeked, 32)))) {
+            Error{} << "Trade::AnySceneImporter::openFile(): cannot determine the format of" << filename;
+            return;
+        }
     }
 
     /* Try to load the plugin */
@@ -200,10 +251,15 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
             d << "(provided by" << metadata->name() << Debug::nospace << ")";
     }
 
-    /* Instantiate the plugin, propagate flags and the file callback, if set */
+    /* Instantiate the plugin, propagate flags and the file callback, if set.
+       If the file was already fetched through the callback for signature
+       detection, the concrete plugin gets the fetched data instead of calling
+       the callback again. */
     Containers::Pointer<AbstractImporter> importer = static_cast<PluginManager::Manager<AbstractImporter>*>(manager())->instantiate(plugin);
     importer->setFlags(flags());
-    if(fileCallback())
+    if(peeked && peeked->data)
+        importer->setFileCallback(Magnum::Implementation::peekedFileCallback, peeked.get());
+    else if(fileCallback())
         importer->setFileCallback(fileCallback(), fileCallbackUserData());
 
     /* Propagate configuration */
@@ -214,8 +270,10 @@ void AnySceneImporter::doOpenFile(const Containers::StringView filename) {
     if(!importer->openFile(filename))
         return;
 
-    /* Success, save the instance */
+    /* Success, save the instance. The peeked file, if any, has to stay
+       alive for as long as the instance can call the file callback. */
     _in = Utility::move(importer);
+    _peekedFile = Utility::move(peeked);
 }
 
 UnsignedInt AnySceneImporter::doAnimationCount() const { return _in->animationCount(); }
@@ -49,7 +49,11 @@
 #define MAGNUM_ANYSCENEIMPORTER_LOCAL
 #endif
 
-namespace Magnum { namespace Trade {
+namespace Magnum {
+
+namespace Implementation { struct PeekedFile; }
+
+namespace Trade {
 
 /**
 @brief Any scene importer plugin
@@ -115,6 +119,18 @@ tries to open the file with it. Supported formats:
 Only loading from files is supported as the filename is used to detect the
 format, however @ref ImporterFeature::FileCallback is supported as well.
 
+If the file extension isn't recognized, the format is detected from the file
+signature instead. That's done only for glTF binary, Stanford PLY, FBX binary,
+Blender, USD ASCII and binary and IFC files, as the other formats either don't
+have a signature or it's too generic. If no file callback is set, only the
+first few bytes are read for the detection by memory-mapping the file on
+platforms that support it, and the file is then opened by the concrete plugin
+itself. If a file callback is set, the file is fetched through it with
+@ref InputFileCallbackPolicy::LoadTemporary and the concrete plugin then gets
+the already fetched data when it requests the same file through the callback,
+so the file callback is called only once for it. Requests for other files,
+such as external buffers, are passed to the file callback as usual.
+
 @section Trade-AnySceneImporter-usage Usage
 
 @m_class{m-note m-success}
@@ -304,6 +320,8 @@ class MAGNUM_ANYSCENEIMPORTER_EXPORT AnySceneImporter: public AbstractImporter {
 
         MAGNUM_ANYSCENEIMPORTER_LOCAL const void* doImporterState() const override;
 
+        /* Destroyed after the _in instance that references it */
+        Containers::Pointer<Magnum::Implementation::PeekedFile> _peekedFile;
         Containers::Pointer<AbstractImporter> _in;
 };
 
@@ -25,10 +25,12 @@
 */
 
 #include <Corrade/Containers/ArrayView.h>
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringIterable.h>
 #include <Corrade/PluginManager/Manager.h>
 #include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/String.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
 #include <Corrade/Utility/Format.h>
@@ -67,8 +69,10 @@ struct AnySceneImporterTest: TestSuite::Tester {
     void load();
     void detect();
     void reject();
+    void detectSignature();
 
     void unknown();
+    void unknownSignature();
 
     void propagateFlags();
     void propagateConfiguration();
@@ -183,6 +187,26 @@ const struct {
     {"3D Game Studio (3DGS) *.mdl", "3dgs.mdl"},
 };
 
+using namespace Containers::Literals;
+
+const struct {
+    const char* name;
+    const char* filename;
+    Containers::StringView data;
+    const char* plugin;
+} DetectSignatureData[]{
+    /* Extensions that aren't recognized or are rejected above, with a
+       signature that is */
+    {"glTF binary", "scene.bin", "glTF\x02\x00\x00\x00"_s, "GltfImporter"},
+    {"Stanford PLY", "scan", "ply\nformat ascii 1.0\n"_s, "StanfordImporter"},
+    {"Stanford PLY, CRLF", "scan", "ply\r\nformat ascii 1.0\r\n"_s, "StanfordImporter"},
+    {"FBX binary", "model.dat", "Kaydara FBX Binary  \x00\x1a\x00"_s, "FbxImporter"},
+    {"Blender", "scene.blend1", "BLENDER-v300"_s, "BlenderImporter"},
+    {"USD ASCII", "model", "#usda 1.0\n"_s, "UsdImporter"},
+    {"USD binary", "model", "PXR-USDC"_s, "UsdImporter"},
+    {"IFC", "building.stp", "ISO-10303-21;\nHEADER;\n"_s, "IfcImporter"},
+};
+
 const struct {
     const char* name;
     ImporterFlags flags;
@@ -202,7 +226,11 @@ AnySceneImporterTest::AnySceneImporterTest() {
     addInstancedTests({&AnySceneImporterTest::reject},
         Containers::arraySize(RejectData));
 
+    addInstancedTests({&AnySceneImporterTest::detectSignature},
+        Containers::arraySize(DetectSignatureData));
+
     addTests({&AnySceneImporterTest::unknown,
+              &AnySceneImporterTest::unknownSignature,
 
               &AnySceneImporterTest::propagateFlags,
               &AnySceneImporterTest::propagateConfiguration});
@@ -311,6 +339,45 @@ void AnySceneImporterTest::reject() {
     CORRADE_COMPARE(out, Utility::format("Trade::AnySceneImporter::openFile(): cannot determine the format of {}\n", data.filename));
 }
 
+void AnySceneImporterTest::detectSignature() {
+    auto&& data = DetectSignatureData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+
+    /* The file is only peeked at and then closed again, the concrete plugin
+       isn't available so it doesn't request it again */
+    struct State {
+        Containers::StringView data;
+        Containers::Array<InputFileCallbackPolicy> policies;
+    } state{data.data, {}};
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy policy, State& state) -> Containers::Optional<Containers::ArrayView<const char>> {
+        arrayAppend(state.policies, policy);
+        if(policy == InputFileCallbackPolicy::Close)
+            return {};
+        return Containers::ArrayView<const char>{state.data};
+    }, state);
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile(data.filename));
+    #ifndef CORRADE_PLUGINMANAGER_NO_DYNAMIC_PLUGIN_SUPPORT
+    CORRADE_COMPARE(out, Utility::format(
+        "PluginManager::Manager::load(): plugin {0} is not static and was not found in nonexistent\n"
+        "Trade::AnySceneImporter::openFile(): cannot load the {0} plugin\n",
+        data.plugin));
+    #else
+    CORRADE_COMPARE(out, Utility::format(
+        "PluginManager::Manager::load(): plugin {0} was not found\n"
+        "Trade::AnySceneImporter::openFile(): cannot load the {0} plugin\n",
+        data.plugin));
+    #endif
+    CORRADE_COMPARE_AS(state.policies, Containers::arrayView({
+        InputFileCallbackPolicy::LoadTemporary,
+        InputFileCallbackPolicy::Close
+    }), TestSuite::Compare::Container);
+}
+
 void AnySceneImporterTest::unknown() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
 
@@ -320,6 +387,21 @@ void AnySceneImporterTest::unknown() {
     CORRADE_COMPARE(out, "Trade::AnySceneImporter::openFile(): cannot determine the format of mesh.wtf\n");
 }
 
+void AnySceneImporterTest::unknownSignature() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("AnySceneImporter");
+
+    /* A Quake 1 *.mdl, which is deliberately rejected based on the extension,
+       isn't detected by the signature either */
+    importer->setFileCallback([](const std::string&, InputFileCallbackPolicy, void*) -> Containers::Optional<Containers::ArrayView<const char>> {
+        return Containers::arrayView("IDPO\x06\x00\x00\x00");
+    });
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile("quake.mdl"));
+    CORRADE_COMPARE(out, "Trade::AnySceneImporter::openFile(): cannot determine the format of quake.mdl\n");
+}
+
 void AnySceneImporterTest::propagateFlags() {
     PluginManager::Manager<AbstractImporter> manager{MAGNUM_PLUGINS_IMPORTER_INSTALL_DIR};
     #ifdef ANYSCENEIMPORTER_PLUGIN_FILENAME
@@ -0,0 +1,142 @@
+#ifndef Magnum_Implementation_peekFileHeader_h
+#define Magnum_Implementation_peekFileHeader_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <string> /** @todo remove once file callbacks are <string>-free */
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StringStl.h> /** @todo remove once file callbacks are <string>-free */
+#include <Corrade/Utility/Algorithms.h>
+#include <Corrade/Utility/Debug.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/FileCallback.h"
+#include "Magnum/Math/Functions.h"
+
+/* Used by Any* importer plugins to detect a file format from its signature
+   when the extension isn't recognized, without having to fetch the whole file
+   more than once. peekFileHeader() returns a copy of at most `size` initial
+   bytes of the file, or an empty array if the file can't be accessed. No
+   error is printed in that case, the caller is expected to print its own.
+
+   If a file callback is set, the file is requested with
+   InputFileCallbackPolicy::LoadTemporary and the returned view is kept in
+   PeekedFile instead of being closed right away. The plugin then sets
+   peekedFileCallback() with the PeekedFile instance as user data on the
+   concrete plugin, which gets the already fetched view back when it requests
+   the same file, and requests for any other file get forwarded to the
+   original callback. The file is closed through the original callback once
+   the concrete plugin closes it or, if it didn't request it at all, once the
+   PeekedFile instance is destroyed. So the PeekedFile instance has to outlive
+   the concrete plugin.
+
+   Otherwise the file is memory-mapped on platforms that support it, so only
+   the first page gets actually read from the disk.
+
+   Tested in AnyImageImporterTest and AnySceneImporterTest. */
+
+namespace Magnum { namespace Implementation {
+
+/* Not in an anonymous namespace so it can be forward-declared in plugin
+   headers */
+struct PeekedFile {
+    explicit PeekedFile(Containers::Optional<Containers::ArrayView<const char>>(*const callback)(const std::string&, InputFileCallbackPolicy, void*), void* const userData): callback{callback}, userData{userData} {}
+
+    PeekedFile(const PeekedFile&) = delete;
+    PeekedFile& operator=(const PeekedFile&) = delete;
+
+    ~PeekedFile() { close(); }
+
+    void close() {
+        if(!data) return;
+        data = Containers::NullOpt;
+        callback(filename, InputFileCallbackPolicy::Close, userData);
+    }
+
+    Containers::Optional<Containers::ArrayView<const char>>(*callback)(const std::string&, InputFileCallbackPolicy, void*);
+    void* userData;
+    std::string filename;
+    /* Set if the file was fetched through the callback and not closed yet */
+    Containers::Optional<Containers::ArrayView<const char>> data;
+};
+
+/* Used only in plugins where we don't want it to be exported */
+namespace {
+
+Containers::Array<char> peekFileHeader(const Containers::StringView filename, PeekedFile& file, const std::size_t size) {
+    Containers::Array<char> out;
+
+    if(file.callback) {
+        file.data = file.callback(filename, InputFileCallbackPolicy::LoadTemporary, file.userData);
+        if(!file.data)
+            return out;
+
+        file.filename = std::string{filename.data(), filename.size()};
+        out = Containers::Array<char>{NoInit, Math::min(file.data->size(), size)};
+        Utility::copy(file.data->prefix(out.size()), out);
+        return out;
+    }
+
+    /* Utility::Path would print an error for nonexistent files and
+       directories, bail early in that case. Other errors, such as missing
+       permissions, are silenced below. */
+    if(!Utility::Path::exists(filename) || Utility::Path::isDirectory(filename))
+        return out;
+
+    Error silenceError{nullptr};
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    const Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> data = Utility::Path::mapRead(filename);
+    #else
+    const Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+    #endif
+    if(!data)
+        return out;
+
+    out = Containers::Array<char>{NoInit, Math::min(data->size(), size)};
+    Utility::copy(data->prefix(out.size()), out);
+    return out;
+}
+
+Containers::Optional<Containers::ArrayView<const char>> peekedFileCallback(const std::string& filename, const InputFileCallbackPolicy policy, void* const userData) {
+    PeekedFile& file = *static_cast<PeekedFile*>(userData);
+    if(file.data && filename == file.filename) {
+        if(policy == InputFileCallbackPolicy::Close) {
+            file.close();
+            return {};
+        }
+
+        return file.data;
+    }
+
+    return file.callback(filename, policy, file.userData);
+}
+
+}
+
+}}
+
+#endif
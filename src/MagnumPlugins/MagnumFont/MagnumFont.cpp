@@ -29,12 +29,13 @@
 #include "MagnumFont.h"
 
 #include <sstream>
-#include <unordered_map>
 #include <Corrade/Containers/Array.h>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/Reference.h>
 #include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/Containers/Triple.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/Configuration.h>
@@ -44,6 +45,7 @@
 #include "Magnum/ImageView.h"
 #include "Magnum/PixelFormat.h"
 #include "Magnum/Math/ConfigurationValue.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Text/AbstractShaper.h"
 #include "Magnum/Text/GlyphCacheGL.h"
 #include "Magnum/Trade/ImageData.h"
@@ -51,6 +53,8 @@
 
 namespace Magnum { namespace Text {
 
+using namespace Containers::Literals;
+
 struct MagnumFont::Data {
     /* Otherwise Clang complains about Utility::Configuration having explicit
        constructor when emplace()ing the Pointer. Using = default works on
@@ -60,12 +64,27 @@ struct MagnumFont::Data {
     Utility::Configuration conf;
     Containers::Optional<Trade::ImageData2D> image;
     Containers::Optional<Containers::String> filePath;
-    std::unordered_map<char32_t, UnsignedInt> glyphId;
+    /* Two-level character to glyph ID map. The first level is indexed with
+       the upper bits of a codepoint and contains offsets of 256-item pages in
+       the second level, or ~UnsignedInt{} if there are no characters in given
+       range. It's thus just two lookups for any character, pages for ASCII /
+       Latin are dense and CJK fonts need only the pages they actually use.
+       Characters not present in the font map to the invalid glyph 0. */
+    Containers::Array<UnsignedInt> glyphIdPages;
+    Containers::Array<UnsignedInt> glyphIds;
     struct Glyph {
-        Vector2i size;
+        Vector2i position;
+        Range2Di rectangle;
         Vector2 advance;
     };
     Containers::Array<Glyph> glyphs;
+
+    UnsignedInt glyphId(const char32_t character) const {
+        const std::size_t page = character >> 8;
+        if(page >= glyphIdPages.size() || glyphIdPages[page] == ~UnsignedInt{})
+            return 0;
+        return glyphIds[glyphIdPages[page] + (character & 0xff)];
+    }
 };
 
 MagnumFont::MagnumFont(): _opened(nullptr) {} /* LCOV_EXCL_LINE */
@@ -125,22 +144,51 @@ void MagnumFont::doOpenData(Containers::Array<char>&& data, DataFlags, Float, Un
     /* Everything okay, save the data internally */
     _opened->conf = Utility::move(conf);
 
-    /* Glyph advances */
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
-    _opened->glyphs = Containers::Array<Data::Glyph>{NoInit, glyphs.size()};
-    for(std::size_t i = 0; i != glyphs.size(); ++i)
-        _opened->glyphs[i] = {
-            glyphs[i]->value<Range2Di>("rectangle").size(),
-            glyphs[i]->value<Vector2>("advance")
-        };
-
-    /* Fill character->glyph map */
-    const std::vector<Utility::ConfigurationGroup*> chars = _opened->conf.groups("char");
-    for(const Utility::ConfigurationGroup* const c: chars) {
-        const UnsignedInt glyphId = c->value<UnsignedInt>("glyph");
-        CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphs.size());
-        _opened->glyphId.emplace(c->value<char32_t>("unicode"), glyphId);
+    /* Glyph properties and the character->glyph mapping. Parsed just once
+       here, so creating a glyph cache doesn't need to go through the
+       configuration again. All groups are iterated in a single pass, without
+       making a copy of the group list. */
+    const Utility::ConfigurationGroup& root = _opened->conf;
+    _opened->glyphs = Containers::Array<Data::Glyph>{NoInit, root.groupCount("glyph")};
+    Containers::Array<Containers::Pair<char32_t, UnsignedInt>> characters{NoInit, root.groupCount("char")};
+    std::size_t glyphCount = 0;
+    std::size_t characterCount = 0;
+    std::size_t pageCount = 0;
+    for(Containers::Pair<Containers::StringView, Containers::Reference<const Utility::ConfigurationGroup>> group: root.groups()) {
+        if(group.first() == "glyph"_s) {
+            _opened->glyphs[glyphCount++] = {
+                group.second()->value<Vector2i>("position"),
+                group.second()->value<Range2Di>("rectangle"),
+                group.second()->value<Vector2>("advance")
+            };
+        } else if(group.first() == "char"_s) {
+            const char32_t character = group.second()->value<char32_t>("unicode");
+            const UnsignedInt glyphId = group.second()->value<UnsignedInt>("glyph");
+            CORRADE_INTERNAL_ASSERT(glyphId < _opened->glyphs.size());
+            characters[characterCount++] = {character, glyphId};
+            /* Find the highest page used */
+            pageCount = Math::max(pageCount, std::size_t(character >> 8) + 1);
+        }
     }
+    CORRADE_INTERNAL_ASSERT(glyphCount == _opened->glyphs.size() && characterCount == characters.size());
+
+    /* Fill the two-level map, allocating pages as needed. Going in reverse so
+       if a character is listed more than once, the first occurrence wins. */
+    _opened->glyphIdPages = Containers::Array<UnsignedInt>{DirectInit, pageCount, ~UnsignedInt{}};
+    _opened->glyphIds = {};
+    for(std::size_t i = characters.size(); i != 0; --i) {
+        const Containers::Pair<char32_t, UnsignedInt>& c = characters[i - 1];
+        UnsignedInt& page = _opened->glyphIdPages[c.first() >> 8];
+        if(page == ~UnsignedInt{}) {
+            page = _opened->glyphIds.size();
+            arrayAppend(_opened->glyphIds, ValueInit, 256);
+        }
+        _opened->glyphIds[page + (c.first() & 0xff)] = c.second();
+    }
+
+    /* Turn the array back into a non-growable to avoid a dangling deleter on
+       plugin unload */
+    arrayShrink(_opened->glyphIds);
 }
 
 auto MagnumFont::doProperties() -> Properties {
@@ -159,14 +207,13 @@ void MagnumFont::doOpenFile(const Containers::StringView filename, const Float s
 }
 
 void MagnumFont::doGlyphIdsInto(const Containers::StridedArrayView1D<const char32_t>& characters, const Containers::StridedArrayView1D<UnsignedInt>& glyphs) {
-    for(std::size_t i = 0; i != characters.size(); ++i) {
-        auto it = _opened->glyphId.find(characters[i]);
-        glyphs[i] = it != _opened->glyphId.end() ? it->second : 0;
-    }
+    const Data& data = *_opened;
+    for(std::size_t i = 0; i != characters.size(); ++i)
+        glyphs[i] = data.glyphId(characters[i]);
 }
 
 Vector2 MagnumFont::doGlyphSize(const UnsignedInt glyph) {
-    return Vector2{_opened->glyphs[glyph].size};
+    return Vector2{_opened->glyphs[glyph].rectangle.size()};
 }
 
 Vector2 MagnumFont::doGlyphAdvance(const UnsignedInt glyph) {
@@ -193,17 +240,17 @@ Containers::Pointer<AbstractGlyphCache> MagnumFont::doCreateGlyphCache() {
         _opened->conf.value<Vector2i>("padding")};
     cache->setProcessedImage({}, *_opened->image);
 
-    const std::vector<Utility::ConfigurationGroup*> glyphs = _opened->conf.groups("glyph");
+    const Containers::ArrayView<const Data::Glyph> glyphs = _opened->glyphs;
 
     /* Set the global invalid glyph to the same as the per-font invalid
        glyph. */
-    if(!glyphs.empty())
-        cache->setInvalidGlyph(glyphs[0]->value<Vector2i>("position"), glyphs[0]->value<Range2Di>("rectangle"));
+    if(!glyphs.isEmpty())
+        cache->setInvalidGlyph(glyphs[0].position, glyphs[0].rectangle);
 
     /* Add a font, fill the glyph map */
     const UnsignedInt fontId = cache->addFont(glyphs.size(), this);
     for(std::size_t i = 0; i < glyphs.size(); ++i)
-        cache->addGlyph(fontId, i, glyphs[i]->value<Vector2i>("position"), glyphs[i]->value<Range2Di>("rectangle"));
+        cache->addGlyph(fontId, i, glyphs[i].position, glyphs[i].rectangle);
 
     /* GCC 4.8 needs extra help here */
     return Containers::Pointer<AbstractGlyphCache>{Utility::move(cache)};
@@ -224,9 +271,8 @@ Containers::Pointer<AbstractShaper> MagnumFont::doCreateShaper() {
             arrayReserve(_glyphs, text.size());
             for(std::size_t i = 0; i != text.size(); ) {
                 const Containers::Pair<char32_t, std::size_t> codepointNext = Utility::Unicode::nextChar(text, i);
-                const auto it = fontData.glyphId.find(codepointNext.first());
                 arrayAppend(_glyphs, InPlaceInit,
-                    it == fontData.glyphId.end() ? 0 : it->second,
+                    fontData.glyphId(codepointNext.first()),
                     begin + UnsignedInt(i));
                 i = codepointNext.second();
             }
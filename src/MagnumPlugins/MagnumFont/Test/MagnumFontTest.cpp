@@ -29,6 +29,7 @@
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StridedArrayView.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/TestSuite/Compare/String.h>
@@ -53,6 +54,7 @@ struct MagnumFontTest: TestSuite::Tester {
     void nonexistent();
     void nonZeroFontId();
     void properties();
+    void glyphIdMultiplePages();
 
     void shape();
     void shapeEmpty();
@@ -66,6 +68,8 @@ struct MagnumFontTest: TestSuite::Tester {
     PluginManager::Manager<AbstractFont> _fontManager{"nonexistent"};
 };
 
+using namespace Containers::Literals;
+
 const struct {
     const char* name;
     const char* string;
@@ -81,7 +85,8 @@ const struct {
 MagnumFontTest::MagnumFontTest() {
     addTests({&MagnumFontTest::nonexistent,
               &MagnumFontTest::nonZeroFontId,
-              &MagnumFontTest::properties});
+              &MagnumFontTest::properties,
+              &MagnumFontTest::glyphIdMultiplePages});
 
     addInstancedTests({&MagnumFontTest::shape},
         Containers::arraySize(ShapeData));
@@ -145,10 +150,59 @@ void MagnumFontTest::properties() {
         #endif
     );
     CORRADE_COMPARE(eId, 3);
+    /* Characters not in the font, in a page that has other characters and
+       past the last page */
+    CORRADE_COMPARE(font->glyphId(U'X'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\u0150'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\u4e00'), 0);
     CORRADE_COMPARE(font->glyphSize(font->glyphId(U'W')), (Vector2{8.0f, 44.0f}));
     CORRADE_COMPARE(font->glyphAdvance(font->glyphId(U'W')), (Vector2{23.0f, 0.0f}));
 }
 
+void MagnumFontTest::glyphIdMultiplePages() {
+    Containers::Pointer<AbstractFont> font = _fontManager.instantiate("MagnumFont");
+
+    /* Take the original font and add characters from pages far apart, with
+       one of them listed twice */
+    Containers::Optional<Containers::String> conf = Utility::Path::readString(Utility::Path::join(MAGNUMFONT_TEST_DIR, "font.conf"));
+    Containers::Optional<Containers::Array<char>> tga = Utility::Path::read(Utility::Path::join(MAGNUMFONT_TEST_DIR, "font.tga"));
+    CORRADE_VERIFY(conf);
+    CORRADE_VERIFY(tga);
+    const Containers::String data = *conf +
+        "[char]\n"
+        "unicode=4E00\n"
+        "glyph=2\n"
+        "[char]\n"
+        "unicode=1F600\n"
+        "glyph=1\n"
+        "[char]\n"
+        "unicode=4E00\n"
+        "glyph=0\n"_s;
+
+    /* The image is loaded through the callback, as there's no file path */
+    font->setFileCallback([](const std::string&, InputFileCallbackPolicy, Containers::Array<char>& tga) {
+            return Containers::optional(Containers::ArrayView<const char>(tga));
+        }, *tga);
+    CORRADE_VERIFY(font->openData(Containers::arrayView(data.data(), data.size()), 16.0f));
+    CORRADE_COMPARE(font->glyphCount(), 4);
+
+    /* The original characters are still there */
+    CORRADE_COMPARE(font->glyphId(U'W'), 2);
+    CORRADE_COMPARE(font->glyphId(U'e'), 1);
+    CORRADE_COMPARE(font->glyphId(U'\u011B'), 3);
+
+    /* First occurrence wins */
+    CORRADE_COMPARE(font->glyphId(U'\u4e00'), 2);
+    CORRADE_COMPARE(font->glyphId(U'\U0001F600'), 1);
+
+    /* Characters not in the font, in pages that have other characters, in an
+       unused page between and past the last page */
+    CORRADE_COMPARE(font->glyphId(U'\u4e01'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\U0001F601'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\u9fff'), 0);
+    CORRADE_COMPARE(font->glyphId(U'\U0010FFFF'), 0);
+}
+
 void MagnumFontTest::shape() {
     auto&& data = ShapeData[testCaseInstanceId()];
     setTestCaseDescription(data.name);
@@ -0,0 +1,195 @@
+#ifndef Magnum_Trade_BlobFormat_h
+#define Magnum_Trade_BlobFormat_h
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "Magnum/Types.h"
+
+/* Used by both MagnumImporter and MagnumSceneConverter, which is why it isn't
+   directly inside MagnumImporter.cpp. OTOH it doesn't need to be exposed
+   publicly, which is why it has no docblocks.
+
+   The file is a BlobHeader followed by BlobHeader::chunkCount chunks. Each
+   chunk starts with a BlobChunkHeader, followed by a type-specific header
+   (BlobMesh, BlobScene, ...), followed by a type-specific array of entries
+   (BlobMeshAttribute, BlobSceneField, BlobAnimationTrack), followed by the
+   chunk name and the actual data. All offsets in the type-specific headers
+   are relative to the chunk start, all offsets in the entries are relative to
+   the data they describe. Everything is in the native endianness of the
+   platform the file was written on, each chunk and each data block in it is
+   aligned to BlobAlignment bytes. The reserved fields are zero. */
+
+namespace Magnum { namespace Trade { namespace Implementation {
+
+enum: UnsignedShort {
+    BlobByteOrderMark = 0xfeff,
+    BlobVersion = 1
+};
+
+enum: std::size_t {
+    BlobAlignment = 8
+};
+
+enum class BlobChunkType: UnsignedInt {
+    Scene = 1,
+    Animation = 2,
+    Mesh = 3,
+    Material = 4,
+    Image1D = 5,
+    Image2D = 6,
+    Image3D = 7
+};
+
+/* File header */
+struct BlobHeader {
+    char magic[4];                  /* MGNB */
+    UnsignedShort byteOrderMark;    /* BlobByteOrderMark in file endianness */
+    UnsignedShort version;          /* BlobVersion */
+    Int defaultScene;               /* -1 if there's no default scene */
+    UnsignedInt chunkCount;
+    UnsignedLong size;              /* Size of the whole file */
+};
+
+/* Common chunk header */
+struct BlobChunkHeader {
+    UnsignedInt type;               /* BlobChunkType */
+    UnsignedInt nameSize;           /* Name follows the type-specific entries */
+    UnsignedLong size;              /* Whole chunk including this header */
+};
+
+struct BlobMesh {
+    UnsignedLong indexDataOffset;
+    UnsignedLong indexDataSize;
+    UnsignedLong vertexDataOffset;
+    UnsignedLong vertexDataSize;
+    UnsignedLong indexOffset;       /* Relative to index data */
+    UnsignedInt primitive;          /* MeshPrimitive */
+    UnsignedInt indexType;          /* MeshIndexType, 0 if not indexed */
+    UnsignedInt indexCount;
+    Int indexStride;
+    UnsignedInt vertexCount;
+    UnsignedInt attributeCount;     /* BlobMeshAttribute entries that follow */
+};
+
+struct BlobMeshAttribute {
+    UnsignedLong offset;            /* Relative to vertex data */
+    UnsignedInt format;             /* VertexFormat */
+    Int stride;
+    Int morphTargetId;
+    UnsignedShort name;             /* MeshAttribute */
+    UnsignedShort arraySize;
+};
+
+struct BlobScene {
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+    UnsignedLong mappingBound;
+    UnsignedInt mappingType;        /* SceneMappingType */
+    UnsignedInt fieldCount;         /* BlobSceneField entries that follow */
+};
+
+struct BlobSceneField {
+    UnsignedLong size;
+    UnsignedLong mappingOffset;     /* Relative to scene data */
+    UnsignedLong fieldOffset;       /* Relative to scene data */
+    UnsignedLong stringOffset;      /* Relative to scene data, strings only */
+    Int mappingStride;
+    Int fieldStride;                /* In bits for bit fields */
+    UnsignedInt name;               /* SceneField */
+    UnsignedShort fieldType;        /* SceneFieldType */
+    UnsignedShort arraySize;
+    UnsignedByte flags;             /* SceneFieldFlags */
+    UnsignedByte fieldBitOffset;    /* Bit fields only */
+    UnsignedShort reserved;
+    UnsignedInt reserved2;
+};
+
+struct BlobMaterial {
+    UnsignedLong attributeDataOffset;
+    UnsignedLong layerDataOffset;
+    UnsignedInt types;              /* MaterialTypes */
+    UnsignedInt attributeCount;     /* MaterialAttributeData items */
+    UnsignedInt layerCount;         /* UnsignedInt layer offsets */
+    UnsignedInt reserved;
+};
+
+/* For all dimensions, with the unused size components set to 1 */
+struct BlobImage {
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+    Int size[3];
+    UnsignedInt format;             /* PixelFormat or CompressedPixelFormat */
+    UnsignedInt formatExtra;        /* Uncompressed images only */
+    UnsignedInt pixelSize;          /* Block data size for compressed images */
+    Int blockSize[3];               /* Compressed images only */
+    Int storageAlignment;           /* Uncompressed images only */
+    Int storageRowLength;
+    Int storageImageHeight;
+    Int storageSkip[3];
+    UnsignedShort flags;            /* ImageFlags */
+    UnsignedByte compressed;
+    UnsignedByte reserved;
+};
+
+struct BlobAnimation {
+    UnsignedLong dataOffset;
+    UnsignedLong dataSize;
+    Float duration[2];
+    UnsignedInt trackCount;         /* BlobAnimationTrack entries that follow */
+    UnsignedInt reserved;
+};
+
+struct BlobAnimationTrack {
+    UnsignedLong target;
+    UnsignedLong keysOffset;        /* Relative to animation data */
+    UnsignedLong valuesOffset;      /* Relative to animation data */
+    UnsignedInt size;
+    Int keysStride;
+    Int valuesStride;
+    UnsignedShort targetName;       /* AnimationTrackTarget */
+    UnsignedByte type;              /* AnimationTrackType */
+    UnsignedByte resultType;        /* AnimationTrackType */
+    UnsignedByte interpolation;     /* Animation::Interpolation */
+    UnsignedByte before;            /* Animation::Extrapolation */
+    UnsignedByte after;             /* Animation::Extrapolation */
+    UnsignedByte reserved;
+    UnsignedInt reserved2;
+};
+
+static_assert(sizeof(BlobHeader) == 24, "BlobHeader size is not 24 bytes");
+static_assert(sizeof(BlobChunkHeader) == 16, "BlobChunkHeader size is not 16 bytes");
+static_assert(sizeof(BlobMesh) == 64, "BlobMesh size is not 64 bytes");
+static_assert(sizeof(BlobMeshAttribute) == 24, "BlobMeshAttribute size is not 24 bytes");
+static_assert(sizeof(BlobScene) == 32, "BlobScene size is not 32 bytes");
+static_assert(sizeof(BlobSceneField) == 56, "BlobSceneField size is not 56 bytes");
+static_assert(sizeof(BlobMaterial) == 32, "BlobMaterial size is not 32 bytes");
+static_assert(sizeof(BlobImage) == 80, "BlobImage size is not 80 bytes");
+static_assert(sizeof(BlobAnimation) == 32, "BlobAnimation size is not 32 bytes");
+static_assert(sizeof(BlobAnimationTrack) == 48, "BlobAnimationTrack size is not 48 bytes");
+
+}}}
+
+#endif
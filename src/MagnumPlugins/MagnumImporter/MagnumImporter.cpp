@@ -0,0 +1,1099 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumImporter.h"
+
+#include <cstdint>
+#include <cstring>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pair.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/ImageFlags.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/PixelStorage.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Animation/Interpolation.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/Data.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MagnumImporter/BlobFormat.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Implementation;
+
+namespace {
+
+struct Chunk {
+    const char* data;
+    Containers::StringView name;
+};
+
+Int chunkForName(const Containers::ArrayView<const Chunk> chunks, const Containers::StringView name) {
+    for(std::size_t i = 0; i != chunks.size(); ++i)
+        if(chunks[i].name == name) return i;
+    return -1;
+}
+
+template<class T> const T& chunkHeader(const Chunk& chunk) {
+    return *reinterpret_cast<const T*>(chunk.data + sizeof(BlobChunkHeader));
+}
+
+template<class T, class U> Containers::ArrayView<const T> chunkEntries(const Chunk& chunk, const std::size_t count) {
+    return {reinterpret_cast<const T*>(chunk.data + sizeof(BlobChunkHeader) + sizeof(U)), count};
+}
+
+Containers::ArrayView<const char> chunkData(const Chunk& chunk, const UnsignedLong offset, const UnsignedLong size) {
+    return {chunk.data + offset, std::size_t(size)};
+}
+
+/* Checks that the first item of a strided view is at most at the end of given
+   data and that all count items of given size fit into them. Written in a way
+   that can't overflow for arbitrary values coming from the file. */
+bool isStridedRangeInBounds(const UnsignedLong offset, const UnsignedLong count, const UnsignedLong typeSize, const Long stride, const UnsignedLong dataSize) {
+    if(offset > dataSize) return false;
+    if(!count) return true;
+    if(typeSize > dataSize - offset) return false;
+
+    const UnsignedLong absoluteStride = stride < 0 ? -stride : stride;
+    if(absoluteStride && count - 1 > dataSize/absoluteStride) return false;
+    const UnsignedLong distance = (count - 1)*absoluteStride;
+    return stride < 0 ? distance <= offset : distance <= dataSize - offset - typeSize;
+}
+
+bool isStrideInRange(const Int stride) {
+    return stride >= -32768 && stride <= 32767;
+}
+
+/* The checks below mirror the assertions in SceneData, MeshData and other
+   constructors, so a malformed file is reported on open instead of causing
+   an assertion on import. They assume the chunk layout and data ranges were
+   already checked. */
+
+/* Which transformation fields are 2D. All others are 3D, assuming the field
+   type was already checked to be valid for given field. */
+bool isSceneFieldType2D(const SceneFieldType type) {
+    return
+        type == SceneFieldType::Matrix3x3 ||
+        type == SceneFieldType::Matrix3x3d ||
+        type == SceneFieldType::Matrix3x2 ||
+        type == SceneFieldType::Matrix3x2d ||
+        type == SceneFieldType::DualComplex ||
+        type == SceneFieldType::DualComplexd ||
+        type == SceneFieldType::Vector2 ||
+        type == SceneFieldType::Vector2d ||
+        type == SceneFieldType::Complex ||
+        type == SceneFieldType::Complexd;
+}
+
+bool checkScene(const UnsignedInt id, const Chunk& chunk) {
+    const BlobScene& scene = chunkHeader<BlobScene>(chunk);
+    if(!scene.mappingType || scene.mappingType > UnsignedInt(SceneMappingType::UnsignedLong)) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid mapping type" << scene.mappingType;
+        return false;
+    }
+    const SceneMappingType mappingType = SceneMappingType(scene.mappingType);
+    if((mappingType == SceneMappingType::UnsignedByte && scene.mappingBound > 0xffull) ||
+       (mappingType == SceneMappingType::UnsignedShort && scene.mappingBound > 0xffffull) ||
+       (mappingType == SceneMappingType::UnsignedInt && scene.mappingBound > 0xffffffffull))
+    {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "mapping type" << mappingType << "is too small for" << scene.mappingBound << "objects";
+        return false;
+    }
+    const UnsignedInt mappingTypeSize = sceneMappingTypeSize(mappingType);
+
+    /* Builtin fields are checked for duplicates using a bit mask, custom
+       fields in a O(n^2) way, same as in SceneData */
+    const Containers::ArrayView<const BlobSceneField> fields = chunkEntries<BlobSceneField, BlobScene>(chunk, scene.fieldCount);
+    UnsignedInt builtinFieldsPresent = 0;
+    UnsignedInt transformationFields[4]{~UnsignedInt{}, ~UnsignedInt{}, ~UnsignedInt{}, ~UnsignedInt{}};
+    UnsignedInt meshMaterialFields[2]{~UnsignedInt{}, ~UnsignedInt{}};
+    bool hasSkinField = false;
+    for(UnsignedInt i = 0; i != fields.size(); ++i) {
+        const BlobSceneField& field = fields[i];
+        const SceneField name = SceneField(field.name);
+        const SceneFieldType fieldType = SceneFieldType(field.fieldType);
+        if(!isSceneFieldCustom(name) && (!field.name || field.name > UnsignedInt(SceneField::ImporterState))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "has an invalid name" << field.name;
+            return false;
+        }
+        /* Pointers wouldn't survive a round trip through a file, so they're
+           treated as invalid as well */
+        if(!field.fieldType || field.fieldType > UnsignedShort(SceneFieldType::MutablePointer) || fieldType == SceneFieldType::Pointer || fieldType == SceneFieldType::MutablePointer) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "has an invalid type" << fieldType;
+            return false;
+        }
+        if(!Implementation::isSceneFieldTypeCompatibleWithField(name, fieldType)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "type" << fieldType << "is not valid for" << name;
+            return false;
+        }
+        /* The offset-only and null-terminated flags are implicit and thus
+           not stored */
+        const SceneFieldFlags flags = SceneFieldFlag(field.flags);
+        if(flags & ~(SceneFieldFlag::ImplicitMapping|SceneFieldFlag::MultiEntry) || flags & Implementation::disallowedSceneFieldFlagsFor(name)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "has invalid flags" << Debug::hex << UnsignedInt(field.flags);
+            return false;
+        }
+        if(field.arraySize && (!Implementation::isSceneFieldArrayAllowed(name) || Implementation::isSceneFieldTypeString(fieldType))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "can't be an array field";
+            return false;
+        }
+        if(fieldType == SceneFieldType::Bit && field.fieldBitOffset >= 8) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "has an invalid bit offset" << UnsignedInt(field.fieldBitOffset);
+            return false;
+        }
+        if(!isStrideInRange(field.mappingStride) || !isStrideInRange(field.fieldStride)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "strides" << field.mappingStride << "and" << field.fieldStride << "don't fit into 16 bits";
+            return false;
+        }
+        /* Same limit as SceneFieldData has for bit fields, applied to all
+           fields for simplicity */
+        if(field.size >= (UnsignedLong{1} << (sizeof(std::size_t)*8 - 3))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "size" << field.size << "too large";
+            return false;
+        }
+
+        if(!isSceneFieldCustom(name)) {
+            if(builtinFieldsPresent & (1u << field.name)) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has a duplicate field" << name;
+                return false;
+            }
+            builtinFieldsPresent |= 1u << field.name;
+        } else for(UnsignedInt j = 0; j != i; ++j) {
+            if(fields[j].name == field.name) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has a duplicate field" << name;
+                return false;
+            }
+        }
+
+        /* Empty fields can point anywhere */
+        if(field.size) {
+            if(!isStridedRangeInBounds(field.mappingOffset, field.size, mappingTypeSize, field.mappingStride, scene.dataSize)) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "mapping out of range for" << scene.dataSize << "bytes";
+                return false;
+            }
+
+            /* Bit field offsets, sizes and strides are in bits */
+            const UnsignedInt arraySize = field.arraySize ? field.arraySize : 1;
+            if(fieldType == SceneFieldType::Bit ?
+                field.fieldOffset > scene.dataSize || !isStridedRangeInBounds(field.fieldOffset*8 + field.fieldBitOffset, field.size, arraySize, field.fieldStride, scene.dataSize*8) :
+                !isStridedRangeInBounds(field.fieldOffset, field.size, sceneFieldTypeSize(fieldType)*arraySize, field.fieldStride, scene.dataSize))
+            {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "data out of range for" << scene.dataSize << "bytes";
+                return false;
+            }
+
+            if(Implementation::isSceneFieldTypeString(fieldType) && field.stringOffset > scene.dataSize) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "field" << i << "string data out of range for" << scene.dataSize << "bytes";
+                return false;
+            }
+        }
+
+        if(name == SceneField::Transformation)
+            transformationFields[0] = i;
+        else if(name == SceneField::Translation)
+            transformationFields[1] = i;
+        else if(name == SceneField::Rotation)
+            transformationFields[2] = i;
+        else if(name == SceneField::Scaling)
+            transformationFields[3] = i;
+        else if(name == SceneField::Mesh)
+            meshMaterialFields[0] = i;
+        else if(name == SceneField::MeshMaterial)
+            meshMaterialFields[1] = i;
+        else if(name == SceneField::Skin)
+            hasSkinField = true;
+    }
+
+    /* TRS fields have to share the same object mapping, and so do mesh and
+       material fields */
+    for(const Containers::ArrayView<const UnsignedInt> sharedFields: {
+        Containers::arrayView(transformationFields).exceptPrefix(1),
+        Containers::arrayView(meshMaterialFields)
+    }) {
+        const BlobSceneField* first = nullptr;
+        for(const UnsignedInt i: sharedFields) {
+            if(i == ~UnsignedInt{}) continue;
+            const BlobSceneField& field = fields[i];
+            if(!first) {
+                first = &field;
+                continue;
+            }
+            if(field.mappingOffset != first->mappingOffset || field.size != first->size || field.mappingStride != first->mappingStride) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << SceneField(field.name) << "mapping data is different from" << SceneField(first->name) << "mapping data";
+                return false;
+            }
+        }
+    }
+
+    /* All transformation fields have to agree on the dimension count, and a
+       skin field needs at least one to disambiguate between 2D and 3D */
+    Int dimensions = 0;
+    for(const UnsignedInt i: transformationFields) {
+        if(i == ~UnsignedInt{}) continue;
+        const Int fieldDimensions = isSceneFieldType2D(SceneFieldType(fields[i].fieldType)) ? 2 : 3;
+        if(dimensions && dimensions != fieldDimensions) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has both 2D and 3D transformation fields";
+            return false;
+        }
+        dimensions = fieldDimensions;
+    }
+    if(hasSkinField && !dimensions) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has a skin field but no transformation field";
+        return false;
+    }
+
+    return true;
+}
+
+bool checkAnimation(const UnsignedInt id, const Chunk& chunk) {
+    const BlobAnimation& animation = chunkHeader<BlobAnimation>(chunk);
+    const Containers::ArrayView<const BlobAnimationTrack> tracks = chunkEntries<BlobAnimationTrack, BlobAnimation>(chunk, animation.trackCount);
+    for(UnsignedInt i = 0; i != tracks.size(); ++i) {
+        const BlobAnimationTrack& track = tracks[i];
+        if(!isAnimationTrackTargetCustom(AnimationTrackTarget(track.targetName)) && (!track.targetName || track.targetName > UnsignedShort(AnimationTrackTarget::Scaling3D))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "has an invalid target name" << track.targetName;
+            return false;
+        }
+        if(!track.type || track.type > UnsignedByte(AnimationTrackType::CubicHermiteQuaternion)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "has an invalid type" << UnsignedInt(track.type);
+            return false;
+        }
+
+        /* Only the builtin interpolators can be used, which means the result
+           type is implied by the type and splines work only for spline
+           types */
+        const AnimationTrackType type = AnimationTrackType(track.type);
+        AnimationTrackType resultType;
+        switch(type) {
+            case AnimationTrackType::CubicHermite1D:
+                resultType = AnimationTrackType::Float;
+                break;
+            case AnimationTrackType::CubicHermite2D:
+                resultType = AnimationTrackType::Vector2;
+                break;
+            case AnimationTrackType::CubicHermite3D:
+                resultType = AnimationTrackType::Vector3;
+                break;
+            case AnimationTrackType::CubicHermiteComplex:
+                resultType = AnimationTrackType::Complex;
+                break;
+            case AnimationTrackType::CubicHermiteQuaternion:
+                resultType = AnimationTrackType::Quaternion;
+                break;
+            default:
+                resultType = type;
+        }
+        if(AnimationTrackType(track.resultType) != resultType) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "has an invalid result type" << UnsignedInt(track.resultType) << "for" << type;
+            return false;
+        }
+        if(track.interpolation > UnsignedByte(Animation::Interpolation::Spline) || (Animation::Interpolation(track.interpolation) == Animation::Interpolation::Spline && resultType == type)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "has an invalid interpolation" << UnsignedInt(track.interpolation) << "for" << type;
+            return false;
+        }
+        if(track.before > UnsignedByte(Animation::Extrapolation::DefaultConstructed) || track.after > UnsignedByte(Animation::Extrapolation::DefaultConstructed)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "has an invalid extrapolation" << UnsignedInt(track.before) << Debug::nospace << "," << UnsignedInt(track.after);
+            return false;
+        }
+
+        if(!isStrideInRange(track.keysStride) || !isStrideInRange(track.valuesStride)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "strides" << track.keysStride << "and" << track.valuesStride << "don't fit into 16 bits";
+            return false;
+        }
+        if(!isStridedRangeInBounds(track.keysOffset, track.size, sizeof(Float), track.keysStride, animation.dataSize)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "keys out of range for" << animation.dataSize << "bytes";
+            return false;
+        }
+        if(!isStridedRangeInBounds(track.valuesOffset, track.size, animationTrackTypeSize(type), track.valuesStride, animation.dataSize)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "track" << i << "values out of range for" << animation.dataSize << "bytes";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool checkMesh(const UnsignedInt id, const Chunk& chunk) {
+    const BlobMesh& mesh = chunkHeader<BlobMesh>(chunk);
+    if(!isMeshPrimitiveImplementationSpecific(MeshPrimitive(mesh.primitive)) && (!mesh.primitive || mesh.primitive > UnsignedInt(MeshPrimitive::Meshlets))) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid primitive" << mesh.primitive;
+        return false;
+    }
+
+    if(mesh.indexType) {
+        const MeshIndexType indexType = MeshIndexType(mesh.indexType);
+        if(!isMeshIndexTypeImplementationSpecific(indexType) && mesh.indexType > UnsignedInt(MeshIndexType::UnsignedInt)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid index type" << mesh.indexType;
+            return false;
+        }
+        if(!isStrideInRange(mesh.indexStride)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "index stride" << mesh.indexStride << "doesn't fit into 16 bits";
+            return false;
+        }
+        /* For implementation-specific types the size isn't known, check at
+           least partially with zero, same as MeshData does */
+        const UnsignedInt typeSize = isMeshIndexTypeImplementationSpecific(indexType) ? 0 : meshIndexTypeSize(indexType);
+        if(!isStridedRangeInBounds(mesh.indexOffset, mesh.indexCount, typeSize, mesh.indexStride, mesh.indexDataSize)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "indices out of range for" << mesh.indexDataSize << "bytes";
+            return false;
+        }
+    }
+    if(!(mesh.indexType ? mesh.indexCount : 0) && mesh.indexDataSize) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has index data but no indices";
+        return false;
+    }
+    if(!mesh.attributeCount && mesh.vertexCount == MeshData::ImplicitVertexCount) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an implicit vertex count but no attributes";
+        return false;
+    }
+
+    const Containers::ArrayView<const BlobMeshAttribute> attributes = chunkEntries<BlobMeshAttribute, BlobMesh>(chunk, mesh.attributeCount);
+    UnsignedInt jointIdAttributeCount = 0;
+    UnsignedInt weightAttributeCount = 0;
+    for(UnsignedInt i = 0; i != attributes.size(); ++i) {
+        const BlobMeshAttribute& attribute = attributes[i];
+        const MeshAttribute name = MeshAttribute(attribute.name);
+        const VertexFormat format = VertexFormat(attribute.format);
+        if(!isMeshAttributeCustom(name) && (!attribute.name || attribute.name > UnsignedShort(MeshAttribute::ObjectId))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "has an invalid name" << attribute.name;
+            return false;
+        }
+        if(!isVertexFormatImplementationSpecific(format) && (!attribute.format || attribute.format > UnsignedInt(VertexFormat::Matrix4x3sNormalizedAligned))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "has an invalid format" << attribute.format;
+            return false;
+        }
+        if(!Implementation::isVertexFormatCompatibleWithAttribute(name, format)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "format" << format << "is not valid for" << name;
+            return false;
+        }
+        if(attribute.morphTargetId != -1 && (UnsignedInt(attribute.morphTargetId) >= 128 || !Implementation::isMorphTargetAllowed(name))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "has an invalid morph target ID" << attribute.morphTargetId;
+            return false;
+        }
+        if(!isStrideInRange(attribute.stride)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "stride" << attribute.stride << "doesn't fit into 16 bits";
+            return false;
+        }
+        if(attribute.arraySize && !Implementation::isAttributeArrayAllowed(name)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "can't be an array attribute";
+            return false;
+        }
+
+        /* If the mesh has no vertices, the attributes can point anywhere. For
+           implementation-specific formats the size isn't known, check at
+           least partially with zero, same as MeshData does. */
+        if(mesh.vertexCount) {
+            const UnsignedInt typeSize = isVertexFormatImplementationSpecific(format) ? 0 :
+                vertexFormatSize(format)*(attribute.arraySize ? attribute.arraySize : 1);
+            if(!isStridedRangeInBounds(attribute.offset, mesh.vertexCount, typeSize, attribute.stride, mesh.vertexDataSize)) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "out of range for" << mesh.vertexDataSize << "bytes";
+                return false;
+            }
+        }
+
+        if(name == MeshAttribute::JointIds)
+            ++jointIdAttributeCount;
+        else if(name == MeshAttribute::Weights)
+            ++weightAttributeCount;
+    }
+
+    /* Skin joint IDs and weights have to come in pairs of matching array
+       sizes. Neither can be a morph target, so no need to filter those out. */
+    if(jointIdAttributeCount != weightAttributeCount) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has" << jointIdAttributeCount << "joint ID attributes but" << weightAttributeCount << "weight attributes";
+        return false;
+    }
+    for(UnsignedInt i = 0, weightId = 0; i != attributes.size(); ++i) {
+        if(MeshAttribute(attributes[i].name) != MeshAttribute::JointIds)
+            continue;
+        while(MeshAttribute(attributes[weightId].name) != MeshAttribute::Weights)
+            ++weightId;
+        if(attributes[i].arraySize != attributes[weightId].arraySize) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "array size" << attributes[i].arraySize << "doesn't match weight attribute" << weightId << "array size" << attributes[weightId].arraySize;
+            return false;
+        }
+        ++weightId;
+    }
+
+    return true;
+}
+
+bool checkMaterial(const UnsignedInt id, const Chunk& chunk) {
+    const BlobMaterial& material = chunkHeader<BlobMaterial>(chunk);
+    const Containers::ArrayView<const MaterialAttributeData> attributes{reinterpret_cast<const MaterialAttributeData*>(chunk.data + material.attributeDataOffset), material.attributeCount};
+    for(UnsignedInt i = 0; i != attributes.size(); ++i) {
+        /* Pointers wouldn't survive a round trip through a file, so they're
+           treated as invalid as well */
+        const MaterialAttributeType type = attributes[i].type();
+        if(type == MaterialAttributeType{} || UnsignedByte(type) > UnsignedByte(MaterialAttributeType::TextureSwizzle) || type == MaterialAttributeType::Pointer || type == MaterialAttributeType::MutablePointer) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "has an invalid type" << type;
+            return false;
+        }
+
+        /* The name is right after the type and has to be non-empty and
+           null-terminated, the value is at the end. Same size checks as in
+           the MaterialAttributeData constructors. */
+        const char* const data = reinterpret_cast<const char*>(attributes + i);
+        const char* const nameEnd = static_cast<const char*>(std::memchr(data + 1, '\0', Implementation::MaterialAttributeDataSize - 1));
+        if(!nameEnd || nameEnd == data + 1) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "has an invalid name";
+            return false;
+        }
+        const std::size_t nameSize = nameEnd - data - 1;
+        std::size_t size;
+        if(type == MaterialAttributeType::String)
+            /* String values are null-terminated, with the size in the last
+               byte */
+            size = data[Implementation::MaterialAttributeDataSize - 2] ? Implementation::MaterialAttributeDataSize : UnsignedByte(data[Implementation::MaterialAttributeDataSize - 1]) + 4;
+        else if(type == MaterialAttributeType::Buffer)
+            size = UnsignedByte(nameEnd[1]) + 3;
+        else
+            size = materialAttributeTypeSize(type) + 2;
+        if(nameSize + size > Implementation::MaterialAttributeDataSize) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "attribute" << i << "has an invalid value size";
+            return false;
+        }
+    }
+
+    /* Layer offsets have to be monotonic and in bounds, with attributes in
+       each layer sorted and unique so they can be referenced directly */
+    const UnsignedInt implicitLayerData[]{material.attributeCount};
+    const Containers::ArrayView<const UnsignedInt> layerOffsets = material.layerCount ?
+        Containers::ArrayView<const UnsignedInt>{reinterpret_cast<const UnsignedInt*>(chunk.data + material.layerDataOffset), material.layerCount} :
+        Containers::arrayView(implicitLayerData);
+    UnsignedInt begin = 0;
+    for(UnsignedInt i = 0; i != layerOffsets.size(); ++i) {
+        const UnsignedInt end = layerOffsets[i];
+        if(end < begin || end > attributes.size()) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "layer" << i << "has an invalid range" << begin << Debug::nospace << ":" << Debug::nospace << end << "for" << attributes.size() << "attributes";
+            return false;
+        }
+
+        for(UnsignedInt j = begin + 1; j < end; ++j) {
+            const Containers::StringView previous = attributes[j - 1].name();
+            const Containers::StringView current = attributes[j].name();
+            if(previous == current) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "layer" << i << "has a duplicate attribute" << current;
+                return false;
+            }
+            if(current < previous) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "layer" << i << "attribute" << current << "has to be sorted before" << previous;
+                return false;
+            }
+        }
+
+        begin = end;
+    }
+    if(layerOffsets.back() != attributes.size()) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "last layer offset" << layerOffsets.back() << "too short for" << attributes.size() << "attributes";
+        return false;
+    }
+
+    return true;
+}
+
+bool checkImage(const UnsignedInt id, const Chunk& chunk, const UnsignedInt dimensions) {
+    const BlobImage& image = chunkHeader<BlobImage>(chunk);
+    if(image.compressed > 1) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid compressed flag" << UnsignedInt(image.compressed);
+        return false;
+    }
+
+    /* Sizes in the dimensions the image doesn't have are treated as 1, same
+       as ImageData does */
+    Vector3i size{1};
+    for(UnsignedInt i = 0; i != dimensions; ++i)
+        size[i] = image.size[i];
+
+    /* The image size and storage parameters are Ints and PixelStorage and
+       ImageData calculate with them directly, so limit them to a range where
+       that can't overflow */
+    const Vector3i skip = Vector3i::from(image.storageSkip);
+    if((size < Vector3i{0}).any() || (size >= Vector3i{1 << 30}).any() ||
+       (skip < Vector3i{0}).any() || (skip >= Vector3i{1 << 30}).any() ||
+       image.storageRowLength < 0 || image.storageRowLength >= (1 << 30) ||
+       image.storageImageHeight < 0 || image.storageImageHeight >= (1 << 30) ||
+       Double(size.x())*size.y()*size.z() >= Double(1u << 31) ||
+       (Double(Math::max(size.x(), image.storageRowLength)) + skip.x() + 1)*
+       (Double(Math::max(size.y(), image.storageImageHeight)) + skip.y() + 1)*
+       (Double(size.z()) + skip.z() + 1)*(Double(image.pixelSize) + 8) >= Double(1ull << 48))
+    {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "size or storage parameters out of range";
+        return false;
+    }
+
+    const UnsignedShort allowedFlags = dimensions == 3 ? UnsignedShort(ImageFlag3D::Array|ImageFlag3D::CubeMap) : dimensions == 2 ? UnsignedShort(ImageFlag2D::Array) : 0;
+    if(image.flags & ~allowedFlags) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has invalid flags" << Debug::hex << UnsignedInt(image.flags);
+        return false;
+    }
+    if(image.flags & UnsignedShort(ImageFlag3D::CubeMap) && (size.x() != size.y() || (image.flags & UnsignedShort(ImageFlag3D::Array) ? size.z() % 6 : size.z() != 6))) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid cube map size" << Debug::packed << size;
+        return false;
+    }
+
+    std::pair<Math::Vector3<std::size_t>, Math::Vector3<std::size_t>> dataProperties;
+    std::size_t dataSize;
+    if(image.compressed) {
+        if(!isCompressedPixelFormatImplementationSpecific(CompressedPixelFormat(image.format)) && (!image.format || image.format > UnsignedInt(CompressedPixelFormat::PvrtcRGBA4bppSrgb))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid format" << image.format;
+            return false;
+        }
+        const Vector3i blockSize = Vector3i::from(image.blockSize);
+        if((blockSize <= Vector3i{0}).any() || (blockSize >= Vector3i{256}).any() || !image.pixelSize || image.pixelSize >= 256) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid block size" << Debug::packed << blockSize << "or block data size" << image.pixelSize;
+            return false;
+        }
+
+        CompressedPixelStorage storage;
+        storage.setRowLength(image.storageRowLength)
+            .setImageHeight(image.storageImageHeight)
+            .setSkip(skip)
+            .setCompressedBlockSize(blockSize)
+            .setCompressedBlockDataSize(image.pixelSize);
+        dataProperties = storage.dataProperties(size);
+        dataSize = dataProperties.second.product()*image.pixelSize;
+    } else {
+        if(!isPixelFormatImplementationSpecific(PixelFormat(image.format)) && (!image.format || image.format > UnsignedInt(PixelFormat::Depth32FStencil8UI))) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid format" << image.format;
+            return false;
+        }
+        if(!image.pixelSize || image.pixelSize >= 256) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid pixel size" << image.pixelSize;
+            return false;
+        }
+        if(image.storageAlignment != 1 && image.storageAlignment != 2 && image.storageAlignment != 4 && image.storageAlignment != 8) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "has an invalid row alignment" << image.storageAlignment;
+            return false;
+        }
+
+        PixelStorage storage;
+        storage.setAlignment(image.storageAlignment)
+            .setRowLength(image.storageRowLength)
+            .setImageHeight(image.storageImageHeight)
+            .setSkip(skip);
+        dataProperties = storage.dataProperties(image.pixelSize, size);
+        dataSize = dataProperties.second.product();
+    }
+
+    /* The smallest data size that covers the image, including the skip, same
+       as ImageData calculates */
+    if(dataProperties.first.z())
+        dataSize += dataProperties.first.z();
+    else if(dataProperties.first.y()) {
+        if(!image.storageImageHeight)
+            dataSize += dataProperties.first.y();
+    } else if(dataProperties.first.x()) {
+        if(!image.storageRowLength)
+            dataSize += dataProperties.first.x();
+    }
+    if(dataSize > image.dataSize) {
+        Error{} << "Trade::MagnumImporter::openData(): chunk" << id << "data too small, expected at least" << dataSize << "bytes but got" << image.dataSize;
+        return false;
+    }
+
+    return true;
+}
+
+}
+
+struct MagnumImporter::State {
+    /* If the file is memory-mapped, this is a non-owning view on
+       mappedFileData */
+    Containers::Array<char> data;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mappedFileData;
+    #endif
+    /* If the data are externally owned, imported data reference them
+       directly, otherwise they're copied */
+    bool externallyOwned;
+    Int defaultScene;
+    Containers::Array<Chunk> scenes;
+    Containers::Array<Chunk> animations;
+    Containers::Array<Chunk> meshes;
+    Containers::Array<Chunk> materials;
+    Containers::Array<Chunk> images1D;
+    Containers::Array<Chunk> images2D;
+    Containers::Array<Chunk> images3D;
+};
+
+MagnumImporter::MagnumImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
+
+MagnumImporter::~MagnumImporter() = default;
+
+ImporterFeatures MagnumImporter::doFeatures() const { return ImporterFeature::OpenData; }
+
+bool MagnumImporter::doIsOpened() const { return !!_state; }
+
+void MagnumImporter::doClose() { _state = nullptr; }
+
+void MagnumImporter::doOpenFile(const Containers::StringView filename) {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename);
+    if(!mapped) {
+        Error{} << "Trade::MagnumImporter::openFile(): cannot map file" << filename;
+        return;
+    }
+
+    /* Pass a non-owning view to doOpenData(), which references it directly
+       as it's marked as externally owned, and then keep the mapping alive for
+       as long as the file is open */
+    doOpenData(Containers::Array<char>{const_cast<char*>(mapped->data()), mapped->size(), Implementation::nonOwnedArrayDeleter}, DataFlag::ExternallyOwned);
+    if(_state) _state->mappedFileData = Utility::move(mapped);
+    #else
+    AbstractImporter::doOpenFile(filename);
+    #endif
+}
+
+void MagnumImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
+    if(data.size() < sizeof(BlobHeader)) {
+        Error{} << "Trade::MagnumImporter::openData(): file too short, expected at least" << sizeof(BlobHeader) << "bytes but got" << data.size();
+        return;
+    }
+
+    Containers::Pointer<State> state{InPlaceInit};
+
+    /* Take over the existing array or copy the data if we can't. Copy also if
+       the memory isn't suitably aligned, in which case the data can't be
+       referenced directly. */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned) && reinterpret_cast<std::uintptr_t>(data.data()) % BlobAlignment == 0) {
+        state->externallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
+        state->data = Utility::move(data);
+    } else {
+        state->externallyOwned = false;
+        state->data = Containers::Array<char>{InPlaceInit, data};
+    }
+
+    const BlobHeader& header = *reinterpret_cast<const BlobHeader*>(state->data.data());
+    if(std::memcmp(header.magic, "MGNB", 4) != 0) {
+        Error{} << "Trade::MagnumImporter::openData(): invalid file signature" << Containers::StringView{header.magic, 4};
+        return;
+    }
+    if(header.byteOrderMark != BlobByteOrderMark) {
+        if(header.byteOrderMark == 0xfffe)
+            Error{} << "Trade::MagnumImporter::openData(): file endianness doesn't match the platform";
+        else
+            Error{} << "Trade::MagnumImporter::openData(): invalid byte order mark" << Debug::hex << header.byteOrderMark;
+        return;
+    }
+    if(header.version != BlobVersion) {
+        Error{} << "Trade::MagnumImporter::openData(): unsupported file version" << header.version << Debug::nospace << ", expected" << BlobVersion;
+        return;
+    }
+    if(header.size != state->data.size()) {
+        Error{} << "Trade::MagnumImporter::openData(): file size mismatch, expected" << header.size << "bytes but got" << state->data.size();
+        return;
+    }
+    state->defaultScene = header.defaultScene;
+
+    /* Verify that all chunks, their headers, entries, names and data blocks
+       are in bounds so the import functions can access everything without
+       further checks */
+    std::size_t offset = sizeof(BlobHeader);
+    for(UnsignedInt i = 0; i != header.chunkCount; ++i) {
+        if(state->data.size() - offset < sizeof(BlobChunkHeader)) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << i << "at offset" << offset << "out of range for" << state->data.size() << "bytes";
+            return;
+        }
+
+        const char* const chunk = state->data.data() + offset;
+        const BlobChunkHeader& chunkHeader = *reinterpret_cast<const BlobChunkHeader*>(chunk);
+        if(chunkHeader.size < sizeof(BlobChunkHeader) || chunkHeader.size % BlobAlignment || chunkHeader.size > state->data.size() - offset) {
+            Error{} << "Trade::MagnumImporter::openData(): invalid chunk" << i << "size" << chunkHeader.size << "at offset" << offset << "for" << state->data.size() << "bytes";
+            return;
+        }
+
+        std::size_t headerSize;
+        std::size_t entrySize = 0;
+        Containers::Array<Chunk>* chunks;
+        switch(BlobChunkType(chunkHeader.type)) {
+            case BlobChunkType::Scene:
+                headerSize = sizeof(BlobScene);
+                entrySize = sizeof(BlobSceneField);
+                chunks = &state->scenes;
+                break;
+            case BlobChunkType::Animation:
+                headerSize = sizeof(BlobAnimation);
+                entrySize = sizeof(BlobAnimationTrack);
+                chunks = &state->animations;
+                break;
+            case BlobChunkType::Mesh:
+                headerSize = sizeof(BlobMesh);
+                entrySize = sizeof(BlobMeshAttribute);
+                chunks = &state->meshes;
+                break;
+            case BlobChunkType::Material:
+                headerSize = sizeof(BlobMaterial);
+                chunks = &state->materials;
+                break;
+            case BlobChunkType::Image1D:
+                headerSize = sizeof(BlobImage);
+                chunks = &state->images1D;
+                break;
+            case BlobChunkType::Image2D:
+                headerSize = sizeof(BlobImage);
+                chunks = &state->images2D;
+                break;
+            case BlobChunkType::Image3D:
+                headerSize = sizeof(BlobImage);
+                chunks = &state->images3D;
+                break;
+            default:
+                Error{} << "Trade::MagnumImporter::openData(): unknown chunk" << i << "type" << chunkHeader.type;
+                return;
+        }
+
+        if(chunkHeader.size < sizeof(BlobChunkHeader) + headerSize) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << i << "too short, expected at least" << sizeof(BlobChunkHeader) + headerSize << "bytes but got" << chunkHeader.size;
+            return;
+        }
+
+        /* Gather the entry count and data ranges from the type-specific
+           header */
+        const char* const typeHeader = chunk + sizeof(BlobChunkHeader);
+        UnsignedLong entryCount = 0;
+        Containers::Pair<UnsignedLong, UnsignedLong> ranges[2]{};
+        switch(BlobChunkType(chunkHeader.type)) {
+            case BlobChunkType::Scene: {
+                const BlobScene& scene = *reinterpret_cast<const BlobScene*>(typeHeader);
+                entryCount = scene.fieldCount;
+                ranges[0] = {scene.dataOffset, scene.dataSize};
+            } break;
+            case BlobChunkType::Animation: {
+                const BlobAnimation& animation = *reinterpret_cast<const BlobAnimation*>(typeHeader);
+                entryCount = animation.trackCount;
+                ranges[0] = {animation.dataOffset, animation.dataSize};
+            } break;
+            case BlobChunkType::Mesh: {
+                const BlobMesh& mesh = *reinterpret_cast<const BlobMesh*>(typeHeader);
+                entryCount = mesh.attributeCount;
+                ranges[0] = {mesh.indexDataOffset, mesh.indexDataSize};
+                ranges[1] = {mesh.vertexDataOffset, mesh.vertexDataSize};
+            } break;
+            case BlobChunkType::Material: {
+                const BlobMaterial& material = *reinterpret_cast<const BlobMaterial*>(typeHeader);
+                ranges[0] = {material.attributeDataOffset, UnsignedLong(material.attributeCount)*sizeof(MaterialAttributeData)};
+                ranges[1] = {material.layerDataOffset, UnsignedLong(material.layerCount)*sizeof(UnsignedInt)};
+            } break;
+            case BlobChunkType::Image1D:
+            case BlobChunkType::Image2D:
+            case BlobChunkType::Image3D: {
+                const BlobImage& image = *reinterpret_cast<const BlobImage*>(typeHeader);
+                ranges[0] = {image.dataOffset, image.dataSize};
+            } break;
+        }
+
+        const UnsignedLong nameOffset = sizeof(BlobChunkHeader) + headerSize + entryCount*entrySize;
+        if(nameOffset + chunkHeader.nameSize > chunkHeader.size) {
+            Error{} << "Trade::MagnumImporter::openData(): chunk" << i << "header, entries and name out of range for" << chunkHeader.size << "bytes";
+            return;
+        }
+        for(const Containers::Pair<UnsignedLong, UnsignedLong>& range: ranges) {
+            if(range.first() % BlobAlignment || range.first() > chunkHeader.size || range.second() > chunkHeader.size - range.first()) {
+                Error{} << "Trade::MagnumImporter::openData(): chunk" << i << "data range" << range.first() << Debug::nospace << ":" << Debug::nospace << range.first() + range.second() << "misaligned or out of range for" << chunkHeader.size << "bytes";
+                return;
+            }
+        }
+
+        /* With all ranges in bounds, check the item metadata as well so the
+           import functions don't trigger assertions on malformed input */
+        const Chunk entry{chunk, Containers::StringView{chunk + nameOffset, chunkHeader.nameSize}};
+        bool valid = false;
+        switch(BlobChunkType(chunkHeader.type)) {
+            case BlobChunkType::Scene:
+                valid = checkScene(i, entry);
+                break;
+            case BlobChunkType::Animation:
+                valid = checkAnimation(i, entry);
+                break;
+            case BlobChunkType::Mesh:
+                valid = checkMesh(i, entry);
+                break;
+            case BlobChunkType::Material:
+                valid = checkMaterial(i, entry);
+                break;
+            case BlobChunkType::Image1D:
+                valid = checkImage(i, entry, 1);
+                break;
+            case BlobChunkType::Image2D:
+                valid = checkImage(i, entry, 2);
+                break;
+            case BlobChunkType::Image3D:
+                valid = checkImage(i, entry, 3);
+                break;
+        }
+        if(!valid) return;
+
+        arrayAppend(*chunks, entry);
+        offset += chunkHeader.size;
+    }
+
+    if(state->defaultScene != -1 && (state->defaultScene < 0 || UnsignedInt(state->defaultScene) >= state->scenes.size())) {
+        Error{} << "Trade::MagnumImporter::openData(): default scene" << state->defaultScene << "out of range for" << state->scenes.size() << "scenes";
+        return;
+    }
+
+    /* Everything passed, commit the state */
+    _state = Utility::move(state);
+}
+
+Int MagnumImporter::doDefaultScene() const { return _state->defaultScene; }
+
+UnsignedInt MagnumImporter::doSceneCount() const { return _state->scenes.size(); }
+
+Int MagnumImporter::doSceneForName(const Containers::StringView name) {
+    return chunkForName(_state->scenes, name);
+}
+
+Containers::String MagnumImporter::doSceneName(const UnsignedInt id) {
+    return _state->scenes[id].name;
+}
+
+Containers::Optional<SceneData> MagnumImporter::doScene(const UnsignedInt id) {
+    const Chunk& chunk = _state->scenes[id];
+    const BlobScene& header = chunkHeader<BlobScene>(chunk);
+    const Containers::ArrayView<const BlobSceneField> blobFields = chunkEntries<BlobSceneField, BlobScene>(chunk, header.fieldCount);
+    const Containers::ArrayView<const char> data = chunkData(chunk, header.dataOffset, header.dataSize);
+    const SceneMappingType mappingType = SceneMappingType(header.mappingType);
+
+    Containers::Array<SceneFieldData> fields{ValueInit, header.fieldCount};
+    for(std::size_t i = 0; i != fields.size(); ++i) {
+        const BlobSceneField& field = blobFields[i];
+        const SceneField name = SceneField(field.name);
+        const SceneFieldType fieldType = SceneFieldType(field.fieldType);
+        const SceneFieldFlags flags = SceneFieldFlag(field.flags);
+        if(fieldType == SceneFieldType::Bit)
+            fields[i] = SceneFieldData{name, std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), field.mappingStride, std::size_t(field.fieldOffset), field.fieldBitOffset, field.fieldStride, field.arraySize, flags};
+        else if(Implementation::isSceneFieldTypeString(fieldType))
+            fields[i] = SceneFieldData{name, std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), field.mappingStride, std::size_t(field.stringOffset), fieldType, std::size_t(field.fieldOffset), field.fieldStride, flags};
+        else
+            fields[i] = SceneFieldData{name, std::size_t(field.size), mappingType, std::size_t(field.mappingOffset), field.mappingStride, fieldType, std::size_t(field.fieldOffset), field.fieldStride, field.arraySize, flags};
+    }
+
+    if(_state->externallyOwned)
+        return SceneData{mappingType, header.mappingBound, DataFlag::ExternallyOwned, data, Utility::move(fields)};
+    return SceneData{mappingType, header.mappingBound, Containers::Array<char>{InPlaceInit, data}, Utility::move(fields)};
+}
+
+UnsignedInt MagnumImporter::doAnimationCount() const { return _state->animations.size(); }
+
+Int MagnumImporter::doAnimationForName(const Containers::StringView name) {
+    return chunkForName(_state->animations, name);
+}
+
+Containers::String MagnumImporter::doAnimationName(const UnsignedInt id) {
+    return _state->animations[id].name;
+}
+
+Containers::Optional<AnimationData> MagnumImporter::doAnimation(const UnsignedInt id) {
+    const Chunk& chunk = _state->animations[id];
+    const BlobAnimation& header = chunkHeader<BlobAnimation>(chunk);
+    const Containers::ArrayView<const BlobAnimationTrack> blobTracks = chunkEntries<BlobAnimationTrack, BlobAnimation>(chunk, header.trackCount);
+
+    /* The tracks reference the data directly, so if copying, they have to
+       point to the copy */
+    Containers::Array<char> dataCopy;
+    Containers::ArrayView<const char> data = chunkData(chunk, header.dataOffset, header.dataSize);
+    if(!_state->externallyOwned) {
+        dataCopy = Containers::Array<char>{InPlaceInit, data};
+        data = dataCopy;
+    }
+
+    Containers::Array<AnimationTrackData> tracks{ValueInit, header.trackCount};
+    for(std::size_t i = 0; i != tracks.size(); ++i) {
+        const BlobAnimationTrack& track = blobTracks[i];
+        const Containers::StridedArrayView1D<const Float> keys{data, reinterpret_cast<const Float*>(data.data() + track.keysOffset), track.size, track.keysStride};
+        const Containers::StridedArrayView1D<const void> values{data, data.data() + track.valuesOffset, track.size, track.valuesStride};
+        tracks[i] = AnimationTrackData{AnimationTrackTarget(track.targetName), track.target, AnimationTrackType(track.type), AnimationTrackType(track.resultType), keys, values, Animation::Interpolation(track.interpolation), Animation::Extrapolation(track.before), Animation::Extrapolation(track.after)};
+    }
+
+    const Range1D duration{header.duration[0], header.duration[1]};
+    if(_state->externallyOwned)
+        return AnimationData{DataFlag::ExternallyOwned, data, Utility::move(tracks), duration};
+    return AnimationData{Utility::move(dataCopy), Utility::move(tracks), duration};
+}
+
+UnsignedInt MagnumImporter::doMeshCount() const { return _state->meshes.size(); }
+
+Int MagnumImporter::doMeshForName(const Containers::StringView name) {
+    return chunkForName(_state->meshes, name);
+}
+
+Containers::String MagnumImporter::doMeshName(const UnsignedInt id) {
+    return _state->meshes[id].name;
+}
+
+Containers::Optional<MeshData> MagnumImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    const Chunk& chunk = _state->meshes[id];
+    const BlobMesh& header = chunkHeader<BlobMesh>(chunk);
+    const Containers::ArrayView<const BlobMeshAttribute> blobAttributes = chunkEntries<BlobMeshAttribute, BlobMesh>(chunk, header.attributeCount);
+    const Containers::ArrayView<const char> indexData = chunkData(chunk, header.indexDataOffset, header.indexDataSize);
+    const Containers::ArrayView<const char> vertexData = chunkData(chunk, header.vertexDataOffset, header.vertexDataSize);
+
+    /* The attributes are offset-only, so they work the same for both the
+       original and copied vertex data */
+    Containers::Array<MeshAttributeData> attributes{ValueInit, header.attributeCount};
+    for(std::size_t i = 0; i != attributes.size(); ++i) {
+        const BlobMeshAttribute& attribute = blobAttributes[i];
+        attributes[i] = MeshAttributeData{MeshAttribute(attribute.name), VertexFormat(attribute.format), std::size_t(attribute.offset), header.vertexCount, attribute.stride, attribute.arraySize, attribute.morphTargetId};
+    }
+
+    /* The index view is not offset-only, so it has to point to the actual
+       data the mesh ends up with */
+    const auto indicesFor = [&header](const Containers::ArrayView<const char> indexData) {
+        if(!header.indexType) return MeshIndexData{};
+        return MeshIndexData{MeshIndexType(header.indexType), Containers::StridedArrayView1D<const void>{indexData, indexData.data() + header.indexOffset, header.indexCount, header.indexStride}};
+    };
+
+    if(_state->externallyOwned)
+        return MeshData{MeshPrimitive(header.primitive),
+            DataFlag::ExternallyOwned, indexData, indicesFor(indexData),
+            DataFlag::ExternallyOwned, vertexData, Utility::move(attributes),
+            header.vertexCount};
+
+    Containers::Array<char> indexDataCopy{InPlaceInit, indexData};
+    const MeshIndexData indices = indicesFor(indexDataCopy);
+    return MeshData{MeshPrimitive(header.primitive),
+        Utility::move(indexDataCopy), indices,
+        Containers::Array<char>{InPlaceInit, vertexData},
+        Utility::move(attributes), header.vertexCount};
+}
+
+UnsignedInt MagnumImporter::doMaterialCount() const { return _state->materials.size(); }
+
+Int MagnumImporter::doMaterialForName(const Containers::StringView name) {
+    return chunkForName(_state->materials, name);
+}
+
+Containers::String MagnumImporter::doMaterialName(const UnsignedInt id) {
+    return _state->materials[id].name;
+}
+
+Containers::Optional<MaterialData> MagnumImporter::doMaterial(const UnsignedInt id) {
+    const Chunk& chunk = _state->materials[id];
+    const BlobMaterial& header = chunkHeader<BlobMaterial>(chunk);
+    const Containers::ArrayView<const MaterialAttributeData> attributeData{reinterpret_cast<const MaterialAttributeData*>(chunk.data + header.attributeDataOffset), header.attributeCount};
+    const Containers::ArrayView<const UnsignedInt> layerData{reinterpret_cast<const UnsignedInt*>(chunk.data + header.layerDataOffset), header.layerCount};
+    const MaterialTypes types = MaterialType(header.types);
+
+    if(_state->externallyOwned)
+        return MaterialData{types,
+            DataFlag::ExternallyOwned, attributeData,
+            DataFlag::ExternallyOwned, layerData};
+    return MaterialData{types,
+        Containers::Array<MaterialAttributeData>{InPlaceInit, attributeData},
+        Containers::Array<UnsignedInt>{InPlaceInit, layerData}};
+}
+
+namespace {
+
+template<UnsignedInt dimensions> ImageData<dimensions> importImage(const Chunk& chunk, const bool externallyOwned) {
+    const BlobImage& header = chunkHeader<BlobImage>(chunk);
+    const Containers::ArrayView<const char> data = chunkData(chunk, header.dataOffset, header.dataSize);
+    const Math::Vector<dimensions, Int> size = Math::Vector<dimensions, Int>::pad(Vector3i::from(header.size));
+    const ImageFlags<dimensions> flags = ImageFlag<dimensions>(header.flags);
+
+    if(header.compressed) {
+        CompressedPixelStorage storage;
+        storage.setRowLength(header.storageRowLength)
+            .setImageHeight(header.storageImageHeight)
+            .setSkip(Vector3i::from(header.storageSkip));
+        if(externallyOwned)
+            return ImageData<dimensions>{storage, CompressedPixelFormat(header.format), Vector3i::from(header.blockSize), header.pixelSize, size, DataFlag::ExternallyOwned, data, flags};
+        return ImageData<dimensions>{storage, CompressedPixelFormat(header.format), Vector3i::from(header.blockSize), header.pixelSize, size, Containers::Array<char>{InPlaceInit, data}, flags};
+    }
+
+    PixelStorage storage;
+    storage.setAlignment(header.storageAlignment)
+        .setRowLength(header.storageRowLength)
+        .setImageHeight(header.storageImageHeight)
+        .setSkip(Vector3i::from(header.storageSkip));
+    if(externallyOwned)
+        return ImageData<dimensions>{storage, PixelFormat(header.format), header.formatExtra, header.pixelSize, size, DataFlag::ExternallyOwned, data, flags};
+    return ImageData<dimensions>{storage, PixelFormat(header.format), header.formatExtra, header.pixelSize, size, Containers::Array<char>{InPlaceInit, data}, flags};
+}
+
+}
+
+UnsignedInt MagnumImporter::doImage1DCount() const { return _state->images1D.size(); }
+
+Int MagnumImporter::doImage1DForName(const Containers::StringView name) {
+    return chunkForName(_state->images1D, name);
+}
+
+Containers::String MagnumImporter::doImage1DName(const UnsignedInt id) {
+    return _state->images1D[id].name;
+}
+
+Containers::Optional<ImageData1D> MagnumImporter::doImage1D(const UnsignedInt id, UnsignedInt) {
+    return importImage<1>(_state->images1D[id], _state->externallyOwned);
+}
+
+UnsignedInt MagnumImporter::doImage2DCount() const { return _state->images2D.size(); }
+
+Int MagnumImporter::doImage2DForName(const Containers::StringView name) {
+    return chunkForName(_state->images2D, name);
+}
+
+Containers::String MagnumImporter::doImage2DName(const UnsignedInt id) {
+    return _state->images2D[id].name;
+}
+
+Containers::Optional<ImageData2D> MagnumImporter::doImage2D(const UnsignedInt id, UnsignedInt) {
+    return importImage<2>(_state->images2D[id], _state->externallyOwned);
+}
+
+UnsignedInt MagnumImporter::doImage3DCount() const { return _state->images3D.size(); }
+
+Int MagnumImporter::doImage3DForName(const Containers::StringView name) {
+    return chunkForName(_state->images3D, name);
+}
+
+Containers::String MagnumImporter::doImage3DName(const UnsignedInt id) {
+    return _state->images3D[id].name;
+}
+
+Containers::Optional<ImageData3D> MagnumImporter::doImage3D(const UnsignedInt id, UnsignedInt) {
+    return importImage<3>(_state->images3D[id], _state->externallyOwned);
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MagnumImporter, Magnum::Trade::MagnumImporter,
+    MAGNUM_TRADE_ABSTRACTIMPORTER_PLUGIN_INTERFACE)
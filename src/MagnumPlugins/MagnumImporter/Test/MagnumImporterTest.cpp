@@ -0,0 +1,976 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <cstddef>
+#include <cstring>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/TestSuite/Compare/String.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+#include <Corrade/Utility/Format.h>
+#include <Corrade/Utility/Path.h>
+
+#include "Magnum/ImageFlags.h"
+#include "Magnum/Mesh.h"
+#include "Magnum/PixelFormat.h"
+#include "Magnum/VertexFormat.h"
+#include "Magnum/Animation/Interpolation.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Math/Vector2.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MagnumImporter/BlobFormat.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+using namespace Implementation;
+
+struct MagnumImporterTest: TestSuite::Tester {
+    explicit MagnumImporterTest();
+
+    void invalid();
+    void invalidScene();
+    void invalidAnimation();
+    void invalidMesh();
+    void invalidMaterial();
+
+    void scene();
+    void animation();
+    void mesh();
+    void material();
+    void image();
+    void imageMisalignedMemory();
+    void fileNotFound();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+};
+
+/* A minimal file with a single 2x1 RGBA8 image. All types have sizes that are
+   multiples of 8, so there's no padding between the members. */
+struct File {
+    BlobHeader header;
+    BlobChunkHeader chunkHeader;
+    BlobImage image;
+    char name[8];
+    char data[8];
+};
+
+static_assert(sizeof(File) == 136, "unexpected padding");
+
+File validFile() {
+    File file{};
+    std::memcpy(file.header.magic, "MGNB", 4);
+    file.header.byteOrderMark = BlobByteOrderMark;
+    file.header.version = BlobVersion;
+    file.header.defaultScene = -1;
+    file.header.chunkCount = 1;
+    file.header.size = sizeof(File);
+
+    file.chunkHeader.type = UnsignedInt(BlobChunkType::Image2D);
+    file.chunkHeader.nameSize = 5;
+    file.chunkHeader.size = sizeof(File) - sizeof(BlobHeader);
+
+    file.image.dataOffset = offsetof(File, data) - offsetof(File, chunkHeader);
+    file.image.dataSize = 8;
+    file.image.size[0] = 2;
+    file.image.size[1] = 1;
+    file.image.size[2] = 1;
+    file.image.format = UnsignedInt(PixelFormat::RGBA8Unorm);
+    file.image.pixelSize = 4;
+    file.image.storageAlignment = 4;
+
+    std::memcpy(file.name, "image", 5);
+    const char data[]{'\x11', '\x22', '\x33', '\x44', '\x55', '\x66', '\x77', '\x88'};
+    std::memcpy(file.data, data, 8);
+    return file;
+}
+
+const struct {
+    const char* name;
+    std::size_t size;
+    void(*modify)(File&);
+    const char* message;
+} InvalidData[]{
+    {"too short", sizeof(BlobHeader) - 1, [](File&) {},
+        "file too short, expected at least 24 bytes but got 23"},
+    {"invalid signature", sizeof(File), [](File& file) {
+            file.header.magic[3] = 'X';
+        }, "invalid file signature MGNX"},
+    {"different endianness", sizeof(File), [](File& file) {
+            file.header.byteOrderMark = 0xfffe;
+        }, "file endianness doesn't match the platform"},
+    {"invalid byte order mark", sizeof(File), [](File& file) {
+            file.header.byteOrderMark = 0x1234;
+        }, "invalid byte order mark 0x1234"},
+    {"unsupported version", sizeof(File), [](File& file) {
+            file.header.version = 2;
+        }, "unsupported file version 2, expected 1"},
+    {"size mismatch", sizeof(File), [](File& file) {
+            file.header.size = 144;
+        }, "file size mismatch, expected 144 bytes but got 136"},
+    {"chunk out of range", sizeof(File), [](File& file) {
+            file.header.chunkCount = 2;
+        }, "chunk 1 at offset 136 out of range for 136 bytes"},
+    {"chunk size too small", sizeof(File), [](File& file) {
+            file.chunkHeader.size = 12;
+        }, "invalid chunk 0 size 12 at offset 24 for 136 bytes"},
+    {"chunk size misaligned", sizeof(File), [](File& file) {
+            file.chunkHeader.size = 100;
+        }, "invalid chunk 0 size 100 at offset 24 for 136 bytes"},
+    {"chunk size too large", sizeof(File), [](File& file) {
+            file.chunkHeader.size = 120;
+        }, "invalid chunk 0 size 120 at offset 24 for 136 bytes"},
+    {"unknown chunk type", sizeof(File), [](File& file) {
+            file.chunkHeader.type = 0xdead;
+        }, "unknown chunk 0 type 57005"},
+    {"chunk too short", sizeof(BlobHeader) + sizeof(BlobChunkHeader), [](File& file) {
+            file.header.size = sizeof(BlobHeader) + sizeof(BlobChunkHeader);
+            file.chunkHeader.size = sizeof(BlobChunkHeader);
+        }, "chunk 0 too short, expected at least 96 bytes but got 16"},
+    {"name out of range", sizeof(File), [](File& file) {
+            file.chunkHeader.nameSize = 17;
+        }, "chunk 0 header, entries and name out of range for 112 bytes"},
+    {"data misaligned", sizeof(File), [](File& file) {
+            file.image.dataOffset -= 4;
+        }, "chunk 0 data range 100:108 misaligned or out of range for 112 bytes"},
+    {"data out of range", sizeof(File), [](File& file) {
+            file.image.dataSize = 16;
+        }, "chunk 0 data range 104:120 misaligned or out of range for 112 bytes"},
+    {"invalid image compressed flag", sizeof(File), [](File& file) {
+            file.image.compressed = 2;
+        }, "chunk 0 has an invalid compressed flag 2"},
+    {"negative image size", sizeof(File), [](File& file) {
+            file.image.size[0] = -1;
+        }, "chunk 0 size or storage parameters out of range"},
+    {"image size too large", sizeof(File), [](File& file) {
+            file.image.size[0] = 65536;
+            file.image.size[1] = 65536;
+        }, "chunk 0 size or storage parameters out of range"},
+    {"image skip too large", sizeof(File), [](File& file) {
+            file.image.storageSkip[1] = 1 << 30;
+        }, "chunk 0 size or storage parameters out of range"},
+    {"invalid image flags", sizeof(File), [](File& file) {
+            file.image.flags = UnsignedShort(ImageFlag3D::CubeMap);
+        }, "chunk 0 has invalid flags 0x2"},
+    {"invalid cube map size", sizeof(File), [](File& file) {
+            file.chunkHeader.type = UnsignedInt(BlobChunkType::Image3D);
+            file.image.flags = UnsignedShort(ImageFlag3D::CubeMap);
+        }, "chunk 0 has an invalid cube map size {2, 1, 1}"},
+    {"invalid pixel format", sizeof(File), [](File& file) {
+            file.image.format = 0xffff;
+        }, "chunk 0 has an invalid format 65535"},
+    {"invalid pixel size", sizeof(File), [](File& file) {
+            file.image.pixelSize = 0;
+        }, "chunk 0 has an invalid pixel size 0"},
+    {"invalid row alignment", sizeof(File), [](File& file) {
+            file.image.storageAlignment = 3;
+        }, "chunk 0 has an invalid row alignment 3"},
+    {"image data too small", sizeof(File), [](File& file) {
+            file.image.size[0] = 3;
+        }, "chunk 0 data too small, expected at least 12 bytes but got 8"},
+    {"image data too small with skip", sizeof(File), [](File& file) {
+            file.image.storageSkip[0] = 1;
+        }, "chunk 0 data too small, expected at least 12 bytes but got 8"},
+    {"invalid compressed format", sizeof(File), [](File& file) {
+            file.image.compressed = 1;
+            file.image.format = 0xffff;
+        }, "chunk 0 has an invalid format 65535"},
+    {"invalid block size", sizeof(File), [](File& file) {
+            file.image.compressed = 1;
+            file.image.format = UnsignedInt(CompressedPixelFormat::Bc1RGBAUnorm);
+            file.image.blockSize[0] = 4;
+            file.image.blockSize[1] = 4;
+            file.image.pixelSize = 8;
+        }, "chunk 0 has an invalid block size {4, 4, 0} or block data size 8"},
+    {"compressed image data too small", sizeof(File), [](File& file) {
+            file.image.compressed = 1;
+            file.image.format = UnsignedInt(CompressedPixelFormat::Bc3RGBAUnorm);
+            file.image.blockSize[0] = 4;
+            file.image.blockSize[1] = 4;
+            file.image.blockSize[2] = 1;
+            file.image.pixelSize = 16;
+        }, "chunk 0 data too small, expected at least 16 bytes but got 8"},
+    {"default scene out of range", sizeof(File), [](File& file) {
+            file.header.defaultScene = 0;
+        }, "default scene 0 out of range for 0 scenes"},
+    {"negative default scene", sizeof(File), [](File& file) {
+            file.header.defaultScene = -2;
+        }, "default scene -2 out of range for 0 scenes"},
+};
+
+/* A minimal file with a single scene containing a parent and a mesh field
+   that share the object mapping */
+struct SceneFile {
+    BlobHeader header;
+    BlobChunkHeader chunkHeader;
+    BlobScene scene;
+    BlobSceneField fields[2];
+    UnsignedInt mapping[2];
+    Int parents[2];
+    UnsignedInt meshes[2];
+};
+
+static_assert(sizeof(SceneFile) == 208, "unexpected padding");
+
+SceneFile validSceneFile() {
+    SceneFile file{};
+    std::memcpy(file.header.magic, "MGNB", 4);
+    file.header.byteOrderMark = BlobByteOrderMark;
+    file.header.version = BlobVersion;
+    file.header.defaultScene = 0;
+    file.header.chunkCount = 1;
+    file.header.size = sizeof(SceneFile);
+
+    file.chunkHeader.type = UnsignedInt(BlobChunkType::Scene);
+    file.chunkHeader.size = sizeof(SceneFile) - sizeof(BlobHeader);
+
+    file.scene.dataOffset = offsetof(SceneFile, mapping) - offsetof(SceneFile, chunkHeader);
+    file.scene.dataSize = 24;
+    file.scene.mappingBound = 2;
+    file.scene.mappingType = UnsignedInt(SceneMappingType::UnsignedInt);
+    file.scene.fieldCount = 2;
+
+    file.fields[0].size = 2;
+    file.fields[0].mappingStride = 4;
+    file.fields[0].fieldOffset = 8;
+    file.fields[0].fieldStride = 4;
+    file.fields[0].name = UnsignedInt(SceneField::Parent);
+    file.fields[0].fieldType = UnsignedShort(SceneFieldType::Int);
+
+    file.fields[1].size = 2;
+    file.fields[1].mappingStride = 4;
+    file.fields[1].fieldOffset = 16;
+    file.fields[1].fieldStride = 4;
+    file.fields[1].name = UnsignedInt(SceneField::Mesh);
+    file.fields[1].fieldType = UnsignedShort(SceneFieldType::UnsignedInt);
+
+    file.mapping[0] = 0;
+    file.mapping[1] = 1;
+    file.parents[0] = -1;
+    file.parents[1] = 0;
+    file.meshes[0] = 0;
+    file.meshes[1] = 0;
+    return file;
+}
+
+const struct {
+    const char* name;
+    void(*modify)(SceneFile&);
+    const char* message;
+} InvalidSceneData[]{
+    {"invalid mapping type", [](SceneFile& file) {
+            file.scene.mappingType = 5;
+        }, "chunk 0 has an invalid mapping type 5"},
+    {"mapping type too small", [](SceneFile& file) {
+            file.scene.mappingType = UnsignedInt(SceneMappingType::UnsignedByte);
+            file.scene.mappingBound = 256;
+        }, "chunk 0 mapping type Trade::SceneMappingType::UnsignedByte is too small for 256 objects"},
+    {"invalid field name", [](SceneFile& file) {
+            file.fields[1].name = 0;
+        }, "chunk 0 field 1 has an invalid name 0"},
+    {"invalid field type", [](SceneFile& file) {
+            file.fields[1].fieldType = 0;
+        }, "chunk 0 field 1 has an invalid type Trade::SceneFieldType(0x0)"},
+    {"pointer field type", [](SceneFile& file) {
+            file.fields[1].name = UnsignedInt(sceneFieldCustom(1));
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Pointer);
+        }, "chunk 0 field 1 has an invalid type Trade::SceneFieldType::Pointer"},
+    {"field type not valid for field", [](SceneFile& file) {
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Float);
+        }, "chunk 0 field 1 type Trade::SceneFieldType::Float is not valid for Trade::SceneField::Mesh"},
+    {"invalid field flags", [](SceneFile& file) {
+            file.fields[1].flags = UnsignedByte(SceneFieldFlag::OffsetOnly);
+        }, "chunk 0 field 1 has invalid flags 0x1"},
+    {"field flags not allowed for field", [](SceneFile& file) {
+            file.fields[0].flags = UnsignedByte(SceneFieldFlag::MultiEntry);
+        }, "chunk 0 field 0 has invalid flags 0x10"},
+    {"array field", [](SceneFile& file) {
+            file.fields[1].arraySize = 2;
+        }, "chunk 0 field 1 can't be an array field"},
+    {"invalid bit offset", [](SceneFile& file) {
+            file.fields[1].name = UnsignedInt(sceneFieldCustom(1));
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Bit);
+            file.fields[1].fieldBitOffset = 8;
+        }, "chunk 0 field 1 has an invalid bit offset 8"},
+    {"stride too large", [](SceneFile& file) {
+            file.fields[1].fieldStride = 32768;
+        }, "chunk 0 field 1 strides 4 and 32768 don't fit into 16 bits"},
+    {"field size too large", [](SceneFile& file) {
+            file.fields[1].size = 1ull << 61;
+        }, "chunk 0 field 1 size 2305843009213693952 too large"},
+    {"duplicate field", [](SceneFile& file) {
+            file.fields[1].name = UnsignedInt(SceneField::Parent);
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Int);
+        }, "chunk 0 has a duplicate field Trade::SceneField::Parent"},
+    {"duplicate custom field", [](SceneFile& file) {
+            file.fields[0].name = UnsignedInt(sceneFieldCustom(1));
+            file.fields[1].name = UnsignedInt(sceneFieldCustom(1));
+        }, "chunk 0 has a duplicate field Trade::SceneField::Custom(1)"},
+    {"mapping out of range", [](SceneFile& file) {
+            file.fields[1].mappingOffset = 20;
+        }, "chunk 0 field 1 mapping out of range for 24 bytes"},
+    {"mapping out of range with a negative stride", [](SceneFile& file) {
+            file.fields[1].mappingStride = -4;
+        }, "chunk 0 field 1 mapping out of range for 24 bytes"},
+    {"field data out of range", [](SceneFile& file) {
+            file.fields[1].fieldOffset = 20;
+        }, "chunk 0 field 1 data out of range for 24 bytes"},
+    {"bit field data out of range", [](SceneFile& file) {
+            file.fields[1].name = UnsignedInt(sceneFieldCustom(1));
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Bit);
+            file.fields[1].fieldOffset = 23;
+            file.fields[1].fieldBitOffset = 7;
+            file.fields[1].fieldStride = 2;
+        }, "chunk 0 field 1 data out of range for 24 bytes"},
+    {"string data out of range", [](SceneFile& file) {
+            file.fields[1].name = UnsignedInt(sceneFieldCustom(1));
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::StringOffset32);
+            file.fields[1].stringOffset = 25;
+        }, "chunk 0 field 1 string data out of range for 24 bytes"},
+    {"different TRS mapping", [](SceneFile& file) {
+            file.fields[0].name = UnsignedInt(SceneField::Translation);
+            file.fields[0].fieldType = UnsignedShort(SceneFieldType::Vector2);
+            file.fields[0].fieldStride = 0;
+            file.fields[1].name = UnsignedInt(SceneField::Rotation);
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Complex);
+            file.fields[1].fieldStride = 0;
+            file.fields[1].mappingStride = 0;
+        }, "chunk 0 Trade::SceneField::Rotation mapping data is different from Trade::SceneField::Translation mapping data"},
+    {"different mesh and material mapping", [](SceneFile& file) {
+            file.fields[0].name = UnsignedInt(SceneField::MeshMaterial);
+            file.fields[0].mappingStride = 0;
+        }, "chunk 0 Trade::SceneField::MeshMaterial mapping data is different from Trade::SceneField::Mesh mapping data"},
+    {"2D and 3D transformations", [](SceneFile& file) {
+            file.fields[0].name = UnsignedInt(SceneField::Translation);
+            file.fields[0].fieldType = UnsignedShort(SceneFieldType::Vector2);
+            file.fields[0].fieldStride = 0;
+            file.fields[1].name = UnsignedInt(SceneField::Rotation);
+            file.fields[1].fieldType = UnsignedShort(SceneFieldType::Quaternion);
+            file.fields[1].fieldOffset = 8;
+            file.fields[1].fieldStride = 0;
+        }, "chunk 0 has both 2D and 3D transformation fields"},
+    {"skin without transformation", [](SceneFile& file) {
+            file.fields[1].name = UnsignedInt(SceneField::Skin);
+        }, "chunk 0 has a skin field but no transformation field"},
+};
+
+/* A minimal file with a single animation with one 2D translation track */
+struct AnimationFile {
+    BlobHeader header;
+    BlobChunkHeader chunkHeader;
+    BlobAnimation animation;
+    BlobAnimationTrack track;
+    Float keys[2];
+    Float values[4];
+};
+
+static_assert(sizeof(AnimationFile) == 144, "unexpected padding");
+
+AnimationFile validAnimationFile() {
+    AnimationFile file{};
+    std::memcpy(file.header.magic, "MGNB", 4);
+    file.header.byteOrderMark = BlobByteOrderMark;
+    file.header.version = BlobVersion;
+    file.header.defaultScene = -1;
+    file.header.chunkCount = 1;
+    file.header.size = sizeof(AnimationFile);
+
+    file.chunkHeader.type = UnsignedInt(BlobChunkType::Animation);
+    file.chunkHeader.size = sizeof(AnimationFile) - sizeof(BlobHeader);
+
+    file.animation.dataOffset = offsetof(AnimationFile, keys) - offsetof(AnimationFile, chunkHeader);
+    file.animation.dataSize = 24;
+    file.animation.duration[0] = 0.0f;
+    file.animation.duration[1] = 1.0f;
+    file.animation.trackCount = 1;
+
+    file.track.keysOffset = 0;
+    file.track.valuesOffset = 8;
+    file.track.size = 2;
+    file.track.keysStride = 4;
+    file.track.valuesStride = 8;
+    file.track.targetName = UnsignedShort(AnimationTrackTarget::Translation2D);
+    file.track.type = UnsignedByte(AnimationTrackType::Vector2);
+    file.track.resultType = UnsignedByte(AnimationTrackType::Vector2);
+    file.track.interpolation = UnsignedByte(Animation::Interpolation::Linear);
+    file.track.before = UnsignedByte(Animation::Extrapolation::Constant);
+    file.track.after = UnsignedByte(Animation::Extrapolation::Constant);
+
+    file.keys[0] = 0.0f;
+    file.keys[1] = 1.0f;
+    file.values[0] = 1.0f;
+    file.values[1] = 2.0f;
+    file.values[2] = 3.0f;
+    file.values[3] = 4.0f;
+    return file;
+}
+
+const struct {
+    const char* name;
+    void(*modify)(AnimationFile&);
+    const char* message;
+} InvalidAnimationData[]{
+    {"invalid target name", [](AnimationFile& file) {
+            file.track.targetName = 0;
+        }, "chunk 0 track 0 has an invalid target name 0"},
+    {"invalid type", [](AnimationFile& file) {
+            file.track.type = 0;
+        }, "chunk 0 track 0 has an invalid type 0"},
+    {"invalid result type", [](AnimationFile& file) {
+            file.track.resultType = UnsignedByte(AnimationTrackType::Float);
+        }, "chunk 0 track 0 has an invalid result type 2 for Trade::AnimationTrackType::Vector2"},
+    {"spline interpolation for a non-spline type", [](AnimationFile& file) {
+            file.track.interpolation = UnsignedByte(Animation::Interpolation::Spline);
+        }, "chunk 0 track 0 has an invalid interpolation 2 for Trade::AnimationTrackType::Vector2"},
+    {"custom interpolation", [](AnimationFile& file) {
+            file.track.interpolation = UnsignedByte(Animation::Interpolation::Custom);
+        }, "chunk 0 track 0 has an invalid interpolation 3 for Trade::AnimationTrackType::Vector2"},
+    {"invalid extrapolation", [](AnimationFile& file) {
+            file.track.after = 3;
+        }, "chunk 0 track 0 has an invalid extrapolation 1, 3"},
+    {"stride too large", [](AnimationFile& file) {
+            file.track.valuesStride = 32768;
+        }, "chunk 0 track 0 strides 4 and 32768 don't fit into 16 bits"},
+    {"keys out of range", [](AnimationFile& file) {
+            file.track.keysOffset = 20;
+        }, "chunk 0 track 0 keys out of range for 24 bytes"},
+    {"keys out of range for an empty track", [](AnimationFile& file) {
+            file.track.size = 0;
+            file.track.keysOffset = 32;
+        }, "chunk 0 track 0 keys out of range for 24 bytes"},
+    {"values out of range", [](AnimationFile& file) {
+            file.track.valuesOffset = 12;
+        }, "chunk 0 track 0 values out of range for 24 bytes"},
+    {"values out of range with a negative stride", [](AnimationFile& file) {
+            file.track.valuesStride = -16;
+        }, "chunk 0 track 0 values out of range for 24 bytes"},
+};
+
+/* A minimal file with a single indexed mesh with two attributes sharing the
+   same vertex data */
+struct MeshFile {
+    BlobHeader header;
+    BlobChunkHeader chunkHeader;
+    BlobMesh mesh;
+    BlobMeshAttribute attributes[2];
+    UnsignedShort indices[4];
+    Float vertices[4];
+};
+
+static_assert(sizeof(MeshFile) == 176, "unexpected padding");
+
+MeshFile validMeshFile() {
+    MeshFile file{};
+    std::memcpy(file.header.magic, "MGNB", 4);
+    file.header.byteOrderMark = BlobByteOrderMark;
+    file.header.version = BlobVersion;
+    file.header.defaultScene = -1;
+    file.header.chunkCount = 1;
+    file.header.size = sizeof(MeshFile);
+
+    file.chunkHeader.type = UnsignedInt(BlobChunkType::Mesh);
+    file.chunkHeader.size = sizeof(MeshFile) - sizeof(BlobHeader);
+
+    file.mesh.indexDataOffset = offsetof(MeshFile, indices) - offsetof(MeshFile, chunkHeader);
+    file.mesh.indexDataSize = 8;
+    file.mesh.vertexDataOffset = offsetof(MeshFile, vertices) - offsetof(MeshFile, chunkHeader);
+    file.mesh.vertexDataSize = 16;
+    file.mesh.primitive = UnsignedInt(MeshPrimitive::Triangles);
+    file.mesh.indexType = UnsignedInt(MeshIndexType::UnsignedShort);
+    file.mesh.indexCount = 3;
+    file.mesh.indexStride = 2;
+    file.mesh.vertexCount = 2;
+    file.mesh.attributeCount = 2;
+
+    file.attributes[0].format = UnsignedInt(VertexFormat::Vector2);
+    file.attributes[0].stride = 8;
+    file.attributes[0].morphTargetId = -1;
+    file.attributes[0].name = UnsignedShort(MeshAttribute::Position);
+
+    file.attributes[1].format = UnsignedInt(VertexFormat::Vector2);
+    file.attributes[1].stride = 8;
+    file.attributes[1].morphTargetId = -1;
+    file.attributes[1].name = UnsignedShort(MeshAttribute::TextureCoordinates);
+
+    file.indices[0] = 0;
+    file.indices[1] = 1;
+    file.indices[2] = 0;
+    file.vertices[0] = 1.0f;
+    file.vertices[1] = 2.0f;
+    file.vertices[2] = 3.0f;
+    file.vertices[3] = 4.0f;
+    return file;
+}
+
+const struct {
+    const char* name;
+    void(*modify)(MeshFile&);
+    const char* message;
+} InvalidMeshData[]{
+    {"invalid primitive", [](MeshFile& file) {
+            file.mesh.primitive = 0;
+        }, "chunk 0 has an invalid primitive 0"},
+    {"invalid index type", [](MeshFile& file) {
+            file.mesh.indexType = 4;
+        }, "chunk 0 has an invalid index type 4"},
+    {"index stride too large", [](MeshFile& file) {
+            file.mesh.indexStride = -32769;
+        }, "chunk 0 index stride -32769 doesn't fit into 16 bits"},
+    {"indices out of range", [](MeshFile& file) {
+            file.mesh.indexCount = 5;
+        }, "chunk 0 indices out of range for 8 bytes"},
+    {"indices out of range with an offset", [](MeshFile& file) {
+            file.mesh.indexOffset = 4;
+        }, "chunk 0 indices out of range for 8 bytes"},
+    {"index data for a non-indexed mesh", [](MeshFile& file) {
+            file.mesh.indexType = 0;
+        }, "chunk 0 has index data but no indices"},
+    {"implicit vertex count without attributes", [](MeshFile& file) {
+            file.mesh.vertexCount = 0xffffffffu;
+            file.mesh.attributeCount = 0;
+        }, "chunk 0 has an implicit vertex count but no attributes"},
+    {"invalid attribute name", [](MeshFile& file) {
+            file.attributes[1].name = 0;
+        }, "chunk 0 attribute 1 has an invalid name 0"},
+    {"invalid attribute format", [](MeshFile& file) {
+            file.attributes[1].format = 0;
+        }, "chunk 0 attribute 1 has an invalid format 0"},
+    {"attribute format not valid for attribute", [](MeshFile& file) {
+            file.attributes[1].format = UnsignedInt(VertexFormat::Vector3);
+        }, "chunk 0 attribute 1 format VertexFormat::Vector3 is not valid for Trade::MeshAttribute::TextureCoordinates"},
+    {"invalid morph target ID", [](MeshFile& file) {
+            file.attributes[1].morphTargetId = 128;
+        }, "chunk 0 attribute 1 has an invalid morph target ID 128"},
+    {"morph target not allowed for attribute", [](MeshFile& file) {
+            file.attributes[1].name = UnsignedShort(MeshAttribute::ObjectId);
+            file.attributes[1].format = UnsignedInt(VertexFormat::UnsignedInt);
+            file.attributes[1].morphTargetId = 0;
+        }, "chunk 0 attribute 1 has an invalid morph target ID 0"},
+    {"attribute stride too large", [](MeshFile& file) {
+            file.attributes[1].stride = 32768;
+        }, "chunk 0 attribute 1 stride 32768 doesn't fit into 16 bits"},
+    {"array attribute", [](MeshFile& file) {
+            file.attributes[1].arraySize = 2;
+        }, "chunk 0 attribute 1 can't be an array attribute"},
+    {"attribute out of range", [](MeshFile& file) {
+            file.attributes[1].offset = 12;
+        }, "chunk 0 attribute 1 out of range for 16 bytes"},
+    {"attribute out of range with a negative stride", [](MeshFile& file) {
+            file.attributes[1].stride = -8;
+        }, "chunk 0 attribute 1 out of range for 16 bytes"},
+    {"joint IDs without weights", [](MeshFile& file) {
+            file.attributes[1].name = UnsignedShort(MeshAttribute::JointIds);
+            file.attributes[1].format = UnsignedInt(VertexFormat::UnsignedByte);
+            file.attributes[1].arraySize = 4;
+        }, "chunk 0 has 1 joint ID attributes but 0 weight attributes"},
+    {"joint ID and weight array size mismatch", [](MeshFile& file) {
+            file.attributes[0].name = UnsignedShort(MeshAttribute::JointIds);
+            file.attributes[0].format = UnsignedInt(VertexFormat::UnsignedByte);
+            file.attributes[0].arraySize = 4;
+            file.attributes[1].name = UnsignedShort(MeshAttribute::Weights);
+            file.attributes[1].format = UnsignedInt(VertexFormat::UnsignedByteNormalized);
+            file.attributes[1].arraySize = 2;
+        }, "chunk 0 attribute 0 array size 4 doesn't match weight attribute 1 array size 2"},
+};
+
+/* A minimal file with a single material with two attributes in one layer */
+struct MaterialFile {
+    BlobHeader header;
+    BlobChunkHeader chunkHeader;
+    BlobMaterial material;
+    char attributes[2][sizeof(MaterialAttributeData)];
+    UnsignedInt layers[2];
+};
+
+static_assert(sizeof(MaterialFile) == 208, "unexpected padding");
+
+MaterialFile validMaterialFile() {
+    MaterialFile file{};
+    std::memcpy(file.header.magic, "MGNB", 4);
+    file.header.byteOrderMark = BlobByteOrderMark;
+    file.header.version = BlobVersion;
+    file.header.defaultScene = -1;
+    file.header.chunkCount = 1;
+    file.header.size = sizeof(MaterialFile);
+
+    file.chunkHeader.type = UnsignedInt(BlobChunkType::Material);
+    file.chunkHeader.size = sizeof(MaterialFile) - sizeof(BlobHeader);
+
+    file.material.attributeDataOffset = offsetof(MaterialFile, attributes) - offsetof(MaterialFile, chunkHeader);
+    file.material.layerDataOffset = offsetof(MaterialFile, layers) - offsetof(MaterialFile, chunkHeader);
+    file.material.attributeCount = 2;
+    file.material.layerCount = 1;
+
+    const MaterialAttributeData attributes[]{
+        {"a", 1.0f},
+        {"b", 2u}
+    };
+    std::memcpy(file.attributes, attributes, sizeof(attributes));
+    file.layers[0] = 2;
+    return file;
+}
+
+const struct {
+    const char* name;
+    void(*modify)(MaterialFile&);
+    const char* message;
+} InvalidMaterialData[]{
+    {"invalid attribute type", [](MaterialFile& file) {
+            file.attributes[1][0] = 0;
+        }, "chunk 0 attribute 1 has an invalid type Trade::MaterialAttributeType(0x0)"},
+    {"pointer attribute type", [](MaterialFile& file) {
+            file.attributes[1][0] = char(MaterialAttributeType::Pointer);
+        }, "chunk 0 attribute 1 has an invalid type Trade::MaterialAttributeType::Pointer"},
+    {"empty attribute name", [](MaterialFile& file) {
+            file.attributes[1][1] = '\0';
+        }, "chunk 0 attribute 1 has an invalid name"},
+    {"attribute name not null-terminated", [](MaterialFile& file) {
+            std::memset(file.attributes[1] + 1, 'b', sizeof(MaterialAttributeData) - 1);
+        }, "chunk 0 attribute 1 has an invalid name"},
+    {"attribute name too long", [](MaterialFile& file) {
+            std::memset(file.attributes[1] + 1, 'b', 59);
+            file.attributes[1][60] = '\0';
+        }, "chunk 0 attribute 1 has an invalid value size"},
+    {"string attribute value too long", [](MaterialFile& file) {
+            const MaterialAttributeData attribute{"b", Containers::StringView{"hello"}};
+            std::memcpy(file.attributes[1], &attribute, sizeof(attribute));
+            file.attributes[1][sizeof(MaterialAttributeData) - 1] = 60;
+        }, "chunk 0 attribute 1 has an invalid value size"},
+    {"invalid layer range", [](MaterialFile& file) {
+            file.material.layerCount = 2;
+            file.layers[1] = 1;
+        }, "chunk 0 layer 1 has an invalid range 2:1 for 2 attributes"},
+    {"layer out of range", [](MaterialFile& file) {
+            file.layers[0] = 3;
+        }, "chunk 0 layer 0 has an invalid range 0:3 for 2 attributes"},
+    {"duplicate attribute", [](MaterialFile& file) {
+            std::memcpy(file.attributes[1], file.attributes[0], sizeof(MaterialAttributeData));
+        }, "chunk 0 layer 0 has a duplicate attribute a"},
+    {"attributes not sorted", [](MaterialFile& file) {
+            char attribute[sizeof(MaterialAttributeData)];
+            std::memcpy(attribute, file.attributes[0], sizeof(MaterialAttributeData));
+            std::memcpy(file.attributes[0], file.attributes[1], sizeof(MaterialAttributeData));
+            std::memcpy(file.attributes[1], attribute, sizeof(MaterialAttributeData));
+        }, "chunk 0 layer 0 attribute a has to be sorted before b"},
+    {"last layer too short", [](MaterialFile& file) {
+            file.layers[0] = 1;
+        }, "chunk 0 last layer offset 1 too short for 2 attributes"},
+};
+
+const struct {
+    const char* name;
+    bool(*open)(AbstractImporter&, Containers::ArrayView<const void>);
+    DataFlags expectedDataFlags;
+    bool referencesInput;
+} ImageOpenData[]{
+    {"data", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        return importer.openData(data);
+    }, DataFlag::Owned|DataFlag::Mutable, false},
+    {"memory", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        return importer.openMemory(data);
+    }, DataFlag::ExternallyOwned, true},
+    {"file", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        Containers::String filename = Utility::Path::join(MAGNUMIMPORTER_TEST_OUTPUT_DIR, "file.blob");
+        CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::write(filename, data));
+        return importer.openFile(filename);
+    },
+    /* The file is memory-mapped and referenced directly on platforms that
+       support it, read and copied otherwise */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    DataFlag::ExternallyOwned,
+    #else
+    DataFlag::Owned|DataFlag::Mutable,
+    #endif
+    false},
+};
+
+MagnumImporterTest::MagnumImporterTest() {
+    addInstancedTests({&MagnumImporterTest::invalid},
+        Containers::arraySize(InvalidData));
+
+    addInstancedTests({&MagnumImporterTest::invalidScene},
+        Containers::arraySize(InvalidSceneData));
+
+    addInstancedTests({&MagnumImporterTest::invalidAnimation},
+        Containers::arraySize(InvalidAnimationData));
+
+    addInstancedTests({&MagnumImporterTest::invalidMesh},
+        Containers::arraySize(InvalidMeshData));
+
+    addInstancedTests({&MagnumImporterTest::invalidMaterial},
+        Containers::arraySize(InvalidMaterialData));
+
+    addTests({&MagnumImporterTest::scene,
+              &MagnumImporterTest::animation,
+              &MagnumImporterTest::mesh,
+              &MagnumImporterTest::material});
+
+    addInstancedTests({&MagnumImporterTest::image},
+        Containers::arraySize(ImageOpenData));
+
+    addTests({&MagnumImporterTest::imageMisalignedMemory,
+              &MagnumImporterTest::fileNotFound});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MAGNUMIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(MAGNUMIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+
+    /* Create the output directory if it doesn't exist yet */
+    CORRADE_INTERNAL_ASSERT_OUTPUT(Utility::Path::make(MAGNUMIMPORTER_TEST_OUTPUT_DIR));
+}
+
+void MagnumImporterTest::invalid() {
+    auto&& data = InvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    File file = validFile();
+    data.modify(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::arrayView(reinterpret_cast<const char*>(&file), data.size)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::openData(): {}\n", data.message));
+}
+
+void MagnumImporterTest::invalidScene() {
+    auto&& data = InvalidSceneData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    SceneFile file = validSceneFile();
+    data.modify(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::openData(): {}\n", data.message));
+}
+
+void MagnumImporterTest::invalidAnimation() {
+    auto&& data = InvalidAnimationData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    AnimationFile file = validAnimationFile();
+    data.modify(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::openData(): {}\n", data.message));
+}
+
+void MagnumImporterTest::invalidMesh() {
+    auto&& data = InvalidMeshData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    MeshFile file = validMeshFile();
+    data.modify(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::openData(): {}\n", data.message));
+}
+
+void MagnumImporterTest::invalidMaterial() {
+    auto&& data = InvalidMaterialData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    MaterialFile file = validMaterialFile();
+    data.modify(file);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(out, Utility::format("Trade::MagnumImporter::openData(): {}\n", data.message));
+}
+
+void MagnumImporterTest::scene() {
+    const SceneFile file = validSceneFile();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(importer->defaultScene(), 0);
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+
+    Containers::Optional<Trade::SceneData> scene = importer->scene(0);
+    CORRADE_VERIFY(scene);
+    CORRADE_COMPARE(scene->mappingType(), SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(scene->mappingBound(), 2);
+    CORRADE_COMPARE(scene->fieldCount(), 2);
+    CORRADE_COMPARE_AS(scene->field<Int>(SceneField::Parent),
+        Containers::arrayView<Int>({-1, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(scene->field<UnsignedInt>(SceneField::Mesh),
+        Containers::arrayView<UnsignedInt>({0, 0}),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::animation() {
+    const AnimationFile file = validAnimationFile();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(importer->animationCount(), 1);
+
+    Containers::Optional<Trade::AnimationData> animation = importer->animation(0);
+    CORRADE_VERIFY(animation);
+    CORRADE_COMPARE(animation->duration(), (Range1D{0.0f, 1.0f}));
+    CORRADE_COMPARE(animation->trackCount(), 1);
+    CORRADE_COMPARE(animation->trackTargetName(0), AnimationTrackTarget::Translation2D);
+    CORRADE_COMPARE(animation->trackType(0), AnimationTrackType::Vector2);
+    CORRADE_COMPARE(animation->track<Vector2>(0).at(0.5f), (Vector2{2.0f, 3.0f}));
+}
+
+void MagnumImporterTest::mesh() {
+    const MeshFile file = validMeshFile();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(importer->meshCount(), 1);
+
+    Containers::Optional<Trade::MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedShort>(),
+        Containers::arrayView<UnsignedShort>({0, 1, 0}),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(mesh->vertexCount(), 2);
+    CORRADE_COMPARE(mesh->attributeCount(), 2);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        Containers::arrayView<Vector2>({{1.0f, 2.0f}, {3.0f, 4.0f}}),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::material() {
+    const MaterialFile file = validMaterialFile();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openData(Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(importer->materialCount(), 1);
+
+    Containers::Optional<Trade::MaterialData> material = importer->material(0);
+    CORRADE_VERIFY(material);
+    CORRADE_COMPARE(material->layerCount(), 1);
+    CORRADE_COMPARE(material->attributeCount(), 2);
+    CORRADE_COMPARE(material->attribute<Float>("a"), 1.0f);
+    CORRADE_COMPARE(material->attribute<UnsignedInt>("b"), 2u);
+}
+
+void MagnumImporterTest::image() {
+    auto&& data = ImageOpenData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const File file = validFile();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.open(*importer, Containers::arrayView(&file, 1)));
+    CORRADE_COMPARE(importer->defaultScene(), -1);
+    CORRADE_COMPARE(importer->image1DCount(), 0);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 0);
+    CORRADE_COMPARE(importer->image2DName(0), "image");
+    CORRADE_COMPARE(importer->image2DForName("image"), 0);
+    CORRADE_COMPARE(importer->image2DForName("nonexistent"), -1);
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_VERIFY(!image->isCompressed());
+    CORRADE_COMPARE(image->dataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{2, 1}));
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(file.data),
+        TestSuite::Compare::Container);
+
+    /* With openMemory() the data are referenced directly, otherwise it's a
+       copy or a mapping of a different memory */
+    if(data.referencesInput)
+        CORRADE_COMPARE(static_cast<const void*>(image->data().data()), file.data);
+    else
+        CORRADE_VERIFY(static_cast<const void*>(image->data().data()) != file.data);
+}
+
+void MagnumImporterTest::imageMisalignedMemory() {
+    /* Offset the file by one byte so the data can't be referenced directly */
+    const File file = validFile();
+    char storage[sizeof(File) + 8];
+    std::memcpy(storage + 1, &file, sizeof(File));
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(importer->openMemory(Containers::arrayView(storage + 1, sizeof(File))));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    CORRADE_COMPARE_AS(image->data(),
+        Containers::arrayView(file.data),
+        TestSuite::Compare::Container);
+}
+
+void MagnumImporterTest::fileNotFound() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("MagnumImporter");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->openFile("nonexistent.blob"));
+    /* There's an error from Path::mapRead() or Path::read() before */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    CORRADE_COMPARE_AS(out,
+        "\nTrade::MagnumImporter::openFile(): cannot map file nonexistent.blob\n",
+        TestSuite::Compare::StringHasSuffix);
+    #else
+    CORRADE_COMPARE_AS(out,
+        "\nTrade::AbstractImporter::openFile(): cannot open file nonexistent.blob\n",
+        TestSuite::Compare::StringHasSuffix);
+    #endif
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumImporterTest)
@@ -0,0 +1,410 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include "MagnumSceneConverter.h"
+
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/Utility/Algorithms.h>
+
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Vector3.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MagnumImporter/BlobFormat.h"
+
+namespace Magnum { namespace Trade {
+
+using namespace Implementation;
+
+struct MagnumSceneConverter::State {
+    Containers::Array<char> data;
+    UnsignedInt chunkCount{};
+    Int defaultScene = -1;
+};
+
+MagnumSceneConverter::MagnumSceneConverter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractSceneConverter{manager, plugin} {}
+
+MagnumSceneConverter::~MagnumSceneConverter() = default;
+
+SceneConverterFeatures MagnumSceneConverter::doFeatures() const {
+    return SceneConverterFeature::ConvertMultipleToData|
+           SceneConverterFeature::AddScenes|
+           SceneConverterFeature::AddAnimations|
+           SceneConverterFeature::AddMeshes|
+           SceneConverterFeature::AddMaterials|
+           SceneConverterFeature::AddImages1D|
+           SceneConverterFeature::AddImages2D|
+           SceneConverterFeature::AddImages3D|
+           SceneConverterFeature::AddCompressedImages1D|
+           SceneConverterFeature::AddCompressedImages2D|
+           SceneConverterFeature::AddCompressedImages3D;
+}
+
+void MagnumSceneConverter::doAbort() {
+    _state = nullptr;
+}
+
+bool MagnumSceneConverter::doBeginData() {
+    _state.emplace();
+    arrayAppend(_state->data, ValueInit, sizeof(BlobHeader));
+    return true;
+}
+
+Containers::Optional<Containers::Array<char>> MagnumSceneConverter::doEndData() {
+    Containers::Array<char>& out = _state->data;
+
+    BlobHeader& header = *reinterpret_cast<BlobHeader*>(out.data());
+    header.magic[0] = 'M';
+    header.magic[1] = 'G';
+    header.magic[2] = 'N';
+    header.magic[3] = 'B';
+    header.byteOrderMark = BlobByteOrderMark;
+    header.version = BlobVersion;
+    header.defaultScene = _state->defaultScene;
+    header.chunkCount = _state->chunkCount;
+    header.size = out.size();
+
+    /* Turn the array into a non-growable to avoid a dangling deleter on
+       plugin unload */
+    arrayShrink(out, DefaultInit);
+
+    /* GCC 4.8 needs extra help here */
+    Containers::Optional<Containers::Array<char>> result{Utility::move(out)};
+    _state = nullptr;
+    return result;
+}
+
+namespace {
+
+template<class T> T& at(Containers::Array<char>& out, const std::size_t offset) {
+    return *reinterpret_cast<T*>(out.data() + offset);
+}
+
+void padToAlignment(Containers::Array<char>& out) {
+    const std::size_t padding = (BlobAlignment - out.size() % BlobAlignment) % BlobAlignment;
+    if(padding) arrayAppend(out, ValueInit, padding);
+}
+
+/* Appends a chunk header, zero-initialized space for a type-specific header
+   and entries and the name. Returns offset of the chunk in the output. */
+std::size_t beginChunk(Containers::Array<char>& out, const BlobChunkType type, const std::size_t headerSize, const std::size_t entriesSize, const Containers::StringView name) {
+    const std::size_t chunkOffset = out.size();
+    const std::size_t nameOffset = sizeof(BlobChunkHeader) + headerSize + entriesSize;
+    arrayAppend(out, ValueInit, nameOffset + name.size());
+    Utility::copy(Containers::arrayView(name.data(), name.size()), out.sliceSize(chunkOffset + nameOffset, name.size()));
+
+    BlobChunkHeader& header = at<BlobChunkHeader>(out, chunkOffset);
+    header.type = UnsignedInt(type);
+    header.nameSize = name.size();
+    return chunkOffset;
+}
+
+/* Appends data aligned to BlobAlignment and returns their offset relative to
+   the chunk start */
+std::size_t appendData(Containers::Array<char>& out, const std::size_t chunkOffset, const Containers::ArrayView<const char> data) {
+    padToAlignment(out);
+    const std::size_t offset = out.size();
+    arrayAppend(out, data);
+    return offset - chunkOffset;
+}
+
+void endChunk(Containers::Array<char>& out, const std::size_t chunkOffset) {
+    padToAlignment(out);
+    at<BlobChunkHeader>(out, chunkOffset).size = out.size() - chunkOffset;
+}
+
+/* Checks that a strided view with given element size is fully inside given
+   data */
+bool isInside(const Containers::ArrayView<const char> data, const void* const begin, const std::size_t size, const std::ptrdiff_t stride, const std::size_t elementSize) {
+    if(!size) return true;
+    const char* const first = static_cast<const char*>(begin);
+    const char* const last = first + std::ptrdiff_t(size - 1)*stride;
+    return (stride < 0 ? last : first) >= data.begin() &&
+           (stride < 0 ? first : last) + elementSize <= data.end();
+}
+
+template<UnsignedInt dimensions> void addImage(Containers::Array<char>& out, const ImageData<dimensions>& image, const BlobChunkType type, const Containers::StringView name) {
+    const std::size_t chunkOffset = beginChunk(out, type, sizeof(BlobImage), 0, name);
+    const std::size_t dataOffset = appendData(out, chunkOffset, image.data());
+
+    BlobImage& header = at<BlobImage>(out, chunkOffset + sizeof(BlobChunkHeader));
+    header.dataOffset = dataOffset;
+    header.dataSize = image.data().size();
+    Vector3i::from(header.size) = Vector3i::pad(image.size(), 1);
+    header.flags = UnsignedShort(image.flags());
+    if(image.isCompressed()) {
+        const CompressedPixelStorage storage = image.compressedStorage();
+        header.compressed = 1;
+        header.format = UnsignedInt(image.compressedFormat());
+        header.pixelSize = image.blockDataSize();
+        Vector3i::from(header.blockSize) = image.blockSize();
+        header.storageRowLength = storage.rowLength();
+        header.storageImageHeight = storage.imageHeight();
+        Vector3i::from(header.storageSkip) = storage.skip();
+    } else {
+        const PixelStorage storage = image.storage();
+        header.format = UnsignedInt(image.format());
+        header.formatExtra = image.formatExtra();
+        header.pixelSize = image.pixelSize();
+        header.storageAlignment = storage.alignment();
+        header.storageRowLength = storage.rowLength();
+        header.storageImageHeight = storage.imageHeight();
+        Vector3i::from(header.storageSkip) = storage.skip();
+    }
+
+    endChunk(out, chunkOffset);
+}
+
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const SceneData& scene, const Containers::StringView name) {
+    Containers::Array<char>& out = _state->data;
+    const Containers::ArrayView<const char> data = scene.data();
+
+    /* Pointers wouldn't survive a round trip through a file. String data for
+       string fields are only a pointer, verify they're inside the scene data.
+       All other views are verified by SceneData itself. */
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        if(scene.fieldType(i) == SceneFieldType::Pointer ||
+           scene.fieldType(i) == SceneFieldType::MutablePointer)
+        {
+            Error{} << "Trade::MagnumSceneConverter::add(): field" << i << "is a pointer, which can't be serialized";
+            return false;
+        }
+        if(!Implementation::isSceneFieldTypeString(scene.fieldType(i)) || !scene.fieldSize(i))
+            continue;
+        const char* const stringData = scene.fieldStringData(i);
+        if(stringData < data.begin() || stringData > data.end()) {
+            Error{} << "Trade::MagnumSceneConverter::add(): string data of field" << i << "are not contained in the scene data";
+            return false;
+        }
+    }
+
+    const std::size_t chunkOffset = beginChunk(out, BlobChunkType::Scene, sizeof(BlobScene), scene.fieldCount()*sizeof(BlobSceneField), name);
+    const std::size_t dataOffset = appendData(out, chunkOffset, data);
+
+    BlobScene& header = at<BlobScene>(out, chunkOffset + sizeof(BlobChunkHeader));
+    header.dataOffset = dataOffset;
+    header.dataSize = data.size();
+    header.mappingBound = scene.mappingBound();
+    header.mappingType = UnsignedInt(scene.mappingType());
+    header.fieldCount = scene.fieldCount();
+
+    const Containers::ArrayView<BlobSceneField> fields = Containers::arrayCast<BlobSceneField>(out.sliceSize(chunkOffset + sizeof(BlobChunkHeader) + sizeof(BlobScene), scene.fieldCount()*sizeof(BlobSceneField)));
+    for(UnsignedInt i = 0; i != scene.fieldCount(); ++i) {
+        BlobSceneField& field = fields[i];
+        const SceneFieldType fieldType = scene.fieldType(i);
+        field.size = scene.fieldSize(i);
+        field.name = UnsignedInt(scene.fieldName(i));
+        field.fieldType = UnsignedShort(fieldType);
+        field.arraySize = scene.fieldArraySize(i);
+        /* Data in the output are always offset-only, and the null-terminated
+           flag is implied by the string field type */
+        field.flags = UnsignedByte(scene.fieldFlags(i) & ~(SceneFieldFlag::OffsetOnly|SceneFieldFlag::NullTerminatedString));
+
+        /* Empty views can point anywhere, leave the offsets zero for those */
+        if(!field.size) continue;
+
+        const Containers::StridedArrayView2D<const char> mapping = scene.mapping(i);
+        field.mappingOffset = static_cast<const char*>(mapping.data()) - data.data();
+        field.mappingStride = mapping.stride()[0];
+
+        if(fieldType == SceneFieldType::Bit) {
+            const Containers::StridedBitArrayView2D bits = scene.fieldBitArrays(i);
+            field.fieldOffset = static_cast<const char*>(bits.data()) - data.data();
+            field.fieldBitOffset = bits.offset();
+            field.fieldStride = bits.stride()[0];
+        } else {
+            const Containers::StridedArrayView2D<const char> fieldData = scene.field(i);
+            field.fieldOffset = static_cast<const char*>(fieldData.data()) - data.data();
+            field.fieldStride = fieldData.stride()[0];
+            if(Implementation::isSceneFieldTypeString(fieldType))
+                field.stringOffset = scene.fieldStringData(i) - data.data();
+        }
+    }
+
+    endChunk(out, chunkOffset);
+    ++_state->chunkCount;
+    return true;
+}
+
+void MagnumSceneConverter::doSetDefaultScene(const UnsignedInt id) {
+    _state->defaultScene = id;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const AnimationData& animation, const Containers::StringView name) {
+    Containers::Array<char>& out = _state->data;
+    const Containers::ArrayView<const char> data = animation.data();
+
+    /* Only the builtin interpolators can be restored on import, and the track
+       views have to be inside the data in order to be stored as offsets */
+    for(UnsignedInt i = 0; i != animation.trackCount(); ++i) {
+        const Animation::TrackViewStorage<const Float> track = animation.track(i);
+        if(track.interpolation() == Animation::Interpolation::Custom) {
+            Error{} << "Trade::MagnumSceneConverter::add(): track" << i << "uses a custom interpolator, which can't be serialized";
+            return false;
+        }
+        if(!isInside(data, track.keys().data(), track.keys().size(), track.keys().stride(), sizeof(Float)) ||
+           !isInside(data, track.values().data(), track.values().size(), track.values().stride(), animationTrackTypeSize(animation.trackType(i))))
+        {
+            Error{} << "Trade::MagnumSceneConverter::add(): track" << i << "is not contained in the animation data";
+            return false;
+        }
+    }
+
+    const std::size_t chunkOffset = beginChunk(out, BlobChunkType::Animation, sizeof(BlobAnimation), animation.trackCount()*sizeof(BlobAnimationTrack), name);
+    const std::size_t dataOffset = appendData(out, chunkOffset, data);
+
+    BlobAnimation& header = at<BlobAnimation>(out, chunkOffset + sizeof(BlobChunkHeader));
+    header.dataOffset = dataOffset;
+    header.dataSize = data.size();
+    header.duration[0] = animation.duration().min();
+    header.duration[1] = animation.duration().max();
+    header.trackCount = animation.trackCount();
+
+    const Containers::ArrayView<BlobAnimationTrack> tracks = Containers::arrayCast<BlobAnimationTrack>(out.sliceSize(chunkOffset + sizeof(BlobChunkHeader) + sizeof(BlobAnimation), animation.trackCount()*sizeof(BlobAnimationTrack)));
+    for(UnsignedInt i = 0; i != animation.trackCount(); ++i) {
+        const Animation::TrackViewStorage<const Float> track = animation.track(i);
+        BlobAnimationTrack& blobTrack = tracks[i];
+        blobTrack.target = animation.trackTarget(i);
+        blobTrack.size = track.size();
+        blobTrack.targetName = UnsignedShort(animation.trackTargetName(i));
+        blobTrack.type = UnsignedByte(animation.trackType(i));
+        blobTrack.resultType = UnsignedByte(animation.trackResultType(i));
+        blobTrack.interpolation = UnsignedByte(track.interpolation());
+        blobTrack.before = UnsignedByte(track.before());
+        blobTrack.after = UnsignedByte(track.after());
+
+        /* Empty views can point anywhere, leave the offsets zero for those */
+        if(!track.size()) continue;
+
+        blobTrack.keysOffset = static_cast<const char*>(track.keys().data()) - data.data();
+        blobTrack.keysStride = track.keys().stride();
+        blobTrack.valuesOffset = static_cast<const char*>(track.values().data()) - data.data();
+        blobTrack.valuesStride = track.values().stride();
+    }
+
+    endChunk(out, chunkOffset);
+    ++_state->chunkCount;
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const MeshData& mesh, const Containers::StringView name) {
+    Containers::Array<char>& out = _state->data;
+
+    const std::size_t chunkOffset = beginChunk(out, BlobChunkType::Mesh, sizeof(BlobMesh), mesh.attributeCount()*sizeof(BlobMeshAttribute), name);
+    const std::size_t indexDataOffset = appendData(out, chunkOffset, mesh.indexData());
+    const std::size_t vertexDataOffset = appendData(out, chunkOffset, mesh.vertexData());
+
+    BlobMesh& header = at<BlobMesh>(out, chunkOffset + sizeof(BlobChunkHeader));
+    header.indexDataOffset = indexDataOffset;
+    header.indexDataSize = mesh.indexData().size();
+    header.vertexDataOffset = vertexDataOffset;
+    header.vertexDataSize = mesh.vertexData().size();
+    header.primitive = UnsignedInt(mesh.primitive());
+    if(mesh.isIndexed()) {
+        header.indexOffset = mesh.indexOffset();
+        header.indexType = UnsignedInt(mesh.indexType());
+        header.indexCount = mesh.indexCount();
+        header.indexStride = mesh.indexStride();
+    }
+    header.vertexCount = mesh.vertexCount();
+    header.attributeCount = mesh.attributeCount();
+
+    const Containers::ArrayView<BlobMeshAttribute> attributes = Containers::arrayCast<BlobMeshAttribute>(out.sliceSize(chunkOffset + sizeof(BlobChunkHeader) + sizeof(BlobMesh), mesh.attributeCount()*sizeof(BlobMeshAttribute)));
+    for(UnsignedInt i = 0; i != mesh.attributeCount(); ++i) {
+        BlobMeshAttribute& attribute = attributes[i];
+        attribute.offset = mesh.attributeOffset(i);
+        attribute.format = UnsignedInt(mesh.attributeFormat(i));
+        attribute.stride = mesh.attributeStride(i);
+        attribute.morphTargetId = mesh.attributeMorphTargetId(i);
+        attribute.name = UnsignedShort(mesh.attributeName(i));
+        attribute.arraySize = mesh.attributeArraySize(i);
+    }
+
+    endChunk(out, chunkOffset);
+    ++_state->chunkCount;
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const MaterialData& material, const Containers::StringView name) {
+    Containers::Array<char>& out = _state->data;
+
+    /* Pointers wouldn't survive a round trip through a file */
+    for(const MaterialAttributeData& attribute: material.attributeData()) {
+        if(attribute.type() == MaterialAttributeType::Pointer ||
+           attribute.type() == MaterialAttributeType::MutablePointer)
+        {
+            Error{} << "Trade::MagnumSceneConverter::add(): material attribute" << attribute.name() << "is a pointer, which can't be serialized";
+            return false;
+        }
+    }
+
+    const std::size_t chunkOffset = beginChunk(out, BlobChunkType::Material, sizeof(BlobMaterial), 0, name);
+    const std::size_t attributeDataOffset = appendData(out, chunkOffset, Containers::arrayCast<const char>(material.attributeData()));
+    const std::size_t layerDataOffset = appendData(out, chunkOffset, Containers::arrayCast<const char>(material.layerData()));
+
+    BlobMaterial& header = at<BlobMaterial>(out, chunkOffset + sizeof(BlobChunkHeader));
+    header.attributeDataOffset = attributeDataOffset;
+    header.layerDataOffset = layerDataOffset;
+    header.types = UnsignedInt(material.types());
+    header.attributeCount = material.attributeData().size();
+    header.layerCount = material.layerData().size();
+
+    endChunk(out, chunkOffset);
+    ++_state->chunkCount;
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData1D& image, const Containers::StringView name) {
+    addImage(_state->data, image, BlobChunkType::Image1D, name);
+    ++_state->chunkCount;
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData2D& image, const Containers::StringView name) {
+    addImage(_state->data, image, BlobChunkType::Image2D, name);
+    ++_state->chunkCount;
+    return true;
+}
+
+bool MagnumSceneConverter::doAdd(UnsignedInt, const ImageData3D& image, const Containers::StringView name) {
+    addImage(_state->data, image, BlobChunkType::Image3D, name);
+    ++_state->chunkCount;
+    return true;
+}
+
+}}
+
+CORRADE_PLUGIN_REGISTER(MagnumSceneConverter, Magnum::Trade::MagnumSceneConverter,
+    MAGNUM_TRADE_ABSTRACTSCENECONVERTER_PLUGIN_INTERFACE)
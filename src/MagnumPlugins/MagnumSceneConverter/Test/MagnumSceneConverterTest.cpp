@@ -0,0 +1,525 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+*/
+
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/StridedArrayView.h>
+#include <Corrade/Containers/StridedBitArrayView.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/TestSuite/Compare/Container.h>
+#include <Corrade/Utility/DebugStl.h> /** @todo remove once Debug is stream-free */
+
+#include "Magnum/PixelFormat.h"
+#include "Magnum/Animation/Track.h"
+#include "Magnum/Math/Color.h"
+#include "Magnum/Math/Range.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/AbstractSceneConverter.h"
+#include "Magnum/Trade/AnimationData.h"
+#include "Magnum/Trade/ImageData.h"
+#include "Magnum/Trade/MaterialData.h"
+#include "Magnum/Trade/MeshData.h"
+#include "Magnum/Trade/SceneData.h"
+#include "MagnumPlugins/MagnumImporter/BlobFormat.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct MagnumSceneConverterTest: TestSuite::Tester {
+    explicit MagnumSceneConverterTest();
+
+    void empty();
+
+    void mesh();
+    void scene();
+    void material();
+    void animation();
+    void images();
+
+    void scenePointerField();
+    void materialPointerAttribute();
+    void animationCustomInterpolator();
+    void animationTrackNotInData();
+
+    /* Explicitly forbid system-wide plugin dependencies */
+    PluginManager::Manager<AbstractSceneConverter> _converterManager{"nonexistent"};
+    PluginManager::Manager<AbstractImporter> _importerManager{"nonexistent"};
+};
+
+const struct {
+    const char* name;
+    bool(*open)(AbstractImporter&, Containers::ArrayView<const void>);
+    DataFlags expectedDataFlags;
+} ImportData[]{
+    {"data", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        return importer.openData(data);
+    }, DataFlag::Owned|DataFlag::Mutable},
+    {"memory", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
+        return importer.openMemory(data);
+    }, DataFlag::ExternallyOwned},
+};
+
+MagnumSceneConverterTest::MagnumSceneConverterTest() {
+    addTests({&MagnumSceneConverterTest::empty});
+
+    addInstancedTests({&MagnumSceneConverterTest::mesh,
+                       &MagnumSceneConverterTest::scene,
+                       &MagnumSceneConverterTest::material,
+                       &MagnumSceneConverterTest::animation,
+                       &MagnumSceneConverterTest::images},
+        Containers::arraySize(ImportData));
+
+    addTests({&MagnumSceneConverterTest::scenePointerField,
+              &MagnumSceneConverterTest::materialPointerAttribute,
+              &MagnumSceneConverterTest::animationCustomInterpolator,
+              &MagnumSceneConverterTest::animationTrackNotInData});
+
+    /* Load the plugin directly from the build tree. Otherwise it's static and
+       already loaded. */
+    #ifdef MAGNUMSCENECONVERTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_converterManager.load(MAGNUMSCENECONVERTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+    /* Optional plugins that don't have to be here */
+    #ifdef MAGNUMIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_importerManager.load(MAGNUMIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void MagnumSceneConverterTest::empty() {
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+
+    CORRADE_VERIFY(converter->beginData());
+    Containers::Optional<Containers::Array<char>> data = converter->endData();
+    CORRADE_VERIFY(data);
+    CORRADE_COMPARE(data->size(), sizeof(Implementation::BlobHeader));
+
+    const Implementation::BlobHeader& header = *reinterpret_cast<const Implementation::BlobHeader*>(data->data());
+    CORRADE_COMPARE((Containers::StringView{header.magic, 4}), "MGNB");
+    CORRADE_COMPARE(header.byteOrderMark, 0xfeff);
+    CORRADE_COMPARE(header.version, 1);
+    CORRADE_COMPARE(header.defaultScene, -1);
+    CORRADE_COMPARE(header.chunkCount, 0);
+    CORRADE_COMPARE(header.size, sizeof(Implementation::BlobHeader));
+}
+
+void MagnumSceneConverterTest::mesh() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const struct Vertex {
+        Vector3 position;
+        Vector2 textureCoordinates;
+    } vertices[]{
+        {{1.0f, 2.0f, 3.0f}, {0.25f, 0.5f}},
+        {{4.0f, 5.0f, 6.0f}, {0.75f, 1.0f}},
+        {{7.0f, 8.0f, 9.0f}, {0.0f, 0.125f}},
+    };
+    const UnsignedShort indices[]{0, 1, 2, 2, 1, 0};
+    Containers::StridedArrayView1D<const Vertex> verticesView = vertices;
+    MeshData mesh{MeshPrimitive::Triangles,
+        {}, indices, MeshIndexData{indices},
+        {}, vertices, {
+            MeshAttributeData{MeshAttribute::Position, verticesView.slice(&Vertex::position)},
+            MeshAttributeData{MeshAttribute::TextureCoordinates, verticesView.slice(&Vertex::textureCoordinates)},
+        }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(MeshData{MeshPrimitive::Points, 5}, "empty"));
+    CORRADE_VERIFY(converter->add(mesh, "a mesh"));
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    if(!(_importerManager.loadState("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.open(*importer, *out));
+    CORRADE_COMPARE(importer->meshCount(), 2);
+    CORRADE_COMPARE(importer->meshName(1), "a mesh");
+    CORRADE_COMPARE(importer->meshForName("a mesh"), 1);
+
+    Containers::Optional<MeshData> empty = importer->mesh(0);
+    CORRADE_VERIFY(empty);
+    CORRADE_COMPARE(empty->primitive(), MeshPrimitive::Points);
+    CORRADE_VERIFY(!empty->isIndexed());
+    CORRADE_COMPARE(empty->attributeCount(), 0);
+    CORRADE_COMPARE(empty->vertexCount(), 5);
+
+    Containers::Optional<MeshData> imported = importer->mesh(1);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE(imported->indexDataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(imported->vertexDataFlags(), data.expectedDataFlags);
+    CORRADE_VERIFY(imported->isIndexed());
+    CORRADE_COMPARE(imported->indexType(), MeshIndexType::UnsignedShort);
+    CORRADE_COMPARE_AS(imported->indices<UnsignedShort>(),
+        Containers::arrayView(indices),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE(imported->vertexCount(), 3);
+    CORRADE_COMPARE(imported->attributeCount(), 2);
+    CORRADE_COMPARE(imported->attributeStride(0), sizeof(Vertex));
+    CORRADE_COMPARE_AS(imported->attribute<Vector3>(MeshAttribute::Position),
+        verticesView.slice(&Vertex::position),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imported->attribute<Vector2>(MeshAttribute::TextureCoordinates),
+        verticesView.slice(&Vertex::textureCoordinates),
+        TestSuite::Compare::Container);
+
+    /* With openMemory() the data should point directly to the blob */
+    if(data.expectedDataFlags & DataFlag::ExternallyOwned) {
+        CORRADE_VERIFY(imported->vertexData().begin() >= out->begin());
+        CORRADE_VERIFY(imported->vertexData().end() <= out->end());
+    }
+}
+
+void MagnumSceneConverterTest::scene() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    struct Scene {
+        UnsignedInt mapping[3];
+        Int parent[3];
+        Vector3 translation[3];
+        UnsignedByte visible[1];
+    } sceneData[]{{
+        {0, 1, 2},
+        {-1, 0, 1},
+        {{1.0f, 2.0f, 3.0f}, {4.0f, 5.0f, 6.0f}, {7.0f, 8.0f, 9.0f}},
+        {0x5}
+    }};
+    SceneData scene{SceneMappingType::UnsignedInt, 3, {}, sceneData, {
+        SceneFieldData{SceneField::Parent,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->parent),
+            SceneFieldFlag::ImplicitMapping},
+        SceneFieldData{SceneField::Translation,
+            Containers::arrayView(sceneData->mapping),
+            Containers::arrayView(sceneData->translation)},
+        SceneFieldData{sceneFieldCustom(15),
+            Containers::arrayView(sceneData->mapping),
+            Containers::StridedBitArrayView1D{Containers::BitArrayView{sceneData->visible, 0, 3}}}
+    }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(scene, "a scene"));
+    converter->setDefaultScene(0);
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    if(!(_importerManager.loadState("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.open(*importer, *out));
+    CORRADE_COMPARE(importer->sceneCount(), 1);
+    CORRADE_COMPARE(importer->defaultScene(), 0);
+    CORRADE_COMPARE(importer->sceneName(0), "a scene");
+
+    Containers::Optional<SceneData> imported = importer->scene(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->dataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(imported->mappingType(), SceneMappingType::UnsignedInt);
+    CORRADE_COMPARE(imported->mappingBound(), 3);
+    CORRADE_COMPARE(imported->fieldCount(), 3);
+
+    CORRADE_COMPARE(imported->fieldFlags(SceneField::Parent), SceneFieldFlag::ImplicitMapping);
+    CORRADE_COMPARE_AS(imported->mapping<UnsignedInt>(SceneField::Parent),
+        Containers::arrayView(sceneData->mapping),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imported->field<Int>(SceneField::Parent),
+        Containers::arrayView(sceneData->parent),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(imported->field<Vector3>(SceneField::Translation),
+        Containers::arrayView(sceneData->translation),
+        TestSuite::Compare::Container);
+
+    CORRADE_COMPARE(imported->fieldType(sceneFieldCustom(15)), SceneFieldType::Bit);
+    Containers::StridedBitArrayView1D visible = imported->fieldBits(sceneFieldCustom(15));
+    CORRADE_COMPARE(visible.size(), 3);
+    CORRADE_VERIFY(visible[0]);
+    CORRADE_VERIFY(!visible[1]);
+    CORRADE_VERIFY(visible[2]);
+}
+
+void MagnumSceneConverterTest::material() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    MaterialData material{MaterialType::PbrMetallicRoughness|MaterialType::PbrClearCoat, {
+        {MaterialAttribute::BaseColor, Color4{0.2f, 0.4f, 0.6f, 0.8f}},
+        {MaterialAttribute::Metalness, 0.5f},
+        {"highlight", "yes"},
+        {MaterialLayer::ClearCoat},
+        {MaterialAttribute::LayerFactor, 0.25f},
+    }, {3, 5}};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(material, "a material"));
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    if(!(_importerManager.loadState("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.open(*importer, *out));
+    CORRADE_COMPARE(importer->materialCount(), 1);
+    CORRADE_COMPARE(importer->materialForName("a material"), 0);
+
+    Containers::Optional<MaterialData> imported = importer->material(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->attributeDataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(imported->layerDataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(imported->types(), MaterialType::PbrMetallicRoughness|MaterialType::PbrClearCoat);
+    CORRADE_COMPARE(imported->layerCount(), 2);
+    CORRADE_COMPARE(imported->attributeCount(0), 3);
+    CORRADE_COMPARE(imported->attribute<Color4>(MaterialAttribute::BaseColor), (Color4{0.2f, 0.4f, 0.6f, 0.8f}));
+    CORRADE_COMPARE(imported->attribute<Float>(MaterialAttribute::Metalness), 0.5f);
+    CORRADE_COMPARE(imported->attribute<Containers::StringView>("highlight"), "yes");
+    CORRADE_COMPARE(imported->layerName(1), "ClearCoat");
+    CORRADE_COMPARE(imported->layerFactor(1), 0.25f);
+}
+
+void MagnumSceneConverterTest::animation() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const struct Keyframe {
+        Float time;
+        Vector3 translation;
+    } keyframes[]{
+        {0.5f, {1.0f, 2.0f, 3.0f}},
+        {1.5f, {3.0f, 4.0f, 5.0f}},
+    };
+    Containers::StridedArrayView1D<const Keyframe> keyframesView = keyframes;
+    AnimationData animation{{}, keyframes, {
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 17,
+            AnimationTrackType::Vector3,
+            keyframesView.slice(&Keyframe::time),
+            keyframesView.slice(&Keyframe::translation),
+            Animation::Interpolation::Linear,
+            Animation::Extrapolation::DefaultConstructed,
+            Animation::Extrapolation::Extrapolated}
+    }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(animation, "an animation"));
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    if(!(_importerManager.loadState("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.open(*importer, *out));
+    CORRADE_COMPARE(importer->animationCount(), 1);
+    CORRADE_COMPARE(importer->animationName(0), "an animation");
+
+    Containers::Optional<AnimationData> imported = importer->animation(0);
+    CORRADE_VERIFY(imported);
+    CORRADE_COMPARE(imported->dataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(imported->duration(), (Range1D{0.5f, 1.5f}));
+    CORRADE_COMPARE(imported->trackCount(), 1);
+    CORRADE_COMPARE(imported->trackTargetName(0), AnimationTrackTarget::Translation3D);
+    CORRADE_COMPARE(imported->trackTarget(0), 17);
+    CORRADE_COMPARE(imported->trackType(0), AnimationTrackType::Vector3);
+    CORRADE_COMPARE(imported->trackResultType(0), AnimationTrackType::Vector3);
+
+    Animation::TrackView<const Float, const Vector3> track = imported->track<Vector3>(0);
+    CORRADE_COMPARE(track.interpolation(), Animation::Interpolation::Linear);
+    CORRADE_COMPARE(track.before(), Animation::Extrapolation::DefaultConstructed);
+    CORRADE_COMPARE(track.after(), Animation::Extrapolation::Extrapolated);
+    CORRADE_COMPARE_AS(track.keys(),
+        keyframesView.slice(&Keyframe::time),
+        TestSuite::Compare::Container);
+    /* The interpolator got restored as well */
+    CORRADE_COMPARE(track.at(1.0f), (Vector3{2.0f, 3.0f, 4.0f}));
+}
+
+void MagnumSceneConverterTest::images() {
+    auto&& data = ImportData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const char pixels1D[]{'\x10', '\x20', '\x30', '\x40'};
+    const char pixels2D[]{
+        1, 2, 3, 4, 5, 6,
+        7, 8, 9, 10, 11, 12,
+        13, 14, 15, 16, 17, 18
+    };
+    const char blocks3D[8]{'\xaa', '\xbb', '\xcc', '\xdd', 1, 2, 3, 4};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+    CORRADE_VERIFY(converter->add(ImageData1D{PixelFormat::R8Unorm, 4, {}, pixels1D}, "a 1D image"));
+    CORRADE_VERIFY(converter->add(ImageData2D{PixelStorage{}.setAlignment(1), PixelFormat::RGB8Unorm, {2, 3}, {}, pixels2D, ImageFlag2D::Array}, "a 2D image"));
+    CORRADE_VERIFY(converter->add(ImageData3D{CompressedPixelFormat::Bc1RGBUnorm, {4, 4, 1}, {}, blocks3D}, "a 3D image"));
+    Containers::Optional<Containers::Array<char>> out = converter->endData();
+    CORRADE_VERIFY(out);
+
+    if(!(_importerManager.loadState("MagnumImporter") & PluginManager::LoadState::Loaded))
+        CORRADE_SKIP("MagnumImporter plugin not enabled, can't test the result");
+
+    Containers::Pointer<AbstractImporter> importer = _importerManager.instantiate("MagnumImporter");
+    CORRADE_VERIFY(data.open(*importer, *out));
+    CORRADE_COMPARE(importer->image1DCount(), 1);
+    CORRADE_COMPARE(importer->image2DCount(), 1);
+    CORRADE_COMPARE(importer->image3DCount(), 1);
+    CORRADE_COMPARE(importer->image2DForName("a 2D image"), 0);
+    CORRADE_COMPARE(importer->image3DName(0), "a 3D image");
+
+    Containers::Optional<ImageData1D> image1D = importer->image1D(0);
+    CORRADE_VERIFY(image1D);
+    CORRADE_VERIFY(!image1D->isCompressed());
+    CORRADE_COMPARE(image1D->dataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(image1D->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image1D->size(), Math::Vector<1, Int>{4});
+    CORRADE_COMPARE_AS(image1D->data(),
+        Containers::arrayView(pixels1D),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<ImageData2D> image2D = importer->image2D(0);
+    CORRADE_VERIFY(image2D);
+    CORRADE_VERIFY(!image2D->isCompressed());
+    CORRADE_COMPARE(image2D->dataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(image2D->flags(), ImageFlag2D::Array);
+    CORRADE_COMPARE(image2D->storage().alignment(), 1);
+    CORRADE_COMPARE(image2D->format(), PixelFormat::RGB8Unorm);
+    CORRADE_COMPARE(image2D->size(), (Vector2i{2, 3}));
+    CORRADE_COMPARE_AS(image2D->data(),
+        Containers::arrayView(pixels2D),
+        TestSuite::Compare::Container);
+
+    Containers::Optional<ImageData3D> image3D = importer->image3D(0);
+    CORRADE_VERIFY(image3D);
+    CORRADE_VERIFY(image3D->isCompressed());
+    CORRADE_COMPARE(image3D->dataFlags(), data.expectedDataFlags);
+    CORRADE_COMPARE(image3D->compressedFormat(), CompressedPixelFormat::Bc1RGBUnorm);
+    CORRADE_COMPARE(image3D->size(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(image3D->blockSize(), (Vector3i{4, 4, 1}));
+    CORRADE_COMPARE(image3D->blockDataSize(), 8);
+    CORRADE_COMPARE_AS(image3D->data(),
+        Containers::arrayView(blocks3D),
+        TestSuite::Compare::Container);
+}
+
+void MagnumSceneConverterTest::scenePointerField() {
+    const struct Field {
+        UnsignedInt object;
+        const void* pointer;
+    } fields[2]{};
+    Containers::StridedArrayView1D<const Field> fieldsView = fields;
+    SceneData scene{SceneMappingType::UnsignedInt, 2, {}, fields, {
+        SceneFieldData{sceneFieldCustom(3),
+            fieldsView.slice(&Field::object),
+            fieldsView.slice(&Field::pointer)},
+    }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(scene));
+    CORRADE_COMPARE(out, "Trade::MagnumSceneConverter::add(): field 0 is a pointer, which can't be serialized\n");
+}
+
+void MagnumSceneConverterTest::materialPointerAttribute() {
+    const Float value = 3.0f;
+    MaterialData material{{}, {
+        {"pointer", &value},
+    }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(material));
+    CORRADE_COMPARE(out, "Trade::MagnumSceneConverter::add(): material attribute pointer is a pointer, which can't be serialized\n");
+}
+
+Vector3 customInterpolator(const Vector3& a, const Vector3&, Float) {
+    return a;
+}
+
+void MagnumSceneConverterTest::animationCustomInterpolator() {
+    const struct Keyframe {
+        Float time;
+        Vector3 translation;
+    } keyframes[2]{};
+    Containers::StridedArrayView1D<const Keyframe> keyframesView = keyframes;
+    AnimationData animation{{}, keyframes, {
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 0,
+            AnimationTrackType::Vector3,
+            keyframesView.slice(&Keyframe::time),
+            keyframesView.slice(&Keyframe::translation),
+            Animation::Interpolation::Constant,
+            Animation::Extrapolation::Constant},
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 1,
+            AnimationTrackType::Vector3,
+            keyframesView.slice(&Keyframe::time),
+            keyframesView.slice(&Keyframe::translation),
+            reinterpret_cast<void(*)()>(customInterpolator)}
+    }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(animation));
+    CORRADE_COMPARE(out, "Trade::MagnumSceneConverter::add(): track 1 uses a custom interpolator, which can't be serialized\n");
+}
+
+void MagnumSceneConverterTest::animationTrackNotInData() {
+    const Float keys[]{0.0f, 1.0f};
+    const Vector3 values[2]{};
+    AnimationData animation{{}, keys, {
+        AnimationTrackData{AnimationTrackTarget::Translation3D, 0,
+            AnimationTrackType::Vector3,
+            Containers::arrayView(keys),
+            Containers::arrayView(values),
+            Animation::Interpolation::Linear}
+    }};
+
+    Containers::Pointer<AbstractSceneConverter> converter = _converterManager.instantiate("MagnumSceneConverter");
+    CORRADE_VERIFY(converter->beginData());
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!converter->add(animation));
+    CORRADE_COMPARE(out, "Trade::MagnumSceneConverter::add(): track 0 is not contained in the animation data\n");
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::MagnumSceneConverterTest)
@@ -26,7 +26,10 @@
 
 #include "ObjImporter.h"
 
+#include <cfloat> /* FLT_MIN, FLT_MAX */
 #include <climits> /* INT_MIN, INT_MAX */
+#include <clocale> /* localeconv() */
+#include <cstring>
 #include <unordered_map>
 #include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
@@ -35,11 +38,16 @@
 #include <Corrade/Containers/StringStlHash.h>
 #include <Corrade/Utility/Algorithms.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Path.h>
 
 #include "Magnum/Mesh.h"
 #include "Magnum/MeshTools/RemoveDuplicates.h"
 #include "Magnum/MeshTools/Duplicate.h"
 #include "Magnum/Math/Color.h"
+#include "Magnum/Math/Functions.h"
+#include "Magnum/ThreadPool.h"
+#include "Magnum/Trade/AbstractAllocator.h"
+#include "Magnum/Trade/Data.h"
 #include "Magnum/Trade/MeshData.h"
 
 namespace Magnum { namespace Trade {
@@ -70,7 +78,12 @@ struct ObjImporter::File {
     /* Contains always n + 1 entries, with the last entry being an upper bound
        on the file range and index offsets */
     Containers::Array<Mesh> meshes;
+    /* If the file is memory-mapped, this is a non-owning view on
+       mappedFileData */
     Containers::Array<char> fileData;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mappedFileData;
+    #endif
 };
 
 namespace {
@@ -84,26 +97,165 @@ namespace {
    since that is a significant delimiter that has to be treated separately. */
 constexpr Containers::StringView Whitespace = " \t\r"_s;
 
-/* Mostly just a copy of Corrade's Utility::Json::parseFloatInternal() and
-   parseUnsignedIntInternal() */
-/** @todo make a common API in Corrade once we have something that can parse
-    numbers like a grownup */
+/* Parses a run of decimal digits into `value`, returning a pointer after the
+   last digit. Eight digits are checked and combined at once with plain 64-bit
+   arithmetic if there's enough of them, which is what makes the common case
+   of long fractional parts fast. The value silently overflows if there's more
+   than 19 digits, the caller is expected to check that. */
+inline const char* parseDigits(const char* i, const char* const end, std::uint64_t& value) {
+    #ifndef CORRADE_TARGET_BIG_ENDIAN
+    while(end - i >= 8) {
+        std::uint64_t chunk;
+        std::memcpy(&chunk, i, 8);
+        /* All eight bytes are digits if the high nibble of each is 3 and
+           adding 6 to each doesn't overflow into the high nibble */
+        if(((chunk & 0xf0f0f0f0f0f0f0f0ull)|(((chunk + 0x0606060606060606ull) & 0xf0f0f0f0f0f0f0f0ull) >> 4)) != 0x3333333333333333ull)
+            break;
+        /* Combine pairs of digits, then pairs of pairs, then pairs of
+           quadruples. The first digit is in the lowest byte. */
+        chunk = ((chunk & 0x0f0f0f0f0f0f0f0full)*2561) >> 8;
+        chunk = ((chunk & 0x00ff00ff00ff00ffull)*6553601) >> 16;
+        chunk = ((chunk & 0x0000ffff0000ffffull)*42949672960001ull) >> 32;
+        value = value*100000000 + (chunk & 0xffffffffull);
+        i += 8;
+    }
+    #endif
+
+    for(; i != end && UnsignedInt(*i - '0') < 10; ++i)
+        value = value*10 + (*i - '0');
+
+    return i;
+}
+
+/* Locale-independent parsing of a decimal floating-point literal. Returns
+   false if the literal isn't handled here, in which case the caller falls
+   back to strtof(). The result is exact for all inputs that are handled
+   here:
+
+   -    with at most 19 significant digits the mantissa is exact in a 64-bit
+        integer, and if it's additionally at most 2^53 and the decimal
+        exponent is in the [-22, 22] range, it's exactly representable in a
+        double together with the power of ten, meaning the single
+        multiplication or division is correctly rounded to a double
+   -    rounding the double to a float then gives the same result as rounding
+        the original decimal value directly, unless the double is exactly in
+        the middle between two floats, or in the denormal / overflow range,
+        which are left to strtof()
+
+   This relies on doubles not having excess precision, i.e. not being
+   calculated on a x87 FPU. */
+inline bool parseFloatFast(const Containers::StringView string, Float& out) {
+    const char* i = string.begin();
+    const char* const end = string.end();
+
+    bool negative = false;
+    if(i != end && (*i == '-' || *i == '+')) {
+        negative = *i == '-';
+        ++i;
+    }
+
+    std::uint64_t mantissa = 0;
+    const char* const integerBegin = i;
+    i = parseDigits(i, end, mantissa);
+    std::size_t digitCount = i - integerBegin;
+    Int exponent = 0;
+    if(i != end && *i == '.') {
+        const char* const fractionBegin = ++i;
+        i = parseDigits(i, end, mantissa);
+        exponent = -Int(i - fractionBegin);
+        digitCount += i - fractionBegin;
+    }
+
+    /* No digits at all, could be an inf / nan or an invalid literal */
+    if(!digitCount)
+        return false;
+
+    if(i != end && (*i == 'e' || *i == 'E')) {
+        ++i;
+        bool exponentNegative = false;
+        if(i != end && (*i == '-' || *i == '+')) {
+            exponentNegative = *i == '-';
+            ++i;
+        }
+        const char* const exponentBegin = i;
+        Int explicitExponent = 0;
+        for(; i != end && UnsignedInt(*i - '0') < 10; ++i)
+            /* Saturate to avoid overflow, anything this large goes to the
+               fallback anyway */
+            if(explicitExponent < 100000)
+                explicitExponent = explicitExponent*10 + (*i - '0');
+        if(i == exponentBegin)
+            return false;
+        exponent += exponentNegative ? -explicitExponent : explicitExponent;
+    }
+
+    /* Trailing garbage, hexadecimal literals, too many digits or values
+       outside of the exactly representable range go to the fallback */
+    if(i != end || digitCount > 19 || mantissa > (1ull << 53) || exponent < -22 || exponent > 22)
+        return false;
+
+    /* All exactly representable as doubles */
+    constexpr double PowersOf10[]{
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+    };
+    double value = double(mantissa);
+    if(exponent < 0)
+        value /= PowersOf10[-exponent];
+    else
+        value *= PowersOf10[exponent];
+
+    if(value != 0.0) {
+        if(value < double(FLT_MIN) || value > double(FLT_MAX))
+            return false;
+        /* A float has 29 mantissa bits less than a double. If the lowest 29
+           bits are exactly a half of a float ULP, the decimal value may lie
+           on either side of the midpoint and rounding again to a float may
+           go the wrong way. */
+        std::uint64_t bits;
+        std::memcpy(&bits, &value, 8);
+        if((bits & 0x1fffffffull) == 0x10000000ull)
+            return false;
+    }
+
+    out = Float(negative ? -value : value);
+    return true;
+}
+
+/* If errorPrefix is nullptr, no error is printed. Used when parsing on worker
+   threads, see parseChunk() for details. */
 inline bool parseFloat(const char* const errorPrefix, const Containers::StringView string, Float& out) {
+    if(parseFloatFast(string, out))
+        return true;
+
+    /* Fallback for the rare cases, mostly just a copy of Corrade's
+       Utility::Json::parseFloatInternal() */
     /** @todo replace with something that can parse non-null-terminated stuff,
         then drop this "too long" error */
     char buffer[128];
     const std::size_t size = string.size();
     if(size > Containers::arraySize(buffer) - 1) {
-        Error{} << errorPrefix << "too long numeric literal" << string;
+        if(errorPrefix) Error{} << errorPrefix << "too long numeric literal" << string;
         return false;
     }
 
-    std::memcpy(buffer, string.data(), size);
+    /* Translate the period to what strtof() expects in the current locale,
+       and treat the locale-specific decimal point as invalid, to not accept
+       different files based on the locale */
+    const char decimalPoint = *std::localeconv()->decimal_point;
+    for(std::size_t i = 0; i != size; ++i) {
+        if(string[i] == '.')
+            buffer[i] = decimalPoint;
+        else if(string[i] == decimalPoint) {
+            if(errorPrefix) Error{} << errorPrefix << "invalid floating-point literal" << string;
+            return false;
+        } else buffer[i] = string[i];
+    }
     buffer[size] = '\0';
     char* end;
     out = std::strtof(buffer, &end);
     if(!string || std::size_t(end - buffer) != size) {
-        Error{} << errorPrefix << "invalid floating-point literal" << string;
+        if(errorPrefix) Error{} << errorPrefix << "invalid floating-point literal" << string;
         return false;
     }
 
@@ -112,12 +264,32 @@ inline bool parseFloat(const char* const errorPrefix, const Containers::StringVi
 }
 
 inline bool parseInt(const char* const errorPrefix, const Containers::StringView string, Int& out) {
+    /* Fast path for at most nine digits, which always fit into 32 bits. The
+       rest goes through strtoll() below. */
+    {
+        const char* i = string.begin();
+        const char* const end = string.end();
+        const bool negative = i != end && *i == '-';
+        if(negative) ++i;
+        if(end - i >= 1 && end - i <= 9) {
+            Int value = 0;
+            for(; i != end && UnsignedInt(*i - '0') < 10; ++i)
+                value = value*10 + (*i - '0');
+            if(i == end) {
+                out = negative ? -value : value;
+                return true;
+            }
+        }
+    }
+
+    /* Fallback, mostly just a copy of Corrade's
+       Utility::Json::parseUnsignedIntInternal() */
     /** @todo replace with something that can parse non-null-terminated stuff,
         then drop this "too long" error */
     char buffer[128];
     const std::size_t size = string.size();
     if(size > Containers::arraySize(buffer) - 1) {
-        Error{} << errorPrefix << "too long numeric literal" << string;
+        if(errorPrefix) Error{} << errorPrefix << "too long numeric literal" << string;
         return false;
     }
 
@@ -128,11 +300,11 @@ inline bool parseInt(const char* const errorPrefix, const Containers::StringView
        additionally check errno to detect overflows */
     const std::int64_t outLong = std::strtoll(buffer, &end, 10);
     if(!string || std::size_t(end - buffer) != size) {
-        Error{} << errorPrefix << "invalid integer literal" << string;
+        if(errorPrefix) Error{} << errorPrefix << "invalid integer literal" << string;
         return false;
     }
     if(outLong < INT_MIN || outLong > INT_MAX) {
-        Error{} << errorPrefix << "too small or large integer literal" << string;
+        if(errorPrefix) Error{} << errorPrefix << "too small or large integer literal" << string;
         return false;
     }
 
@@ -159,6 +331,27 @@ void ObjImporter::doClose() {
 
 bool ObjImporter::doIsOpened() const { return !!_file; }
 
+void ObjImporter::doOpenFile(const Containers::StringView filename) {
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    if(configuration().value<bool>("mapFile")) {
+        Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename);
+        if(!mapped) {
+            Error{} << "Trade::ObjImporter::openFile(): cannot map file" << filename;
+            return;
+        }
+
+        /* Pass a non-owning view to doOpenData(), which takes it over
+           without copying as it's marked as externally owned, and then keep
+           the mapping alive for as long as the file is open */
+        doOpenData(Containers::Array<char>{const_cast<char*>(mapped->data()), mapped->size(), Implementation::nonOwnedArrayDeleter}, DataFlag::ExternallyOwned);
+        _file->mappedFileData = Utility::move(mapped);
+        return;
+    }
+    #endif
+
+    AbstractImporter::doOpenFile(filename);
+}
+
 void ObjImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     _file.emplace();
 
@@ -279,22 +472,74 @@ template<class T> bool checkAndDuplicateInto(const Containers::StridedArrayView1
     return true;
 }
 
-}
+/* Merges index tuples by looking up the unique tuples having the same
+   position index in a linked list instead of hashing whole tuples. For files
+   where the texture coordinate and normal indices are either absent or equal
+   to the position index, which is what most exporters produce, each list has
+   just one item and this is a direct lookup. The output is the same as with
+   MeshTools::removeDuplicatesInPlaceInto(), i.e. unique tuples in order of
+   their first occurrence. Returns NullOpt if any position index is out of
+   range, in which case the hash-based path gets used and the error is
+   reported later. */
+Containers::Optional<std::size_t> removeDuplicatesByPositionInPlaceInto(const Containers::ArrayView<Vector3ui> indices, const std::size_t positionCount, const Containers::ArrayView<UnsignedInt> out) {
+    /* Has to be checked upfront, as the indices are modified in-place */
+    for(const Vector3ui& i: indices)
+        if(i[0] >= positionCount)
+            return {};
 
-Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, UnsignedInt) {
-    /* Seek the file, set mesh parsing parameters */
-    const Mesh& mesh = _file->meshes[id];
+    constexpr UnsignedInt Empty = ~UnsignedInt{};
+    Containers::Array<UnsignedInt> first{DirectInit, positionCount, Empty};
+    Containers::Array<UnsignedInt> next{NoInit, indices.size()};
+    UnsignedInt count = 0;
+    for(std::size_t i = 0; i != indices.size(); ++i) {
+        const Vector3ui tuple = indices[i];
+        UnsignedInt id = first[tuple[0]];
+        while(id != Empty && indices[id] != tuple)
+            id = next[id];
+
+        /* Not found, put it after the unique tuples found so far. As count is
+           always at most i, this doesn't overwrite anything not processed
+           yet. */
+        if(id == Empty) {
+            id = count++;
+            indices[id] = tuple;
+            next[id] = first[tuple[0]];
+            first[tuple[0]] = id;
+        }
+
+        out[i] = id;
+    }
 
+    return std::size_t{count};
+}
+
+/* A range of lines of a single mesh, parsed independently of the others */
+struct Chunk {
+    Containers::StringView data;
     Containers::Optional<MeshPrimitive> primitive;
     Containers::Array<Vector3> positions;
     Containers::Array<Vector2> textureCoordinates;
     Containers::Array<Vector3> normals;
     /* Taking a shortcut as there's fortunately nothing else than just 3 types
-       of data. First positions, then normals, then texture coordinates. */
+       of data. First positions, then texture coordinates, then normals. */
     Containers::Array<Vector3ui> indices;
-    std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+    /* Offsets of components in the indices array that were negative and are
+       thus relative to the start of this chunk and not the mesh */
+    Containers::Array<std::size_t> relativeIndices;
+    std::size_t textureCoordinateIndexCount, normalIndexCount;
+    /* Offsets into the concatenated arrays, filled in doMesh() */
+    std::size_t positionOffset, textureCoordinateOffset, normalOffset, indexOffset;
+    bool failed;
+};
+
+/* Error printing is global state unless Corrade is built with
+   CORRADE_BUILD_MULTITHREADED, so chunks parsed on worker threads don't print
+   anything. If any of them fails, the chunk gets parsed again on the calling
+   thread with printErrors enabled to report the error. */
+bool parseChunk(Chunk& chunk, const Mesh& mesh, const bool printErrors) {
+    const char* const errorPrefix = printErrors ? "Trade::ObjImporter::mesh():" : nullptr;
 
-    Containers::StringView in{mesh.begin, std::size_t(_file->meshes[id + 1].begin - mesh.begin)};
+    Containers::StringView in = chunk.data;
     while(in) {
         /* Get a line from the input */
         const Containers::StringView lineEnd = in.findOr('\n', in.end());
@@ -344,8 +589,8 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             for(; i != maxComponentCount && contents; ++i) {
                 const Containers::StringView foundSpace = contents.findAnyOr(Whitespace, contents.end());
 
-                if(!parseFloat("Trade::ObjImporter::mesh():", contents.prefix(foundSpace.begin()), data[i]))
-                    return {};
+                if(!parseFloat(errorPrefix, contents.prefix(foundSpace.begin()), data[i]))
+                    return false;
 
                 contents = contents.suffix(foundSpace.end()).trimmedPrefix(Whitespace);
             }
@@ -353,37 +598,37 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             /* Position */
             if(keyword == "v"_s) {
                 if(i < 3 || contents) {
-                    Error{} << "Trade::ObjImporter::mesh(): expected 3 or 4 position coordinates, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): expected 3 or 4 position coordinates, got" << line.suffix(keywordEnd.end());
+                    return false;
                 }
                 if(i == 4 && !Math::equal(data[3], 1.0f)) {
-                    Error{} << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): homogeneous coordinates are not supported";
+                    return false;
                 }
 
-                arrayAppend(positions, Vector3::from(data));
+                arrayAppend(chunk.positions, Vector3::from(data));
 
             /* Texture coordinate */
             } else if(keyword == "vt"_s) {
                 if(i < 2 || contents) {
-                    Error{} << "Trade::ObjImporter::mesh(): expected 2 or 3 texture coordinates, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): expected 2 or 3 texture coordinates, got" << line.suffix(keywordEnd.end());
+                    return false;
                 }
                 if(i == 3 && !Math::equal(data[2], 0.0f)) {
-                    Error{} << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): 3D texture coordinates are not supported";
+                    return false;
                 }
 
-                arrayAppend(textureCoordinates, Vector2::from(data));
+                arrayAppend(chunk.textureCoordinates, Vector2::from(data));
 
             /* Normal */
             } else if(keyword == "vn"_s) {
                 if(i < 3 || contents) {
-                    Error{} << "Trade::ObjImporter::mesh(): expected 3 normal coordinates, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): expected 3 normal coordinates, got" << line.suffix(keywordEnd.end());
+                    return false;
                 }
 
-                arrayAppend(normals, Vector3::from(data));
+                arrayAppend(chunk.normals, Vector3::from(data));
 
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
@@ -403,6 +648,9 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
             /* Parse them all. If there's less than expected, `i` would be too
                small; if there's more then `contents` would stay non-empty. */
             Vector3ui data[4];
+            /* Bits 0, 1, 2 set if given position, texture coordinate or
+               normal index in a tuple is negative */
+            UnsignedByte relative[4]{};
             std::size_t i = 0;
             for(; i != maxIndexTupleCount && contents; ++i) {
                 const Containers::StringView foundSpace = contents.findAnyOr(Whitespace, contents.end());
@@ -411,13 +659,16 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                 /* The number before first slash is a position index */
                 const Containers::StringView foundSlash1 = indexTuple.findOr('/', indexTuple.end());
                 Int index;
-                if(!parseInt("Trade::ObjImporter::mesh():", indexTuple.prefix(foundSlash1.begin()), index))
-                    return {};
+                if(!parseInt(errorPrefix, indexTuple.prefix(foundSlash1.begin()), index))
+                    return false;
                 /* If the number is negative, it counts from the end (-1 is
-                   the last known position at this point, counting from 1) */
-                if(index < 0)
-                    index += positions.size() + 1;
-                data[i][0] = index - mesh.positionIndexOffset;
+                   the last known position at this point, counting from 1).
+                   Only the positions in this chunk are known at this point,
+                   the rest is added in doMesh() once all chunks are parsed. */
+                if(index < 0) {
+                    data[i][0] = UnsignedInt(index) + UnsignedInt(chunk.positions.size());
+                    relative[i] |= 1 << 0;
+                } else data[i][0] = index - mesh.positionIndexOffset;
 
                 /* If there was a slash, next is a texture coordinate or
                    empty */
@@ -425,72 +676,76 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                     indexTuple = indexTuple.suffix(foundSlash1.end());
                     const Containers::StringView foundSlash2 = indexTuple.findOr('/', indexTuple.end());
                     if(!foundSlash2 || foundSlash2.begin() != indexTuple.begin()) {
-                        if(!parseInt("Trade::ObjImporter::mesh():", indexTuple.prefix(foundSlash2.begin()), index))
-                            return {};
+                        if(!parseInt(errorPrefix, indexTuple.prefix(foundSlash2.begin()), index))
+                            return false;
                         /* If the number is negative, it counts from the end
                            (-1 is the last known texture coordinate at this
                            point, counting from 1) */
-                        if(index < 0)
-                            index += textureCoordinates.size() + 1;
-                        data[i][1] = index - mesh.textureCoordinateIndexOffset;
-                        ++textureCoordinateIndexCount;
+                        if(index < 0) {
+                            data[i][1] = UnsignedInt(index) + UnsignedInt(chunk.textureCoordinates.size());
+                            relative[i] |= 1 << 1;
+                        } else data[i][1] = index - mesh.textureCoordinateIndexOffset;
+                        ++chunk.textureCoordinateIndexCount;
                     }
 
                     /* If there was a second slash, last is a normal */
                     if(foundSlash2) {
                         indexTuple = indexTuple.suffix(foundSlash2.end());
-                        if(!parseInt("Trade::ObjImporter::mesh():", indexTuple, index))
-                            return {};
+                        if(!parseInt(errorPrefix, indexTuple, index))
+                            return false;
                         /* If the number is negative, it counts from the end
                            (-1 is the last known normal at this point, counting
                            from 1) */
-                        if(index < 0)
-                            index += normals.size() + 1;
-                        data[i][2] = index - mesh.normalIndexOffset;
-                        ++normalIndexCount;
+                        if(index < 0) {
+                            data[i][2] = UnsignedInt(index) + UnsignedInt(chunk.normals.size());
+                            relative[i] |= 1 << 2;
+                        } else data[i][2] = index - mesh.normalIndexOffset;
+                        ++chunk.normalIndexCount;
                     }
                 }
 
                 contents = contents.suffix(foundSpace.end()).trimmedPrefix(Whitespace);
             }
 
+            const std::size_t indexBegin = chunk.indices.size();
+
             /* Points */
             if(keyword == "p") {
-                if(primitive && primitive != MeshPrimitive::Points) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Points;
-                    return {};
+                if(chunk.primitive && chunk.primitive != MeshPrimitive::Points) {
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): mixed primitive" << *chunk.primitive << "and" << MeshPrimitive::Points;
+                    return false;
                 }
                 if(i < 1 || contents) {
-                    Error() << "Trade::ObjImporter::mesh(): expected exactly 1 position index tuple for a point, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): expected exactly 1 position index tuple for a point, got" << line.suffix(keywordEnd.end());
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Points;
-                arrayAppend(indices, Containers::arrayView(data).prefix(1));
+                chunk.primitive = MeshPrimitive::Points;
+                arrayAppend(chunk.indices, Containers::arrayView(data).prefix(1));
 
             /* Lines */
             } else if(keyword == "l") {
-                if(primitive && primitive != MeshPrimitive::Lines) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Lines;
-                    return {};
+                if(chunk.primitive && chunk.primitive != MeshPrimitive::Lines) {
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): mixed primitive" << *chunk.primitive << "and" << MeshPrimitive::Lines;
+                    return false;
                 }
                 if(i < 2 || contents) {
-                    Error() << "Trade::ObjImporter::mesh(): expected exactly 2 position index tuples for a line, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): expected exactly 2 position index tuples for a line, got" << line.suffix(keywordEnd.end());
+                    return false;
                 }
 
-                primitive = MeshPrimitive::Lines;
-                arrayAppend(indices, Containers::arrayView(data).prefix(2));
+                chunk.primitive = MeshPrimitive::Lines;
+                arrayAppend(chunk.indices, Containers::arrayView(data).prefix(2));
 
             /* Faces */
             } else if(keyword == "f") {
-                if(primitive && primitive != MeshPrimitive::Triangles) {
-                    Error() << "Trade::ObjImporter::mesh(): mixed primitive" << *primitive << "and" << MeshPrimitive::Triangles;
-                    return {};
+                if(chunk.primitive && chunk.primitive != MeshPrimitive::Triangles) {
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): mixed primitive" << *chunk.primitive << "and" << MeshPrimitive::Triangles;
+                    return false;
                 }
                 if(i < 3 || contents) {
-                    Error() << "Trade::ObjImporter::mesh(): expected 3 or 4 position index tuples for a face, got" << line.suffix(keywordEnd.end());
-                    return {};
+                    if(printErrors) Error{} << "Trade::ObjImporter::mesh(): expected 3 or 4 position index tuples for a face, got" << line.suffix(keywordEnd.end());
+                    return false;
                 }
 
                 /* If it's a quad, convert it to two triangles */
@@ -502,7 +757,7 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                        | \ \ |
                        |  \ \|
                        1---2 2 */
-                    arrayAppend(indices, {
+                    arrayAppend(chunk.indices, {
                         data[0],
                         data[1],
                         data[2],
@@ -515,21 +770,154 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
                        more to the counters as well. If they matched the index
                        array size before, they'll continue to match; if they
                        didn't, they'll continue to not match. */
-                    if(textureCoordinateIndexCount)
-                        textureCoordinateIndexCount += 2;
-                    if(normalIndexCount)
-                        normalIndexCount += 2;
-                } else arrayAppend(indices, Containers::arrayView(data).prefix(3));
+                    if(chunk.textureCoordinateIndexCount)
+                        chunk.textureCoordinateIndexCount += 2;
+                    if(chunk.normalIndexCount)
+                        chunk.normalIndexCount += 2;
+                } else arrayAppend(chunk.indices, Containers::arrayView(data).prefix(3));
 
-                primitive = MeshPrimitive::Triangles;
+                chunk.primitive = MeshPrimitive::Triangles;
 
             } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
 
+            /* Remember which of the just added index components were
+               negative so they can be made relative to the mesh start later.
+               For quads the tuples are added in the order shown above. */
+            if(relative[0]|relative[1]|relative[2]|relative[3]) {
+                constexpr UnsignedByte QuadTuples[]{0, 1, 2, 0, 2, 3};
+                for(std::size_t j = 0, jMax = chunk.indices.size() - indexBegin; j != jMax; ++j) {
+                    const UnsignedByte tupleRelative = relative[i == 4 ? QuadTuples[j] : j];
+                    for(std::size_t k = 0; k != 3; ++k)
+                        if(tupleRelative & (1 << k))
+                            arrayAppend(chunk.relativeIndices, (indexBegin + j)*3 + k);
+                }
+            }
+
         /* Unknown keyword */
         } else {
-            Error{} << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
+            if(printErrors) Error{} << "Trade::ObjImporter::mesh(): unknown keyword" << keyword;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+}
+
+Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, UnsignedInt) {
+    /* Seek the file, set mesh parsing parameters */
+    const Mesh& mesh = _file->meshes[id];
+
+    const bool mergeIndexArrays = configuration().value<bool>("mergeIndexArrays");
+    const Containers::String mergeIndexArraysStrategy = configuration().value("mergeIndexArraysStrategy");
+    if(mergeIndexArrays && mergeIndexArraysStrategy != "positionBuckets"_s && mergeIndexArraysStrategy != "hash"_s) {
+        Error{} << "Trade::ObjImporter::mesh(): expected mergeIndexArraysStrategy to be positionBuckets or hash but got" << mergeIndexArraysStrategy;
+        return {};
+    }
+
+    /* Split the mesh into chunks on line boundaries and parse them in
+       parallel, with a few chunks per thread for load balancing. The chunk
+       count depends on the thread count but the result doesn't, as the chunks
+       are concatenated in order. */
+    constexpr std::size_t MinChunkSize = 512*1024;
+    const Containers::StringView in{mesh.begin, std::size_t(_file->meshes[id + 1].begin - mesh.begin)};
+    ThreadPool& threadPool = ThreadPool::global();
+    const std::size_t chunkCount = threadPool.threadCount() == 1 ? 1 :
+        Math::max(Math::min(in.size()/MinChunkSize, std::size_t(threadPool.threadCount())*4), std::size_t{1});
+    Containers::Array<Chunk> chunks{chunkCount};
+    {
+        const char* begin = in.begin();
+        for(std::size_t i = 0; i != chunkCount; ++i) {
+            const char* end = in.end();
+            if(i != chunkCount - 1) {
+                const Containers::StringView rest = in.exceptPrefix(Math::max(std::size_t(begin - in.begin()), in.size()*(i + 1)/chunkCount));
+                end = rest.findOr('\n', rest.end()).end();
+            }
+            chunks[i].data = {begin, std::size_t(end - begin)};
+            begin = end;
+        }
+    }
+
+    Containers::Optional<MeshPrimitive> primitive;
+    Containers::Array<Vector3> positions;
+    Containers::Array<Vector2> textureCoordinates;
+    Containers::Array<Vector3> normals;
+    Containers::Array<Vector3ui> indices;
+    std::size_t textureCoordinateIndexCount = 0, normalIndexCount = 0;
+
+    /* A single chunk is parsed directly on the calling thread, with the
+       arrays taken over as-is */
+    if(chunkCount == 1) {
+        Chunk& chunk = chunks[0];
+        if(!parseChunk(chunk, mesh, true))
             return {};
+
+        primitive = chunk.primitive;
+        positions = Utility::move(chunk.positions);
+        textureCoordinates = Utility::move(chunk.textureCoordinates);
+        normals = Utility::move(chunk.normals);
+        indices = Utility::move(chunk.indices);
+        textureCoordinateIndexCount = chunk.textureCoordinateIndexCount;
+        normalIndexCount = chunk.normalIndexCount;
+
+    } else {
+        threadPool.parallelFor(chunkCount, 1, [&](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i)
+                chunks[i].failed = !parseChunk(chunks[i], mesh, false);
+        });
+
+        /* Go through the chunks in order and calculate their offsets in the
+           concatenated arrays. If a chunk failed or uses a different
+           primitive than the chunks before, parse it again with the
+           primitive from previous chunks to print the same error that a
+           sequential parse would. */
+        std::size_t positionCount = 0, textureCoordinateCount = 0, normalCount = 0, indexCount = 0;
+        for(Chunk& chunk: chunks) {
+            if(chunk.failed || (primitive && chunk.primitive && *chunk.primitive != *primitive)) {
+                const Containers::StringView data = chunk.data;
+                chunk = Chunk{};
+                chunk.data = data;
+                chunk.primitive = primitive;
+                CORRADE_INTERNAL_ASSERT_OUTPUT(!parseChunk(chunk, mesh, true));
+                return {};
+            }
+            if(chunk.primitive)
+                primitive = chunk.primitive;
+
+            chunk.positionOffset = positionCount;
+            chunk.textureCoordinateOffset = textureCoordinateCount;
+            chunk.normalOffset = normalCount;
+            chunk.indexOffset = indexCount;
+            positionCount += chunk.positions.size();
+            textureCoordinateCount += chunk.textureCoordinates.size();
+            normalCount += chunk.normals.size();
+            indexCount += chunk.indices.size();
+            textureCoordinateIndexCount += chunk.textureCoordinateIndexCount;
+            normalIndexCount += chunk.normalIndexCount;
         }
+
+        /* Concatenate the chunks, making the negative indices relative to
+           the start of the mesh */
+        positions = Containers::Array<Vector3>{NoInit, positionCount};
+        textureCoordinates = Containers::Array<Vector2>{NoInit, textureCoordinateCount};
+        normals = Containers::Array<Vector3>{NoInit, normalCount};
+        indices = Containers::Array<Vector3ui>{NoInit, indexCount};
+        threadPool.parallelFor(chunkCount, 1, [&](const std::size_t begin, const std::size_t end) {
+            for(std::size_t i = begin; i != end; ++i) {
+                const Chunk& chunk = chunks[i];
+                Utility::copy(chunk.positions, positions.sliceSize(chunk.positionOffset, chunk.positions.size()));
+                Utility::copy(chunk.textureCoordinates, textureCoordinates.sliceSize(chunk.textureCoordinateOffset, chunk.textureCoordinates.size()));
+                Utility::copy(chunk.normals, normals.sliceSize(chunk.normalOffset, chunk.normals.size()));
+                const Containers::ArrayView<Vector3ui> chunkIndices = indices.sliceSize(chunk.indexOffset, chunk.indices.size());
+                Utility::copy(chunk.indices, chunkIndices);
+
+                const Vector3ui offsets{UnsignedInt(chunk.positionOffset), UnsignedInt(chunk.textureCoordinateOffset), UnsignedInt(chunk.normalOffset)};
+                const Containers::ArrayView<UnsignedInt> chunkIndexComponents = Containers::arrayCast<UnsignedInt>(chunkIndices);
+                for(const std::size_t j: chunk.relativeIndices)
+                    chunkIndexComponents[j] += offsets[j % 3];
+            }
+        });
     }
 
     /* There should be at least indexed position data */
@@ -565,11 +953,15 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
        any way. */
     Containers::Array<char> indexData;
     std::size_t vertexCount;
-    if(configuration().value<bool>("mergeIndexArrays")) {
-        indexData = Containers::Array<char>{NoInit, indices.size()*sizeof(UnsignedInt)};
+    if(mergeIndexArrays) {
+        indexData = allocator() ? allocator()->allocate(indices.size()*sizeof(UnsignedInt)) : Containers::Array<char>{NoInit, indices.size()*sizeof(UnsignedInt)};
         const auto indexDataI = Containers::arrayCast<UnsignedInt>(indexData);
-        vertexCount = MeshTools::removeDuplicatesInPlaceInto(
-            Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
+        Containers::Optional<std::size_t> uniqueCount;
+        if(mergeIndexArraysStrategy == "positionBuckets"_s)
+            uniqueCount = removeDuplicatesByPositionInPlaceInto(indices, positions.size(), indexDataI);
+        vertexCount = uniqueCount ? *uniqueCount :
+            MeshTools::removeDuplicatesInPlaceInto(
+                Containers::arrayCast<2, char>(arrayView(indices)), indexDataI);
 
     /* If merging was disabled, this behaves like if all index tuples were
        unique. No other change needed. */
@@ -587,7 +979,9 @@ Containers::Optional<MeshData> ObjImporter::doMesh(const UnsignedInt id, Unsigne
         stride += sizeof(Vector3);
     }
     Containers::Array<MeshAttributeData> attributeData{ValueInit, attributeCount};
-    Containers::Array<char> vertexData{NoInit, vertexCount*stride};
+    /* Allocating from the user-provided allocator directly, if set, to avoid
+       AbstractImporter copying the data there afterwards */
+    Containers::Array<char> vertexData = allocator() ? allocator()->allocate(vertexCount*stride) : Containers::Array<char>{NoInit, vertexCount*stride};
 
     /* Duplicate the vertices into the output */
     const auto indicesPerAttribute = Containers::arrayCast<2, const UnsignedInt>(stridedArrayView(indices)).transposed<0, 1>();
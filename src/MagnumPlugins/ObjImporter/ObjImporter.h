@@ -104,11 +104,22 @@ By default the per-attribute index arrays are merged into a single
 @ref MeshIndexType::UnsignedInt index buffer. If you disable the
 @cb{.ini} mergeIndexArrays @ce @ref Trade-ObjImporter-configuration "configuration option",
 the resulting mesh will be non-indexed, with the vertex data duplicated
-according to per-attribute index arrays.
+according to per-attribute index arrays. The merging is done by bucketing
+the index tuples by their position index, which doesn't need any hashing and
+produces the same output as @ref MeshTools::removeDuplicatesInPlace(). Set the
+@cb{.ini} mergeIndexArraysStrategy @ce option to @cb{.ini} hash @ce to use the
+hash-based approach instead.
 
 Optional fourth position coordinates are allowed if they're set to 1, optional
 third texture coordinate is allowed if it's set to 0.
 
+Numbers are parsed independently of the current C locale, i.e. a period is
+always the decimal separator. Floating-point values are correctly rounded.
+Common literals with at most 19 significant digits and a decimal exponent in
+the @f$ [-22, 22] @f$ range are parsed with a dedicated fast path. Special
+values such as infinity, NaN or hexadecimal float literals, extremely long
+literals and results in the denormal range go through @ref std::strtof().
+
 Negative indices (where -1 is the last position / texture coordinate / normal
 known at given point in the file, -2 is the second-to-last, etc.), produced for
 example by 3ds Max or [Mineways](http://mineways.com), are supported. Quads are
@@ -118,8 +129,29 @@ that mix points, lines and faces together are not supported.
 Files containing object name annotations (`o`) are split into multiple meshes,
 with the object name available through @ref meshName() / @ref meshForName().
 
+If @ref ThreadPool::globalThreadCount() is larger than @cpp 1 @ce, large meshes
+are split into chunks of lines that are parsed in parallel and then
+concatenated. The result is the same regardless of the thread count, including
+error messages.
+
 Material properties are currently not supported.
 
+@section Trade-ObjImporter-map-file Memory-mapped import of large files
+
+With the @cb{.ini} mapFile @ce @ref Trade-ObjImporter-configuration "configuration option"
+enabled, files opened with @ref openFile() are memory-mapped using
+@ref Corrade::Utility::Path::mapRead() instead of being read into memory, and
+the data are paged in by the operating system only while individual meshes get
+parsed. The option has no effect on @ref openData() and on files opened through
+@ref Trade-AbstractImporter-usage-callbacks "file callbacks", where the data
+are provided by the callback. On platforms without memory mapping support the
+file is read into memory as usual.
+
+The option only avoids keeping a copy of the whole file in memory. Each mesh
+is still imported whole, so the memory needed to import it is proportional to
+the size of its part of the file, and a file consisting of a single huge
+object needs as much memory for the imported mesh as without the option.
+
 @section Trade-ObjImporter-configuration Plugin-specific configuration
 
 It's possible to tune various import options through @ref configuration(). See
@@ -153,6 +185,7 @@ class MAGNUM_OBJIMPORTER_EXPORT ObjImporter: public AbstractImporter {
         MAGNUM_OBJIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
 
         MAGNUM_OBJIMPORTER_LOCAL bool doIsOpened() const override;
+        MAGNUM_OBJIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
         MAGNUM_OBJIMPORTER_LOCAL void doOpenData(Containers::Array<char>&& data, DataFlags dataFlags) override;
         MAGNUM_OBJIMPORTER_LOCAL void doClose() override;
 
@@ -0,0 +1,165 @@
+/*
+    This file is part of Magnum.
+
+    Copyright © 2010, 2011, 2012, 2013, 2014, 2015, 2016, 2017, 2018, 2019,
+                2020, 2021, 2022, 2023, 2024, 2025, 2026
+              Vladimír Vondruš <mosra@centrum.cz>
+
+    Permission is hereby granted, free of charge, to any person obtaining a
+    copy of this software and associated documentation files (the "Software"),
+    to deal in the Software without restriction, including without limitation
+    the rights to use, copy, modify, merge, publish, distribute, sublicense,
+    and/or sell copies of the Software, and to permit persons to whom the
+    Software is furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included
+    in all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+    THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+    FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+    DEALINGS IN THE SOFTWARE.
+
+#include <chrono>
+#include <Corrade/Containers/GrowableArray.h>
+#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
+#include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
+#include <Corrade/PluginManager/Manager.h>
+#include <Corrade/TestSuite/Tester.h>
+#include <Corrade/Utility/ConfigurationGroup.h>
+#include <Corrade/Utility/Format.h>
+
+#include "Magnum/Math/Functions.h"
+#include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/MeshData.h"
+
+#include "configure.h"
+
+namespace Magnum { namespace Trade { namespace Test { namespace {
+
+struct ObjImporterBenchmark: TestSuite::Tester {
+    explicit ObjImporterBenchmark();
+
+    void mesh();
+    void meshHashMergeStrategy();
+
+    void throughputBegin();
+    std::uint64_t throughputEnd();
+
+    private:
+        void benchmarkMesh(Containers::StringView mergeIndexArraysStrategy);
+
+        PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
+        std::chrono::high_resolution_clock::time_point _throughputBegin;
+        std::size_t _throughputBytes{};
+        Containers::Array<char> _files[3];
+};
+
+const struct {
+    const char* name;
+    bool textureCoordinates, normals;
+} MeshBenchmarkData[]{
+    {"positions", false, false},
+    {"positions, texture coordinates", true, false},
+    {"positions, texture coordinates, normals", true, true},
+};
+
+/* A grid of vertices with pseudorandom coordinates, printed with six decimal
+   places like most exporters do, and two triangles per grid cell. With
+   everything enabled that's roughly 30 MB of text. */
+constexpr Int GridSize = 384;
+
+Containers::Array<char> generateFile(const bool textureCoordinates, const bool normals) {
+    Containers::Array<char> file;
+    UnsignedInt seed = 1;
+    const auto random = [&seed]() -> Float {
+        seed = seed*1664525u + 1013904223u;
+        return Float(seed >> 8)/Float(1 << 24);
+    };
+    for(Int y = 0; y != GridSize; ++y) for(Int x = 0; x != GridSize; ++x)
+        arrayAppend(file, Utility::format("v {:.6f} {:.6f} {:.6f}\n", x + random() - 0.5f, y + random() - 0.5f, random()*10.0f - 5.0f));
+    if(textureCoordinates)
+        for(Int y = 0; y != GridSize; ++y) for(Int x = 0; x != GridSize; ++x)
+            arrayAppend(file, Utility::format("vt {:.6f} {:.6f}\n", Float(x)/GridSize, Float(y)/GridSize));
+    if(normals)
+        for(Int i = 0; i != GridSize*GridSize; ++i)
+            arrayAppend(file, Utility::format("vn {:.6f} {:.6f} {:.6f}\n", random() - 0.5f, random() - 0.5f, 1.0f));
+    for(Int y = 0; y != GridSize - 1; ++y) for(Int x = 0; x != GridSize - 1; ++x) {
+        const Int a = y*GridSize + x + 1;
+        const Int b = a + 1;
+        const Int c = a + GridSize;
+        const Int d = c + 1;
+        if(textureCoordinates && normals)
+            arrayAppend(file, Utility::format("f {0}/{0}/{0} {1}/{1}/{1} {2}/{2}/{2}\nf {1}/{1}/{1} {3}/{3}/{3} {2}/{2}/{2}\n", a, b, c, d));
+        else if(textureCoordinates)
+            arrayAppend(file, Utility::format("f {0}/{0} {1}/{1} {2}/{2}\nf {1}/{1} {3}/{3} {2}/{2}\n", a, b, c, d));
+        else
+            arrayAppend(file, Utility::format("f {0} {1} {2}\nf {1} {3} {2}\n", a, b, c, d));
+    }
+
+    return file;
+}
+
+ObjImporterBenchmark::ObjImporterBenchmark() {
+    /* The benchmark reports bytes per second, which makes the numbers
+       comparable across different files */
+    addCustomInstancedBenchmarks({&ObjImporterBenchmark::mesh,
+                                  &ObjImporterBenchmark::meshHashMergeStrategy}, 5,
+        Containers::arraySize(MeshBenchmarkData),
+        &ObjImporterBenchmark::throughputBegin,
+        &ObjImporterBenchmark::throughputEnd,
+        BenchmarkUnits::Bytes);
+
+    for(std::size_t i = 0; i != Containers::arraySize(MeshBenchmarkData); ++i)
+        _files[i] = generateFile(MeshBenchmarkData[i].textureCoordinates, MeshBenchmarkData[i].normals);
+
+    #ifdef OBJIMPORTER_PLUGIN_FILENAME
+    CORRADE_INTERNAL_ASSERT_OUTPUT(_manager.load(OBJIMPORTER_PLUGIN_FILENAME) & PluginManager::LoadState::Loaded);
+    #endif
+}
+
+void ObjImporterBenchmark::throughputBegin() {
+    _throughputBegin = std::chrono::high_resolution_clock::now();
+}
+
+std::uint64_t ObjImporterBenchmark::throughputEnd() {
+    const std::uint64_t duration = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - _throughputBegin).count();
+    return _throughputBytes*1000000000ull/Math::max(duration, std::uint64_t{1});
+}
+
+void ObjImporterBenchmark::mesh() {
+    benchmarkMesh("positionBuckets");
+}
+
+void ObjImporterBenchmark::meshHashMergeStrategy() {
+    benchmarkMesh("hash");
+}
+
+void ObjImporterBenchmark::benchmarkMesh(const Containers::StringView mergeIndexArraysStrategy) {
+    auto&& data = MeshBenchmarkData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    const Containers::Array<char>& file = _files[testCaseInstanceId()];
+    _throughputBytes = file.size();
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("mergeIndexArraysStrategy", mergeIndexArraysStrategy);
+    CORRADE_VERIFY(importer->openData(file));
+
+    Containers::Optional<MeshData> mesh;
+    CORRADE_BENCHMARK(1)
+        mesh = importer->mesh(0);
+
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->vertexCount(), UnsignedInt(GridSize*GridSize));
+    CORRADE_COMPARE(mesh->indexCount(), UnsignedInt((GridSize - 1)*(GridSize - 1)*6));
+}
+
+}}}}
+
+CORRADE_TEST_MAIN(Magnum::Trade::Test::ObjImporterBenchmark)
@@ -24,8 +24,10 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <Corrade/Containers/GrowableArray.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
+#include <Corrade/Containers/StringView.h>
 #include <Corrade/TestSuite/Tester.h>
 #include <Corrade/TestSuite/Compare/Container.h>
 #include <Corrade/Utility/ConfigurationGroup.h>
@@ -34,6 +36,7 @@
 
 #include "Magnum/Mesh.h"
 #include "Magnum/Math/Vector3.h"
+#include "Magnum/ThreadPool.h"
 #include "Magnum/Trade/AbstractImporter.h"
 #include "Magnum/Trade/MeshData.h"
 
@@ -58,7 +61,10 @@ struct ObjImporterTest: TestSuite::Tester {
     void meshTextureCoordinatesNormals();
 
     void meshNoMergeIndexArrays();
+    void meshMergeIndexArraysStrategy();
+    void meshMergeIndexArraysStrategyInvalid();
     void meshNegativeIndices();
+    void meshNegativeIndicesMultipleMeshes();
     void meshQuads();
 
     void meshIgnoredKeyword();
@@ -82,6 +88,12 @@ struct ObjImporterTest: TestSuite::Tester {
     void invalidOptionalCoordinate();
 
     void whitespace();
+    void numberFormats();
+
+    void parallel();
+    void parallelInvalid();
+
+    void mapFile();
 
     void openTwice();
     void importTwice();
@@ -132,7 +144,10 @@ const struct {
     {"position index out of range", "index 3 out of range for 1 vertices"},
     {"texture index out of range", "index 4 out of range for 3 vertices"},
     {"normal index out of range", "index 3 out of range for 2 vertices"},
-    {"zero index", "index 0 out of range for 1 vertices"}
+    {"zero index", "index 0 out of range for 1 vertices"},
+    {"incomplete float exponent", "invalid floating-point literal 1e"},
+    {"locale-specific decimal separator", "invalid floating-point literal 1,5"},
+    {"integer literal with a decimal point", "invalid integer literal 1.0"}
 };
 
 const struct {
@@ -188,6 +203,44 @@ const struct {
     {"texture with optional third component not zero", "3D texture coordinates are not supported"}
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+} MeshMergeIndexArraysStrategyData[]{
+    {"positions only", "mesh-primitive-triangles.obj"},
+    {"all attributes", "mesh-texture-coordinates-normals.obj"},
+    {"quads", "mesh-quads.obj"},
+    {"negative indices", "mesh-negative-indices.obj"},
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+} ParallelData[]{
+    {"single thread", 1},
+    {"four threads", 4}
+};
+
+const struct {
+    const char* name;
+    UnsignedInt threadCount;
+    const char* secondHalf;
+    const char* message;
+} ParallelInvalidData[]{
+    {"mixed primitive, single thread", 1,
+        "l 1 2\n",
+        "mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Lines"},
+    {"mixed primitive, four threads", 4,
+        "l 1 2\n",
+        "mixed primitive MeshPrimitive::Triangles and MeshPrimitive::Lines"},
+    {"invalid number, single thread", 1,
+        "v 1 bleh 2\n",
+        "invalid floating-point literal bleh"},
+    {"invalid number, four threads", 4,
+        "v 1 bleh 2\n",
+        "invalid floating-point literal bleh"},
+};
+
 ObjImporterTest::ObjImporterTest() {
     addTests({&ObjImporterTest::empty,
 
@@ -201,8 +254,14 @@ ObjImporterTest::ObjImporterTest() {
               &ObjImporterTest::meshNormals,
               &ObjImporterTest::meshTextureCoordinatesNormals,
 
-              &ObjImporterTest::meshNoMergeIndexArrays,
+              &ObjImporterTest::meshNoMergeIndexArrays});
+
+    addInstancedTests({&ObjImporterTest::meshMergeIndexArraysStrategy},
+        Containers::arraySize(MeshMergeIndexArraysStrategyData));
+
+    addTests({&ObjImporterTest::meshMergeIndexArraysStrategyInvalid,
               &ObjImporterTest::meshNegativeIndices,
+              &ObjImporterTest::meshNegativeIndicesMultipleMeshes,
               &ObjImporterTest::meshQuads,
 
               &ObjImporterTest::meshIgnoredKeyword,
@@ -236,6 +295,15 @@ ObjImporterTest::ObjImporterTest() {
         Containers::arraySize(InvalidOptionalCoordinateData));
 
     addTests({&ObjImporterTest::whitespace,
+              &ObjImporterTest::numberFormats});
+
+    addInstancedTests({&ObjImporterTest::parallel},
+        Containers::arraySize(ParallelData));
+
+    addInstancedTests({&ObjImporterTest::parallelInvalid},
+        Containers::arraySize(ParallelInvalidData));
+
+    addTests({&ObjImporterTest::mapFile,
 
               &ObjImporterTest::openTwice,
               &ObjImporterTest::importTwice});
@@ -507,6 +575,44 @@ void ObjImporterTest::meshNoMergeIndexArrays() {
         }), TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshMergeIndexArraysStrategy() {
+    auto&& data = MeshMergeIndexArraysStrategyData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* The hash-based strategy is tested by all other cases already, here
+       just verify that the other produces the exact same output */
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, data.filename)));
+
+    importer->configuration().setValue("mergeIndexArraysStrategy", "hash");
+    const Containers::Optional<MeshData> expected = importer->mesh(0);
+    CORRADE_VERIFY(expected);
+
+    importer->configuration().setValue("mergeIndexArraysStrategy", "positionBuckets");
+    const Containers::Optional<MeshData> actual = importer->mesh(0);
+    CORRADE_VERIFY(actual);
+
+    CORRADE_COMPARE(actual->vertexCount(), expected->vertexCount());
+    CORRADE_COMPARE_AS(actual->indices<UnsignedInt>(),
+        expected->indices<UnsignedInt>(),
+        TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(actual->vertexData(),
+        expected->vertexData(),
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::meshMergeIndexArraysStrategyInvalid() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-primitive-triangles.obj")));
+
+    importer->configuration().setValue("mergeIndexArraysStrategy", "sort");
+
+    Containers::String out;
+    Error redirectError{&out};
+    CORRADE_VERIFY(!importer->mesh(0));
+    CORRADE_COMPARE(out, "Trade::ObjImporter::mesh(): expected mergeIndexArraysStrategy to be positionBuckets or hash but got sort\n");
+}
+
 void ObjImporterTest::meshNegativeIndices() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-negative-indices.obj")));
@@ -563,6 +669,37 @@ void ObjImporterTest::meshNegativeIndices() {
         }), TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::meshNegativeIndicesMultipleMeshes() {
+    /* Negative indices count from the last vertex in the whole file, which
+       has to be taken into account in meshes other than the first */
+    Containers::StringView data =
+        "o first\n"
+        "v 1 2 3\n"
+        "p -1\n"
+        "o second\n"
+        "v 4 5 6\n"
+        "v 7 8 9\n"
+        "p -2\n"
+        "p -1\n"
+        "p 2\n";
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(data));
+    CORRADE_COMPARE(importer->meshCount(), 2);
+
+    Containers::Optional<MeshData> mesh = importer->mesh("second");
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {4.0f, 5.0f, 6.0f},
+            {7.0f, 8.0f, 9.0f}
+        }), TestSuite::Compare::Container);
+    CORRADE_COMPARE_AS(mesh->indices<UnsignedInt>(),
+        Containers::arrayView<UnsignedInt>({
+            0, 1, 0
+        }), TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::meshQuads() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
     CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-quads.obj")));
@@ -904,6 +1041,134 @@ void ObjImporterTest::whitespace() {
         TestSuite::Compare::Container);
 }
 
+void ObjImporterTest::numberFormats() {
+    /* Covers both the fast path and the strtof() fallback */
+    Containers::StringView data =
+        "v 0.1 -2.5e3 1E-2\n"
+        "v .5 5. +1.5\n"
+        /* Eight and more digits go through the multi-digit path */
+        "v 0.12345678 -1234567890.5 3.40282347e38\n"
+        /* More than 19 significant digits or an exponent outside of
+           [-22, 22] */
+        "v 0.1000000000000000000001 1e-30 -7e25\n"
+        "vt -0 0.000000\n"
+        "p 1/1\n"
+        "p +2/-1\n"
+        "p 3/1\n"
+        "p -1/1\n";
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(data));
+
+    /* Disabling index merging to have the positions in file order */
+    importer->configuration().setValue("mergeIndexArrays", false);
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.1f, -2500.0f, 0.01f},
+            {0.5f, 5.0f, 1.5f},
+            {0.12345678f, -1234567890.5f, 3.40282347e38f},
+            {0.1f, 1e-30f, -7e25f}
+        }), TestSuite::Compare::Container);
+}
+
+/* About 1.5 MB of data, which is enough for the mesh to get split into
+   several chunks if more than one thread is used */
+constexpr UnsignedInt ParallelBlockCount = 32768;
+
+Containers::Array<char> parallelFileData() {
+    /* Blocks of three positions and a triangle referencing them, alternating
+       between negative and positive indices to verify both get offset
+       correctly when concatenating the chunks */
+    Containers::Array<char> out;
+    for(UnsignedInt i = 0; i != ParallelBlockCount; ++i) {
+        arrayAppend(out, Utility::format("v {0} 0 0\nv {0} 1 0\nv {0} 2 0\n", i));
+        if(i % 2)
+            arrayAppend(out, Utility::format("f {} {} {}\n", i*3 + 1, i*3 + 2, i*3 + 3));
+        else
+            arrayAppend(out, Containers::StringView{"f -3 -2 -1\n"});
+    }
+    return out;
+}
+
+void ObjImporterTest::parallel() {
+    auto&& data = ParallelData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    /* Disabling index merging to have the positions in file order */
+    importer->configuration().setValue("mergeIndexArrays", false);
+    CORRADE_VERIFY(importer->openData(parallelFileData()));
+
+    ThreadPool::setGlobalThreadCount(data.threadCount);
+    const Containers::Optional<MeshData> mesh = importer->mesh(0);
+    ThreadPool::setGlobalThreadCount(1);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+
+    Containers::Array<Vector3> expected;
+    for(UnsignedInt i = 0; i != ParallelBlockCount; ++i)
+        arrayAppend(expected, {
+            {Float(i), 0.0f, 0.0f},
+            {Float(i), 1.0f, 0.0f},
+            {Float(i), 2.0f, 0.0f}
+        });
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        expected,
+        TestSuite::Compare::Container);
+}
+
+void ObjImporterTest::parallelInvalid() {
+    auto&& data = ParallelInvalidData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    /* Put enough invalid lines after the valid data that at least one chunk
+       contains only those, to verify errors spanning chunk boundaries as
+       well */
+    Containers::Array<char> fileData = parallelFileData();
+    for(UnsignedInt i = 0; i != ParallelBlockCount*4; ++i)
+        arrayAppend(fileData, Containers::StringView{data.secondHalf});
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    CORRADE_VERIFY(importer->openData(fileData));
+
+    ThreadPool::setGlobalThreadCount(data.threadCount);
+    Containers::Optional<MeshData> mesh;
+    Containers::String out;
+    {
+        Error redirectError{&out};
+        mesh = importer->mesh(0);
+    }
+    ThreadPool::setGlobalThreadCount(1);
+    CORRADE_VERIFY(!mesh);
+    CORRADE_COMPARE(out, Utility::format("Trade::ObjImporter::mesh(): {}\n", data.message));
+}
+
+void ObjImporterTest::mapFile() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
+    importer->configuration().setValue("mapFile", true);
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(OBJIMPORTER_TEST_DIR, "mesh-multiple.obj")));
+
+    /* Same as in moreMeshes() */
+    CORRADE_COMPARE(importer->meshCount(), 3);
+    CORRADE_COMPARE(importer->meshName(0), "PointMesh");
+    CORRADE_COMPARE(importer->meshName(1), "LineMesh");
+    CORRADE_COMPARE(importer->meshName(2), "TriangleMesh");
+    CORRADE_COMPARE(importer->meshForName("TriangleMesh"), 2);
+
+    const Containers::Optional<MeshData> mesh = importer->mesh(2);
+    CORRADE_VERIFY(mesh);
+    CORRADE_COMPARE(mesh->primitive(), MeshPrimitive::Triangles);
+    CORRADE_COMPARE_AS(mesh->attribute<Vector3>(MeshAttribute::Position),
+        Containers::arrayView<Vector3>({
+            {0.5f, 2.0f, 3.0f},
+            {0.0f, 1.5f, 1.0f},
+            {2.0f, 3.0f, 5.5f}
+        }), TestSuite::Compare::Container);
+}
+
 void ObjImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("ObjImporter");
 
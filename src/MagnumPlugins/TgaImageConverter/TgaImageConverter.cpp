@@ -145,6 +145,17 @@ template<class T> void rleEncode(Containers::Array<char>& data, const ImageView2
                 count = 1;
             }
 
+            /* Skip over all following pixels that are the same, up to the end
+               of the row or the maximum repeat count. Compares the original
+               unswizzled values, so it's just a tight loop without any of the
+               above state handling. The increment below then accounts for the
+               current pixel, making the count at most 128 again. */
+            const T original = currentRow[x];
+            while(count + 1 < 128 && x + 1 < currentRow.size() && currentRow[x + 1] == original) {
+                ++count;
+                ++x;
+            }
+
         /* Otherwise, if the current pixel is different from the previous,
            count towards a sequence run */
         } else {
@@ -298,10 +309,8 @@ Containers::Optional<Containers::Array<char>> TgaImageConverter::doConvertToData
         if(image.format() == PixelFormat::RGB8Unorm) {
             for(Vector3ub& pixel: Containers::arrayCast<Vector3ub>(pixels))
                 pixel = Math::gather<'b', 'g', 'r'>(pixel);
-        } else if(image.format() == PixelFormat::RGBA8Unorm) {
-            for(Vector4ub& pixel: Containers::arrayCast<Vector4ub>(pixels))
-                pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
-        }
+        } else if(image.format() == PixelFormat::RGBA8Unorm)
+            Implementation::swizzleRedBlue32(pixels);
     }
 
     /* If we started with a RLE-encoded file, turn the array back into a
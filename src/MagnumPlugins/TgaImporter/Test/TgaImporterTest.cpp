@@ -33,7 +33,9 @@
 #include <Corrade/Utility/Path.h>
 
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Color.h"
 #include "Magnum/Trade/AbstractImporter.h"
+#include "Magnum/Trade/ArenaAllocator.h"
 #include "Magnum/Trade/ImageData.h"
 
 #include "configure.h"
@@ -52,6 +54,7 @@ struct TgaImporterTest: TestSuite::Tester {
     void color24Rle();
     void color32();
     void color32Rle();
+    void color32RleLongRuns();
     void grayscale8();
     void grayscale8Rle();
 
@@ -59,9 +62,12 @@ struct TgaImporterTest: TestSuite::Tester {
     void fileTooLong();
 
     void openMemory();
+    void openMemoryGrayscale();
     void openTwice();
     void importTwice();
 
+    void allocator();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
@@ -255,15 +261,16 @@ const struct {
 const struct {
     const char* name;
     bool(*open)(AbstractImporter&, Containers::ArrayView<const void>);
+    bool externallyOwned;
 } OpenMemoryData[]{
     {"data", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
         /* Copy to ensure the original memory isn't referenced */
         Containers::Array<char> copy{InPlaceInit, Containers::arrayCast<const char>(data)};
         return importer.openData(copy);
-    }},
+    }, false},
     {"memory", [](AbstractImporter& importer, Containers::ArrayView<const void> data) {
         return importer.openMemory(data);
-    }},
+    }, true},
 };
 
 TgaImporterTest::TgaImporterTest() {
@@ -285,7 +292,8 @@ TgaImporterTest::TgaImporterTest() {
         &TgaImporterTest::color32Rle},
         Containers::arraySize(VerboseData));
 
-    addTests({&TgaImporterTest::grayscale8,
+    addTests({&TgaImporterTest::color32RleLongRuns,
+              &TgaImporterTest::grayscale8,
               &TgaImporterTest::grayscale8Rle});
 
     addInstancedTests({&TgaImporterTest::tga2},
@@ -294,11 +302,14 @@ TgaImporterTest::TgaImporterTest() {
     addInstancedTests({&TgaImporterTest::fileTooLong},
         Containers::arraySize(FileTooLongData));
 
-    addInstancedTests({&TgaImporterTest::openMemory},
+    addInstancedTests({&TgaImporterTest::openMemory,
+                       &TgaImporterTest::openMemoryGrayscale},
         Containers::arraySize(OpenMemoryData));
 
     addTests({&TgaImporterTest::openTwice,
-              &TgaImporterTest::importTwice});
+              &TgaImporterTest::importTwice,
+
+              &TgaImporterTest::allocator});
 
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
@@ -486,6 +497,36 @@ void TgaImporterTest::color32Rle() {
     CORRADE_COMPARE(out, data.message32);
 }
 
+void TgaImporterTest::color32RleLongRuns() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    const char input[] = {
+        0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 67, 0, 2, 0, 32, 0,
+        /* 1 pixel 128x repeated, the max that a single packet can do */
+        '\xff', 1, 2, 3, 4,
+        /* 1 pixel 5x repeated, not a power of two */
+        '\x84', 5, 6, 7, 8,
+        /* 1 pixel as-is */
+        '\x00', 9, 10, 11, 12
+    };
+    CORRADE_VERIFY(importer->openData(input));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->format(), PixelFormat::RGBA8Unorm);
+    CORRADE_COMPARE(image->size(), (Vector2i{67, 2}));
+
+    Containers::ArrayView<const Color4ub> pixels = Containers::arrayCast<const Color4ub>(image->data());
+    for(std::size_t i = 0; i != 128; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(pixels[i], (Color4ub{3, 2, 1, 4}));
+    }
+    for(std::size_t i = 128; i != 133; ++i) {
+        CORRADE_ITERATION(i);
+        CORRADE_COMPARE(pixels[i], (Color4ub{7, 6, 5, 8}));
+    }
+    CORRADE_COMPARE(pixels[133], (Color4ub{11, 10, 9, 12}));
+}
+
 void TgaImporterTest::grayscale8() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
     CORRADE_VERIFY(importer->openData(Grayscale8));
@@ -603,6 +644,34 @@ void TgaImporterTest::openMemory() {
     }), TestSuite::Compare::Container);
 }
 
+void TgaImporterTest::openMemoryGrayscale() {
+    /* same as grayscale8() except that it uses openData() & openMemory() to
+       test that the data are referenced directly if possible */
+
+    auto&& data = OpenMemoryData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+    CORRADE_VERIFY(data.open(*importer, Containers::arrayView(Grayscale8)));
+
+    Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+    CORRADE_VERIFY(image);
+    CORRADE_COMPARE(image->storage().alignment(), 1);
+    CORRADE_COMPARE(image->format(), PixelFormat::R8Unorm);
+    CORRADE_COMPARE(image->size(), Vector2i(2, 3));
+    CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+        1, 2,
+        3, 4,
+        5, 6
+    }), TestSuite::Compare::Container);
+    if(data.externallyOwned) {
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::ExternallyOwned);
+        CORRADE_COMPARE(static_cast<const void*>(image->data().data()), static_cast<const void*>(Grayscale8 + 18));
+    } else {
+        CORRADE_COMPARE(image->dataFlags(), DataFlag::Owned|DataFlag::Mutable);
+    }
+}
+
 void TgaImporterTest::openTwice() {
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
 
@@ -628,6 +697,40 @@ void TgaImporterTest::importTwice() {
     }
 }
 
+void TgaImporterTest::allocator() {
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("TgaImporter");
+
+    ArenaAllocator allocator;
+    importer->setAllocator(&allocator);
+
+    /* Both the plain copy and the RLE decoding path should allocate from the
+       allocator directly */
+    {
+        CORRADE_VERIFY(importer->openData(Color24));
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(allocator.allocationCount(), 1);
+        CORRADE_COMPARE(allocator.allocatedSize(), 18);
+        CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+            3, 2, 1, 4, 3, 2,
+            5, 4, 3, 6, 5, 4,
+            7, 6, 5, 8, 7, 6
+        }), TestSuite::Compare::Container);
+        CORRADE_VERIFY(image->release().deleter() == AbstractAllocator::deleter);
+    } {
+        CORRADE_VERIFY(importer->openData(Color24Rle));
+        Containers::Optional<Trade::ImageData2D> image = importer->image2D(0);
+        CORRADE_VERIFY(image);
+        CORRADE_COMPARE(allocator.allocationCount(), 2);
+        CORRADE_COMPARE_AS(image->data(), Containers::arrayView<char>({
+            3, 2, 1, 4, 3, 2,
+            5, 4, 3, 6, 5, 4,
+            6, 5, 4, 6, 5, 4
+        }), TestSuite::Compare::Container);
+    }
+    CORRADE_COMPARE(allocator.liveAllocationCount(), 0);
+}
+
 }}}}
 
 CORRADE_TEST_MAIN(Magnum::Trade::Test::TgaImporterTest)
@@ -26,6 +26,9 @@
     DEALINGS IN THE SOFTWARE.
 */
 
+#include <cstring>
+#include <Corrade/Containers/ArrayView.h>
+
 #include "Magnum/Types.h"
 
 /* Used by both TgaImporter and TgaImageConverter, which is why it isn't
@@ -62,6 +65,27 @@ struct TgaFooter {
 
 static_assert(sizeof(TgaHeader) == 18, "TgaHeader size is not 18 bytes");
 
+/* Converts four-byte BGRA pixels to RGBA and vice versa. Operates on whole
+   32-bit words instead of gathering individual bytes, which compilers can
+   turn into vector code. The memcpy() is there because the data don't need to
+   be four-byte aligned, which is the case in the converter as the 18-byte
+   header is directly followed by the pixel data. */
+inline void swizzleRedBlue32(const Containers::ArrayView<char> data) {
+    char* const begin = data.data();
+    for(std::size_t i = 0, size = data.size() & ~std::size_t{3}; i != size; i += 4) {
+        UnsignedInt pixel;
+        std::memcpy(&pixel, begin + i, 4);
+        /* Swapping the first and third byte, which are the lowest and
+           second-highest on Little-Endian and vice versa */
+        #ifndef CORRADE_TARGET_BIG_ENDIAN
+        pixel = (pixel & 0xff00ff00u)|((pixel >> 16) & 0x000000ffu)|((pixel & 0x000000ffu) << 16);
+        #else
+        pixel = (pixel & 0x00ff00ffu)|((pixel >> 16) & 0x0000ff00u)|((pixel & 0x0000ff00u) << 16);
+        #endif
+        std::memcpy(begin + i, &pixel, 4);
+    }
+}
+
 }}}
 
 #endif
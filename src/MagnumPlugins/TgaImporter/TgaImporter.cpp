@@ -26,6 +26,7 @@
 
 #include "TgaImporter.h"
 
+#include <cstring>
 #include <Corrade/Containers/ArrayView.h>
 #include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/StringView.h>
@@ -33,8 +34,10 @@
 #include <Corrade/Utility/Endianness.h>
 
 #include "Magnum/PixelFormat.h"
+#include "Magnum/Math/Functions.h"
 #include "Magnum/Math/Swizzle.h"
 #include "Magnum/Math/Vector4.h"
+#include "Magnum/Trade/AbstractAllocator.h"
 #include "Magnum/Trade/ImageData.h"
 #include "MagnumPlugins/TgaImporter/TgaHeader.h"
 
@@ -54,7 +57,10 @@ ImporterFeatures TgaImporter::doFeatures() const { return ImporterFeature::OpenD
 
 bool TgaImporter::doIsOpened() const { return !!_in; }
 
-void TgaImporter::doClose() { _in = nullptr; }
+void TgaImporter::doClose() {
+    _in = nullptr;
+    _inExternallyOwned = false;
+}
 
 void TgaImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dataFlags) {
     /* Because here we're copying the data and using the _in to check if file
@@ -69,11 +75,16 @@ void TgaImporter::doOpenData(Containers::Array<char>&& data, const DataFlags dat
         return;
     }
 
-    /* Ttake over the existing array or copy the data if we can't */
-    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned))
+    /* Ttake over the existing array or copy the data if we can't. Remember
+       whether the memory is externally owned, in which case uncompressed
+       images that don't need any conversion can reference it directly. */
+    if(dataFlags & (DataFlag::Owned|DataFlag::ExternallyOwned)) {
         _in = Utility::move(data);
-    else
+        _inExternallyOwned = !!(dataFlags & DataFlag::ExternallyOwned);
+    } else {
         _in = Containers::Array<char>{InPlaceInit, data};
+        _inExternallyOwned = false;
+    }
 }
 
 UnsignedInt TgaImporter::doImage2DCount() const { return 1; }
@@ -182,8 +193,13 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
         }
     }
 
+    /* Adjust pixel storage if row size is not four byte aligned */
+    PixelStorage storage;
+    if((size.x()*header.bpp/8)%4 != 0)
+        storage.setAlignment(1);
+
     /* Copy data directly if not RLE */
-    Containers::Array<char> data{NoInit, outputSize};
+    Containers::Array<char> data;
     if(!rle) {
         if(srcPixels.size() < outputSize) {
             Error{} << "Trade::TgaImporter::image2D(): file too short, expected" << outputSize + sizeof(Implementation::TgaHeader) << "bytes but got" << _in.size();
@@ -197,10 +213,19 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
             Warning{} << "Trade::TgaImporter::image2D(): ignoring" << srcPixels.size() - outputSize << "extra bytes at the end of image data";
         }
 
-        Utility::copy(srcPixels.prefix(data.size()), data);
+        /* If the memory is externally owned and the data don't need any
+           swizzling, reference them directly. The rows are stored bottom-up
+           in TGA, which matches the image orientation used in Magnum, and
+           the alignment is handled by the pixel storage above. */
+        if(_inExternallyOwned && format == PixelFormat::R8Unorm)
+            return ImageData2D{storage, format, size, DataFlag::ExternallyOwned, srcPixels.prefix(outputSize)};
+
+        data = allocator() ? allocator()->allocate(outputSize) : Containers::Array<char>{NoInit, outputSize};
+        Utility::copy(srcPixels.prefix(outputSize), data);
 
     /* Otherwise decode */
     } else {
+        data = allocator() ? allocator()->allocate(outputSize) : Containers::Array<char>{NoInit, outputSize};
         Containers::ArrayView<char> dstPixels = data;
         while(!srcPixels.isEmpty()) {
             /* Reference: https://paulbourke.net/dataformats/tga/ */
@@ -212,9 +237,8 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
 
             /* First bit set to 1 means copying the following pixel given
                number of times, 0 means copying the following number of
-               pixels once. We represent that operation with a stride. */
+               pixels once */
             const std::size_t dataSize = (rleHeader & 0x80 ? 1 : count)*pixelSize;
-            const std::ptrdiff_t stride = rleHeader & 0x80 ? 0 : pixelSize;
 
             /* Check bounds */
             if(1 + dataSize > srcPixels.size()) {
@@ -226,14 +250,18 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
                 return {};
             }
 
-            /* Copy the data */
-            Containers::StridedArrayView2D<const char> src{
-                srcPixels.slice(1, 1 + dataSize),
-                {count, pixelSize}, {stride, 1}};
-            Containers::StridedArrayView2D<char> dst{
-                dstPixels.prefix(count*pixelSize),
-                {count, pixelSize}};
-            Utility::copy(src, dst);
+            /* Copy the data. For a repeat run, copy the pixel once and then
+               fill the rest by repeatedly doubling the already written
+               prefix, which needs just log2(count) copies instead of one
+               for each pixel. */
+            char* const dst = dstPixels.data();
+            const char* const src = srcPixels.data() + 1;
+            if(rleHeader & 0x80) {
+                const std::size_t runSize = count*pixelSize;
+                std::memcpy(dst, src, pixelSize);
+                for(std::size_t filled = pixelSize; filled < runSize; filled *= 2)
+                    std::memcpy(dst + filled, dst, Math::min(filled, runSize - filled));
+            } else std::memcpy(dst, src, dataSize);
 
             /* Update views for the next round */
             srcPixels = srcPixels.exceptPrefix(1 + dataSize);
@@ -241,11 +269,6 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
         }
     }
 
-    /* Adjust pixel storage if row size is not four byte aligned */
-    PixelStorage storage;
-    if((size.x()*header.bpp/8)%4 != 0)
-        storage.setAlignment(1);
-
     if(format == PixelFormat::RGB8Unorm) {
         if(flags() & ImporterFlag::Verbose)
             Debug{} << "Trade::TgaImporter::image2D(): converting from BGR to RGB";
@@ -254,8 +277,7 @@ Containers::Optional<ImageData2D> TgaImporter::doImage2D(UnsignedInt, UnsignedIn
     } else if(format == PixelFormat::RGBA8Unorm) {
         if(flags() & ImporterFlag::Verbose)
             Debug{} << "Trade::TgaImporter::image2D(): converting from BGRA to RGBA";
-        for(Vector4ub& pixel: Containers::arrayCast<Vector4ub>(data))
-            pixel = Math::gather<'b', 'g', 'r', 'a'>(pixel);
+        Implementation::swizzleRedBlue32(data);
     }
 
     return ImageData2D{storage, format, size, Utility::move(data)};
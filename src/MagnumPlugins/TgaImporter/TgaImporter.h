@@ -107,6 +107,15 @@ which may be changed to `1` if the data require it.
 
 RLE compression is supported, paletted images are not.
 
+When the file is opened with @ref openMemory(), for example with a file
+memory-mapped using @ref Corrade::Utility::Path::mapRead(), uncompressed
+grayscale images reference the passed memory directly and have
+@ref DataFlag::ExternallyOwned set. It's the user responsibility to keep the
+memory alive for as long as the imported data are in use. Color images are
+always copied as the BGR(A) channel order stored in the file has to be swizzled
+to RGB(A), and so are RLE-compressed images. When opened with @ref openData()
+or @ref openFile(), the data are copied into an owned array on import.
+
 If a TGA 2 footer is recognized in the file, the optional extension and
 developer area blocks at the end of the file are ignored.
 
@@ -140,6 +149,7 @@ class MAGNUM_TGAIMPORTER_EXPORT TgaImporter: public AbstractImporter {
         MAGNUM_TGAIMPORTER_LOCAL Containers::Optional<ImageData2D> doImage2D(UnsignedInt id, UnsignedInt level) override;
 
         Containers::Array<char> _in;
+        bool _inExternallyOwned{};
 };
 
 }}
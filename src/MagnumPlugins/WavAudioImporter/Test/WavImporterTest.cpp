@@ -27,6 +27,7 @@
 
 #include <string> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Containers/String.h>
 #include <Corrade/Containers/StringStl.h> /** @todo remove once AbstractImporter is <string>-free */
 #include <Corrade/TestSuite/Tester.h>
@@ -80,10 +81,28 @@ struct WavImporterTest: TestSuite::Tester {
     void surround51Channel16();
     void surround71Channel24();
 
+    void frames();
+
     /* Explicitly forbid system-wide plugin dependencies */
     PluginManager::Manager<AbstractImporter> _manager{"nonexistent"};
 };
 
+const struct {
+    const char* name;
+    const char* filename;
+    bool openData;
+    std::size_t frameCount;
+    std::size_t offset, count;
+} FramesData[]{
+    {"16-bit mono", "mono16.wav", false, 2, 1, 1},
+    {"16-bit mono, openData()", "mono16.wav", true, 2, 1, 1},
+    {"24-bit stereo", "stereo24.wav", false, 23493, 1000, 3},
+    {"24-bit stereo, openData()", "stereo24.wav", true, 23493, 1000, 3},
+    {"32-bit stereo", "stereo32.wav", false, 23493, 1000, 3},
+    {"32-bit float mono, Big-Endian", "mono32fbe.wav", false, 4, 1, 2},
+    {"64-bit float stereo", "stereo64f.wav", false, 23493, 23490, 3},
+};
+
 WavImporterTest::WavImporterTest() {
     addTests({&WavImporterTest::empty,
               &WavImporterTest::wrongSignature,
@@ -123,6 +142,9 @@ WavImporterTest::WavImporterTest() {
               &WavImporterTest::surround51Channel16,
               &WavImporterTest::surround71Channel24});
 
+    addInstancedTests({&WavImporterTest::frames},
+        Containers::arraySize(FramesData));
+
     /* Load the plugin directly from the build tree. Otherwise it's static and
        already loaded. */
     #ifdef WAVAUDIOIMPORTER_PLUGIN_FILENAME
@@ -147,7 +169,7 @@ void WavImporterTest::wrongSignature() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "wrongSignature.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): the file signature is invalid\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): the file signature is invalid\n");
 }
 
 void WavImporterTest::unsupportedFormat() {
@@ -156,7 +178,7 @@ void WavImporterTest::unsupportedFormat() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedFormat.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::AdPcm\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::AdPcm\n");
 }
 
 void WavImporterTest::unsupportedChannelCount() {
@@ -165,7 +187,7 @@ void WavImporterTest::unsupportedChannelCount() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "unsupportedChannelCount.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): PCM with unsupported channel count 6 with 8 bits per sample\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): PCM with unsupported channel count 6 with 8 bits per sample\n");
 }
 
 void WavImporterTest::invalidPadding() {
@@ -174,7 +196,7 @@ void WavImporterTest::invalidPadding() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "invalidPadding.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): the file has improper size, expected 66 but got 73\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): the file has improper size, expected 66 but got 73\n");
 }
 
 void WavImporterTest::invalidLength() {
@@ -183,7 +205,7 @@ void WavImporterTest::invalidLength() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "invalidLength.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): the file has improper size, expected 160844 but got 80444\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): the file has improper size, expected 160844 but got 80444\n");
 }
 
 void WavImporterTest::invalidDataChunk() {
@@ -192,7 +214,7 @@ void WavImporterTest::invalidDataChunk() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "invalidDataChunk.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): the file contains no data chunk\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): the file contains no data chunk\n");
 }
 
 void WavImporterTest::invalidFactChunk() {
@@ -224,7 +246,7 @@ void WavImporterTest::mono4() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "mono4.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::AdPcm\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::AdPcm\n");
 }
 
 void WavImporterTest::mono8() {
@@ -308,7 +330,7 @@ void WavImporterTest::stereo4() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo4.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::AdPcm\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::AdPcm\n");
 }
 
 void WavImporterTest::stereo8() {
@@ -355,7 +377,7 @@ void WavImporterTest::stereo12() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo12.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): PCM with unsupported channel count 2 with 12 bits per sample\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): PCM with unsupported channel count 2 with 12 bits per sample\n");
 }
 
 void WavImporterTest::stereo16() {
@@ -371,21 +393,33 @@ void WavImporterTest::stereo16() {
 }
 
 void WavImporterTest::stereo24() {
-    Containers::String out;
-    Error redirectError{&out};
-
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
-    CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo24.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): PCM with unsupported channel count 2 with 24 bits per sample\n");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo24.wav")));
+
+    /* Converted to floats, same source as stereo64f() */
+    CORRADE_COMPARE(importer->format(), BufferFormat::StereoFloat);
+    CORRADE_COMPARE(importer->frequency(), 8000);
+
+    CORRADE_COMPARE(importer->data().size(), 23493*2*4);
+    CORRADE_COMPARE_AS(Containers::arrayCast<Float>(importer->data()).prefix(8),
+        Containers::arrayView<Float>({
+            0.0f, 0.0f, 0.0f, 0.0f, 3.0517578125e-05f, 6.103515625e-05f, -9.1552734375e-05f, 0.0f}),
+        TestSuite::Compare::Container);
 }
 
 void WavImporterTest::stereo32() {
-    Containers::String out;
-    Error redirectError{&out};
-
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
-    CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo32.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): PCM with unsupported channel count 2 with 32 bits per sample\n");
+    CORRADE_VERIFY(importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "stereo32.wav")));
+
+    /* Converted to floats, same source as stereo64f() */
+    CORRADE_COMPARE(importer->format(), BufferFormat::StereoFloat);
+    CORRADE_COMPARE(importer->frequency(), 8000);
+
+    CORRADE_COMPARE(importer->data().size(), 23493*2*4);
+    CORRADE_COMPARE_AS(Containers::arrayCast<Float>(importer->data()).prefix(8),
+        Containers::arrayView<Float>({
+            0.0f, 0.0f, 0.0f, 0.0f, 3.0517578125e-05f, 6.103515625e-05f, -9.1552734375e-05f, 0.0f}),
+        TestSuite::Compare::Container);
 }
 
 void WavImporterTest::mono32f() {
@@ -459,7 +493,7 @@ void WavImporterTest::surround51Channel16() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "surround51Channel16.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::Extensible\n");
 }
 
 void WavImporterTest::surround71Channel24() {
@@ -468,7 +502,32 @@ void WavImporterTest::surround71Channel24() {
 
     Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
     CORRADE_VERIFY(!importer->openFile(Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, "surround71Channel24.wav")));
-    CORRADE_COMPARE(out, "Audio::WavImporter::openData(): unsupported format Audio::WavAudioFormat::Extensible\n");
+    CORRADE_COMPARE(out, "Audio::WavImporter::openFile(): unsupported format Audio::WavAudioFormat::Extensible\n");
+}
+
+void WavImporterTest::frames() {
+    auto&& data = FramesData[testCaseInstanceId()];
+    setTestCaseDescription(data.name);
+
+    Containers::Pointer<AbstractImporter> importer = _manager.instantiate("WavAudioImporter");
+    const Containers::String filename = Utility::Path::join(WAVAUDIOIMPORTER_TEST_DIR, data.filename);
+    if(data.openData) {
+        Containers::Optional<Containers::Array<char>> file = Utility::Path::read(filename);
+        CORRADE_VERIFY(file);
+        CORRADE_VERIFY(importer->openData(*file));
+    } else CORRADE_VERIFY(importer->openFile(filename));
+
+    CORRADE_VERIFY(importer->features() & ImporterFeature::Streaming);
+    CORRADE_COMPARE(importer->frameCount(), data.frameCount);
+
+    /* The chunk should be the same as the corresponding range of all data,
+       including endian swapping and conversion */
+    const Containers::Array<char> all = importer->data();
+    const std::size_t frameSize = all.size()/data.frameCount;
+    const Containers::Array<char> chunk = importer->frames(data.offset, data.count);
+    CORRADE_COMPARE_AS(Containers::arrayView(chunk),
+        all.slice(data.offset*frameSize, (data.offset + data.count)*frameSize),
+        TestSuite::Compare::Container);
 }
 
 }}}}
@@ -27,9 +27,13 @@
 
 #include "WavImporter.h"
 
+#include <cstring>
+#include <Corrade/Containers/Array.h>
+#include <Corrade/Containers/Optional.h>
 #include <Corrade/Utility/Assert.h>
 #include <Corrade/Utility/Debug.h>
 #include <Corrade/Utility/EndiannessBatch.h>
+#include <Corrade/Utility/Path.h>
 
 #include "MagnumPlugins/WavAudioImporter/WavHeader.h"
 
@@ -40,31 +44,121 @@ using Implementation::WavAudioFormat;
 using Implementation::WavFormatChunk;
 using Implementation::WavHeaderChunk;
 
+struct WavImporter::State {
+    /* Owned copy of the sample data if opened through openData(), the whole
+       file if opened through openFile() on platforms without memory mapping,
+       empty otherwise */
+    Containers::Array<char> data;
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    /* Memory-mapped file if opened through openFile() */
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mappedFile;
+    #endif
+    /* Sample data as stored in the file, pointing either to the data array
+       or into the mapped file */
+    Containers::ArrayView<const char> samples;
+
+    BufferFormat format;
+    UnsignedInt frequency;
+    /* Size of a single frame and a single sample in the file */
+    UnsignedInt frameSize;
+    UnsignedInt sampleSize;
+    /* The file has a RIFX header */
+    bool bigEndianData;
+    /* 24- and 32-bit integer PCM, converted to floats on output */
+    bool integerToFloat;
+};
+
+namespace {
+
+/* Converts 24- and 32-bit integer PCM to floats in the [-1, 1) range. The
+   samples are first expanded to the upper bits of a 32-bit integer so both
+   sizes share the same scale. Kept as a branchless loop with the sizes known
+   at compile time so the compiler can vectorize it. */
+template<std::size_t size, bool bigEndian> void integerToFloat(const char* const src, Float* const dst, const std::size_t count) {
+    const auto* const in = reinterpret_cast<const UnsignedByte*>(src);
+    for(std::size_t i = 0; i != count; ++i) {
+        UnsignedInt value = 0;
+        for(std::size_t j = 0; j != size; ++j)
+            value |= UnsignedInt(in[i*size + (bigEndian ? j : size - 1 - j)]) << (24 - 8*j);
+        dst[i] = Float(Int(value))*(1.0f/2147483648.0f);
+    }
+}
+
+}
+
 #ifdef MAGNUM_BUILD_DEPRECATED
 WavImporter::WavImporter() = default; /* LCOV_EXCL_LINE */
 #endif
 
 WavImporter::WavImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin): AbstractImporter{manager, plugin} {}
 
-ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData; }
+WavImporter::~WavImporter() = default;
+
+ImporterFeatures WavImporter::doFeatures() const { return ImporterFeature::OpenData|ImporterFeature::Streaming; }
+
+bool WavImporter::doIsOpened() const { return !!_state; }
+
+void WavImporter::doOpenData(const Containers::ArrayView<const char> data) {
+    Containers::Pointer<State> state = parse(data, "Audio::WavImporter::openData():");
+    if(!state) return;
+
+    /* Copy the sample data, as the input view isn't guaranteed to stay
+       around */
+    state->data = Containers::Array<char>{InPlaceInit, state->samples};
+    state->samples = state->data;
+    _state = Utility::move(state);
+}
+
+void WavImporter::doOpenFile(const Containers::StringView filename) {
+    /* Map the file if possible so the sample data don't need to be read
+       upfront, and only the parts that are actually requested through data()
+       or frames() get paged in */
+    #if defined(CORRADE_TARGET_UNIX) || (defined(CORRADE_TARGET_WINDOWS) && !defined(CORRADE_TARGET_WINDOWS_RT))
+    Containers::Optional<Containers::Array<const char, Utility::Path::MapDeleter>> mapped = Utility::Path::mapRead(filename);
+    if(!mapped) {
+        Error{} << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
+    }
+
+    Containers::Pointer<State> state = parse(*mapped, "Audio::WavImporter::openFile():");
+    if(!state) return;
+
+    /* The sample view points into the mapped memory, which stays at the same
+       location when the array is moved */
+    state->mappedFile = Utility::move(mapped);
+    #else
+    Containers::Optional<Containers::Array<char>> data = Utility::Path::read(filename);
+    if(!data) {
+        Error{} << "Audio::WavImporter::openFile(): cannot open file" << filename;
+        return;
+    }
 
-bool WavImporter::doIsOpened() const { return !!_data; }
+    Containers::Pointer<State> state = parse(*data, "Audio::WavImporter::openFile():");
+    if(!state) return;
 
-void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
+    /* Same as above, the sample view stays valid when the array is moved */
+    state->data = *Utility::move(data);
+    #endif
+    _state = Utility::move(state);
+}
+
+Containers::Pointer<WavImporter::State> WavImporter::parse(const Containers::ArrayView<const char> data, const char* const prefix) {
     /* Check file size */
     if(data.size() < sizeof(WavHeaderChunk) + sizeof(WavFormatChunk) + sizeof(RiffChunk)) {
-        Error() << "Audio::WavImporter::openData(): the file is too short:" << data.size() << "bytes";
-        return;
+        Error() << prefix << "the file is too short:" << data.size() << "bytes";
+        return {};
     }
 
+    Containers::Pointer<State> state{InPlaceInit};
+
     /* Get the RIFF/WAV header */
     WavHeaderChunk header(*reinterpret_cast<const WavHeaderChunk*>(data.begin()));
 
     /* Check RIFF/WAV file signature */
     if((std::strncmp(header.chunk.chunkId, "RIFF", 4) != 0 && std::strncmp(header.chunk.chunkId, "RIFX", 4) != 0) ||
        std::strncmp(header.format, "WAVE", 4) != 0) {
-        Error() << "Audio::WavImporter::openData(): the file signature is invalid";
-        return;
+        Error() << prefix << "the file signature is invalid";
+        return {};
     }
 
     /* Check if the file is Big-Endian. While RIFX files are extremely rare,
@@ -77,9 +171,9 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
 
     /* Check file size */
     if(header.chunk.chunkSize < 36 || header.chunk.chunkSize + 8 != data.size()) {
-        Error() << "Audio::WavImporter::openData(): the file has improper size, expected"
+        Error() << prefix << "the file has improper size, expected"
                 << header.chunk.chunkSize + 8 << "but got" << data.size();
-        return;
+        return {};
     }
 
     const RiffChunk* dataChunk = nullptr;
@@ -102,16 +196,16 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
 
         if(std::strncmp(currChunk->chunkId, "fmt ", 4) == 0) {
             if(formatChunk) {
-                Error() << "Audio::WavImporter::openData(): the file contains too many format chunks";
-                return;
+                Error() << prefix << "the file contains too many format chunks";
+                return {};
             }
 
             formatChunk = WavFormatChunk{*reinterpret_cast<const WavFormatChunk*>(currChunk)};
 
         } else if(std::strncmp(currChunk->chunkId, "data", 4) == 0) {
             if(dataChunk != nullptr) {
-                Error() << "Audio::WavImporter::openData(): the file contains too many data chunks";
-                return;
+                Error() << prefix << "the file contains too many data chunks";
+                return {};
             }
 
             dataChunk = currChunk;
@@ -122,14 +216,14 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
 
     /* Make sure we actually got a format chunk */
     if(!formatChunk) {
-        Error() << "Audio::WavImporter::openData(): the file contains no format chunk";
-        return;
+        Error() << prefix << "the file contains no format chunk";
+        return {};
     }
 
     /* Make sure we actually got a data chunk */
     if(dataChunk == nullptr) {
-        Error() << "Audio::WavImporter::openData(): the file contains no data chunk";
-        return;
+        Error() << prefix << "the file contains no data chunk";
+        return {};
     }
 
     /* Fix endianness on Format chunk */
@@ -144,108 +238,153 @@ void WavImporter::doOpenData(Containers::ArrayView<const char> data) {
     if(formatChunk->audioFormat == WavAudioFormat::Pcm) {
         /* Decide about format */
         if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 8)
-            _format = BufferFormat::Mono8;
+            state->format = BufferFormat::Mono8;
         else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 16)
-            _format = BufferFormat::Mono16;
+            state->format = BufferFormat::Mono16;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 8)
-            _format = BufferFormat::Stereo8;
+            state->format = BufferFormat::Stereo8;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 16)
-             _format = BufferFormat::Stereo16;
-        else {
-            Error() << "Audio::WavImporter::openData(): PCM with unsupported channel count"
+             state->format = BufferFormat::Stereo16;
+        /* 24- and 32-bit PCM has no corresponding buffer format, convert to
+           floats */
+        else if(formatChunk->numChannels == 1 && (formatChunk->bitsPerSample == 24 || formatChunk->bitsPerSample == 32)) {
+            state->format = BufferFormat::MonoFloat;
+            state->integerToFloat = true;
+        } else if(formatChunk->numChannels == 2 && (formatChunk->bitsPerSample == 24 || formatChunk->bitsPerSample == 32)) {
+            state->format = BufferFormat::StereoFloat;
+            state->integerToFloat = true;
+        } else {
+            Error() << prefix << "PCM with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check IEEE Float format */
     } else if(formatChunk->audioFormat == WavAudioFormat::IeeeFloat) {
         if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 32)
-            _format = BufferFormat::MonoFloat;
+            state->format = BufferFormat::MonoFloat;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 32)
-            _format = BufferFormat::StereoFloat;
+            state->format = BufferFormat::StereoFloat;
         else if(formatChunk->numChannels == 1 && formatChunk->bitsPerSample == 64)
-            _format = BufferFormat::MonoDouble;
+            state->format = BufferFormat::MonoDouble;
         else if(formatChunk->numChannels == 2 && formatChunk->bitsPerSample == 64)
-            _format = BufferFormat::StereoDouble;
+            state->format = BufferFormat::StereoDouble;
         else {
-            Error() << "Audio::WavImporter::openData(): IEEE with unsupported channel count"
+            Error() << prefix << "IEEE with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check A-Law format */
     } else if(formatChunk->audioFormat == WavAudioFormat::ALaw) {
         if(formatChunk->numChannels == 1)
-            _format = BufferFormat::MonoALaw;
+            state->format = BufferFormat::MonoALaw;
         else if(formatChunk->numChannels == 2)
-            _format = BufferFormat::StereoALaw;
+            state->format = BufferFormat::StereoALaw;
         else {
-            Error() << "Audio::WavImporter::openData(): ALaw with unsupported channel count"
+            Error() << prefix << "ALaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Check μ-Law format */
     } else if(formatChunk->audioFormat == WavAudioFormat::MuLaw) {
         if(formatChunk->numChannels == 1)
-            _format = BufferFormat::MonoMuLaw;
+            state->format = BufferFormat::MonoMuLaw;
         else if(formatChunk->numChannels == 2)
-            _format = BufferFormat::StereoMuLaw;
+            state->format = BufferFormat::StereoMuLaw;
         else {
-            Error() << "Audio::WavImporter::openData(): MuLaw with unsupported channel count"
+            Error() << prefix << "MuLaw with unsupported channel count"
                     << formatChunk->numChannels << "with" << formatChunk->bitsPerSample
                     << "bits per sample";
-            return;
+            return {};
         }
 
     /* Unknown/unimplemented format */
     } else {
-        Error() << "Audio::WavImporter::openData(): unsupported format" << formatChunk->audioFormat;
-        return;
+        Error() << prefix << "unsupported format" << formatChunk->audioFormat;
+        return {};
     }
 
     /* Size sanity checks */
     if(headerSize + offset > data.size()) {
-        Error() << "Audio::WavImporter::openData(): file size doesn't match computed size";
-        return;
+        Error() << prefix << "file size doesn't match computed size";
+        return {};
     }
 
     /* Format sanity checks */
     if(formatChunk->blockAlign != formatChunk->numChannels * formatChunk->bitsPerSample / 8 ||
        formatChunk->byteRate != formatChunk->sampleRate * formatChunk->blockAlign) {
-        Error() << "Audio::WavImporter::openData(): the file is corrupted";
-        return;
+        Error() << prefix << "the file is corrupted";
+        return {};
     }
 
-    /* Save frequency */
-    _frequency = formatChunk->sampleRate;
-
-    /* Copy the data */
-    _data = Containers::Array<char>{InPlaceInit, Containers::arrayView(reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize)};
-
-    /* Fix the data endianness */
-    if(hasBigEndianData != Utility::Endianness::isBigEndian()) {
-        if(formatChunk->bitsPerSample == 16)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(*_data));
-        else if(formatChunk->bitsPerSample == 32)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(*_data));
-        else if(formatChunk->bitsPerSample == 64)
-            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(*_data));
-        else CORRADE_INTERNAL_ASSERT(formatChunk->bitsPerSample == 8);
-    }
+    /* Save frequency, sample layout and reference the data. The endianness
+       is fixed and integer samples converted only on output, so a file that's
+       mapped doesn't need to be touched upfront. */
+    state->frequency = formatChunk->sampleRate;
+    state->frameSize = formatChunk->blockAlign;
+    state->sampleSize = formatChunk->bitsPerSample/8;
+    state->bigEndianData = hasBigEndianData;
+    state->samples = Containers::arrayView(reinterpret_cast<const char*>(dataChunk + 1), dataChunkSize);
+
+    return state;
 }
 
-void WavImporter::doClose() { _data = Containers::NullOpt; }
+void WavImporter::doClose() { _state = nullptr; }
 
-BufferFormat WavImporter::doFormat() const { return _format; }
+BufferFormat WavImporter::doFormat() const { return _state->format; }
 
-UnsignedInt WavImporter::doFrequency() const { return _frequency; }
+UnsignedInt WavImporter::doFrequency() const { return _state->frequency; }
 
 Containers::Array<char> WavImporter::doData() {
-    return Containers::Array<char>{InPlaceInit, *_data};
+    return convert(_state->samples);
+}
+
+std::size_t WavImporter::doFrameCount() const {
+    return _state->samples.size()/_state->frameSize;
+}
+
+Containers::Array<char> WavImporter::doFrames(const std::size_t offset, const std::size_t count) {
+    return convert(_state->samples.slice(offset*_state->frameSize, (offset + count)*_state->frameSize));
+}
+
+Containers::Array<char> WavImporter::convert(const Containers::ArrayView<const char> samples) const {
+    /* Integer samples get converted to floats, taking the file endianness
+       into account directly */
+    if(_state->integerToFloat) {
+        const std::size_t count = samples.size()/_state->sampleSize;
+        Containers::Array<char> out{NoInit, count*sizeof(Float)};
+        Float* const dst = reinterpret_cast<Float*>(out.data());
+        if(_state->sampleSize == 3) {
+            if(_state->bigEndianData)
+                integerToFloat<3, true>(samples.data(), dst, count);
+            else
+                integerToFloat<3, false>(samples.data(), dst, count);
+        } else if(_state->sampleSize == 4) {
+            if(_state->bigEndianData)
+                integerToFloat<4, true>(samples.data(), dst, count);
+            else
+                integerToFloat<4, false>(samples.data(), dst, count);
+        } else CORRADE_INTERNAL_ASSERT_UNREACHABLE(); /* LCOV_EXCL_LINE */
+        return out;
+    }
+
+    /* Otherwise copy the data and fix the endianness */
+    Containers::Array<char> out{InPlaceInit, samples};
+    if(_state->bigEndianData != Utility::Endianness::isBigEndian()) {
+        if(_state->sampleSize == 2)
+            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint16_t>(out));
+        else if(_state->sampleSize == 4)
+            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint32_t>(out));
+        else if(_state->sampleSize == 8)
+            Utility::Endianness::swapInPlace(Containers::arrayCast<std::uint64_t>(out));
+        else CORRADE_INTERNAL_ASSERT(_state->sampleSize == 1);
+    }
+    return out;
 }
 
 }}
@@ -31,8 +31,7 @@
  * @brief Class @ref Magnum::Audio::WavImporter
  */
 
-#include <Corrade/Containers/Array.h>
-#include <Corrade/Containers/Optional.h>
+#include <Corrade/Containers/Pointer.h>
 
 #include "Magnum/Audio/AbstractImporter.h"
 
@@ -107,6 +106,9 @@ Supports mono and stereo files of the following formats:
     @ref BufferFormat::Stereo8
 -   16 bit per channel PCM, imported as @ref BufferFormat::Mono16 and
     @ref BufferFormat::Stereo16
+-   24 and 32 bit per channel PCM, converted to floats in the
+    @f$ [-1, 1) @f$ range and imported as @ref BufferFormat::MonoFloat /
+    @ref BufferFormat::StereoFloat
 -   32-bit IEEE Float, imported as @ref BufferFormat::MonoFloat /
     @ref BufferFormat::StereoFloat
 -   64-bit IEEE Float, imported as @ref BufferFormat::MonoDouble /
@@ -118,6 +120,12 @@ Both Little-Endian files (with a `RIFF` header) and Big-Endian files (with
 a `RIFX` header) are supported, data is converted to machine endian on import.
 
 Multi-channel formats are not supported.
+
+The plugin supports @ref ImporterFeature::Streaming. When opened with
+@ref openFile(), the file is memory-mapped on platforms that support it and
+the sample data are copied, endian-swapped or converted only for the range
+requested through @ref data() or @ref frames(). When opened with
+@ref openData(), the sample data are copied on open.
 */
 class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
     public:
@@ -134,19 +142,26 @@ class MAGNUM_WAVAUDIOIMPORTER_EXPORT WavImporter: public AbstractImporter {
         /** @brief Plugin manager constructor */
         explicit WavImporter(PluginManager::AbstractManager& manager, const Containers::StringView& plugin);
 
+        ~WavImporter();
+
     private:
+        struct State;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL ImporterFeatures doFeatures() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL bool doIsOpened() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenData(Containers::ArrayView<const char> data) override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL void doOpenFile(Containers::StringView filename) override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL void doClose() override;
 
         MAGNUM_WAVAUDIOIMPORTER_LOCAL BufferFormat doFormat() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL UnsignedInt doFrequency() const override;
         MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doData() override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL std::size_t doFrameCount() const override;
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> doFrames(std::size_t offset, std::size_t count) override;
+
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL static Containers::Pointer<State> parse(Containers::ArrayView<const char> data, const char* prefix);
+        MAGNUM_WAVAUDIOIMPORTER_LOCAL Containers::Array<char> convert(Containers::ArrayView<const char> samples) const;
 
-        Containers::Optional<Containers::Array<char>> _data;
-        BufferFormat _format;
-        UnsignedInt _frequency;
+        Containers::Pointer<State> _state;
 };
 
 }}